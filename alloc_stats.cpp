@@ -0,0 +1,31 @@
+#include "alloc_stats.h"
+
+#include <cstdlib>
+#include <new>
+
+static thread_local uint64_t allocations = 0;
+
+uint64_t thread_allocations() {
+    return allocations;
+}
+
+// libstdc++ routes operator new[] and the nothrow forms through this one,
+// and the default operator delete frees with free(), so only this needs
+// replacing.
+void* operator new(std::size_t size) {
+    allocations++;
+    if (size == 0) {
+        size = 1;
+    }
+    while (true) {
+        void* block = std::malloc(size);
+        if (block != nullptr) {
+            return block;
+        }
+        std::new_handler handler = std::get_new_handler();
+        if (handler == nullptr) {
+            throw std::bad_alloc();
+        }
+        handler();
+    }
+}
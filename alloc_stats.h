@@ -0,0 +1,16 @@
+#ifndef CHAT_ALLOC_STATS_H
+#define CHAT_ALLOC_STATS_H
+
+// Counts heap allocations made through operator new (which is also what
+// std::string, the STL containers and protobuf use), per thread, so a code
+// path can measure exactly how many allocations it performs:
+//
+//     uint64_t before = thread_allocations();
+//     ...
+//     uint64_t made = thread_allocations() - before;
+
+#include <cstdint>
+
+uint64_t thread_allocations();
+
+#endif
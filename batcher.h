@@ -0,0 +1,110 @@
+#ifndef CHAT_BATCHER_H
+#define CHAT_BATCHER_H
+
+// Client-side coalescing of outgoing chat messages.
+//
+// Messages are collected into one SEND_MESSAGE_BATCH request, which is sent
+// once it holds max_messages messages or max_bytes of content, or once the
+// oldest message has waited window_ms (checked by flush_if_due(), which the
+// caller runs from its event loop). A batch of one goes out as a plain
+// SEND_MESSAGE. Requests are handed to a sender function, which frames and
+// writes them. Safe to use from several threads.
+
+#include <chrono>
+#include <functional>
+#include <string>
+#include <pthread.h>
+#include "chat.pb.h"
+
+class MessageBatcher {
+public:
+    // Sends a request; returns false if it could not be written.
+    typedef std::function<bool(chat::Request&)> Sender;
+
+    MessageBatcher(Sender send, size_t max_messages, size_t max_bytes, int window_ms)
+        : send_(send), max_messages_(max_messages), max_bytes_(max_bytes), window_ms_(window_ms), bytes_(0) {
+        pthread_mutex_init(&mutex_, NULL);
+        request_.set_operation(chat::Operation::SEND_MESSAGE_BATCH);
+    }
+
+    ~MessageBatcher() { pthread_mutex_destroy(&mutex_); }
+
+    MessageBatcher(const MessageBatcher&) = delete;
+    MessageBatcher& operator=(const MessageBatcher&) = delete;
+
+    // Queues a message (an empty recipient broadcasts, unless a room is
+    // given). Returns false if a flush it triggered failed to write.
+    bool add(const std::string& recipient, const std::string& content, const std::string& room = "") {
+        pthread_mutex_lock(&mutex_);
+        chat::SendMessageBatchRequest* batch = request_.mutable_send_message_batch();
+        if (batch->messages_size() == 0) {
+            first_added_ = std::chrono::steady_clock::now();
+        }
+        chat::SendMessageRequest* message = batch->add_messages();
+        message->set_recipient(recipient);
+        message->set_content(content);
+        message->set_room(room);
+        bytes_ += content.size();
+        bool ok = true;
+        if (size_t(batch->messages_size()) >= max_messages_ || bytes_ >= max_bytes_) {
+            ok = flush_locked();
+        }
+        pthread_mutex_unlock(&mutex_);
+        return ok;
+    }
+
+    // Milliseconds until the pending batch is due, or -1 if nothing is pending.
+    int due_in_ms() {
+        pthread_mutex_lock(&mutex_);
+        int due = -1;
+        if (request_.send_message_batch().messages_size() > 0) {
+            auto waited = std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::steady_clock::now() - first_added_).count();
+            due = waited >= window_ms_ ? 0 : int(window_ms_ - waited);
+        }
+        pthread_mutex_unlock(&mutex_);
+        return due;
+    }
+
+    bool flush_if_due() {
+        return due_in_ms() != 0 || flush();
+    }
+
+    bool flush() {
+        pthread_mutex_lock(&mutex_);
+        bool ok = flush_locked();
+        pthread_mutex_unlock(&mutex_);
+        return ok;
+    }
+
+private:
+    bool flush_locked() {
+        chat::SendMessageBatchRequest* batch = request_.mutable_send_message_batch();
+        if (batch->messages_size() == 0) {
+            return true;
+        }
+        bool ok;
+        if (batch->messages_size() == 1) {
+            chat::Request single;
+            single.set_operation(chat::Operation::SEND_MESSAGE);
+            single.mutable_send_message()->Swap(batch->mutable_messages(0));
+            ok = send_(single);
+        } else {
+            ok = send_(request_);
+        }
+        request_.mutable_send_message_batch()->clear_messages();
+        bytes_ = 0;
+        return ok;
+    }
+
+    pthread_mutex_t mutex_;
+    Sender send_;
+    size_t max_messages_;
+    size_t max_bytes_;
+    int window_ms_;
+    chat::Request request_;
+    size_t bytes_;
+    std::chrono::steady_clock::time_point first_added_;
+};
+
+#endif
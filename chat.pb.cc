@@ -0,0 +1,9559 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: chat.proto
+
+#include "chat.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace chat {
+PROTOBUF_CONSTEXPR User::User(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.username_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.ip_address_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.id_)*/uint64_t{0u}
+  , /*decltype(_impl_.status_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct UserDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR UserDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~UserDefaultTypeInternal() {}
+  union {
+    User _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 UserDefaultTypeInternal _User_default_instance_;
+PROTOBUF_CONSTEXPR NewUserRequest::NewUserRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.username_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.accept_batched_delivery_)*/false
+  , /*decltype(_impl_.accept_compression_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct NewUserRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR NewUserRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~NewUserRequestDefaultTypeInternal() {}
+  union {
+    NewUserRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 NewUserRequestDefaultTypeInternal _NewUserRequest_default_instance_;
+PROTOBUF_CONSTEXPR ResumeRequest::ResumeRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.token_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ResumeRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ResumeRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ResumeRequestDefaultTypeInternal() {}
+  union {
+    ResumeRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ResumeRequestDefaultTypeInternal _ResumeRequest_default_instance_;
+PROTOBUF_CONSTEXPR FileOffer::FileOffer(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.recipient_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.recipient_id_)*/uint64_t{0u}
+  , /*decltype(_impl_.size_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct FileOfferDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR FileOfferDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~FileOfferDefaultTypeInternal() {}
+  union {
+    FileOffer _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 FileOfferDefaultTypeInternal _FileOffer_default_instance_;
+PROTOBUF_CONSTEXPR FileWindow::FileWindow(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.transfer_id_)*/uint64_t{0u}
+  , /*decltype(_impl_.bytes_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct FileWindowDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR FileWindowDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~FileWindowDefaultTypeInternal() {}
+  union {
+    FileWindow _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 FileWindowDefaultTypeInternal _FileWindow_default_instance_;
+PROTOBUF_CONSTEXPR SendMessageRequest::SendMessageRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.recipient_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.content_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.room_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.recipient_id_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SendMessageRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SendMessageRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SendMessageRequestDefaultTypeInternal() {}
+  union {
+    SendMessageRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SendMessageRequestDefaultTypeInternal _SendMessageRequest_default_instance_;
+PROTOBUF_CONSTEXPR SendMessageBatchRequest::SendMessageBatchRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.messages_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SendMessageBatchRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SendMessageBatchRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SendMessageBatchRequestDefaultTypeInternal() {}
+  union {
+    SendMessageBatchRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SendMessageBatchRequestDefaultTypeInternal _SendMessageBatchRequest_default_instance_;
+PROTOBUF_CONSTEXPR IncomingMessageResponse::IncomingMessageResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.sender_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.content_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.room_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.sender_id_)*/uint64_t{0u}
+  , /*decltype(_impl_.type_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct IncomingMessageResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR IncomingMessageResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~IncomingMessageResponseDefaultTypeInternal() {}
+  union {
+    IncomingMessageResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 IncomingMessageResponseDefaultTypeInternal _IncomingMessageResponse_default_instance_;
+PROTOBUF_CONSTEXPR RoomRequest::RoomRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.room_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct RoomRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RoomRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RoomRequestDefaultTypeInternal() {}
+  union {
+    RoomRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RoomRequestDefaultTypeInternal _RoomRequest_default_instance_;
+PROTOBUF_CONSTEXPR RoomResponse::RoomResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.room_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.members_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct RoomResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RoomResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RoomResponseDefaultTypeInternal() {}
+  union {
+    RoomResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RoomResponseDefaultTypeInternal _RoomResponse_default_instance_;
+PROTOBUF_CONSTEXPR SendMessageBatchResponse::SendMessageBatchResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.results_)*/{}
+  , /*decltype(_impl_._results_cached_byte_size_)*/{0}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SendMessageBatchResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SendMessageBatchResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SendMessageBatchResponseDefaultTypeInternal() {}
+  union {
+    SendMessageBatchResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SendMessageBatchResponseDefaultTypeInternal _SendMessageBatchResponse_default_instance_;
+PROTOBUF_CONSTEXPR UserListRequest::UserListRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.username_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct UserListRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR UserListRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~UserListRequestDefaultTypeInternal() {}
+  union {
+    UserListRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 UserListRequestDefaultTypeInternal _UserListRequest_default_instance_;
+PROTOBUF_CONSTEXPR UserListResponse::UserListResponse(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.users_)*/{}
+  , /*decltype(_impl_.type_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct UserListResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR UserListResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~UserListResponseDefaultTypeInternal() {}
+  union {
+    UserListResponse _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 UserListResponseDefaultTypeInternal _UserListResponse_default_instance_;
+PROTOBUF_CONSTEXPR PresenceEvent::PresenceEvent(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.username_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.change_)*/0
+  , /*decltype(_impl_.status_)*/0
+  , /*decltype(_impl_.user_id_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PresenceEventDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PresenceEventDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PresenceEventDefaultTypeInternal() {}
+  union {
+    PresenceEvent _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PresenceEventDefaultTypeInternal _PresenceEvent_default_instance_;
+PROTOBUF_CONSTEXPR PresenceUpdate::PresenceUpdate(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.users_)*/{}
+  , /*decltype(_impl_.events_)*/{}
+  , /*decltype(_impl_.version_)*/uint64_t{0u}
+  , /*decltype(_impl_.since_version_)*/uint64_t{0u}
+  , /*decltype(_impl_.snapshot_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct PresenceUpdateDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR PresenceUpdateDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~PresenceUpdateDefaultTypeInternal() {}
+  union {
+    PresenceUpdate _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 PresenceUpdateDefaultTypeInternal _PresenceUpdate_default_instance_;
+PROTOBUF_CONSTEXPR FileTransfer::FileTransfer(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.sender_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.transfer_id_)*/uint64_t{0u}
+  , /*decltype(_impl_.sender_id_)*/uint64_t{0u}
+  , /*decltype(_impl_.size_)*/uint64_t{0u}
+  , /*decltype(_impl_.window_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct FileTransferDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR FileTransferDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~FileTransferDefaultTypeInternal() {}
+  union {
+    FileTransfer _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 FileTransferDefaultTypeInternal _FileTransfer_default_instance_;
+PROTOBUF_CONSTEXPR UpdateStatusRequest::UpdateStatusRequest(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.username_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.new_status_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct UpdateStatusRequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR UpdateStatusRequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~UpdateStatusRequestDefaultTypeInternal() {}
+  union {
+    UpdateStatusRequest _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 UpdateStatusRequestDefaultTypeInternal _UpdateStatusRequest_default_instance_;
+PROTOBUF_CONSTEXPR Request::Request(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.request_id_)*/uint64_t{0u}
+  , /*decltype(_impl_.operation_)*/0
+  , /*decltype(_impl_.payload_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_._oneof_case_)*/{}} {}
+struct RequestDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RequestDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RequestDefaultTypeInternal() {}
+  union {
+    Request _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RequestDefaultTypeInternal _Request_default_instance_;
+PROTOBUF_CONSTEXPR Distribution::Distribution(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.count_)*/uint64_t{0u}
+  , /*decltype(_impl_.mean_)*/0
+  , /*decltype(_impl_.p50_)*/uint64_t{0u}
+  , /*decltype(_impl_.p90_)*/uint64_t{0u}
+  , /*decltype(_impl_.p99_)*/uint64_t{0u}
+  , /*decltype(_impl_.p999_)*/uint64_t{0u}
+  , /*decltype(_impl_.max_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct DistributionDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR DistributionDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~DistributionDefaultTypeInternal() {}
+  union {
+    Distribution _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 DistributionDefaultTypeInternal _Distribution_default_instance_;
+PROTOBUF_CONSTEXPR OperationStats::OperationStats(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.latency_)*/nullptr
+  , /*decltype(_impl_.requests_)*/uint64_t{0u}
+  , /*decltype(_impl_.operation_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct OperationStatsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR OperationStatsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~OperationStatsDefaultTypeInternal() {}
+  union {
+    OperationStats _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 OperationStatsDefaultTypeInternal _OperationStats_default_instance_;
+PROTOBUF_CONSTEXPR StatusCodeCount::StatusCodeCount(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.count_)*/uint64_t{0u}
+  , /*decltype(_impl_.status_code_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct StatusCodeCountDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR StatusCodeCountDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~StatusCodeCountDefaultTypeInternal() {}
+  union {
+    StatusCodeCount _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 StatusCodeCountDefaultTypeInternal _StatusCodeCount_default_instance_;
+PROTOBUF_CONSTEXPR ServerStats::ServerStats(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.operations_)*/{}
+  , /*decltype(_impl_.responses_)*/{}
+  , /*decltype(_impl_.queue_depth_)*/nullptr
+  , /*decltype(_impl_.broadcast_fanout_)*/nullptr
+  , /*decltype(_impl_.room_fanout_)*/nullptr
+  , /*decltype(_impl_.pipeline_depth_)*/nullptr
+  , /*decltype(_impl_.uptime_ms_)*/uint64_t{0u}
+  , /*decltype(_impl_.bytes_in_)*/uint64_t{0u}
+  , /*decltype(_impl_.bytes_out_)*/uint64_t{0u}
+  , /*decltype(_impl_.active_connections_)*/uint64_t{0u}
+  , /*decltype(_impl_.total_connections_)*/uint64_t{0u}
+  , /*decltype(_impl_.queued_frames_)*/uint64_t{0u}
+  , /*decltype(_impl_.queued_bytes_)*/uint64_t{0u}
+  , /*decltype(_impl_.heap_allocations_)*/uint64_t{0u}
+  , /*decltype(_impl_.read_calls_)*/uint64_t{0u}
+  , /*decltype(_impl_.write_calls_)*/uint64_t{0u}
+  , /*decltype(_impl_.packed_frames_)*/uint64_t{0u}
+  , /*decltype(_impl_.offline_queued_)*/uint64_t{0u}
+  , /*decltype(_impl_.offline_delivered_)*/uint64_t{0u}
+  , /*decltype(_impl_.offline_pending_)*/uint64_t{0u}
+  , /*decltype(_impl_.offline_syncs_)*/uint64_t{0u}
+  , /*decltype(_impl_.routed_frames_)*/uint64_t{0u}
+  , /*decltype(_impl_.active_rooms_)*/uint64_t{0u}
+  , /*decltype(_impl_.slow_consumers_)*/uint64_t{0u}
+  , /*decltype(_impl_.dropped_frames_)*/uint64_t{0u}
+  , /*decltype(_impl_.overflow_disconnects_)*/uint64_t{0u}
+  , /*decltype(_impl_.compressed_frames_)*/uint64_t{0u}
+  , /*decltype(_impl_.compression_in_bytes_)*/uint64_t{0u}
+  , /*decltype(_impl_.compression_out_bytes_)*/uint64_t{0u}
+  , /*decltype(_impl_.compression_cpu_ns_)*/uint64_t{0u}
+  , /*decltype(_impl_.presence_subscribers_)*/uint64_t{0u}
+  , /*decltype(_impl_.presence_changes_)*/uint64_t{0u}
+  , /*decltype(_impl_.presence_events_)*/uint64_t{0u}
+  , /*decltype(_impl_.presence_updates_)*/uint64_t{0u}
+  , /*decltype(_impl_.sessions_)*/uint64_t{0u}
+  , /*decltype(_impl_.session_bytes_)*/uint64_t{0u}
+  , /*decltype(_impl_.worker_jobs_)*/uint64_t{0u}
+  , /*decltype(_impl_.stolen_jobs_)*/uint64_t{0u}
+  , /*decltype(_impl_.detached_sessions_)*/uint64_t{0u}
+  , /*decltype(_impl_.resumed_sessions_)*/uint64_t{0u}
+  , /*decltype(_impl_.expired_sessions_)*/uint64_t{0u}
+  , /*decltype(_impl_.resumed_frames_)*/uint64_t{0u}
+  , /*decltype(_impl_.roster_builds_)*/uint64_t{0u}
+  , /*decltype(_impl_.roster_served_)*/uint64_t{0u}
+  , /*decltype(_impl_.file_transfers_)*/uint64_t{0u}
+  , /*decltype(_impl_.active_transfers_)*/uint64_t{0u}
+  , /*decltype(_impl_.file_bytes_)*/uint64_t{0u}
+  , /*decltype(_impl_.file_bytes_spooled_)*/uint64_t{0u}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ServerStatsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ServerStatsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ServerStatsDefaultTypeInternal() {}
+  union {
+    ServerStats _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ServerStatsDefaultTypeInternal _ServerStats_default_instance_;
+PROTOBUF_CONSTEXPR Response::Response(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.incoming_messages_)*/{}
+  , /*decltype(_impl_.message_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.resume_token_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.operation_)*/0
+  , /*decltype(_impl_.status_code_)*/0
+  , /*decltype(_impl_.request_id_)*/uint64_t{0u}
+  , /*decltype(_impl_.user_id_)*/uint64_t{0u}
+  , /*decltype(_impl_.compression_threshold_)*/0u
+  , /*decltype(_impl_.result_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_._oneof_case_)*/{}} {}
+struct ResponseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ResponseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ResponseDefaultTypeInternal() {}
+  union {
+    Response _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ResponseDefaultTypeInternal _Response_default_instance_;
+}  // namespace chat
+static ::_pb::Metadata file_level_metadata_chat_2eproto[23];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_chat_2eproto[6];
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_chat_2eproto = nullptr;
+
+const uint32_t TableStruct_chat_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chat::User, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::User, _impl_.username_),
+  PROTOBUF_FIELD_OFFSET(::chat::User, _impl_.ip_address_),
+  PROTOBUF_FIELD_OFFSET(::chat::User, _impl_.status_),
+  PROTOBUF_FIELD_OFFSET(::chat::User, _impl_.id_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chat::NewUserRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::NewUserRequest, _impl_.username_),
+  PROTOBUF_FIELD_OFFSET(::chat::NewUserRequest, _impl_.accept_batched_delivery_),
+  PROTOBUF_FIELD_OFFSET(::chat::NewUserRequest, _impl_.accept_compression_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chat::ResumeRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::ResumeRequest, _impl_.token_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chat::FileOffer, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::FileOffer, _impl_.recipient_),
+  PROTOBUF_FIELD_OFFSET(::chat::FileOffer, _impl_.recipient_id_),
+  PROTOBUF_FIELD_OFFSET(::chat::FileOffer, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::chat::FileOffer, _impl_.size_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chat::FileWindow, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::FileWindow, _impl_.transfer_id_),
+  PROTOBUF_FIELD_OFFSET(::chat::FileWindow, _impl_.bytes_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chat::SendMessageRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::SendMessageRequest, _impl_.recipient_),
+  PROTOBUF_FIELD_OFFSET(::chat::SendMessageRequest, _impl_.content_),
+  PROTOBUF_FIELD_OFFSET(::chat::SendMessageRequest, _impl_.room_),
+  PROTOBUF_FIELD_OFFSET(::chat::SendMessageRequest, _impl_.recipient_id_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chat::SendMessageBatchRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::SendMessageBatchRequest, _impl_.messages_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chat::IncomingMessageResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::IncomingMessageResponse, _impl_.sender_),
+  PROTOBUF_FIELD_OFFSET(::chat::IncomingMessageResponse, _impl_.content_),
+  PROTOBUF_FIELD_OFFSET(::chat::IncomingMessageResponse, _impl_.type_),
+  PROTOBUF_FIELD_OFFSET(::chat::IncomingMessageResponse, _impl_.room_),
+  PROTOBUF_FIELD_OFFSET(::chat::IncomingMessageResponse, _impl_.sender_id_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chat::RoomRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::RoomRequest, _impl_.room_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chat::RoomResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::RoomResponse, _impl_.room_),
+  PROTOBUF_FIELD_OFFSET(::chat::RoomResponse, _impl_.members_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chat::SendMessageBatchResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::SendMessageBatchResponse, _impl_.results_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chat::UserListRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::UserListRequest, _impl_.username_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chat::UserListResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::UserListResponse, _impl_.users_),
+  PROTOBUF_FIELD_OFFSET(::chat::UserListResponse, _impl_.type_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chat::PresenceEvent, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::PresenceEvent, _impl_.username_),
+  PROTOBUF_FIELD_OFFSET(::chat::PresenceEvent, _impl_.change_),
+  PROTOBUF_FIELD_OFFSET(::chat::PresenceEvent, _impl_.status_),
+  PROTOBUF_FIELD_OFFSET(::chat::PresenceEvent, _impl_.user_id_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chat::PresenceUpdate, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::PresenceUpdate, _impl_.snapshot_),
+  PROTOBUF_FIELD_OFFSET(::chat::PresenceUpdate, _impl_.version_),
+  PROTOBUF_FIELD_OFFSET(::chat::PresenceUpdate, _impl_.since_version_),
+  PROTOBUF_FIELD_OFFSET(::chat::PresenceUpdate, _impl_.users_),
+  PROTOBUF_FIELD_OFFSET(::chat::PresenceUpdate, _impl_.events_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chat::FileTransfer, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::FileTransfer, _impl_.transfer_id_),
+  PROTOBUF_FIELD_OFFSET(::chat::FileTransfer, _impl_.sender_),
+  PROTOBUF_FIELD_OFFSET(::chat::FileTransfer, _impl_.sender_id_),
+  PROTOBUF_FIELD_OFFSET(::chat::FileTransfer, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::chat::FileTransfer, _impl_.size_),
+  PROTOBUF_FIELD_OFFSET(::chat::FileTransfer, _impl_.window_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chat::UpdateStatusRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::UpdateStatusRequest, _impl_.username_),
+  PROTOBUF_FIELD_OFFSET(::chat::UpdateStatusRequest, _impl_.new_status_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chat::Request, _internal_metadata_),
+  ~0u,  // no _extensions_
+  PROTOBUF_FIELD_OFFSET(::chat::Request, _impl_._oneof_case_[0]),
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::Request, _impl_.operation_),
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  PROTOBUF_FIELD_OFFSET(::chat::Request, _impl_.request_id_),
+  PROTOBUF_FIELD_OFFSET(::chat::Request, _impl_.payload_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chat::Distribution, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::Distribution, _impl_.count_),
+  PROTOBUF_FIELD_OFFSET(::chat::Distribution, _impl_.mean_),
+  PROTOBUF_FIELD_OFFSET(::chat::Distribution, _impl_.p50_),
+  PROTOBUF_FIELD_OFFSET(::chat::Distribution, _impl_.p90_),
+  PROTOBUF_FIELD_OFFSET(::chat::Distribution, _impl_.p99_),
+  PROTOBUF_FIELD_OFFSET(::chat::Distribution, _impl_.p999_),
+  PROTOBUF_FIELD_OFFSET(::chat::Distribution, _impl_.max_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chat::OperationStats, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::OperationStats, _impl_.operation_),
+  PROTOBUF_FIELD_OFFSET(::chat::OperationStats, _impl_.requests_),
+  PROTOBUF_FIELD_OFFSET(::chat::OperationStats, _impl_.latency_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chat::StatusCodeCount, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::StatusCodeCount, _impl_.status_code_),
+  PROTOBUF_FIELD_OFFSET(::chat::StatusCodeCount, _impl_.count_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chat::ServerStats, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::ServerStats, _impl_.uptime_ms_),
+  PROTOBUF_FIELD_OFFSET(::chat::ServerStats, _impl_.operations_),
+  PROTOBUF_FIELD_OFFSET(::chat::ServerStats, _impl_.responses_),
+  PROTOBUF_FIELD_OFFSET(::chat::ServerStats, _impl_.bytes_in_),
+  PROTOBUF_FIELD_OFFSET(::chat::ServerStats, _impl_.bytes_out_),
+  PROTOBUF_FIELD_OFFSET(::chat::ServerStats, _impl_.active_connections_),
+  PROTOBUF_FIELD_OFFSET(::chat::ServerStats, _impl_.total_connections_),
+  PROTOBUF_FIELD_OFFSET(::chat::ServerStats, _impl_.queued_frames_),
+  PROTOBUF_FIELD_OFFSET(::chat::ServerStats, _impl_.queued_bytes_),
+  PROTOBUF_FIELD_OFFSET(::chat::ServerStats, _impl_.queue_depth_),
+  PROTOBUF_FIELD_OFFSET(::chat::ServerStats, _impl_.broadcast_fanout_),
+  PROTOBUF_FIELD_OFFSET(::chat::ServerStats, _impl_.heap_allocations_),
+  PROTOBUF_FIELD_OFFSET(::chat::ServerStats, _impl_.read_calls_),
+  PROTOBUF_FIELD_OFFSET(::chat::ServerStats, _impl_.write_calls_),
+  PROTOBUF_FIELD_OFFSET(::chat::ServerStats, _impl_.packed_frames_),
+  PROTOBUF_FIELD_OFFSET(::chat::ServerStats, _impl_.offline_queued_),
+  PROTOBUF_FIELD_OFFSET(::chat::ServerStats, _impl_.offline_delivered_),
+  PROTOBUF_FIELD_OFFSET(::chat::ServerStats, _impl_.offline_pending_),
+  PROTOBUF_FIELD_OFFSET(::chat::ServerStats, _impl_.offline_syncs_),
+  PROTOBUF_FIELD_OFFSET(::chat::ServerStats, _impl_.routed_frames_),
+  PROTOBUF_FIELD_OFFSET(::chat::ServerStats, _impl_.active_rooms_),
+  PROTOBUF_FIELD_OFFSET(::chat::ServerStats, _impl_.room_fanout_),
+  PROTOBUF_FIELD_OFFSET(::chat::ServerStats, _impl_.slow_consumers_),
+  PROTOBUF_FIELD_OFFSET(::chat::ServerStats, _impl_.dropped_frames_),
+  PROTOBUF_FIELD_OFFSET(::chat::ServerStats, _impl_.overflow_disconnects_),
+  PROTOBUF_FIELD_OFFSET(::chat::ServerStats, _impl_.compressed_frames_),
+  PROTOBUF_FIELD_OFFSET(::chat::ServerStats, _impl_.compression_in_bytes_),
+  PROTOBUF_FIELD_OFFSET(::chat::ServerStats, _impl_.compression_out_bytes_),
+  PROTOBUF_FIELD_OFFSET(::chat::ServerStats, _impl_.compression_cpu_ns_),
+  PROTOBUF_FIELD_OFFSET(::chat::ServerStats, _impl_.pipeline_depth_),
+  PROTOBUF_FIELD_OFFSET(::chat::ServerStats, _impl_.presence_subscribers_),
+  PROTOBUF_FIELD_OFFSET(::chat::ServerStats, _impl_.presence_changes_),
+  PROTOBUF_FIELD_OFFSET(::chat::ServerStats, _impl_.presence_events_),
+  PROTOBUF_FIELD_OFFSET(::chat::ServerStats, _impl_.presence_updates_),
+  PROTOBUF_FIELD_OFFSET(::chat::ServerStats, _impl_.sessions_),
+  PROTOBUF_FIELD_OFFSET(::chat::ServerStats, _impl_.session_bytes_),
+  PROTOBUF_FIELD_OFFSET(::chat::ServerStats, _impl_.worker_jobs_),
+  PROTOBUF_FIELD_OFFSET(::chat::ServerStats, _impl_.stolen_jobs_),
+  PROTOBUF_FIELD_OFFSET(::chat::ServerStats, _impl_.detached_sessions_),
+  PROTOBUF_FIELD_OFFSET(::chat::ServerStats, _impl_.resumed_sessions_),
+  PROTOBUF_FIELD_OFFSET(::chat::ServerStats, _impl_.expired_sessions_),
+  PROTOBUF_FIELD_OFFSET(::chat::ServerStats, _impl_.resumed_frames_),
+  PROTOBUF_FIELD_OFFSET(::chat::ServerStats, _impl_.roster_builds_),
+  PROTOBUF_FIELD_OFFSET(::chat::ServerStats, _impl_.roster_served_),
+  PROTOBUF_FIELD_OFFSET(::chat::ServerStats, _impl_.file_transfers_),
+  PROTOBUF_FIELD_OFFSET(::chat::ServerStats, _impl_.active_transfers_),
+  PROTOBUF_FIELD_OFFSET(::chat::ServerStats, _impl_.file_bytes_),
+  PROTOBUF_FIELD_OFFSET(::chat::ServerStats, _impl_.file_bytes_spooled_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::chat::Response, _internal_metadata_),
+  ~0u,  // no _extensions_
+  PROTOBUF_FIELD_OFFSET(::chat::Response, _impl_._oneof_case_[0]),
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::chat::Response, _impl_.operation_),
+  PROTOBUF_FIELD_OFFSET(::chat::Response, _impl_.status_code_),
+  PROTOBUF_FIELD_OFFSET(::chat::Response, _impl_.message_),
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  PROTOBUF_FIELD_OFFSET(::chat::Response, _impl_.incoming_messages_),
+  PROTOBUF_FIELD_OFFSET(::chat::Response, _impl_.compression_threshold_),
+  PROTOBUF_FIELD_OFFSET(::chat::Response, _impl_.request_id_),
+  PROTOBUF_FIELD_OFFSET(::chat::Response, _impl_.user_id_),
+  PROTOBUF_FIELD_OFFSET(::chat::Response, _impl_.resume_token_),
+  PROTOBUF_FIELD_OFFSET(::chat::Response, _impl_.result_),
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, -1, -1, sizeof(::chat::User)},
+  { 10, -1, -1, sizeof(::chat::NewUserRequest)},
+  { 19, -1, -1, sizeof(::chat::ResumeRequest)},
+  { 26, -1, -1, sizeof(::chat::FileOffer)},
+  { 36, -1, -1, sizeof(::chat::FileWindow)},
+  { 44, -1, -1, sizeof(::chat::SendMessageRequest)},
+  { 54, -1, -1, sizeof(::chat::SendMessageBatchRequest)},
+  { 61, -1, -1, sizeof(::chat::IncomingMessageResponse)},
+  { 72, -1, -1, sizeof(::chat::RoomRequest)},
+  { 79, -1, -1, sizeof(::chat::RoomResponse)},
+  { 87, -1, -1, sizeof(::chat::SendMessageBatchResponse)},
+  { 94, -1, -1, sizeof(::chat::UserListRequest)},
+  { 101, -1, -1, sizeof(::chat::UserListResponse)},
+  { 109, -1, -1, sizeof(::chat::PresenceEvent)},
+  { 119, -1, -1, sizeof(::chat::PresenceUpdate)},
+  { 130, -1, -1, sizeof(::chat::FileTransfer)},
+  { 142, -1, -1, sizeof(::chat::UpdateStatusRequest)},
+  { 150, -1, -1, sizeof(::chat::Request)},
+  { 170, -1, -1, sizeof(::chat::Distribution)},
+  { 183, -1, -1, sizeof(::chat::OperationStats)},
+  { 192, -1, -1, sizeof(::chat::StatusCodeCount)},
+  { 200, -1, -1, sizeof(::chat::ServerStats)},
+  { 254, -1, -1, sizeof(::chat::Response)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::chat::_User_default_instance_._instance,
+  &::chat::_NewUserRequest_default_instance_._instance,
+  &::chat::_ResumeRequest_default_instance_._instance,
+  &::chat::_FileOffer_default_instance_._instance,
+  &::chat::_FileWindow_default_instance_._instance,
+  &::chat::_SendMessageRequest_default_instance_._instance,
+  &::chat::_SendMessageBatchRequest_default_instance_._instance,
+  &::chat::_IncomingMessageResponse_default_instance_._instance,
+  &::chat::_RoomRequest_default_instance_._instance,
+  &::chat::_RoomResponse_default_instance_._instance,
+  &::chat::_SendMessageBatchResponse_default_instance_._instance,
+  &::chat::_UserListRequest_default_instance_._instance,
+  &::chat::_UserListResponse_default_instance_._instance,
+  &::chat::_PresenceEvent_default_instance_._instance,
+  &::chat::_PresenceUpdate_default_instance_._instance,
+  &::chat::_FileTransfer_default_instance_._instance,
+  &::chat::_UpdateStatusRequest_default_instance_._instance,
+  &::chat::_Request_default_instance_._instance,
+  &::chat::_Distribution_default_instance_._instance,
+  &::chat::_OperationStats_default_instance_._instance,
+  &::chat::_StatusCodeCount_default_instance_._instance,
+  &::chat::_ServerStats_default_instance_._instance,
+  &::chat::_Response_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_chat_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\nchat.proto\022\004chat\"Z\n\004User\022\020\n\010username\030\001"
+  " \001(\t\022\022\n\nip_address\030\002 \001(\t\022 \n\006status\030\003 \001(\016"
+  "2\020.chat.UserStatus\022\n\n\002id\030\004 \001(\004\"_\n\016NewUse"
+  "rRequest\022\020\n\010username\030\001 \001(\t\022\037\n\027accept_bat"
+  "ched_delivery\030\002 \001(\010\022\032\n\022accept_compressio"
+  "n\030\003 \001(\010\"\036\n\rResumeRequest\022\r\n\005token\030\001 \001(\014\""
+  "P\n\tFileOffer\022\021\n\trecipient\030\001 \001(\t\022\024\n\014recip"
+  "ient_id\030\002 \001(\004\022\014\n\004name\030\003 \001(\t\022\014\n\004size\030\004 \001("
+  "\004\"0\n\nFileWindow\022\023\n\013transfer_id\030\001 \001(\004\022\r\n\005"
+  "bytes\030\002 \001(\004\"\\\n\022SendMessageRequest\022\021\n\trec"
+  "ipient\030\001 \001(\t\022\017\n\007content\030\002 \001(\t\022\014\n\004room\030\003 "
+  "\001(\t\022\024\n\014recipient_id\030\004 \001(\004\"E\n\027SendMessage"
+  "BatchRequest\022*\n\010messages\030\001 \003(\0132\030.chat.Se"
+  "ndMessageRequest\"|\n\027IncomingMessageRespo"
+  "nse\022\016\n\006sender\030\001 \001(\t\022\017\n\007content\030\002 \001(\t\022\037\n\004"
+  "type\030\003 \001(\0162\021.chat.MessageType\022\014\n\004room\030\004 "
+  "\001(\t\022\021\n\tsender_id\030\005 \001(\004\"\033\n\013RoomRequest\022\014\n"
+  "\004room\030\001 \001(\t\"-\n\014RoomResponse\022\014\n\004room\030\001 \001("
+  "\t\022\017\n\007members\030\002 \001(\r\"=\n\030SendMessageBatchRe"
+  "sponse\022!\n\007results\030\001 \003(\0162\020.chat.StatusCod"
+  "e\"#\n\017UserListRequest\022\020\n\010username\030\001 \001(\t\"O"
+  "\n\020UserListResponse\022\031\n\005users\030\001 \003(\0132\n.chat"
+  ".User\022 \n\004type\030\002 \001(\0162\022.chat.UserListType\""
+  "z\n\rPresenceEvent\022\020\n\010username\030\001 \001(\t\022$\n\006ch"
+  "ange\030\002 \001(\0162\024.chat.PresenceChange\022 \n\006stat"
+  "us\030\003 \001(\0162\020.chat.UserStatus\022\017\n\007user_id\030\004 "
+  "\001(\004\"\212\001\n\016PresenceUpdate\022\020\n\010snapshot\030\001 \001(\010"
+  "\022\017\n\007version\030\002 \001(\004\022\025\n\rsince_version\030\003 \001(\004"
+  "\022\031\n\005users\030\004 \003(\0132\n.chat.User\022#\n\006events\030\005 "
+  "\003(\0132\023.chat.PresenceEvent\"r\n\014FileTransfer"
+  "\022\023\n\013transfer_id\030\001 \001(\004\022\016\n\006sender\030\002 \001(\t\022\021\n"
+  "\tsender_id\030\003 \001(\004\022\014\n\004name\030\004 \001(\t\022\014\n\004size\030\005"
+  " \001(\004\022\016\n\006window\030\006 \001(\004\"M\n\023UpdateStatusRequ"
+  "est\022\020\n\010username\030\001 \001(\t\022$\n\nnew_status\030\002 \001("
+  "\0162\020.chat.UserStatus\"\271\004\n\007Request\022\"\n\topera"
+  "tion\030\001 \001(\0162\017.chat.Operation\022-\n\rregister_"
+  "user\030\002 \001(\0132\024.chat.NewUserRequestH\000\0220\n\014se"
+  "nd_message\030\003 \001(\0132\030.chat.SendMessageReque"
+  "stH\000\0222\n\rupdate_status\030\004 \001(\0132\031.chat.Updat"
+  "eStatusRequestH\000\022*\n\tget_users\030\005 \001(\0132\025.ch"
+  "at.UserListRequestH\000\022%\n\017unregister_user\030"
+  "\006 \001(\0132\n.chat.UserH\000\022;\n\022send_message_batc"
+  "h\030\007 \001(\0132\035.chat.SendMessageBatchRequestH\000"
+  "\022&\n\tjoin_room\030\010 \001(\0132\021.chat.RoomRequestH\000"
+  "\022\'\n\nleave_room\030\t \001(\0132\021.chat.RoomRequestH"
+  "\000\022%\n\006resume\030\013 \001(\0132\023.chat.ResumeRequestH\000"
+  "\022%\n\nfile_offer\030\014 \001(\0132\017.chat.FileOfferH\000\022"
+  "\'\n\013file_window\030\r \001(\0132\020.chat.FileWindowH\000"
+  "\022\022\n\nrequest_id\030\n \001(\004B\t\n\007payload\"m\n\014Distr"
+  "ibution\022\r\n\005count\030\001 \001(\004\022\014\n\004mean\030\002 \001(\001\022\013\n\003"
+  "p50\030\003 \001(\004\022\013\n\003p90\030\004 \001(\004\022\013\n\003p99\030\005 \001(\004\022\014\n\004p"
+  "999\030\006 \001(\004\022\013\n\003max\030\007 \001(\004\"k\n\016OperationStats"
+  "\022\"\n\toperation\030\001 \001(\0162\017.chat.Operation\022\020\n\010"
+  "requests\030\002 \001(\004\022#\n\007latency\030\003 \001(\0132\022.chat.D"
+  "istribution\"G\n\017StatusCodeCount\022%\n\013status"
+  "_code\030\001 \001(\0162\020.chat.StatusCode\022\r\n\005count\030\002"
+  " \001(\004\"\212\n\n\013ServerStats\022\021\n\tuptime_ms\030\001 \001(\004\022"
+  "(\n\noperations\030\002 \003(\0132\024.chat.OperationStat"
+  "s\022(\n\tresponses\030\003 \003(\0132\025.chat.StatusCodeCo"
+  "unt\022\020\n\010bytes_in\030\004 \001(\004\022\021\n\tbytes_out\030\005 \001(\004"
+  "\022\032\n\022active_connections\030\006 \001(\004\022\031\n\021total_co"
+  "nnections\030\007 \001(\004\022\025\n\rqueued_frames\030\010 \001(\004\022\024"
+  "\n\014queued_bytes\030\t \001(\004\022\'\n\013queue_depth\030\n \001("
+  "\0132\022.chat.Distribution\022,\n\020broadcast_fanou"
+  "t\030\013 \001(\0132\022.chat.Distribution\022\030\n\020heap_allo"
+  "cations\030\014 \001(\004\022\022\n\nread_calls\030\r \001(\004\022\023\n\013wri"
+  "te_calls\030\016 \001(\004\022\025\n\rpacked_frames\030\017 \001(\004\022\026\n"
+  "\016offline_queued\030\020 \001(\004\022\031\n\021offline_deliver"
+  "ed\030\021 \001(\004\022\027\n\017offline_pending\030\022 \001(\004\022\025\n\roff"
+  "line_syncs\030\023 \001(\004\022\025\n\rrouted_frames\030\024 \001(\004\022"
+  "\024\n\014active_rooms\030\025 \001(\004\022\'\n\013room_fanout\030\026 \001"
+  "(\0132\022.chat.Distribution\022\026\n\016slow_consumers"
+  "\030\027 \001(\004\022\026\n\016dropped_frames\030\030 \001(\004\022\034\n\024overfl"
+  "ow_disconnects\030\031 \001(\004\022\031\n\021compressed_frame"
+  "s\030\032 \001(\004\022\034\n\024compression_in_bytes\030\033 \001(\004\022\035\n"
+  "\025compression_out_bytes\030\034 \001(\004\022\032\n\022compress"
+  "ion_cpu_ns\030\035 \001(\004\022*\n\016pipeline_depth\030\036 \001(\013"
+  "2\022.chat.Distribution\022\034\n\024presence_subscri"
+  "bers\030\037 \001(\004\022\030\n\020presence_changes\030  \001(\004\022\027\n\017"
+  "presence_events\030! \001(\004\022\030\n\020presence_update"
+  "s\030\" \001(\004\022\020\n\010sessions\030# \001(\004\022\025\n\rsession_byt"
+  "es\030$ \001(\004\022\023\n\013worker_jobs\030% \001(\004\022\023\n\013stolen_"
+  "jobs\030& \001(\004\022\031\n\021detached_sessions\030\' \001(\004\022\030\n"
+  "\020resumed_sessions\030( \001(\004\022\030\n\020expired_sessi"
+  "ons\030) \001(\004\022\026\n\016resumed_frames\030* \001(\004\022\025\n\rros"
+  "ter_builds\030+ \001(\004\022\025\n\rroster_served\030, \001(\004\022"
+  "\026\n\016file_transfers\030- \001(\004\022\030\n\020active_transf"
+  "ers\030. \001(\004\022\022\n\nfile_bytes\030/ \001(\004\022\032\n\022file_by"
+  "tes_spooled\0300 \001(\004\"\277\004\n\010Response\022\"\n\toperat"
+  "ion\030\001 \001(\0162\017.chat.Operation\022%\n\013status_cod"
+  "e\030\002 \001(\0162\020.chat.StatusCode\022\017\n\007message\030\003 \001"
+  "(\t\022+\n\tuser_list\030\004 \001(\0132\026.chat.UserListRes"
+  "ponseH\000\0229\n\020incoming_message\030\005 \001(\0132\035.chat"
+  ".IncomingMessageResponseH\000\022\"\n\005stats\030\006 \001("
+  "\0132\021.chat.ServerStatsH\000\0227\n\rmessage_batch\030"
+  "\007 \001(\0132\036.chat.SendMessageBatchResponseH\000\022"
+  "\"\n\004room\030\t \001(\0132\022.chat.RoomResponseH\000\022(\n\010p"
+  "resence\030\014 \001(\0132\024.chat.PresenceUpdateH\000\022&\n"
+  "\010transfer\030\017 \001(\0132\022.chat.FileTransferH\000\0228\n"
+  "\021incoming_messages\030\010 \003(\0132\035.chat.Incoming"
+  "MessageResponse\022\035\n\025compression_threshold"
+  "\030\n \001(\r\022\022\n\nrequest_id\030\013 \001(\004\022\017\n\007user_id\030\r "
+  "\001(\004\022\024\n\014resume_token\030\016 \001(\014B\010\n\006result*/\n\nU"
+  "serStatus\022\n\n\006ONLINE\020\000\022\010\n\004BUSY\020\001\022\013\n\007OFFLI"
+  "NE\020\002*2\n\013MessageType\022\r\n\tBROADCAST\020\000\022\n\n\006DI"
+  "RECT\020\001\022\010\n\004ROOM\020\002*#\n\014UserListType\022\007\n\003ALL\020"
+  "\000\022\n\n\006SINGLE\020\001*:\n\016PresenceChange\022\n\n\006JOINE"
+  "D\020\000\022\010\n\004LEFT\020\001\022\022\n\016STATUS_CHANGED\020\002*\365\002\n\tOp"
+  "eration\022\021\n\rREGISTER_USER\020\000\022\020\n\014SEND_MESSA"
+  "GE\020\001\022\021\n\rUPDATE_STATUS\020\002\022\r\n\tGET_USERS\020\003\022\023"
+  "\n\017UNREGISTER_USER\020\004\022\024\n\020INCOMING_MESSAGE\020"
+  "\005\022\r\n\tGET_STATS\020\006\022\026\n\022SEND_MESSAGE_BATCH\020\007"
+  "\022\032\n\026INCOMING_MESSAGE_BATCH\020\010\022\r\n\tJOIN_ROO"
+  "M\020\t\022\016\n\nLEAVE_ROOM\020\n\022\026\n\022SUBSCRIBE_PRESENC"
+  "E\020\013\022\030\n\024UNSUBSCRIBE_PRESENCE\020\014\022\023\n\017PRESENC"
+  "E_UPDATE\020\r\022\n\n\006RESUME\020\016\022\016\n\nFILE_OFFER\020\017\022\017"
+  "\n\013FILE_ACCEPT\020\020\022\017\n\013FILE_WINDOW\020\021\022\017\n\013FILE"
+  "_CANCEL\020\022*\257\001\n\nStatusCode\022\022\n\016UNKNOWN_STAT"
+  "US\020\000\022\007\n\002OK\020\310\001\022\020\n\013BAD_REQUEST\020\220\003\022\021\n\014UNAUT"
+  "HORIZED\020\221\003\022\016\n\tFORBIDDEN\020\223\003\022\016\n\tNOT_FOUND\020"
+  "\224\003\022\r\n\010CONFLICT\020\231\003\022\032\n\025INTERNAL_SERVER_ERR"
+  "OR\020\364\003\022\024\n\017NOT_IMPLEMENTED\020\365\003b\006proto3"
+  ;
+static ::_pbi::once_flag descriptor_table_chat_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_chat_2eproto = {
+    false, false, 4875, descriptor_table_protodef_chat_2eproto,
+    "chat.proto",
+    &descriptor_table_chat_2eproto_once, nullptr, 0, 23,
+    schemas, file_default_instances, TableStruct_chat_2eproto::offsets,
+    file_level_metadata_chat_2eproto, file_level_enum_descriptors_chat_2eproto,
+    file_level_service_descriptors_chat_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_chat_2eproto_getter() {
+  return &descriptor_table_chat_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_chat_2eproto(&descriptor_table_chat_2eproto);
+namespace chat {
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* UserStatus_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_chat_2eproto);
+  return file_level_enum_descriptors_chat_2eproto[0];
+}
+bool UserStatus_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+      return true;
+    default:
+      return false;
+  }
+}
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* MessageType_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_chat_2eproto);
+  return file_level_enum_descriptors_chat_2eproto[1];
+}
+bool MessageType_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+      return true;
+    default:
+      return false;
+  }
+}
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* UserListType_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_chat_2eproto);
+  return file_level_enum_descriptors_chat_2eproto[2];
+}
+bool UserListType_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+      return true;
+    default:
+      return false;
+  }
+}
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* PresenceChange_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_chat_2eproto);
+  return file_level_enum_descriptors_chat_2eproto[3];
+}
+bool PresenceChange_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+      return true;
+    default:
+      return false;
+  }
+}
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Operation_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_chat_2eproto);
+  return file_level_enum_descriptors_chat_2eproto[4];
+}
+bool Operation_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+    case 3:
+    case 4:
+    case 5:
+    case 6:
+    case 7:
+    case 8:
+    case 9:
+    case 10:
+    case 11:
+    case 12:
+    case 13:
+    case 14:
+    case 15:
+    case 16:
+    case 17:
+    case 18:
+      return true;
+    default:
+      return false;
+  }
+}
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* StatusCode_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_chat_2eproto);
+  return file_level_enum_descriptors_chat_2eproto[5];
+}
+bool StatusCode_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 200:
+    case 400:
+    case 401:
+    case 403:
+    case 404:
+    case 409:
+    case 500:
+    case 501:
+      return true;
+    default:
+      return false;
+  }
+}
+
+
+// ===================================================================
+
+class User::_Internal {
+ public:
+};
+
+User::User(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chat.User)
+}
+User::User(const User& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  User* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.username_){}
+    , decltype(_impl_.ip_address_){}
+    , decltype(_impl_.id_){}
+    , decltype(_impl_.status_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.username_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.username_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_username().empty()) {
+    _this->_impl_.username_.Set(from._internal_username(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.ip_address_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.ip_address_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_ip_address().empty()) {
+    _this->_impl_.ip_address_.Set(from._internal_ip_address(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.id_, &from._impl_.id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.status_) -
+    reinterpret_cast<char*>(&_impl_.id_)) + sizeof(_impl_.status_));
+  // @@protoc_insertion_point(copy_constructor:chat.User)
+}
+
+inline void User::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.username_){}
+    , decltype(_impl_.ip_address_){}
+    , decltype(_impl_.id_){uint64_t{0u}}
+    , decltype(_impl_.status_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.username_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.username_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.ip_address_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.ip_address_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+User::~User() {
+  // @@protoc_insertion_point(destructor:chat.User)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void User::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.username_.Destroy();
+  _impl_.ip_address_.Destroy();
+}
+
+void User::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void User::Clear() {
+// @@protoc_insertion_point(message_clear_start:chat.User)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.username_.ClearToEmpty();
+  _impl_.ip_address_.ClearToEmpty();
+  ::memset(&_impl_.id_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.status_) -
+      reinterpret_cast<char*>(&_impl_.id_)) + sizeof(_impl_.status_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* User::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string username = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_username();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "chat.User.username"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string ip_address = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_ip_address();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "chat.User.ip_address"));
+        } else
+          goto handle_unusual;
+        continue;
+      // .chat.UserStatus status = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_status(static_cast<::chat::UserStatus>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 id = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* User::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chat.User)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string username = 1;
+  if (!this->_internal_username().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_username().data(), static_cast<int>(this->_internal_username().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "chat.User.username");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_username(), target);
+  }
+
+  // string ip_address = 2;
+  if (!this->_internal_ip_address().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_ip_address().data(), static_cast<int>(this->_internal_ip_address().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "chat.User.ip_address");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_ip_address(), target);
+  }
+
+  // .chat.UserStatus status = 3;
+  if (this->_internal_status() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      3, this->_internal_status(), target);
+  }
+
+  // uint64 id = 4;
+  if (this->_internal_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_id(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chat.User)
+  return target;
+}
+
+size_t User::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chat.User)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string username = 1;
+  if (!this->_internal_username().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_username());
+  }
+
+  // string ip_address = 2;
+  if (!this->_internal_ip_address().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_ip_address());
+  }
+
+  // uint64 id = 4;
+  if (this->_internal_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_id());
+  }
+
+  // .chat.UserStatus status = 3;
+  if (this->_internal_status() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_status());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData User::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    User::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*User::GetClassData() const { return &_class_data_; }
+
+
+void User::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<User*>(&to_msg);
+  auto& from = static_cast<const User&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.User)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_username().empty()) {
+    _this->_internal_set_username(from._internal_username());
+  }
+  if (!from._internal_ip_address().empty()) {
+    _this->_internal_set_ip_address(from._internal_ip_address());
+  }
+  if (from._internal_id() != 0) {
+    _this->_internal_set_id(from._internal_id());
+  }
+  if (from._internal_status() != 0) {
+    _this->_internal_set_status(from._internal_status());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void User::CopyFrom(const User& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chat.User)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool User::IsInitialized() const {
+  return true;
+}
+
+void User::InternalSwap(User* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.username_, lhs_arena,
+      &other->_impl_.username_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.ip_address_, lhs_arena,
+      &other->_impl_.ip_address_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(User, _impl_.status_)
+      + sizeof(User::_impl_.status_)
+      - PROTOBUF_FIELD_OFFSET(User, _impl_.id_)>(
+          reinterpret_cast<char*>(&_impl_.id_),
+          reinterpret_cast<char*>(&other->_impl_.id_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata User::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_chat_2eproto_getter, &descriptor_table_chat_2eproto_once,
+      file_level_metadata_chat_2eproto[0]);
+}
+
+// ===================================================================
+
+class NewUserRequest::_Internal {
+ public:
+};
+
+NewUserRequest::NewUserRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chat.NewUserRequest)
+}
+NewUserRequest::NewUserRequest(const NewUserRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  NewUserRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.username_){}
+    , decltype(_impl_.accept_batched_delivery_){}
+    , decltype(_impl_.accept_compression_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.username_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.username_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_username().empty()) {
+    _this->_impl_.username_.Set(from._internal_username(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.accept_batched_delivery_, &from._impl_.accept_batched_delivery_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.accept_compression_) -
+    reinterpret_cast<char*>(&_impl_.accept_batched_delivery_)) + sizeof(_impl_.accept_compression_));
+  // @@protoc_insertion_point(copy_constructor:chat.NewUserRequest)
+}
+
+inline void NewUserRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.username_){}
+    , decltype(_impl_.accept_batched_delivery_){false}
+    , decltype(_impl_.accept_compression_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.username_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.username_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+NewUserRequest::~NewUserRequest() {
+  // @@protoc_insertion_point(destructor:chat.NewUserRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void NewUserRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.username_.Destroy();
+}
+
+void NewUserRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void NewUserRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:chat.NewUserRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.username_.ClearToEmpty();
+  ::memset(&_impl_.accept_batched_delivery_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.accept_compression_) -
+      reinterpret_cast<char*>(&_impl_.accept_batched_delivery_)) + sizeof(_impl_.accept_compression_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* NewUserRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string username = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_username();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "chat.NewUserRequest.username"));
+        } else
+          goto handle_unusual;
+        continue;
+      // bool accept_batched_delivery = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.accept_batched_delivery_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bool accept_compression = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.accept_compression_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* NewUserRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chat.NewUserRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string username = 1;
+  if (!this->_internal_username().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_username().data(), static_cast<int>(this->_internal_username().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "chat.NewUserRequest.username");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_username(), target);
+  }
+
+  // bool accept_batched_delivery = 2;
+  if (this->_internal_accept_batched_delivery() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(2, this->_internal_accept_batched_delivery(), target);
+  }
+
+  // bool accept_compression = 3;
+  if (this->_internal_accept_compression() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(3, this->_internal_accept_compression(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chat.NewUserRequest)
+  return target;
+}
+
+size_t NewUserRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chat.NewUserRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string username = 1;
+  if (!this->_internal_username().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_username());
+  }
+
+  // bool accept_batched_delivery = 2;
+  if (this->_internal_accept_batched_delivery() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // bool accept_compression = 3;
+  if (this->_internal_accept_compression() != 0) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData NewUserRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    NewUserRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*NewUserRequest::GetClassData() const { return &_class_data_; }
+
+
+void NewUserRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<NewUserRequest*>(&to_msg);
+  auto& from = static_cast<const NewUserRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.NewUserRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_username().empty()) {
+    _this->_internal_set_username(from._internal_username());
+  }
+  if (from._internal_accept_batched_delivery() != 0) {
+    _this->_internal_set_accept_batched_delivery(from._internal_accept_batched_delivery());
+  }
+  if (from._internal_accept_compression() != 0) {
+    _this->_internal_set_accept_compression(from._internal_accept_compression());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void NewUserRequest::CopyFrom(const NewUserRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chat.NewUserRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool NewUserRequest::IsInitialized() const {
+  return true;
+}
+
+void NewUserRequest::InternalSwap(NewUserRequest* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.username_, lhs_arena,
+      &other->_impl_.username_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(NewUserRequest, _impl_.accept_compression_)
+      + sizeof(NewUserRequest::_impl_.accept_compression_)
+      - PROTOBUF_FIELD_OFFSET(NewUserRequest, _impl_.accept_batched_delivery_)>(
+          reinterpret_cast<char*>(&_impl_.accept_batched_delivery_),
+          reinterpret_cast<char*>(&other->_impl_.accept_batched_delivery_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata NewUserRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_chat_2eproto_getter, &descriptor_table_chat_2eproto_once,
+      file_level_metadata_chat_2eproto[1]);
+}
+
+// ===================================================================
+
+class ResumeRequest::_Internal {
+ public:
+};
+
+ResumeRequest::ResumeRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chat.ResumeRequest)
+}
+ResumeRequest::ResumeRequest(const ResumeRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ResumeRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.token_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.token_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.token_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_token().empty()) {
+    _this->_impl_.token_.Set(from._internal_token(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:chat.ResumeRequest)
+}
+
+inline void ResumeRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.token_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.token_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.token_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+ResumeRequest::~ResumeRequest() {
+  // @@protoc_insertion_point(destructor:chat.ResumeRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ResumeRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.token_.Destroy();
+}
+
+void ResumeRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ResumeRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:chat.ResumeRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.token_.ClearToEmpty();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ResumeRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // bytes token = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_token();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ResumeRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chat.ResumeRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bytes token = 1;
+  if (!this->_internal_token().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        1, this->_internal_token(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chat.ResumeRequest)
+  return target;
+}
+
+size_t ResumeRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chat.ResumeRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // bytes token = 1;
+  if (!this->_internal_token().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_token());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ResumeRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ResumeRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ResumeRequest::GetClassData() const { return &_class_data_; }
+
+
+void ResumeRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ResumeRequest*>(&to_msg);
+  auto& from = static_cast<const ResumeRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.ResumeRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_token().empty()) {
+    _this->_internal_set_token(from._internal_token());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ResumeRequest::CopyFrom(const ResumeRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chat.ResumeRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ResumeRequest::IsInitialized() const {
+  return true;
+}
+
+void ResumeRequest::InternalSwap(ResumeRequest* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.token_, lhs_arena,
+      &other->_impl_.token_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ResumeRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_chat_2eproto_getter, &descriptor_table_chat_2eproto_once,
+      file_level_metadata_chat_2eproto[2]);
+}
+
+// ===================================================================
+
+class FileOffer::_Internal {
+ public:
+};
+
+FileOffer::FileOffer(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chat.FileOffer)
+}
+FileOffer::FileOffer(const FileOffer& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  FileOffer* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.recipient_){}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.recipient_id_){}
+    , decltype(_impl_.size_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.recipient_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.recipient_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_recipient().empty()) {
+    _this->_impl_.recipient_.Set(from._internal_recipient(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_name().empty()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.recipient_id_, &from._impl_.recipient_id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.size_) -
+    reinterpret_cast<char*>(&_impl_.recipient_id_)) + sizeof(_impl_.size_));
+  // @@protoc_insertion_point(copy_constructor:chat.FileOffer)
+}
+
+inline void FileOffer::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.recipient_){}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.recipient_id_){uint64_t{0u}}
+    , decltype(_impl_.size_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.recipient_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.recipient_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+FileOffer::~FileOffer() {
+  // @@protoc_insertion_point(destructor:chat.FileOffer)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void FileOffer::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.recipient_.Destroy();
+  _impl_.name_.Destroy();
+}
+
+void FileOffer::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void FileOffer::Clear() {
+// @@protoc_insertion_point(message_clear_start:chat.FileOffer)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.recipient_.ClearToEmpty();
+  _impl_.name_.ClearToEmpty();
+  ::memset(&_impl_.recipient_id_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.size_) -
+      reinterpret_cast<char*>(&_impl_.recipient_id_)) + sizeof(_impl_.size_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* FileOffer::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string recipient = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_recipient();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "chat.FileOffer.recipient"));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 recipient_id = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.recipient_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string name = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "chat.FileOffer.name"));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 size = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* FileOffer::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chat.FileOffer)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string recipient = 1;
+  if (!this->_internal_recipient().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_recipient().data(), static_cast<int>(this->_internal_recipient().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "chat.FileOffer.recipient");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_recipient(), target);
+  }
+
+  // uint64 recipient_id = 2;
+  if (this->_internal_recipient_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_recipient_id(), target);
+  }
+
+  // string name = 3;
+  if (!this->_internal_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "chat.FileOffer.name");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_name(), target);
+  }
+
+  // uint64 size = 4;
+  if (this->_internal_size() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_size(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chat.FileOffer)
+  return target;
+}
+
+size_t FileOffer::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chat.FileOffer)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string recipient = 1;
+  if (!this->_internal_recipient().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_recipient());
+  }
+
+  // string name = 3;
+  if (!this->_internal_name().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
+  }
+
+  // uint64 recipient_id = 2;
+  if (this->_internal_recipient_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_recipient_id());
+  }
+
+  // uint64 size = 4;
+  if (this->_internal_size() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_size());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData FileOffer::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    FileOffer::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*FileOffer::GetClassData() const { return &_class_data_; }
+
+
+void FileOffer::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<FileOffer*>(&to_msg);
+  auto& from = static_cast<const FileOffer&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.FileOffer)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_recipient().empty()) {
+    _this->_internal_set_recipient(from._internal_recipient());
+  }
+  if (!from._internal_name().empty()) {
+    _this->_internal_set_name(from._internal_name());
+  }
+  if (from._internal_recipient_id() != 0) {
+    _this->_internal_set_recipient_id(from._internal_recipient_id());
+  }
+  if (from._internal_size() != 0) {
+    _this->_internal_set_size(from._internal_size());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void FileOffer::CopyFrom(const FileOffer& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chat.FileOffer)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool FileOffer::IsInitialized() const {
+  return true;
+}
+
+void FileOffer::InternalSwap(FileOffer* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.recipient_, lhs_arena,
+      &other->_impl_.recipient_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(FileOffer, _impl_.size_)
+      + sizeof(FileOffer::_impl_.size_)
+      - PROTOBUF_FIELD_OFFSET(FileOffer, _impl_.recipient_id_)>(
+          reinterpret_cast<char*>(&_impl_.recipient_id_),
+          reinterpret_cast<char*>(&other->_impl_.recipient_id_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata FileOffer::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_chat_2eproto_getter, &descriptor_table_chat_2eproto_once,
+      file_level_metadata_chat_2eproto[3]);
+}
+
+// ===================================================================
+
+class FileWindow::_Internal {
+ public:
+};
+
+FileWindow::FileWindow(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chat.FileWindow)
+}
+FileWindow::FileWindow(const FileWindow& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  FileWindow* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.transfer_id_){}
+    , decltype(_impl_.bytes_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.transfer_id_, &from._impl_.transfer_id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.bytes_) -
+    reinterpret_cast<char*>(&_impl_.transfer_id_)) + sizeof(_impl_.bytes_));
+  // @@protoc_insertion_point(copy_constructor:chat.FileWindow)
+}
+
+inline void FileWindow::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.transfer_id_){uint64_t{0u}}
+    , decltype(_impl_.bytes_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+FileWindow::~FileWindow() {
+  // @@protoc_insertion_point(destructor:chat.FileWindow)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void FileWindow::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void FileWindow::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void FileWindow::Clear() {
+// @@protoc_insertion_point(message_clear_start:chat.FileWindow)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.transfer_id_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.bytes_) -
+      reinterpret_cast<char*>(&_impl_.transfer_id_)) + sizeof(_impl_.bytes_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* FileWindow::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint64 transfer_id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.transfer_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 bytes = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.bytes_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* FileWindow::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chat.FileWindow)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint64 transfer_id = 1;
+  if (this->_internal_transfer_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_transfer_id(), target);
+  }
+
+  // uint64 bytes = 2;
+  if (this->_internal_bytes() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_bytes(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chat.FileWindow)
+  return target;
+}
+
+size_t FileWindow::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chat.FileWindow)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // uint64 transfer_id = 1;
+  if (this->_internal_transfer_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_transfer_id());
+  }
+
+  // uint64 bytes = 2;
+  if (this->_internal_bytes() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_bytes());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData FileWindow::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    FileWindow::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*FileWindow::GetClassData() const { return &_class_data_; }
+
+
+void FileWindow::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<FileWindow*>(&to_msg);
+  auto& from = static_cast<const FileWindow&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.FileWindow)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_transfer_id() != 0) {
+    _this->_internal_set_transfer_id(from._internal_transfer_id());
+  }
+  if (from._internal_bytes() != 0) {
+    _this->_internal_set_bytes(from._internal_bytes());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void FileWindow::CopyFrom(const FileWindow& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chat.FileWindow)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool FileWindow::IsInitialized() const {
+  return true;
+}
+
+void FileWindow::InternalSwap(FileWindow* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(FileWindow, _impl_.bytes_)
+      + sizeof(FileWindow::_impl_.bytes_)
+      - PROTOBUF_FIELD_OFFSET(FileWindow, _impl_.transfer_id_)>(
+          reinterpret_cast<char*>(&_impl_.transfer_id_),
+          reinterpret_cast<char*>(&other->_impl_.transfer_id_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata FileWindow::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_chat_2eproto_getter, &descriptor_table_chat_2eproto_once,
+      file_level_metadata_chat_2eproto[4]);
+}
+
+// ===================================================================
+
+class SendMessageRequest::_Internal {
+ public:
+};
+
+SendMessageRequest::SendMessageRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chat.SendMessageRequest)
+}
+SendMessageRequest::SendMessageRequest(const SendMessageRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SendMessageRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.recipient_){}
+    , decltype(_impl_.content_){}
+    , decltype(_impl_.room_){}
+    , decltype(_impl_.recipient_id_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.recipient_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.recipient_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_recipient().empty()) {
+    _this->_impl_.recipient_.Set(from._internal_recipient(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.content_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.content_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_content().empty()) {
+    _this->_impl_.content_.Set(from._internal_content(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.room_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.room_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_room().empty()) {
+    _this->_impl_.room_.Set(from._internal_room(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.recipient_id_ = from._impl_.recipient_id_;
+  // @@protoc_insertion_point(copy_constructor:chat.SendMessageRequest)
+}
+
+inline void SendMessageRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.recipient_){}
+    , decltype(_impl_.content_){}
+    , decltype(_impl_.room_){}
+    , decltype(_impl_.recipient_id_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.recipient_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.recipient_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.content_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.content_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.room_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.room_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+SendMessageRequest::~SendMessageRequest() {
+  // @@protoc_insertion_point(destructor:chat.SendMessageRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SendMessageRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.recipient_.Destroy();
+  _impl_.content_.Destroy();
+  _impl_.room_.Destroy();
+}
+
+void SendMessageRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SendMessageRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:chat.SendMessageRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.recipient_.ClearToEmpty();
+  _impl_.content_.ClearToEmpty();
+  _impl_.room_.ClearToEmpty();
+  _impl_.recipient_id_ = uint64_t{0u};
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SendMessageRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string recipient = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_recipient();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "chat.SendMessageRequest.recipient"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string content = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_content();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "chat.SendMessageRequest.content"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string room = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_room();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "chat.SendMessageRequest.room"));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 recipient_id = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.recipient_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SendMessageRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chat.SendMessageRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string recipient = 1;
+  if (!this->_internal_recipient().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_recipient().data(), static_cast<int>(this->_internal_recipient().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "chat.SendMessageRequest.recipient");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_recipient(), target);
+  }
+
+  // string content = 2;
+  if (!this->_internal_content().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_content().data(), static_cast<int>(this->_internal_content().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "chat.SendMessageRequest.content");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_content(), target);
+  }
+
+  // string room = 3;
+  if (!this->_internal_room().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_room().data(), static_cast<int>(this->_internal_room().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "chat.SendMessageRequest.room");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_room(), target);
+  }
+
+  // uint64 recipient_id = 4;
+  if (this->_internal_recipient_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_recipient_id(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chat.SendMessageRequest)
+  return target;
+}
+
+size_t SendMessageRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chat.SendMessageRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string recipient = 1;
+  if (!this->_internal_recipient().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_recipient());
+  }
+
+  // string content = 2;
+  if (!this->_internal_content().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_content());
+  }
+
+  // string room = 3;
+  if (!this->_internal_room().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_room());
+  }
+
+  // uint64 recipient_id = 4;
+  if (this->_internal_recipient_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_recipient_id());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SendMessageRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SendMessageRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SendMessageRequest::GetClassData() const { return &_class_data_; }
+
+
+void SendMessageRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SendMessageRequest*>(&to_msg);
+  auto& from = static_cast<const SendMessageRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.SendMessageRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_recipient().empty()) {
+    _this->_internal_set_recipient(from._internal_recipient());
+  }
+  if (!from._internal_content().empty()) {
+    _this->_internal_set_content(from._internal_content());
+  }
+  if (!from._internal_room().empty()) {
+    _this->_internal_set_room(from._internal_room());
+  }
+  if (from._internal_recipient_id() != 0) {
+    _this->_internal_set_recipient_id(from._internal_recipient_id());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SendMessageRequest::CopyFrom(const SendMessageRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chat.SendMessageRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SendMessageRequest::IsInitialized() const {
+  return true;
+}
+
+void SendMessageRequest::InternalSwap(SendMessageRequest* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.recipient_, lhs_arena,
+      &other->_impl_.recipient_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.content_, lhs_arena,
+      &other->_impl_.content_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.room_, lhs_arena,
+      &other->_impl_.room_, rhs_arena
+  );
+  swap(_impl_.recipient_id_, other->_impl_.recipient_id_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SendMessageRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_chat_2eproto_getter, &descriptor_table_chat_2eproto_once,
+      file_level_metadata_chat_2eproto[5]);
+}
+
+// ===================================================================
+
+class SendMessageBatchRequest::_Internal {
+ public:
+};
+
+SendMessageBatchRequest::SendMessageBatchRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chat.SendMessageBatchRequest)
+}
+SendMessageBatchRequest::SendMessageBatchRequest(const SendMessageBatchRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SendMessageBatchRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.messages_){from._impl_.messages_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:chat.SendMessageBatchRequest)
+}
+
+inline void SendMessageBatchRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.messages_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+SendMessageBatchRequest::~SendMessageBatchRequest() {
+  // @@protoc_insertion_point(destructor:chat.SendMessageBatchRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SendMessageBatchRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.messages_.~RepeatedPtrField();
+}
+
+void SendMessageBatchRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SendMessageBatchRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:chat.SendMessageBatchRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.messages_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SendMessageBatchRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .chat.SendMessageRequest messages = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_messages(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SendMessageBatchRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chat.SendMessageBatchRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .chat.SendMessageRequest messages = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_messages_size()); i < n; i++) {
+    const auto& repfield = this->_internal_messages(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chat.SendMessageBatchRequest)
+  return target;
+}
+
+size_t SendMessageBatchRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chat.SendMessageBatchRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .chat.SendMessageRequest messages = 1;
+  total_size += 1UL * this->_internal_messages_size();
+  for (const auto& msg : this->_impl_.messages_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SendMessageBatchRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SendMessageBatchRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SendMessageBatchRequest::GetClassData() const { return &_class_data_; }
+
+
+void SendMessageBatchRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SendMessageBatchRequest*>(&to_msg);
+  auto& from = static_cast<const SendMessageBatchRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.SendMessageBatchRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.messages_.MergeFrom(from._impl_.messages_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SendMessageBatchRequest::CopyFrom(const SendMessageBatchRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chat.SendMessageBatchRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SendMessageBatchRequest::IsInitialized() const {
+  return true;
+}
+
+void SendMessageBatchRequest::InternalSwap(SendMessageBatchRequest* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.messages_.InternalSwap(&other->_impl_.messages_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SendMessageBatchRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_chat_2eproto_getter, &descriptor_table_chat_2eproto_once,
+      file_level_metadata_chat_2eproto[6]);
+}
+
+// ===================================================================
+
+class IncomingMessageResponse::_Internal {
+ public:
+};
+
+IncomingMessageResponse::IncomingMessageResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chat.IncomingMessageResponse)
+}
+IncomingMessageResponse::IncomingMessageResponse(const IncomingMessageResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  IncomingMessageResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.sender_){}
+    , decltype(_impl_.content_){}
+    , decltype(_impl_.room_){}
+    , decltype(_impl_.sender_id_){}
+    , decltype(_impl_.type_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.sender_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.sender_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_sender().empty()) {
+    _this->_impl_.sender_.Set(from._internal_sender(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.content_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.content_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_content().empty()) {
+    _this->_impl_.content_.Set(from._internal_content(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.room_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.room_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_room().empty()) {
+    _this->_impl_.room_.Set(from._internal_room(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.sender_id_, &from._impl_.sender_id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.type_) -
+    reinterpret_cast<char*>(&_impl_.sender_id_)) + sizeof(_impl_.type_));
+  // @@protoc_insertion_point(copy_constructor:chat.IncomingMessageResponse)
+}
+
+inline void IncomingMessageResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.sender_){}
+    , decltype(_impl_.content_){}
+    , decltype(_impl_.room_){}
+    , decltype(_impl_.sender_id_){uint64_t{0u}}
+    , decltype(_impl_.type_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.sender_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.sender_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.content_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.content_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.room_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.room_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+IncomingMessageResponse::~IncomingMessageResponse() {
+  // @@protoc_insertion_point(destructor:chat.IncomingMessageResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void IncomingMessageResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.sender_.Destroy();
+  _impl_.content_.Destroy();
+  _impl_.room_.Destroy();
+}
+
+void IncomingMessageResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void IncomingMessageResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:chat.IncomingMessageResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.sender_.ClearToEmpty();
+  _impl_.content_.ClearToEmpty();
+  _impl_.room_.ClearToEmpty();
+  ::memset(&_impl_.sender_id_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.type_) -
+      reinterpret_cast<char*>(&_impl_.sender_id_)) + sizeof(_impl_.type_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* IncomingMessageResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string sender = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_sender();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "chat.IncomingMessageResponse.sender"));
+        } else
+          goto handle_unusual;
+        continue;
+      // string content = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_content();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "chat.IncomingMessageResponse.content"));
+        } else
+          goto handle_unusual;
+        continue;
+      // .chat.MessageType type = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_type(static_cast<::chat::MessageType>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // string room = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_room();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "chat.IncomingMessageResponse.room"));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 sender_id = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.sender_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* IncomingMessageResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chat.IncomingMessageResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string sender = 1;
+  if (!this->_internal_sender().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_sender().data(), static_cast<int>(this->_internal_sender().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "chat.IncomingMessageResponse.sender");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_sender(), target);
+  }
+
+  // string content = 2;
+  if (!this->_internal_content().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_content().data(), static_cast<int>(this->_internal_content().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "chat.IncomingMessageResponse.content");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_content(), target);
+  }
+
+  // .chat.MessageType type = 3;
+  if (this->_internal_type() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      3, this->_internal_type(), target);
+  }
+
+  // string room = 4;
+  if (!this->_internal_room().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_room().data(), static_cast<int>(this->_internal_room().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "chat.IncomingMessageResponse.room");
+    target = stream->WriteStringMaybeAliased(
+        4, this->_internal_room(), target);
+  }
+
+  // uint64 sender_id = 5;
+  if (this->_internal_sender_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(5, this->_internal_sender_id(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chat.IncomingMessageResponse)
+  return target;
+}
+
+size_t IncomingMessageResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chat.IncomingMessageResponse)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string sender = 1;
+  if (!this->_internal_sender().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_sender());
+  }
+
+  // string content = 2;
+  if (!this->_internal_content().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_content());
+  }
+
+  // string room = 4;
+  if (!this->_internal_room().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_room());
+  }
+
+  // uint64 sender_id = 5;
+  if (this->_internal_sender_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_sender_id());
+  }
+
+  // .chat.MessageType type = 3;
+  if (this->_internal_type() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_type());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData IncomingMessageResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    IncomingMessageResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*IncomingMessageResponse::GetClassData() const { return &_class_data_; }
+
+
+void IncomingMessageResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<IncomingMessageResponse*>(&to_msg);
+  auto& from = static_cast<const IncomingMessageResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.IncomingMessageResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_sender().empty()) {
+    _this->_internal_set_sender(from._internal_sender());
+  }
+  if (!from._internal_content().empty()) {
+    _this->_internal_set_content(from._internal_content());
+  }
+  if (!from._internal_room().empty()) {
+    _this->_internal_set_room(from._internal_room());
+  }
+  if (from._internal_sender_id() != 0) {
+    _this->_internal_set_sender_id(from._internal_sender_id());
+  }
+  if (from._internal_type() != 0) {
+    _this->_internal_set_type(from._internal_type());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void IncomingMessageResponse::CopyFrom(const IncomingMessageResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chat.IncomingMessageResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool IncomingMessageResponse::IsInitialized() const {
+  return true;
+}
+
+void IncomingMessageResponse::InternalSwap(IncomingMessageResponse* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.sender_, lhs_arena,
+      &other->_impl_.sender_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.content_, lhs_arena,
+      &other->_impl_.content_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.room_, lhs_arena,
+      &other->_impl_.room_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(IncomingMessageResponse, _impl_.type_)
+      + sizeof(IncomingMessageResponse::_impl_.type_)
+      - PROTOBUF_FIELD_OFFSET(IncomingMessageResponse, _impl_.sender_id_)>(
+          reinterpret_cast<char*>(&_impl_.sender_id_),
+          reinterpret_cast<char*>(&other->_impl_.sender_id_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata IncomingMessageResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_chat_2eproto_getter, &descriptor_table_chat_2eproto_once,
+      file_level_metadata_chat_2eproto[7]);
+}
+
+// ===================================================================
+
+class RoomRequest::_Internal {
+ public:
+};
+
+RoomRequest::RoomRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chat.RoomRequest)
+}
+RoomRequest::RoomRequest(const RoomRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  RoomRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.room_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.room_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.room_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_room().empty()) {
+    _this->_impl_.room_.Set(from._internal_room(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:chat.RoomRequest)
+}
+
+inline void RoomRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.room_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.room_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.room_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+RoomRequest::~RoomRequest() {
+  // @@protoc_insertion_point(destructor:chat.RoomRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void RoomRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.room_.Destroy();
+}
+
+void RoomRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void RoomRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:chat.RoomRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.room_.ClearToEmpty();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* RoomRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string room = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_room();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "chat.RoomRequest.room"));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* RoomRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chat.RoomRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string room = 1;
+  if (!this->_internal_room().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_room().data(), static_cast<int>(this->_internal_room().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "chat.RoomRequest.room");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_room(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chat.RoomRequest)
+  return target;
+}
+
+size_t RoomRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chat.RoomRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string room = 1;
+  if (!this->_internal_room().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_room());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData RoomRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    RoomRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*RoomRequest::GetClassData() const { return &_class_data_; }
+
+
+void RoomRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<RoomRequest*>(&to_msg);
+  auto& from = static_cast<const RoomRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.RoomRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_room().empty()) {
+    _this->_internal_set_room(from._internal_room());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void RoomRequest::CopyFrom(const RoomRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chat.RoomRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool RoomRequest::IsInitialized() const {
+  return true;
+}
+
+void RoomRequest::InternalSwap(RoomRequest* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.room_, lhs_arena,
+      &other->_impl_.room_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata RoomRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_chat_2eproto_getter, &descriptor_table_chat_2eproto_once,
+      file_level_metadata_chat_2eproto[8]);
+}
+
+// ===================================================================
+
+class RoomResponse::_Internal {
+ public:
+};
+
+RoomResponse::RoomResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chat.RoomResponse)
+}
+RoomResponse::RoomResponse(const RoomResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  RoomResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.room_){}
+    , decltype(_impl_.members_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.room_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.room_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_room().empty()) {
+    _this->_impl_.room_.Set(from._internal_room(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.members_ = from._impl_.members_;
+  // @@protoc_insertion_point(copy_constructor:chat.RoomResponse)
+}
+
+inline void RoomResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.room_){}
+    , decltype(_impl_.members_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.room_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.room_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+RoomResponse::~RoomResponse() {
+  // @@protoc_insertion_point(destructor:chat.RoomResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void RoomResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.room_.Destroy();
+}
+
+void RoomResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void RoomResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:chat.RoomResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.room_.ClearToEmpty();
+  _impl_.members_ = 0u;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* RoomResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string room = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_room();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "chat.RoomResponse.room"));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 members = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.members_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* RoomResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chat.RoomResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string room = 1;
+  if (!this->_internal_room().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_room().data(), static_cast<int>(this->_internal_room().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "chat.RoomResponse.room");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_room(), target);
+  }
+
+  // uint32 members = 2;
+  if (this->_internal_members() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_members(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chat.RoomResponse)
+  return target;
+}
+
+size_t RoomResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chat.RoomResponse)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string room = 1;
+  if (!this->_internal_room().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_room());
+  }
+
+  // uint32 members = 2;
+  if (this->_internal_members() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_members());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData RoomResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    RoomResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*RoomResponse::GetClassData() const { return &_class_data_; }
+
+
+void RoomResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<RoomResponse*>(&to_msg);
+  auto& from = static_cast<const RoomResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.RoomResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_room().empty()) {
+    _this->_internal_set_room(from._internal_room());
+  }
+  if (from._internal_members() != 0) {
+    _this->_internal_set_members(from._internal_members());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void RoomResponse::CopyFrom(const RoomResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chat.RoomResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool RoomResponse::IsInitialized() const {
+  return true;
+}
+
+void RoomResponse::InternalSwap(RoomResponse* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.room_, lhs_arena,
+      &other->_impl_.room_, rhs_arena
+  );
+  swap(_impl_.members_, other->_impl_.members_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata RoomResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_chat_2eproto_getter, &descriptor_table_chat_2eproto_once,
+      file_level_metadata_chat_2eproto[9]);
+}
+
+// ===================================================================
+
+class SendMessageBatchResponse::_Internal {
+ public:
+};
+
+SendMessageBatchResponse::SendMessageBatchResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chat.SendMessageBatchResponse)
+}
+SendMessageBatchResponse::SendMessageBatchResponse(const SendMessageBatchResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  SendMessageBatchResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.results_){from._impl_.results_}
+    , /*decltype(_impl_._results_cached_byte_size_)*/{0}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:chat.SendMessageBatchResponse)
+}
+
+inline void SendMessageBatchResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.results_){arena}
+    , /*decltype(_impl_._results_cached_byte_size_)*/{0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+SendMessageBatchResponse::~SendMessageBatchResponse() {
+  // @@protoc_insertion_point(destructor:chat.SendMessageBatchResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void SendMessageBatchResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.results_.~RepeatedField();
+}
+
+void SendMessageBatchResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void SendMessageBatchResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:chat.SendMessageBatchResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.results_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SendMessageBatchResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .chat.StatusCode results = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedEnumParser(_internal_mutable_results(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 8) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_add_results(static_cast<::chat::StatusCode>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* SendMessageBatchResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chat.SendMessageBatchResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .chat.StatusCode results = 1;
+  {
+    int byte_size = _impl_._results_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteEnumPacked(
+          1, _impl_.results_, byte_size, target);
+    }
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chat.SendMessageBatchResponse)
+  return target;
+}
+
+size_t SendMessageBatchResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chat.SendMessageBatchResponse)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .chat.StatusCode results = 1;
+  {
+    size_t data_size = 0;
+    unsigned int count = static_cast<unsigned int>(this->_internal_results_size());for (unsigned int i = 0; i < count; i++) {
+      data_size += ::_pbi::WireFormatLite::EnumSize(
+        this->_internal_results(static_cast<int>(i)));
+    }
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._results_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData SendMessageBatchResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    SendMessageBatchResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*SendMessageBatchResponse::GetClassData() const { return &_class_data_; }
+
+
+void SendMessageBatchResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<SendMessageBatchResponse*>(&to_msg);
+  auto& from = static_cast<const SendMessageBatchResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.SendMessageBatchResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.results_.MergeFrom(from._impl_.results_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void SendMessageBatchResponse::CopyFrom(const SendMessageBatchResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chat.SendMessageBatchResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SendMessageBatchResponse::IsInitialized() const {
+  return true;
+}
+
+void SendMessageBatchResponse::InternalSwap(SendMessageBatchResponse* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.results_.InternalSwap(&other->_impl_.results_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SendMessageBatchResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_chat_2eproto_getter, &descriptor_table_chat_2eproto_once,
+      file_level_metadata_chat_2eproto[10]);
+}
+
+// ===================================================================
+
+class UserListRequest::_Internal {
+ public:
+};
+
+UserListRequest::UserListRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chat.UserListRequest)
+}
+UserListRequest::UserListRequest(const UserListRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  UserListRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.username_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.username_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.username_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_username().empty()) {
+    _this->_impl_.username_.Set(from._internal_username(), 
+      _this->GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(copy_constructor:chat.UserListRequest)
+}
+
+inline void UserListRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.username_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.username_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.username_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+UserListRequest::~UserListRequest() {
+  // @@protoc_insertion_point(destructor:chat.UserListRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void UserListRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.username_.Destroy();
+}
+
+void UserListRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void UserListRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:chat.UserListRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.username_.ClearToEmpty();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* UserListRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string username = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_username();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "chat.UserListRequest.username"));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* UserListRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chat.UserListRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string username = 1;
+  if (!this->_internal_username().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_username().data(), static_cast<int>(this->_internal_username().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "chat.UserListRequest.username");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_username(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chat.UserListRequest)
+  return target;
+}
+
+size_t UserListRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chat.UserListRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string username = 1;
+  if (!this->_internal_username().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_username());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData UserListRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    UserListRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*UserListRequest::GetClassData() const { return &_class_data_; }
+
+
+void UserListRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<UserListRequest*>(&to_msg);
+  auto& from = static_cast<const UserListRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.UserListRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_username().empty()) {
+    _this->_internal_set_username(from._internal_username());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void UserListRequest::CopyFrom(const UserListRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chat.UserListRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool UserListRequest::IsInitialized() const {
+  return true;
+}
+
+void UserListRequest::InternalSwap(UserListRequest* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.username_, lhs_arena,
+      &other->_impl_.username_, rhs_arena
+  );
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata UserListRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_chat_2eproto_getter, &descriptor_table_chat_2eproto_once,
+      file_level_metadata_chat_2eproto[11]);
+}
+
+// ===================================================================
+
+class UserListResponse::_Internal {
+ public:
+};
+
+UserListResponse::UserListResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chat.UserListResponse)
+}
+UserListResponse::UserListResponse(const UserListResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  UserListResponse* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.users_){from._impl_.users_}
+    , decltype(_impl_.type_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.type_ = from._impl_.type_;
+  // @@protoc_insertion_point(copy_constructor:chat.UserListResponse)
+}
+
+inline void UserListResponse::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.users_){arena}
+    , decltype(_impl_.type_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+UserListResponse::~UserListResponse() {
+  // @@protoc_insertion_point(destructor:chat.UserListResponse)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void UserListResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.users_.~RepeatedPtrField();
+}
+
+void UserListResponse::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void UserListResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:chat.UserListResponse)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.users_.Clear();
+  _impl_.type_ = 0;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* UserListResponse::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .chat.User users = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_users(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // .chat.UserListType type = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_type(static_cast<::chat::UserListType>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* UserListResponse::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chat.UserListResponse)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .chat.User users = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_users_size()); i < n; i++) {
+    const auto& repfield = this->_internal_users(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // .chat.UserListType type = 2;
+  if (this->_internal_type() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      2, this->_internal_type(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chat.UserListResponse)
+  return target;
+}
+
+size_t UserListResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chat.UserListResponse)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .chat.User users = 1;
+  total_size += 1UL * this->_internal_users_size();
+  for (const auto& msg : this->_impl_.users_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // .chat.UserListType type = 2;
+  if (this->_internal_type() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_type());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData UserListResponse::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    UserListResponse::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*UserListResponse::GetClassData() const { return &_class_data_; }
+
+
+void UserListResponse::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<UserListResponse*>(&to_msg);
+  auto& from = static_cast<const UserListResponse&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.UserListResponse)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.users_.MergeFrom(from._impl_.users_);
+  if (from._internal_type() != 0) {
+    _this->_internal_set_type(from._internal_type());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void UserListResponse::CopyFrom(const UserListResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chat.UserListResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool UserListResponse::IsInitialized() const {
+  return true;
+}
+
+void UserListResponse::InternalSwap(UserListResponse* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.users_.InternalSwap(&other->_impl_.users_);
+  swap(_impl_.type_, other->_impl_.type_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata UserListResponse::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_chat_2eproto_getter, &descriptor_table_chat_2eproto_once,
+      file_level_metadata_chat_2eproto[12]);
+}
+
+// ===================================================================
+
+class PresenceEvent::_Internal {
+ public:
+};
+
+PresenceEvent::PresenceEvent(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chat.PresenceEvent)
+}
+PresenceEvent::PresenceEvent(const PresenceEvent& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PresenceEvent* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.username_){}
+    , decltype(_impl_.change_){}
+    , decltype(_impl_.status_){}
+    , decltype(_impl_.user_id_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.username_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.username_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_username().empty()) {
+    _this->_impl_.username_.Set(from._internal_username(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.change_, &from._impl_.change_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.user_id_) -
+    reinterpret_cast<char*>(&_impl_.change_)) + sizeof(_impl_.user_id_));
+  // @@protoc_insertion_point(copy_constructor:chat.PresenceEvent)
+}
+
+inline void PresenceEvent::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.username_){}
+    , decltype(_impl_.change_){0}
+    , decltype(_impl_.status_){0}
+    , decltype(_impl_.user_id_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.username_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.username_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+PresenceEvent::~PresenceEvent() {
+  // @@protoc_insertion_point(destructor:chat.PresenceEvent)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void PresenceEvent::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.username_.Destroy();
+}
+
+void PresenceEvent::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void PresenceEvent::Clear() {
+// @@protoc_insertion_point(message_clear_start:chat.PresenceEvent)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.username_.ClearToEmpty();
+  ::memset(&_impl_.change_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.user_id_) -
+      reinterpret_cast<char*>(&_impl_.change_)) + sizeof(_impl_.user_id_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PresenceEvent::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string username = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_username();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "chat.PresenceEvent.username"));
+        } else
+          goto handle_unusual;
+        continue;
+      // .chat.PresenceChange change = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_change(static_cast<::chat::PresenceChange>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // .chat.UserStatus status = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_status(static_cast<::chat::UserStatus>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 user_id = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.user_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* PresenceEvent::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chat.PresenceEvent)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string username = 1;
+  if (!this->_internal_username().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_username().data(), static_cast<int>(this->_internal_username().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "chat.PresenceEvent.username");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_username(), target);
+  }
+
+  // .chat.PresenceChange change = 2;
+  if (this->_internal_change() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      2, this->_internal_change(), target);
+  }
+
+  // .chat.UserStatus status = 3;
+  if (this->_internal_status() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      3, this->_internal_status(), target);
+  }
+
+  // uint64 user_id = 4;
+  if (this->_internal_user_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_user_id(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chat.PresenceEvent)
+  return target;
+}
+
+size_t PresenceEvent::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chat.PresenceEvent)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string username = 1;
+  if (!this->_internal_username().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_username());
+  }
+
+  // .chat.PresenceChange change = 2;
+  if (this->_internal_change() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_change());
+  }
+
+  // .chat.UserStatus status = 3;
+  if (this->_internal_status() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_status());
+  }
+
+  // uint64 user_id = 4;
+  if (this->_internal_user_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_user_id());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PresenceEvent::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PresenceEvent::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PresenceEvent::GetClassData() const { return &_class_data_; }
+
+
+void PresenceEvent::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PresenceEvent*>(&to_msg);
+  auto& from = static_cast<const PresenceEvent&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.PresenceEvent)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_username().empty()) {
+    _this->_internal_set_username(from._internal_username());
+  }
+  if (from._internal_change() != 0) {
+    _this->_internal_set_change(from._internal_change());
+  }
+  if (from._internal_status() != 0) {
+    _this->_internal_set_status(from._internal_status());
+  }
+  if (from._internal_user_id() != 0) {
+    _this->_internal_set_user_id(from._internal_user_id());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void PresenceEvent::CopyFrom(const PresenceEvent& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chat.PresenceEvent)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PresenceEvent::IsInitialized() const {
+  return true;
+}
+
+void PresenceEvent::InternalSwap(PresenceEvent* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.username_, lhs_arena,
+      &other->_impl_.username_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(PresenceEvent, _impl_.user_id_)
+      + sizeof(PresenceEvent::_impl_.user_id_)
+      - PROTOBUF_FIELD_OFFSET(PresenceEvent, _impl_.change_)>(
+          reinterpret_cast<char*>(&_impl_.change_),
+          reinterpret_cast<char*>(&other->_impl_.change_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PresenceEvent::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_chat_2eproto_getter, &descriptor_table_chat_2eproto_once,
+      file_level_metadata_chat_2eproto[13]);
+}
+
+// ===================================================================
+
+class PresenceUpdate::_Internal {
+ public:
+};
+
+PresenceUpdate::PresenceUpdate(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chat.PresenceUpdate)
+}
+PresenceUpdate::PresenceUpdate(const PresenceUpdate& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  PresenceUpdate* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.users_){from._impl_.users_}
+    , decltype(_impl_.events_){from._impl_.events_}
+    , decltype(_impl_.version_){}
+    , decltype(_impl_.since_version_){}
+    , decltype(_impl_.snapshot_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.version_, &from._impl_.version_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.snapshot_) -
+    reinterpret_cast<char*>(&_impl_.version_)) + sizeof(_impl_.snapshot_));
+  // @@protoc_insertion_point(copy_constructor:chat.PresenceUpdate)
+}
+
+inline void PresenceUpdate::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.users_){arena}
+    , decltype(_impl_.events_){arena}
+    , decltype(_impl_.version_){uint64_t{0u}}
+    , decltype(_impl_.since_version_){uint64_t{0u}}
+    , decltype(_impl_.snapshot_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+PresenceUpdate::~PresenceUpdate() {
+  // @@protoc_insertion_point(destructor:chat.PresenceUpdate)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void PresenceUpdate::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.users_.~RepeatedPtrField();
+  _impl_.events_.~RepeatedPtrField();
+}
+
+void PresenceUpdate::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void PresenceUpdate::Clear() {
+// @@protoc_insertion_point(message_clear_start:chat.PresenceUpdate)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.users_.Clear();
+  _impl_.events_.Clear();
+  ::memset(&_impl_.version_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.snapshot_) -
+      reinterpret_cast<char*>(&_impl_.version_)) + sizeof(_impl_.snapshot_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* PresenceUpdate::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // bool snapshot = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.snapshot_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 version = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.version_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 since_version = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.since_version_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .chat.User users = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_users(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<34>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .chat.PresenceEvent events = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_events(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<42>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* PresenceUpdate::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chat.PresenceUpdate)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // bool snapshot = 1;
+  if (this->_internal_snapshot() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(1, this->_internal_snapshot(), target);
+  }
+
+  // uint64 version = 2;
+  if (this->_internal_version() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_version(), target);
+  }
+
+  // uint64 since_version = 3;
+  if (this->_internal_since_version() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_since_version(), target);
+  }
+
+  // repeated .chat.User users = 4;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_users_size()); i < n; i++) {
+    const auto& repfield = this->_internal_users(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(4, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated .chat.PresenceEvent events = 5;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_events_size()); i < n; i++) {
+    const auto& repfield = this->_internal_events(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(5, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chat.PresenceUpdate)
+  return target;
+}
+
+size_t PresenceUpdate::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chat.PresenceUpdate)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .chat.User users = 4;
+  total_size += 1UL * this->_internal_users_size();
+  for (const auto& msg : this->_impl_.users_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .chat.PresenceEvent events = 5;
+  total_size += 1UL * this->_internal_events_size();
+  for (const auto& msg : this->_impl_.events_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // uint64 version = 2;
+  if (this->_internal_version() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_version());
+  }
+
+  // uint64 since_version = 3;
+  if (this->_internal_since_version() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_since_version());
+  }
+
+  // bool snapshot = 1;
+  if (this->_internal_snapshot() != 0) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData PresenceUpdate::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    PresenceUpdate::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*PresenceUpdate::GetClassData() const { return &_class_data_; }
+
+
+void PresenceUpdate::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<PresenceUpdate*>(&to_msg);
+  auto& from = static_cast<const PresenceUpdate&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.PresenceUpdate)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.users_.MergeFrom(from._impl_.users_);
+  _this->_impl_.events_.MergeFrom(from._impl_.events_);
+  if (from._internal_version() != 0) {
+    _this->_internal_set_version(from._internal_version());
+  }
+  if (from._internal_since_version() != 0) {
+    _this->_internal_set_since_version(from._internal_since_version());
+  }
+  if (from._internal_snapshot() != 0) {
+    _this->_internal_set_snapshot(from._internal_snapshot());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void PresenceUpdate::CopyFrom(const PresenceUpdate& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chat.PresenceUpdate)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool PresenceUpdate::IsInitialized() const {
+  return true;
+}
+
+void PresenceUpdate::InternalSwap(PresenceUpdate* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.users_.InternalSwap(&other->_impl_.users_);
+  _impl_.events_.InternalSwap(&other->_impl_.events_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(PresenceUpdate, _impl_.snapshot_)
+      + sizeof(PresenceUpdate::_impl_.snapshot_)
+      - PROTOBUF_FIELD_OFFSET(PresenceUpdate, _impl_.version_)>(
+          reinterpret_cast<char*>(&_impl_.version_),
+          reinterpret_cast<char*>(&other->_impl_.version_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata PresenceUpdate::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_chat_2eproto_getter, &descriptor_table_chat_2eproto_once,
+      file_level_metadata_chat_2eproto[14]);
+}
+
+// ===================================================================
+
+class FileTransfer::_Internal {
+ public:
+};
+
+FileTransfer::FileTransfer(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chat.FileTransfer)
+}
+FileTransfer::FileTransfer(const FileTransfer& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  FileTransfer* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.sender_){}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.transfer_id_){}
+    , decltype(_impl_.sender_id_){}
+    , decltype(_impl_.size_){}
+    , decltype(_impl_.window_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.sender_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.sender_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_sender().empty()) {
+    _this->_impl_.sender_.Set(from._internal_sender(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_name().empty()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.transfer_id_, &from._impl_.transfer_id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.window_) -
+    reinterpret_cast<char*>(&_impl_.transfer_id_)) + sizeof(_impl_.window_));
+  // @@protoc_insertion_point(copy_constructor:chat.FileTransfer)
+}
+
+inline void FileTransfer::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.sender_){}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.transfer_id_){uint64_t{0u}}
+    , decltype(_impl_.sender_id_){uint64_t{0u}}
+    , decltype(_impl_.size_){uint64_t{0u}}
+    , decltype(_impl_.window_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.sender_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.sender_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+FileTransfer::~FileTransfer() {
+  // @@protoc_insertion_point(destructor:chat.FileTransfer)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void FileTransfer::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.sender_.Destroy();
+  _impl_.name_.Destroy();
+}
+
+void FileTransfer::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void FileTransfer::Clear() {
+// @@protoc_insertion_point(message_clear_start:chat.FileTransfer)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.sender_.ClearToEmpty();
+  _impl_.name_.ClearToEmpty();
+  ::memset(&_impl_.transfer_id_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.window_) -
+      reinterpret_cast<char*>(&_impl_.transfer_id_)) + sizeof(_impl_.window_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* FileTransfer::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint64 transfer_id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.transfer_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string sender = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          auto str = _internal_mutable_sender();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "chat.FileTransfer.sender"));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 sender_id = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.sender_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string name = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "chat.FileTransfer.name"));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 size = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 window = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.window_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* FileTransfer::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chat.FileTransfer)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint64 transfer_id = 1;
+  if (this->_internal_transfer_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_transfer_id(), target);
+  }
+
+  // string sender = 2;
+  if (!this->_internal_sender().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_sender().data(), static_cast<int>(this->_internal_sender().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "chat.FileTransfer.sender");
+    target = stream->WriteStringMaybeAliased(
+        2, this->_internal_sender(), target);
+  }
+
+  // uint64 sender_id = 3;
+  if (this->_internal_sender_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_sender_id(), target);
+  }
+
+  // string name = 4;
+  if (!this->_internal_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "chat.FileTransfer.name");
+    target = stream->WriteStringMaybeAliased(
+        4, this->_internal_name(), target);
+  }
+
+  // uint64 size = 5;
+  if (this->_internal_size() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(5, this->_internal_size(), target);
+  }
+
+  // uint64 window = 6;
+  if (this->_internal_window() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(6, this->_internal_window(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chat.FileTransfer)
+  return target;
+}
+
+size_t FileTransfer::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chat.FileTransfer)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string sender = 2;
+  if (!this->_internal_sender().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_sender());
+  }
+
+  // string name = 4;
+  if (!this->_internal_name().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
+  }
+
+  // uint64 transfer_id = 1;
+  if (this->_internal_transfer_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_transfer_id());
+  }
+
+  // uint64 sender_id = 3;
+  if (this->_internal_sender_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_sender_id());
+  }
+
+  // uint64 size = 5;
+  if (this->_internal_size() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_size());
+  }
+
+  // uint64 window = 6;
+  if (this->_internal_window() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_window());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData FileTransfer::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    FileTransfer::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*FileTransfer::GetClassData() const { return &_class_data_; }
+
+
+void FileTransfer::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<FileTransfer*>(&to_msg);
+  auto& from = static_cast<const FileTransfer&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.FileTransfer)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_sender().empty()) {
+    _this->_internal_set_sender(from._internal_sender());
+  }
+  if (!from._internal_name().empty()) {
+    _this->_internal_set_name(from._internal_name());
+  }
+  if (from._internal_transfer_id() != 0) {
+    _this->_internal_set_transfer_id(from._internal_transfer_id());
+  }
+  if (from._internal_sender_id() != 0) {
+    _this->_internal_set_sender_id(from._internal_sender_id());
+  }
+  if (from._internal_size() != 0) {
+    _this->_internal_set_size(from._internal_size());
+  }
+  if (from._internal_window() != 0) {
+    _this->_internal_set_window(from._internal_window());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void FileTransfer::CopyFrom(const FileTransfer& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chat.FileTransfer)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool FileTransfer::IsInitialized() const {
+  return true;
+}
+
+void FileTransfer::InternalSwap(FileTransfer* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.sender_, lhs_arena,
+      &other->_impl_.sender_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(FileTransfer, _impl_.window_)
+      + sizeof(FileTransfer::_impl_.window_)
+      - PROTOBUF_FIELD_OFFSET(FileTransfer, _impl_.transfer_id_)>(
+          reinterpret_cast<char*>(&_impl_.transfer_id_),
+          reinterpret_cast<char*>(&other->_impl_.transfer_id_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata FileTransfer::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_chat_2eproto_getter, &descriptor_table_chat_2eproto_once,
+      file_level_metadata_chat_2eproto[15]);
+}
+
+// ===================================================================
+
+class UpdateStatusRequest::_Internal {
+ public:
+};
+
+UpdateStatusRequest::UpdateStatusRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chat.UpdateStatusRequest)
+}
+UpdateStatusRequest::UpdateStatusRequest(const UpdateStatusRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  UpdateStatusRequest* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.username_){}
+    , decltype(_impl_.new_status_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.username_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.username_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_username().empty()) {
+    _this->_impl_.username_.Set(from._internal_username(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.new_status_ = from._impl_.new_status_;
+  // @@protoc_insertion_point(copy_constructor:chat.UpdateStatusRequest)
+}
+
+inline void UpdateStatusRequest::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.username_){}
+    , decltype(_impl_.new_status_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.username_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.username_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+UpdateStatusRequest::~UpdateStatusRequest() {
+  // @@protoc_insertion_point(destructor:chat.UpdateStatusRequest)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void UpdateStatusRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.username_.Destroy();
+}
+
+void UpdateStatusRequest::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void UpdateStatusRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:chat.UpdateStatusRequest)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.username_.ClearToEmpty();
+  _impl_.new_status_ = 0;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* UpdateStatusRequest::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string username = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_username();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "chat.UpdateStatusRequest.username"));
+        } else
+          goto handle_unusual;
+        continue;
+      // .chat.UserStatus new_status = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_new_status(static_cast<::chat::UserStatus>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* UpdateStatusRequest::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chat.UpdateStatusRequest)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string username = 1;
+  if (!this->_internal_username().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_username().data(), static_cast<int>(this->_internal_username().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "chat.UpdateStatusRequest.username");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_username(), target);
+  }
+
+  // .chat.UserStatus new_status = 2;
+  if (this->_internal_new_status() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      2, this->_internal_new_status(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chat.UpdateStatusRequest)
+  return target;
+}
+
+size_t UpdateStatusRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chat.UpdateStatusRequest)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string username = 1;
+  if (!this->_internal_username().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_username());
+  }
+
+  // .chat.UserStatus new_status = 2;
+  if (this->_internal_new_status() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_new_status());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData UpdateStatusRequest::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    UpdateStatusRequest::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*UpdateStatusRequest::GetClassData() const { return &_class_data_; }
+
+
+void UpdateStatusRequest::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<UpdateStatusRequest*>(&to_msg);
+  auto& from = static_cast<const UpdateStatusRequest&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.UpdateStatusRequest)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_username().empty()) {
+    _this->_internal_set_username(from._internal_username());
+  }
+  if (from._internal_new_status() != 0) {
+    _this->_internal_set_new_status(from._internal_new_status());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void UpdateStatusRequest::CopyFrom(const UpdateStatusRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chat.UpdateStatusRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool UpdateStatusRequest::IsInitialized() const {
+  return true;
+}
+
+void UpdateStatusRequest::InternalSwap(UpdateStatusRequest* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.username_, lhs_arena,
+      &other->_impl_.username_, rhs_arena
+  );
+  swap(_impl_.new_status_, other->_impl_.new_status_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata UpdateStatusRequest::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_chat_2eproto_getter, &descriptor_table_chat_2eproto_once,
+      file_level_metadata_chat_2eproto[16]);
+}
+
+// ===================================================================
+
+class Request::_Internal {
+ public:
+  static const ::chat::NewUserRequest& register_user(const Request* msg);
+  static const ::chat::SendMessageRequest& send_message(const Request* msg);
+  static const ::chat::UpdateStatusRequest& update_status(const Request* msg);
+  static const ::chat::UserListRequest& get_users(const Request* msg);
+  static const ::chat::User& unregister_user(const Request* msg);
+  static const ::chat::SendMessageBatchRequest& send_message_batch(const Request* msg);
+  static const ::chat::RoomRequest& join_room(const Request* msg);
+  static const ::chat::RoomRequest& leave_room(const Request* msg);
+  static const ::chat::ResumeRequest& resume(const Request* msg);
+  static const ::chat::FileOffer& file_offer(const Request* msg);
+  static const ::chat::FileWindow& file_window(const Request* msg);
+};
+
+const ::chat::NewUserRequest&
+Request::_Internal::register_user(const Request* msg) {
+  return *msg->_impl_.payload_.register_user_;
+}
+const ::chat::SendMessageRequest&
+Request::_Internal::send_message(const Request* msg) {
+  return *msg->_impl_.payload_.send_message_;
+}
+const ::chat::UpdateStatusRequest&
+Request::_Internal::update_status(const Request* msg) {
+  return *msg->_impl_.payload_.update_status_;
+}
+const ::chat::UserListRequest&
+Request::_Internal::get_users(const Request* msg) {
+  return *msg->_impl_.payload_.get_users_;
+}
+const ::chat::User&
+Request::_Internal::unregister_user(const Request* msg) {
+  return *msg->_impl_.payload_.unregister_user_;
+}
+const ::chat::SendMessageBatchRequest&
+Request::_Internal::send_message_batch(const Request* msg) {
+  return *msg->_impl_.payload_.send_message_batch_;
+}
+const ::chat::RoomRequest&
+Request::_Internal::join_room(const Request* msg) {
+  return *msg->_impl_.payload_.join_room_;
+}
+const ::chat::RoomRequest&
+Request::_Internal::leave_room(const Request* msg) {
+  return *msg->_impl_.payload_.leave_room_;
+}
+const ::chat::ResumeRequest&
+Request::_Internal::resume(const Request* msg) {
+  return *msg->_impl_.payload_.resume_;
+}
+const ::chat::FileOffer&
+Request::_Internal::file_offer(const Request* msg) {
+  return *msg->_impl_.payload_.file_offer_;
+}
+const ::chat::FileWindow&
+Request::_Internal::file_window(const Request* msg) {
+  return *msg->_impl_.payload_.file_window_;
+}
+void Request::set_allocated_register_user(::chat::NewUserRequest* register_user) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_payload();
+  if (register_user) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(register_user);
+    if (message_arena != submessage_arena) {
+      register_user = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, register_user, submessage_arena);
+    }
+    set_has_register_user();
+    _impl_.payload_.register_user_ = register_user;
+  }
+  // @@protoc_insertion_point(field_set_allocated:chat.Request.register_user)
+}
+void Request::set_allocated_send_message(::chat::SendMessageRequest* send_message) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_payload();
+  if (send_message) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(send_message);
+    if (message_arena != submessage_arena) {
+      send_message = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, send_message, submessage_arena);
+    }
+    set_has_send_message();
+    _impl_.payload_.send_message_ = send_message;
+  }
+  // @@protoc_insertion_point(field_set_allocated:chat.Request.send_message)
+}
+void Request::set_allocated_update_status(::chat::UpdateStatusRequest* update_status) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_payload();
+  if (update_status) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(update_status);
+    if (message_arena != submessage_arena) {
+      update_status = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, update_status, submessage_arena);
+    }
+    set_has_update_status();
+    _impl_.payload_.update_status_ = update_status;
+  }
+  // @@protoc_insertion_point(field_set_allocated:chat.Request.update_status)
+}
+void Request::set_allocated_get_users(::chat::UserListRequest* get_users) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_payload();
+  if (get_users) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(get_users);
+    if (message_arena != submessage_arena) {
+      get_users = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, get_users, submessage_arena);
+    }
+    set_has_get_users();
+    _impl_.payload_.get_users_ = get_users;
+  }
+  // @@protoc_insertion_point(field_set_allocated:chat.Request.get_users)
+}
+void Request::set_allocated_unregister_user(::chat::User* unregister_user) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_payload();
+  if (unregister_user) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(unregister_user);
+    if (message_arena != submessage_arena) {
+      unregister_user = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, unregister_user, submessage_arena);
+    }
+    set_has_unregister_user();
+    _impl_.payload_.unregister_user_ = unregister_user;
+  }
+  // @@protoc_insertion_point(field_set_allocated:chat.Request.unregister_user)
+}
+void Request::set_allocated_send_message_batch(::chat::SendMessageBatchRequest* send_message_batch) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_payload();
+  if (send_message_batch) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(send_message_batch);
+    if (message_arena != submessage_arena) {
+      send_message_batch = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, send_message_batch, submessage_arena);
+    }
+    set_has_send_message_batch();
+    _impl_.payload_.send_message_batch_ = send_message_batch;
+  }
+  // @@protoc_insertion_point(field_set_allocated:chat.Request.send_message_batch)
+}
+void Request::set_allocated_join_room(::chat::RoomRequest* join_room) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_payload();
+  if (join_room) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(join_room);
+    if (message_arena != submessage_arena) {
+      join_room = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, join_room, submessage_arena);
+    }
+    set_has_join_room();
+    _impl_.payload_.join_room_ = join_room;
+  }
+  // @@protoc_insertion_point(field_set_allocated:chat.Request.join_room)
+}
+void Request::set_allocated_leave_room(::chat::RoomRequest* leave_room) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_payload();
+  if (leave_room) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(leave_room);
+    if (message_arena != submessage_arena) {
+      leave_room = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, leave_room, submessage_arena);
+    }
+    set_has_leave_room();
+    _impl_.payload_.leave_room_ = leave_room;
+  }
+  // @@protoc_insertion_point(field_set_allocated:chat.Request.leave_room)
+}
+void Request::set_allocated_resume(::chat::ResumeRequest* resume) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_payload();
+  if (resume) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(resume);
+    if (message_arena != submessage_arena) {
+      resume = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, resume, submessage_arena);
+    }
+    set_has_resume();
+    _impl_.payload_.resume_ = resume;
+  }
+  // @@protoc_insertion_point(field_set_allocated:chat.Request.resume)
+}
+void Request::set_allocated_file_offer(::chat::FileOffer* file_offer) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_payload();
+  if (file_offer) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(file_offer);
+    if (message_arena != submessage_arena) {
+      file_offer = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, file_offer, submessage_arena);
+    }
+    set_has_file_offer();
+    _impl_.payload_.file_offer_ = file_offer;
+  }
+  // @@protoc_insertion_point(field_set_allocated:chat.Request.file_offer)
+}
+void Request::set_allocated_file_window(::chat::FileWindow* file_window) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_payload();
+  if (file_window) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(file_window);
+    if (message_arena != submessage_arena) {
+      file_window = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, file_window, submessage_arena);
+    }
+    set_has_file_window();
+    _impl_.payload_.file_window_ = file_window;
+  }
+  // @@protoc_insertion_point(field_set_allocated:chat.Request.file_window)
+}
+Request::Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chat.Request)
+}
+Request::Request(const Request& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Request* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.request_id_){}
+    , decltype(_impl_.operation_){}
+    , decltype(_impl_.payload_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.request_id_, &from._impl_.request_id_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.operation_) -
+    reinterpret_cast<char*>(&_impl_.request_id_)) + sizeof(_impl_.operation_));
+  clear_has_payload();
+  switch (from.payload_case()) {
+    case kRegisterUser: {
+      _this->_internal_mutable_register_user()->::chat::NewUserRequest::MergeFrom(
+          from._internal_register_user());
+      break;
+    }
+    case kSendMessage: {
+      _this->_internal_mutable_send_message()->::chat::SendMessageRequest::MergeFrom(
+          from._internal_send_message());
+      break;
+    }
+    case kUpdateStatus: {
+      _this->_internal_mutable_update_status()->::chat::UpdateStatusRequest::MergeFrom(
+          from._internal_update_status());
+      break;
+    }
+    case kGetUsers: {
+      _this->_internal_mutable_get_users()->::chat::UserListRequest::MergeFrom(
+          from._internal_get_users());
+      break;
+    }
+    case kUnregisterUser: {
+      _this->_internal_mutable_unregister_user()->::chat::User::MergeFrom(
+          from._internal_unregister_user());
+      break;
+    }
+    case kSendMessageBatch: {
+      _this->_internal_mutable_send_message_batch()->::chat::SendMessageBatchRequest::MergeFrom(
+          from._internal_send_message_batch());
+      break;
+    }
+    case kJoinRoom: {
+      _this->_internal_mutable_join_room()->::chat::RoomRequest::MergeFrom(
+          from._internal_join_room());
+      break;
+    }
+    case kLeaveRoom: {
+      _this->_internal_mutable_leave_room()->::chat::RoomRequest::MergeFrom(
+          from._internal_leave_room());
+      break;
+    }
+    case kResume: {
+      _this->_internal_mutable_resume()->::chat::ResumeRequest::MergeFrom(
+          from._internal_resume());
+      break;
+    }
+    case kFileOffer: {
+      _this->_internal_mutable_file_offer()->::chat::FileOffer::MergeFrom(
+          from._internal_file_offer());
+      break;
+    }
+    case kFileWindow: {
+      _this->_internal_mutable_file_window()->::chat::FileWindow::MergeFrom(
+          from._internal_file_window());
+      break;
+    }
+    case PAYLOAD_NOT_SET: {
+      break;
+    }
+  }
+  // @@protoc_insertion_point(copy_constructor:chat.Request)
+}
+
+inline void Request::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.request_id_){uint64_t{0u}}
+    , decltype(_impl_.operation_){0}
+    , decltype(_impl_.payload_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}
+  };
+  clear_has_payload();
+}
+
+Request::~Request() {
+  // @@protoc_insertion_point(destructor:chat.Request)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Request::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (has_payload()) {
+    clear_payload();
+  }
+}
+
+void Request::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Request::clear_payload() {
+// @@protoc_insertion_point(one_of_clear_start:chat.Request)
+  switch (payload_case()) {
+    case kRegisterUser: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.payload_.register_user_;
+      }
+      break;
+    }
+    case kSendMessage: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.payload_.send_message_;
+      }
+      break;
+    }
+    case kUpdateStatus: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.payload_.update_status_;
+      }
+      break;
+    }
+    case kGetUsers: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.payload_.get_users_;
+      }
+      break;
+    }
+    case kUnregisterUser: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.payload_.unregister_user_;
+      }
+      break;
+    }
+    case kSendMessageBatch: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.payload_.send_message_batch_;
+      }
+      break;
+    }
+    case kJoinRoom: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.payload_.join_room_;
+      }
+      break;
+    }
+    case kLeaveRoom: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.payload_.leave_room_;
+      }
+      break;
+    }
+    case kResume: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.payload_.resume_;
+      }
+      break;
+    }
+    case kFileOffer: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.payload_.file_offer_;
+      }
+      break;
+    }
+    case kFileWindow: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.payload_.file_window_;
+      }
+      break;
+    }
+    case PAYLOAD_NOT_SET: {
+      break;
+    }
+  }
+  _impl_._oneof_case_[0] = PAYLOAD_NOT_SET;
+}
+
+
+void Request::Clear() {
+// @@protoc_insertion_point(message_clear_start:chat.Request)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.request_id_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.operation_) -
+      reinterpret_cast<char*>(&_impl_.request_id_)) + sizeof(_impl_.operation_));
+  clear_payload();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Request::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .chat.Operation operation = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_operation(static_cast<::chat::Operation>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // .chat.NewUserRequest register_user = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_register_user(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .chat.SendMessageRequest send_message = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_send_message(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .chat.UpdateStatusRequest update_status = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_update_status(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .chat.UserListRequest get_users = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_get_users(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .chat.User unregister_user = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr = ctx->ParseMessage(_internal_mutable_unregister_user(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .chat.SendMessageBatchRequest send_message_batch = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr = ctx->ParseMessage(_internal_mutable_send_message_batch(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .chat.RoomRequest join_room = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          ptr = ctx->ParseMessage(_internal_mutable_join_room(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .chat.RoomRequest leave_room = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 74)) {
+          ptr = ctx->ParseMessage(_internal_mutable_leave_room(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 request_id = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 80)) {
+          _impl_.request_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .chat.ResumeRequest resume = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 90)) {
+          ptr = ctx->ParseMessage(_internal_mutable_resume(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .chat.FileOffer file_offer = 12;
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 98)) {
+          ptr = ctx->ParseMessage(_internal_mutable_file_offer(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .chat.FileWindow file_window = 13;
+      case 13:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 106)) {
+          ptr = ctx->ParseMessage(_internal_mutable_file_window(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Request::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chat.Request)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .chat.Operation operation = 1;
+  if (this->_internal_operation() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_operation(), target);
+  }
+
+  // .chat.NewUserRequest register_user = 2;
+  if (_internal_has_register_user()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::register_user(this),
+        _Internal::register_user(this).GetCachedSize(), target, stream);
+  }
+
+  // .chat.SendMessageRequest send_message = 3;
+  if (_internal_has_send_message()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::send_message(this),
+        _Internal::send_message(this).GetCachedSize(), target, stream);
+  }
+
+  // .chat.UpdateStatusRequest update_status = 4;
+  if (_internal_has_update_status()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(4, _Internal::update_status(this),
+        _Internal::update_status(this).GetCachedSize(), target, stream);
+  }
+
+  // .chat.UserListRequest get_users = 5;
+  if (_internal_has_get_users()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(5, _Internal::get_users(this),
+        _Internal::get_users(this).GetCachedSize(), target, stream);
+  }
+
+  // .chat.User unregister_user = 6;
+  if (_internal_has_unregister_user()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(6, _Internal::unregister_user(this),
+        _Internal::unregister_user(this).GetCachedSize(), target, stream);
+  }
+
+  // .chat.SendMessageBatchRequest send_message_batch = 7;
+  if (_internal_has_send_message_batch()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(7, _Internal::send_message_batch(this),
+        _Internal::send_message_batch(this).GetCachedSize(), target, stream);
+  }
+
+  // .chat.RoomRequest join_room = 8;
+  if (_internal_has_join_room()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(8, _Internal::join_room(this),
+        _Internal::join_room(this).GetCachedSize(), target, stream);
+  }
+
+  // .chat.RoomRequest leave_room = 9;
+  if (_internal_has_leave_room()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(9, _Internal::leave_room(this),
+        _Internal::leave_room(this).GetCachedSize(), target, stream);
+  }
+
+  // uint64 request_id = 10;
+  if (this->_internal_request_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(10, this->_internal_request_id(), target);
+  }
+
+  // .chat.ResumeRequest resume = 11;
+  if (_internal_has_resume()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(11, _Internal::resume(this),
+        _Internal::resume(this).GetCachedSize(), target, stream);
+  }
+
+  // .chat.FileOffer file_offer = 12;
+  if (_internal_has_file_offer()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(12, _Internal::file_offer(this),
+        _Internal::file_offer(this).GetCachedSize(), target, stream);
+  }
+
+  // .chat.FileWindow file_window = 13;
+  if (_internal_has_file_window()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(13, _Internal::file_window(this),
+        _Internal::file_window(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chat.Request)
+  return target;
+}
+
+size_t Request::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chat.Request)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // uint64 request_id = 10;
+  if (this->_internal_request_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_request_id());
+  }
+
+  // .chat.Operation operation = 1;
+  if (this->_internal_operation() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_operation());
+  }
+
+  switch (payload_case()) {
+    // .chat.NewUserRequest register_user = 2;
+    case kRegisterUser: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.payload_.register_user_);
+      break;
+    }
+    // .chat.SendMessageRequest send_message = 3;
+    case kSendMessage: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.payload_.send_message_);
+      break;
+    }
+    // .chat.UpdateStatusRequest update_status = 4;
+    case kUpdateStatus: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.payload_.update_status_);
+      break;
+    }
+    // .chat.UserListRequest get_users = 5;
+    case kGetUsers: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.payload_.get_users_);
+      break;
+    }
+    // .chat.User unregister_user = 6;
+    case kUnregisterUser: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.payload_.unregister_user_);
+      break;
+    }
+    // .chat.SendMessageBatchRequest send_message_batch = 7;
+    case kSendMessageBatch: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.payload_.send_message_batch_);
+      break;
+    }
+    // .chat.RoomRequest join_room = 8;
+    case kJoinRoom: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.payload_.join_room_);
+      break;
+    }
+    // .chat.RoomRequest leave_room = 9;
+    case kLeaveRoom: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.payload_.leave_room_);
+      break;
+    }
+    // .chat.ResumeRequest resume = 11;
+    case kResume: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.payload_.resume_);
+      break;
+    }
+    // .chat.FileOffer file_offer = 12;
+    case kFileOffer: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.payload_.file_offer_);
+      break;
+    }
+    // .chat.FileWindow file_window = 13;
+    case kFileWindow: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.payload_.file_window_);
+      break;
+    }
+    case PAYLOAD_NOT_SET: {
+      break;
+    }
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Request::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Request::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Request::GetClassData() const { return &_class_data_; }
+
+
+void Request::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Request*>(&to_msg);
+  auto& from = static_cast<const Request&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.Request)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_request_id() != 0) {
+    _this->_internal_set_request_id(from._internal_request_id());
+  }
+  if (from._internal_operation() != 0) {
+    _this->_internal_set_operation(from._internal_operation());
+  }
+  switch (from.payload_case()) {
+    case kRegisterUser: {
+      _this->_internal_mutable_register_user()->::chat::NewUserRequest::MergeFrom(
+          from._internal_register_user());
+      break;
+    }
+    case kSendMessage: {
+      _this->_internal_mutable_send_message()->::chat::SendMessageRequest::MergeFrom(
+          from._internal_send_message());
+      break;
+    }
+    case kUpdateStatus: {
+      _this->_internal_mutable_update_status()->::chat::UpdateStatusRequest::MergeFrom(
+          from._internal_update_status());
+      break;
+    }
+    case kGetUsers: {
+      _this->_internal_mutable_get_users()->::chat::UserListRequest::MergeFrom(
+          from._internal_get_users());
+      break;
+    }
+    case kUnregisterUser: {
+      _this->_internal_mutable_unregister_user()->::chat::User::MergeFrom(
+          from._internal_unregister_user());
+      break;
+    }
+    case kSendMessageBatch: {
+      _this->_internal_mutable_send_message_batch()->::chat::SendMessageBatchRequest::MergeFrom(
+          from._internal_send_message_batch());
+      break;
+    }
+    case kJoinRoom: {
+      _this->_internal_mutable_join_room()->::chat::RoomRequest::MergeFrom(
+          from._internal_join_room());
+      break;
+    }
+    case kLeaveRoom: {
+      _this->_internal_mutable_leave_room()->::chat::RoomRequest::MergeFrom(
+          from._internal_leave_room());
+      break;
+    }
+    case kResume: {
+      _this->_internal_mutable_resume()->::chat::ResumeRequest::MergeFrom(
+          from._internal_resume());
+      break;
+    }
+    case kFileOffer: {
+      _this->_internal_mutable_file_offer()->::chat::FileOffer::MergeFrom(
+          from._internal_file_offer());
+      break;
+    }
+    case kFileWindow: {
+      _this->_internal_mutable_file_window()->::chat::FileWindow::MergeFrom(
+          from._internal_file_window());
+      break;
+    }
+    case PAYLOAD_NOT_SET: {
+      break;
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Request::CopyFrom(const Request& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chat.Request)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Request::IsInitialized() const {
+  return true;
+}
+
+void Request::InternalSwap(Request* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Request, _impl_.operation_)
+      + sizeof(Request::_impl_.operation_)
+      - PROTOBUF_FIELD_OFFSET(Request, _impl_.request_id_)>(
+          reinterpret_cast<char*>(&_impl_.request_id_),
+          reinterpret_cast<char*>(&other->_impl_.request_id_));
+  swap(_impl_.payload_, other->_impl_.payload_);
+  swap(_impl_._oneof_case_[0], other->_impl_._oneof_case_[0]);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Request::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_chat_2eproto_getter, &descriptor_table_chat_2eproto_once,
+      file_level_metadata_chat_2eproto[17]);
+}
+
+// ===================================================================
+
+class Distribution::_Internal {
+ public:
+};
+
+Distribution::Distribution(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chat.Distribution)
+}
+Distribution::Distribution(const Distribution& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Distribution* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.count_){}
+    , decltype(_impl_.mean_){}
+    , decltype(_impl_.p50_){}
+    , decltype(_impl_.p90_){}
+    , decltype(_impl_.p99_){}
+    , decltype(_impl_.p999_){}
+    , decltype(_impl_.max_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.count_, &from._impl_.count_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.max_) -
+    reinterpret_cast<char*>(&_impl_.count_)) + sizeof(_impl_.max_));
+  // @@protoc_insertion_point(copy_constructor:chat.Distribution)
+}
+
+inline void Distribution::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.count_){uint64_t{0u}}
+    , decltype(_impl_.mean_){0}
+    , decltype(_impl_.p50_){uint64_t{0u}}
+    , decltype(_impl_.p90_){uint64_t{0u}}
+    , decltype(_impl_.p99_){uint64_t{0u}}
+    , decltype(_impl_.p999_){uint64_t{0u}}
+    , decltype(_impl_.max_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+Distribution::~Distribution() {
+  // @@protoc_insertion_point(destructor:chat.Distribution)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Distribution::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void Distribution::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Distribution::Clear() {
+// @@protoc_insertion_point(message_clear_start:chat.Distribution)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.count_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.max_) -
+      reinterpret_cast<char*>(&_impl_.count_)) + sizeof(_impl_.max_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Distribution::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint64 count = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // double mean = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 17)) {
+          _impl_.mean_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 p50 = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.p50_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 p90 = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.p90_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 p99 = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.p99_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 p999 = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.p999_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 max = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.max_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Distribution::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chat.Distribution)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint64 count = 1;
+  if (this->_internal_count() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_count(), target);
+  }
+
+  // double mean = 2;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_mean = this->_internal_mean();
+  uint64_t raw_mean;
+  memcpy(&raw_mean, &tmp_mean, sizeof(tmp_mean));
+  if (raw_mean != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(2, this->_internal_mean(), target);
+  }
+
+  // uint64 p50 = 3;
+  if (this->_internal_p50() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(3, this->_internal_p50(), target);
+  }
+
+  // uint64 p90 = 4;
+  if (this->_internal_p90() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_p90(), target);
+  }
+
+  // uint64 p99 = 5;
+  if (this->_internal_p99() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(5, this->_internal_p99(), target);
+  }
+
+  // uint64 p999 = 6;
+  if (this->_internal_p999() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(6, this->_internal_p999(), target);
+  }
+
+  // uint64 max = 7;
+  if (this->_internal_max() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(7, this->_internal_max(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chat.Distribution)
+  return target;
+}
+
+size_t Distribution::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chat.Distribution)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // uint64 count = 1;
+  if (this->_internal_count() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_count());
+  }
+
+  // double mean = 2;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_mean = this->_internal_mean();
+  uint64_t raw_mean;
+  memcpy(&raw_mean, &tmp_mean, sizeof(tmp_mean));
+  if (raw_mean != 0) {
+    total_size += 1 + 8;
+  }
+
+  // uint64 p50 = 3;
+  if (this->_internal_p50() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_p50());
+  }
+
+  // uint64 p90 = 4;
+  if (this->_internal_p90() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_p90());
+  }
+
+  // uint64 p99 = 5;
+  if (this->_internal_p99() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_p99());
+  }
+
+  // uint64 p999 = 6;
+  if (this->_internal_p999() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_p999());
+  }
+
+  // uint64 max = 7;
+  if (this->_internal_max() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_max());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Distribution::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Distribution::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Distribution::GetClassData() const { return &_class_data_; }
+
+
+void Distribution::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Distribution*>(&to_msg);
+  auto& from = static_cast<const Distribution&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.Distribution)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_count() != 0) {
+    _this->_internal_set_count(from._internal_count());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_mean = from._internal_mean();
+  uint64_t raw_mean;
+  memcpy(&raw_mean, &tmp_mean, sizeof(tmp_mean));
+  if (raw_mean != 0) {
+    _this->_internal_set_mean(from._internal_mean());
+  }
+  if (from._internal_p50() != 0) {
+    _this->_internal_set_p50(from._internal_p50());
+  }
+  if (from._internal_p90() != 0) {
+    _this->_internal_set_p90(from._internal_p90());
+  }
+  if (from._internal_p99() != 0) {
+    _this->_internal_set_p99(from._internal_p99());
+  }
+  if (from._internal_p999() != 0) {
+    _this->_internal_set_p999(from._internal_p999());
+  }
+  if (from._internal_max() != 0) {
+    _this->_internal_set_max(from._internal_max());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Distribution::CopyFrom(const Distribution& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chat.Distribution)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Distribution::IsInitialized() const {
+  return true;
+}
+
+void Distribution::InternalSwap(Distribution* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Distribution, _impl_.max_)
+      + sizeof(Distribution::_impl_.max_)
+      - PROTOBUF_FIELD_OFFSET(Distribution, _impl_.count_)>(
+          reinterpret_cast<char*>(&_impl_.count_),
+          reinterpret_cast<char*>(&other->_impl_.count_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Distribution::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_chat_2eproto_getter, &descriptor_table_chat_2eproto_once,
+      file_level_metadata_chat_2eproto[18]);
+}
+
+// ===================================================================
+
+class OperationStats::_Internal {
+ public:
+  static const ::chat::Distribution& latency(const OperationStats* msg);
+};
+
+const ::chat::Distribution&
+OperationStats::_Internal::latency(const OperationStats* msg) {
+  return *msg->_impl_.latency_;
+}
+OperationStats::OperationStats(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chat.OperationStats)
+}
+OperationStats::OperationStats(const OperationStats& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  OperationStats* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.latency_){nullptr}
+    , decltype(_impl_.requests_){}
+    , decltype(_impl_.operation_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_latency()) {
+    _this->_impl_.latency_ = new ::chat::Distribution(*from._impl_.latency_);
+  }
+  ::memcpy(&_impl_.requests_, &from._impl_.requests_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.operation_) -
+    reinterpret_cast<char*>(&_impl_.requests_)) + sizeof(_impl_.operation_));
+  // @@protoc_insertion_point(copy_constructor:chat.OperationStats)
+}
+
+inline void OperationStats::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.latency_){nullptr}
+    , decltype(_impl_.requests_){uint64_t{0u}}
+    , decltype(_impl_.operation_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+OperationStats::~OperationStats() {
+  // @@protoc_insertion_point(destructor:chat.OperationStats)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void OperationStats::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.latency_;
+}
+
+void OperationStats::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void OperationStats::Clear() {
+// @@protoc_insertion_point(message_clear_start:chat.OperationStats)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (GetArenaForAllocation() == nullptr && _impl_.latency_ != nullptr) {
+    delete _impl_.latency_;
+  }
+  _impl_.latency_ = nullptr;
+  ::memset(&_impl_.requests_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.operation_) -
+      reinterpret_cast<char*>(&_impl_.requests_)) + sizeof(_impl_.operation_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* OperationStats::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .chat.Operation operation = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_operation(static_cast<::chat::Operation>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 requests = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.requests_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .chat.Distribution latency = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_latency(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* OperationStats::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chat.OperationStats)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .chat.Operation operation = 1;
+  if (this->_internal_operation() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_operation(), target);
+  }
+
+  // uint64 requests = 2;
+  if (this->_internal_requests() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_requests(), target);
+  }
+
+  // .chat.Distribution latency = 3;
+  if (this->_internal_has_latency()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::latency(this),
+        _Internal::latency(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chat.OperationStats)
+  return target;
+}
+
+size_t OperationStats::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chat.OperationStats)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .chat.Distribution latency = 3;
+  if (this->_internal_has_latency()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.latency_);
+  }
+
+  // uint64 requests = 2;
+  if (this->_internal_requests() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_requests());
+  }
+
+  // .chat.Operation operation = 1;
+  if (this->_internal_operation() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_operation());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData OperationStats::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    OperationStats::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*OperationStats::GetClassData() const { return &_class_data_; }
+
+
+void OperationStats::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<OperationStats*>(&to_msg);
+  auto& from = static_cast<const OperationStats&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.OperationStats)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_latency()) {
+    _this->_internal_mutable_latency()->::chat::Distribution::MergeFrom(
+        from._internal_latency());
+  }
+  if (from._internal_requests() != 0) {
+    _this->_internal_set_requests(from._internal_requests());
+  }
+  if (from._internal_operation() != 0) {
+    _this->_internal_set_operation(from._internal_operation());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void OperationStats::CopyFrom(const OperationStats& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chat.OperationStats)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool OperationStats::IsInitialized() const {
+  return true;
+}
+
+void OperationStats::InternalSwap(OperationStats* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(OperationStats, _impl_.operation_)
+      + sizeof(OperationStats::_impl_.operation_)
+      - PROTOBUF_FIELD_OFFSET(OperationStats, _impl_.latency_)>(
+          reinterpret_cast<char*>(&_impl_.latency_),
+          reinterpret_cast<char*>(&other->_impl_.latency_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata OperationStats::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_chat_2eproto_getter, &descriptor_table_chat_2eproto_once,
+      file_level_metadata_chat_2eproto[19]);
+}
+
+// ===================================================================
+
+class StatusCodeCount::_Internal {
+ public:
+};
+
+StatusCodeCount::StatusCodeCount(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chat.StatusCodeCount)
+}
+StatusCodeCount::StatusCodeCount(const StatusCodeCount& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  StatusCodeCount* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.count_){}
+    , decltype(_impl_.status_code_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.count_, &from._impl_.count_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.status_code_) -
+    reinterpret_cast<char*>(&_impl_.count_)) + sizeof(_impl_.status_code_));
+  // @@protoc_insertion_point(copy_constructor:chat.StatusCodeCount)
+}
+
+inline void StatusCodeCount::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.count_){uint64_t{0u}}
+    , decltype(_impl_.status_code_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+StatusCodeCount::~StatusCodeCount() {
+  // @@protoc_insertion_point(destructor:chat.StatusCodeCount)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void StatusCodeCount::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void StatusCodeCount::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void StatusCodeCount::Clear() {
+// @@protoc_insertion_point(message_clear_start:chat.StatusCodeCount)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.count_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.status_code_) -
+      reinterpret_cast<char*>(&_impl_.count_)) + sizeof(_impl_.status_code_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* StatusCodeCount::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .chat.StatusCode status_code = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_status_code(static_cast<::chat::StatusCode>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 count = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* StatusCodeCount::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chat.StatusCodeCount)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .chat.StatusCode status_code = 1;
+  if (this->_internal_status_code() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_status_code(), target);
+  }
+
+  // uint64 count = 2;
+  if (this->_internal_count() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(2, this->_internal_count(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chat.StatusCodeCount)
+  return target;
+}
+
+size_t StatusCodeCount::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chat.StatusCodeCount)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // uint64 count = 2;
+  if (this->_internal_count() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_count());
+  }
+
+  // .chat.StatusCode status_code = 1;
+  if (this->_internal_status_code() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_status_code());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData StatusCodeCount::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    StatusCodeCount::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*StatusCodeCount::GetClassData() const { return &_class_data_; }
+
+
+void StatusCodeCount::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<StatusCodeCount*>(&to_msg);
+  auto& from = static_cast<const StatusCodeCount&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.StatusCodeCount)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_count() != 0) {
+    _this->_internal_set_count(from._internal_count());
+  }
+  if (from._internal_status_code() != 0) {
+    _this->_internal_set_status_code(from._internal_status_code());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void StatusCodeCount::CopyFrom(const StatusCodeCount& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chat.StatusCodeCount)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool StatusCodeCount::IsInitialized() const {
+  return true;
+}
+
+void StatusCodeCount::InternalSwap(StatusCodeCount* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(StatusCodeCount, _impl_.status_code_)
+      + sizeof(StatusCodeCount::_impl_.status_code_)
+      - PROTOBUF_FIELD_OFFSET(StatusCodeCount, _impl_.count_)>(
+          reinterpret_cast<char*>(&_impl_.count_),
+          reinterpret_cast<char*>(&other->_impl_.count_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata StatusCodeCount::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_chat_2eproto_getter, &descriptor_table_chat_2eproto_once,
+      file_level_metadata_chat_2eproto[20]);
+}
+
+// ===================================================================
+
+class ServerStats::_Internal {
+ public:
+  static const ::chat::Distribution& queue_depth(const ServerStats* msg);
+  static const ::chat::Distribution& broadcast_fanout(const ServerStats* msg);
+  static const ::chat::Distribution& room_fanout(const ServerStats* msg);
+  static const ::chat::Distribution& pipeline_depth(const ServerStats* msg);
+};
+
+const ::chat::Distribution&
+ServerStats::_Internal::queue_depth(const ServerStats* msg) {
+  return *msg->_impl_.queue_depth_;
+}
+const ::chat::Distribution&
+ServerStats::_Internal::broadcast_fanout(const ServerStats* msg) {
+  return *msg->_impl_.broadcast_fanout_;
+}
+const ::chat::Distribution&
+ServerStats::_Internal::room_fanout(const ServerStats* msg) {
+  return *msg->_impl_.room_fanout_;
+}
+const ::chat::Distribution&
+ServerStats::_Internal::pipeline_depth(const ServerStats* msg) {
+  return *msg->_impl_.pipeline_depth_;
+}
+ServerStats::ServerStats(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chat.ServerStats)
+}
+ServerStats::ServerStats(const ServerStats& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ServerStats* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.operations_){from._impl_.operations_}
+    , decltype(_impl_.responses_){from._impl_.responses_}
+    , decltype(_impl_.queue_depth_){nullptr}
+    , decltype(_impl_.broadcast_fanout_){nullptr}
+    , decltype(_impl_.room_fanout_){nullptr}
+    , decltype(_impl_.pipeline_depth_){nullptr}
+    , decltype(_impl_.uptime_ms_){}
+    , decltype(_impl_.bytes_in_){}
+    , decltype(_impl_.bytes_out_){}
+    , decltype(_impl_.active_connections_){}
+    , decltype(_impl_.total_connections_){}
+    , decltype(_impl_.queued_frames_){}
+    , decltype(_impl_.queued_bytes_){}
+    , decltype(_impl_.heap_allocations_){}
+    , decltype(_impl_.read_calls_){}
+    , decltype(_impl_.write_calls_){}
+    , decltype(_impl_.packed_frames_){}
+    , decltype(_impl_.offline_queued_){}
+    , decltype(_impl_.offline_delivered_){}
+    , decltype(_impl_.offline_pending_){}
+    , decltype(_impl_.offline_syncs_){}
+    , decltype(_impl_.routed_frames_){}
+    , decltype(_impl_.active_rooms_){}
+    , decltype(_impl_.slow_consumers_){}
+    , decltype(_impl_.dropped_frames_){}
+    , decltype(_impl_.overflow_disconnects_){}
+    , decltype(_impl_.compressed_frames_){}
+    , decltype(_impl_.compression_in_bytes_){}
+    , decltype(_impl_.compression_out_bytes_){}
+    , decltype(_impl_.compression_cpu_ns_){}
+    , decltype(_impl_.presence_subscribers_){}
+    , decltype(_impl_.presence_changes_){}
+    , decltype(_impl_.presence_events_){}
+    , decltype(_impl_.presence_updates_){}
+    , decltype(_impl_.sessions_){}
+    , decltype(_impl_.session_bytes_){}
+    , decltype(_impl_.worker_jobs_){}
+    , decltype(_impl_.stolen_jobs_){}
+    , decltype(_impl_.detached_sessions_){}
+    , decltype(_impl_.resumed_sessions_){}
+    , decltype(_impl_.expired_sessions_){}
+    , decltype(_impl_.resumed_frames_){}
+    , decltype(_impl_.roster_builds_){}
+    , decltype(_impl_.roster_served_){}
+    , decltype(_impl_.file_transfers_){}
+    , decltype(_impl_.active_transfers_){}
+    , decltype(_impl_.file_bytes_){}
+    , decltype(_impl_.file_bytes_spooled_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_queue_depth()) {
+    _this->_impl_.queue_depth_ = new ::chat::Distribution(*from._impl_.queue_depth_);
+  }
+  if (from._internal_has_broadcast_fanout()) {
+    _this->_impl_.broadcast_fanout_ = new ::chat::Distribution(*from._impl_.broadcast_fanout_);
+  }
+  if (from._internal_has_room_fanout()) {
+    _this->_impl_.room_fanout_ = new ::chat::Distribution(*from._impl_.room_fanout_);
+  }
+  if (from._internal_has_pipeline_depth()) {
+    _this->_impl_.pipeline_depth_ = new ::chat::Distribution(*from._impl_.pipeline_depth_);
+  }
+  ::memcpy(&_impl_.uptime_ms_, &from._impl_.uptime_ms_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.file_bytes_spooled_) -
+    reinterpret_cast<char*>(&_impl_.uptime_ms_)) + sizeof(_impl_.file_bytes_spooled_));
+  // @@protoc_insertion_point(copy_constructor:chat.ServerStats)
+}
+
+inline void ServerStats::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.operations_){arena}
+    , decltype(_impl_.responses_){arena}
+    , decltype(_impl_.queue_depth_){nullptr}
+    , decltype(_impl_.broadcast_fanout_){nullptr}
+    , decltype(_impl_.room_fanout_){nullptr}
+    , decltype(_impl_.pipeline_depth_){nullptr}
+    , decltype(_impl_.uptime_ms_){uint64_t{0u}}
+    , decltype(_impl_.bytes_in_){uint64_t{0u}}
+    , decltype(_impl_.bytes_out_){uint64_t{0u}}
+    , decltype(_impl_.active_connections_){uint64_t{0u}}
+    , decltype(_impl_.total_connections_){uint64_t{0u}}
+    , decltype(_impl_.queued_frames_){uint64_t{0u}}
+    , decltype(_impl_.queued_bytes_){uint64_t{0u}}
+    , decltype(_impl_.heap_allocations_){uint64_t{0u}}
+    , decltype(_impl_.read_calls_){uint64_t{0u}}
+    , decltype(_impl_.write_calls_){uint64_t{0u}}
+    , decltype(_impl_.packed_frames_){uint64_t{0u}}
+    , decltype(_impl_.offline_queued_){uint64_t{0u}}
+    , decltype(_impl_.offline_delivered_){uint64_t{0u}}
+    , decltype(_impl_.offline_pending_){uint64_t{0u}}
+    , decltype(_impl_.offline_syncs_){uint64_t{0u}}
+    , decltype(_impl_.routed_frames_){uint64_t{0u}}
+    , decltype(_impl_.active_rooms_){uint64_t{0u}}
+    , decltype(_impl_.slow_consumers_){uint64_t{0u}}
+    , decltype(_impl_.dropped_frames_){uint64_t{0u}}
+    , decltype(_impl_.overflow_disconnects_){uint64_t{0u}}
+    , decltype(_impl_.compressed_frames_){uint64_t{0u}}
+    , decltype(_impl_.compression_in_bytes_){uint64_t{0u}}
+    , decltype(_impl_.compression_out_bytes_){uint64_t{0u}}
+    , decltype(_impl_.compression_cpu_ns_){uint64_t{0u}}
+    , decltype(_impl_.presence_subscribers_){uint64_t{0u}}
+    , decltype(_impl_.presence_changes_){uint64_t{0u}}
+    , decltype(_impl_.presence_events_){uint64_t{0u}}
+    , decltype(_impl_.presence_updates_){uint64_t{0u}}
+    , decltype(_impl_.sessions_){uint64_t{0u}}
+    , decltype(_impl_.session_bytes_){uint64_t{0u}}
+    , decltype(_impl_.worker_jobs_){uint64_t{0u}}
+    , decltype(_impl_.stolen_jobs_){uint64_t{0u}}
+    , decltype(_impl_.detached_sessions_){uint64_t{0u}}
+    , decltype(_impl_.resumed_sessions_){uint64_t{0u}}
+    , decltype(_impl_.expired_sessions_){uint64_t{0u}}
+    , decltype(_impl_.resumed_frames_){uint64_t{0u}}
+    , decltype(_impl_.roster_builds_){uint64_t{0u}}
+    , decltype(_impl_.roster_served_){uint64_t{0u}}
+    , decltype(_impl_.file_transfers_){uint64_t{0u}}
+    , decltype(_impl_.active_transfers_){uint64_t{0u}}
+    , decltype(_impl_.file_bytes_){uint64_t{0u}}
+    , decltype(_impl_.file_bytes_spooled_){uint64_t{0u}}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+ServerStats::~ServerStats() {
+  // @@protoc_insertion_point(destructor:chat.ServerStats)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ServerStats::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.operations_.~RepeatedPtrField();
+  _impl_.responses_.~RepeatedPtrField();
+  if (this != internal_default_instance()) delete _impl_.queue_depth_;
+  if (this != internal_default_instance()) delete _impl_.broadcast_fanout_;
+  if (this != internal_default_instance()) delete _impl_.room_fanout_;
+  if (this != internal_default_instance()) delete _impl_.pipeline_depth_;
+}
+
+void ServerStats::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ServerStats::Clear() {
+// @@protoc_insertion_point(message_clear_start:chat.ServerStats)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.operations_.Clear();
+  _impl_.responses_.Clear();
+  if (GetArenaForAllocation() == nullptr && _impl_.queue_depth_ != nullptr) {
+    delete _impl_.queue_depth_;
+  }
+  _impl_.queue_depth_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.broadcast_fanout_ != nullptr) {
+    delete _impl_.broadcast_fanout_;
+  }
+  _impl_.broadcast_fanout_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.room_fanout_ != nullptr) {
+    delete _impl_.room_fanout_;
+  }
+  _impl_.room_fanout_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.pipeline_depth_ != nullptr) {
+    delete _impl_.pipeline_depth_;
+  }
+  _impl_.pipeline_depth_ = nullptr;
+  ::memset(&_impl_.uptime_ms_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.file_bytes_spooled_) -
+      reinterpret_cast<char*>(&_impl_.uptime_ms_)) + sizeof(_impl_.file_bytes_spooled_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ServerStats::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint64 uptime_ms = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.uptime_ms_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .chat.OperationStats operations = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_operations(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .chat.StatusCodeCount responses = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_responses(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 bytes_in = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.bytes_in_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 bytes_out = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.bytes_out_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 active_connections = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.active_connections_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 total_connections = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.total_connections_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 queued_frames = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _impl_.queued_frames_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 queued_bytes = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          _impl_.queued_bytes_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .chat.Distribution queue_depth = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 82)) {
+          ptr = ctx->ParseMessage(_internal_mutable_queue_depth(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .chat.Distribution broadcast_fanout = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 90)) {
+          ptr = ctx->ParseMessage(_internal_mutable_broadcast_fanout(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 heap_allocations = 12;
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 96)) {
+          _impl_.heap_allocations_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 read_calls = 13;
+      case 13:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 104)) {
+          _impl_.read_calls_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 write_calls = 14;
+      case 14:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 112)) {
+          _impl_.write_calls_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 packed_frames = 15;
+      case 15:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 120)) {
+          _impl_.packed_frames_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 offline_queued = 16;
+      case 16:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 128)) {
+          _impl_.offline_queued_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 offline_delivered = 17;
+      case 17:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 136)) {
+          _impl_.offline_delivered_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 offline_pending = 18;
+      case 18:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 144)) {
+          _impl_.offline_pending_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 offline_syncs = 19;
+      case 19:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 152)) {
+          _impl_.offline_syncs_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 routed_frames = 20;
+      case 20:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 160)) {
+          _impl_.routed_frames_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 active_rooms = 21;
+      case 21:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 168)) {
+          _impl_.active_rooms_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .chat.Distribution room_fanout = 22;
+      case 22:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 178)) {
+          ptr = ctx->ParseMessage(_internal_mutable_room_fanout(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 slow_consumers = 23;
+      case 23:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 184)) {
+          _impl_.slow_consumers_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 dropped_frames = 24;
+      case 24:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 192)) {
+          _impl_.dropped_frames_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 overflow_disconnects = 25;
+      case 25:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 200)) {
+          _impl_.overflow_disconnects_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 compressed_frames = 26;
+      case 26:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 208)) {
+          _impl_.compressed_frames_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 compression_in_bytes = 27;
+      case 27:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 216)) {
+          _impl_.compression_in_bytes_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 compression_out_bytes = 28;
+      case 28:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 224)) {
+          _impl_.compression_out_bytes_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 compression_cpu_ns = 29;
+      case 29:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 232)) {
+          _impl_.compression_cpu_ns_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .chat.Distribution pipeline_depth = 30;
+      case 30:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 242)) {
+          ptr = ctx->ParseMessage(_internal_mutable_pipeline_depth(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 presence_subscribers = 31;
+      case 31:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 248)) {
+          _impl_.presence_subscribers_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 presence_changes = 32;
+      case 32:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 0)) {
+          _impl_.presence_changes_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 presence_events = 33;
+      case 33:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.presence_events_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 presence_updates = 34;
+      case 34:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.presence_updates_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 sessions = 35;
+      case 35:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.sessions_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 session_bytes = 36;
+      case 36:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.session_bytes_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 worker_jobs = 37;
+      case 37:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.worker_jobs_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 stolen_jobs = 38;
+      case 38:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          _impl_.stolen_jobs_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 detached_sessions = 39;
+      case 39:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 56)) {
+          _impl_.detached_sessions_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 resumed_sessions = 40;
+      case 40:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 64)) {
+          _impl_.resumed_sessions_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 expired_sessions = 41;
+      case 41:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 72)) {
+          _impl_.expired_sessions_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 resumed_frames = 42;
+      case 42:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 80)) {
+          _impl_.resumed_frames_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 roster_builds = 43;
+      case 43:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 88)) {
+          _impl_.roster_builds_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 roster_served = 44;
+      case 44:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 96)) {
+          _impl_.roster_served_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 file_transfers = 45;
+      case 45:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 104)) {
+          _impl_.file_transfers_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 active_transfers = 46;
+      case 46:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 112)) {
+          _impl_.active_transfers_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 file_bytes = 47;
+      case 47:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 120)) {
+          _impl_.file_bytes_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 file_bytes_spooled = 48;
+      case 48:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 128)) {
+          _impl_.file_bytes_spooled_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ServerStats::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chat.ServerStats)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint64 uptime_ms = 1;
+  if (this->_internal_uptime_ms() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(1, this->_internal_uptime_ms(), target);
+  }
+
+  // repeated .chat.OperationStats operations = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_operations_size()); i < n; i++) {
+    const auto& repfield = this->_internal_operations(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated .chat.StatusCodeCount responses = 3;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_responses_size()); i < n; i++) {
+    const auto& repfield = this->_internal_responses(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(3, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // uint64 bytes_in = 4;
+  if (this->_internal_bytes_in() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(4, this->_internal_bytes_in(), target);
+  }
+
+  // uint64 bytes_out = 5;
+  if (this->_internal_bytes_out() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(5, this->_internal_bytes_out(), target);
+  }
+
+  // uint64 active_connections = 6;
+  if (this->_internal_active_connections() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(6, this->_internal_active_connections(), target);
+  }
+
+  // uint64 total_connections = 7;
+  if (this->_internal_total_connections() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(7, this->_internal_total_connections(), target);
+  }
+
+  // uint64 queued_frames = 8;
+  if (this->_internal_queued_frames() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(8, this->_internal_queued_frames(), target);
+  }
+
+  // uint64 queued_bytes = 9;
+  if (this->_internal_queued_bytes() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(9, this->_internal_queued_bytes(), target);
+  }
+
+  // .chat.Distribution queue_depth = 10;
+  if (this->_internal_has_queue_depth()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(10, _Internal::queue_depth(this),
+        _Internal::queue_depth(this).GetCachedSize(), target, stream);
+  }
+
+  // .chat.Distribution broadcast_fanout = 11;
+  if (this->_internal_has_broadcast_fanout()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(11, _Internal::broadcast_fanout(this),
+        _Internal::broadcast_fanout(this).GetCachedSize(), target, stream);
+  }
+
+  // uint64 heap_allocations = 12;
+  if (this->_internal_heap_allocations() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(12, this->_internal_heap_allocations(), target);
+  }
+
+  // uint64 read_calls = 13;
+  if (this->_internal_read_calls() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(13, this->_internal_read_calls(), target);
+  }
+
+  // uint64 write_calls = 14;
+  if (this->_internal_write_calls() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(14, this->_internal_write_calls(), target);
+  }
+
+  // uint64 packed_frames = 15;
+  if (this->_internal_packed_frames() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(15, this->_internal_packed_frames(), target);
+  }
+
+  // uint64 offline_queued = 16;
+  if (this->_internal_offline_queued() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(16, this->_internal_offline_queued(), target);
+  }
+
+  // uint64 offline_delivered = 17;
+  if (this->_internal_offline_delivered() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(17, this->_internal_offline_delivered(), target);
+  }
+
+  // uint64 offline_pending = 18;
+  if (this->_internal_offline_pending() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(18, this->_internal_offline_pending(), target);
+  }
+
+  // uint64 offline_syncs = 19;
+  if (this->_internal_offline_syncs() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(19, this->_internal_offline_syncs(), target);
+  }
+
+  // uint64 routed_frames = 20;
+  if (this->_internal_routed_frames() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(20, this->_internal_routed_frames(), target);
+  }
+
+  // uint64 active_rooms = 21;
+  if (this->_internal_active_rooms() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(21, this->_internal_active_rooms(), target);
+  }
+
+  // .chat.Distribution room_fanout = 22;
+  if (this->_internal_has_room_fanout()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(22, _Internal::room_fanout(this),
+        _Internal::room_fanout(this).GetCachedSize(), target, stream);
+  }
+
+  // uint64 slow_consumers = 23;
+  if (this->_internal_slow_consumers() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(23, this->_internal_slow_consumers(), target);
+  }
+
+  // uint64 dropped_frames = 24;
+  if (this->_internal_dropped_frames() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(24, this->_internal_dropped_frames(), target);
+  }
+
+  // uint64 overflow_disconnects = 25;
+  if (this->_internal_overflow_disconnects() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(25, this->_internal_overflow_disconnects(), target);
+  }
+
+  // uint64 compressed_frames = 26;
+  if (this->_internal_compressed_frames() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(26, this->_internal_compressed_frames(), target);
+  }
+
+  // uint64 compression_in_bytes = 27;
+  if (this->_internal_compression_in_bytes() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(27, this->_internal_compression_in_bytes(), target);
+  }
+
+  // uint64 compression_out_bytes = 28;
+  if (this->_internal_compression_out_bytes() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(28, this->_internal_compression_out_bytes(), target);
+  }
+
+  // uint64 compression_cpu_ns = 29;
+  if (this->_internal_compression_cpu_ns() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(29, this->_internal_compression_cpu_ns(), target);
+  }
+
+  // .chat.Distribution pipeline_depth = 30;
+  if (this->_internal_has_pipeline_depth()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(30, _Internal::pipeline_depth(this),
+        _Internal::pipeline_depth(this).GetCachedSize(), target, stream);
+  }
+
+  // uint64 presence_subscribers = 31;
+  if (this->_internal_presence_subscribers() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(31, this->_internal_presence_subscribers(), target);
+  }
+
+  // uint64 presence_changes = 32;
+  if (this->_internal_presence_changes() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(32, this->_internal_presence_changes(), target);
+  }
+
+  // uint64 presence_events = 33;
+  if (this->_internal_presence_events() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(33, this->_internal_presence_events(), target);
+  }
+
+  // uint64 presence_updates = 34;
+  if (this->_internal_presence_updates() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(34, this->_internal_presence_updates(), target);
+  }
+
+  // uint64 sessions = 35;
+  if (this->_internal_sessions() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(35, this->_internal_sessions(), target);
+  }
+
+  // uint64 session_bytes = 36;
+  if (this->_internal_session_bytes() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(36, this->_internal_session_bytes(), target);
+  }
+
+  // uint64 worker_jobs = 37;
+  if (this->_internal_worker_jobs() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(37, this->_internal_worker_jobs(), target);
+  }
+
+  // uint64 stolen_jobs = 38;
+  if (this->_internal_stolen_jobs() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(38, this->_internal_stolen_jobs(), target);
+  }
+
+  // uint64 detached_sessions = 39;
+  if (this->_internal_detached_sessions() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(39, this->_internal_detached_sessions(), target);
+  }
+
+  // uint64 resumed_sessions = 40;
+  if (this->_internal_resumed_sessions() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(40, this->_internal_resumed_sessions(), target);
+  }
+
+  // uint64 expired_sessions = 41;
+  if (this->_internal_expired_sessions() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(41, this->_internal_expired_sessions(), target);
+  }
+
+  // uint64 resumed_frames = 42;
+  if (this->_internal_resumed_frames() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(42, this->_internal_resumed_frames(), target);
+  }
+
+  // uint64 roster_builds = 43;
+  if (this->_internal_roster_builds() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(43, this->_internal_roster_builds(), target);
+  }
+
+  // uint64 roster_served = 44;
+  if (this->_internal_roster_served() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(44, this->_internal_roster_served(), target);
+  }
+
+  // uint64 file_transfers = 45;
+  if (this->_internal_file_transfers() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(45, this->_internal_file_transfers(), target);
+  }
+
+  // uint64 active_transfers = 46;
+  if (this->_internal_active_transfers() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(46, this->_internal_active_transfers(), target);
+  }
+
+  // uint64 file_bytes = 47;
+  if (this->_internal_file_bytes() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(47, this->_internal_file_bytes(), target);
+  }
+
+  // uint64 file_bytes_spooled = 48;
+  if (this->_internal_file_bytes_spooled() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(48, this->_internal_file_bytes_spooled(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chat.ServerStats)
+  return target;
+}
+
+size_t ServerStats::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chat.ServerStats)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .chat.OperationStats operations = 2;
+  total_size += 1UL * this->_internal_operations_size();
+  for (const auto& msg : this->_impl_.operations_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .chat.StatusCodeCount responses = 3;
+  total_size += 1UL * this->_internal_responses_size();
+  for (const auto& msg : this->_impl_.responses_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // .chat.Distribution queue_depth = 10;
+  if (this->_internal_has_queue_depth()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.queue_depth_);
+  }
+
+  // .chat.Distribution broadcast_fanout = 11;
+  if (this->_internal_has_broadcast_fanout()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.broadcast_fanout_);
+  }
+
+  // .chat.Distribution room_fanout = 22;
+  if (this->_internal_has_room_fanout()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.room_fanout_);
+  }
+
+  // .chat.Distribution pipeline_depth = 30;
+  if (this->_internal_has_pipeline_depth()) {
+    total_size += 2 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.pipeline_depth_);
+  }
+
+  // uint64 uptime_ms = 1;
+  if (this->_internal_uptime_ms() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_uptime_ms());
+  }
+
+  // uint64 bytes_in = 4;
+  if (this->_internal_bytes_in() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_bytes_in());
+  }
+
+  // uint64 bytes_out = 5;
+  if (this->_internal_bytes_out() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_bytes_out());
+  }
+
+  // uint64 active_connections = 6;
+  if (this->_internal_active_connections() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_active_connections());
+  }
+
+  // uint64 total_connections = 7;
+  if (this->_internal_total_connections() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_total_connections());
+  }
+
+  // uint64 queued_frames = 8;
+  if (this->_internal_queued_frames() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_queued_frames());
+  }
+
+  // uint64 queued_bytes = 9;
+  if (this->_internal_queued_bytes() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_queued_bytes());
+  }
+
+  // uint64 heap_allocations = 12;
+  if (this->_internal_heap_allocations() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_heap_allocations());
+  }
+
+  // uint64 read_calls = 13;
+  if (this->_internal_read_calls() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_read_calls());
+  }
+
+  // uint64 write_calls = 14;
+  if (this->_internal_write_calls() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_write_calls());
+  }
+
+  // uint64 packed_frames = 15;
+  if (this->_internal_packed_frames() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_packed_frames());
+  }
+
+  // uint64 offline_queued = 16;
+  if (this->_internal_offline_queued() != 0) {
+    total_size += 2 +
+      ::_pbi::WireFormatLite::UInt64Size(
+        this->_internal_offline_queued());
+  }
+
+  // uint64 offline_delivered = 17;
+  if (this->_internal_offline_delivered() != 0) {
+    total_size += 2 +
+      ::_pbi::WireFormatLite::UInt64Size(
+        this->_internal_offline_delivered());
+  }
+
+  // uint64 offline_pending = 18;
+  if (this->_internal_offline_pending() != 0) {
+    total_size += 2 +
+      ::_pbi::WireFormatLite::UInt64Size(
+        this->_internal_offline_pending());
+  }
+
+  // uint64 offline_syncs = 19;
+  if (this->_internal_offline_syncs() != 0) {
+    total_size += 2 +
+      ::_pbi::WireFormatLite::UInt64Size(
+        this->_internal_offline_syncs());
+  }
+
+  // uint64 routed_frames = 20;
+  if (this->_internal_routed_frames() != 0) {
+    total_size += 2 +
+      ::_pbi::WireFormatLite::UInt64Size(
+        this->_internal_routed_frames());
+  }
+
+  // uint64 active_rooms = 21;
+  if (this->_internal_active_rooms() != 0) {
+    total_size += 2 +
+      ::_pbi::WireFormatLite::UInt64Size(
+        this->_internal_active_rooms());
+  }
+
+  // uint64 slow_consumers = 23;
+  if (this->_internal_slow_consumers() != 0) {
+    total_size += 2 +
+      ::_pbi::WireFormatLite::UInt64Size(
+        this->_internal_slow_consumers());
+  }
+
+  // uint64 dropped_frames = 24;
+  if (this->_internal_dropped_frames() != 0) {
+    total_size += 2 +
+      ::_pbi::WireFormatLite::UInt64Size(
+        this->_internal_dropped_frames());
+  }
+
+  // uint64 overflow_disconnects = 25;
+  if (this->_internal_overflow_disconnects() != 0) {
+    total_size += 2 +
+      ::_pbi::WireFormatLite::UInt64Size(
+        this->_internal_overflow_disconnects());
+  }
+
+  // uint64 compressed_frames = 26;
+  if (this->_internal_compressed_frames() != 0) {
+    total_size += 2 +
+      ::_pbi::WireFormatLite::UInt64Size(
+        this->_internal_compressed_frames());
+  }
+
+  // uint64 compression_in_bytes = 27;
+  if (this->_internal_compression_in_bytes() != 0) {
+    total_size += 2 +
+      ::_pbi::WireFormatLite::UInt64Size(
+        this->_internal_compression_in_bytes());
+  }
+
+  // uint64 compression_out_bytes = 28;
+  if (this->_internal_compression_out_bytes() != 0) {
+    total_size += 2 +
+      ::_pbi::WireFormatLite::UInt64Size(
+        this->_internal_compression_out_bytes());
+  }
+
+  // uint64 compression_cpu_ns = 29;
+  if (this->_internal_compression_cpu_ns() != 0) {
+    total_size += 2 +
+      ::_pbi::WireFormatLite::UInt64Size(
+        this->_internal_compression_cpu_ns());
+  }
+
+  // uint64 presence_subscribers = 31;
+  if (this->_internal_presence_subscribers() != 0) {
+    total_size += 2 +
+      ::_pbi::WireFormatLite::UInt64Size(
+        this->_internal_presence_subscribers());
+  }
+
+  // uint64 presence_changes = 32;
+  if (this->_internal_presence_changes() != 0) {
+    total_size += 2 +
+      ::_pbi::WireFormatLite::UInt64Size(
+        this->_internal_presence_changes());
+  }
+
+  // uint64 presence_events = 33;
+  if (this->_internal_presence_events() != 0) {
+    total_size += 2 +
+      ::_pbi::WireFormatLite::UInt64Size(
+        this->_internal_presence_events());
+  }
+
+  // uint64 presence_updates = 34;
+  if (this->_internal_presence_updates() != 0) {
+    total_size += 2 +
+      ::_pbi::WireFormatLite::UInt64Size(
+        this->_internal_presence_updates());
+  }
+
+  // uint64 sessions = 35;
+  if (this->_internal_sessions() != 0) {
+    total_size += 2 +
+      ::_pbi::WireFormatLite::UInt64Size(
+        this->_internal_sessions());
+  }
+
+  // uint64 session_bytes = 36;
+  if (this->_internal_session_bytes() != 0) {
+    total_size += 2 +
+      ::_pbi::WireFormatLite::UInt64Size(
+        this->_internal_session_bytes());
+  }
+
+  // uint64 worker_jobs = 37;
+  if (this->_internal_worker_jobs() != 0) {
+    total_size += 2 +
+      ::_pbi::WireFormatLite::UInt64Size(
+        this->_internal_worker_jobs());
+  }
+
+  // uint64 stolen_jobs = 38;
+  if (this->_internal_stolen_jobs() != 0) {
+    total_size += 2 +
+      ::_pbi::WireFormatLite::UInt64Size(
+        this->_internal_stolen_jobs());
+  }
+
+  // uint64 detached_sessions = 39;
+  if (this->_internal_detached_sessions() != 0) {
+    total_size += 2 +
+      ::_pbi::WireFormatLite::UInt64Size(
+        this->_internal_detached_sessions());
+  }
+
+  // uint64 resumed_sessions = 40;
+  if (this->_internal_resumed_sessions() != 0) {
+    total_size += 2 +
+      ::_pbi::WireFormatLite::UInt64Size(
+        this->_internal_resumed_sessions());
+  }
+
+  // uint64 expired_sessions = 41;
+  if (this->_internal_expired_sessions() != 0) {
+    total_size += 2 +
+      ::_pbi::WireFormatLite::UInt64Size(
+        this->_internal_expired_sessions());
+  }
+
+  // uint64 resumed_frames = 42;
+  if (this->_internal_resumed_frames() != 0) {
+    total_size += 2 +
+      ::_pbi::WireFormatLite::UInt64Size(
+        this->_internal_resumed_frames());
+  }
+
+  // uint64 roster_builds = 43;
+  if (this->_internal_roster_builds() != 0) {
+    total_size += 2 +
+      ::_pbi::WireFormatLite::UInt64Size(
+        this->_internal_roster_builds());
+  }
+
+  // uint64 roster_served = 44;
+  if (this->_internal_roster_served() != 0) {
+    total_size += 2 +
+      ::_pbi::WireFormatLite::UInt64Size(
+        this->_internal_roster_served());
+  }
+
+  // uint64 file_transfers = 45;
+  if (this->_internal_file_transfers() != 0) {
+    total_size += 2 +
+      ::_pbi::WireFormatLite::UInt64Size(
+        this->_internal_file_transfers());
+  }
+
+  // uint64 active_transfers = 46;
+  if (this->_internal_active_transfers() != 0) {
+    total_size += 2 +
+      ::_pbi::WireFormatLite::UInt64Size(
+        this->_internal_active_transfers());
+  }
+
+  // uint64 file_bytes = 47;
+  if (this->_internal_file_bytes() != 0) {
+    total_size += 2 +
+      ::_pbi::WireFormatLite::UInt64Size(
+        this->_internal_file_bytes());
+  }
+
+  // uint64 file_bytes_spooled = 48;
+  if (this->_internal_file_bytes_spooled() != 0) {
+    total_size += 2 +
+      ::_pbi::WireFormatLite::UInt64Size(
+        this->_internal_file_bytes_spooled());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ServerStats::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ServerStats::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ServerStats::GetClassData() const { return &_class_data_; }
+
+
+void ServerStats::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ServerStats*>(&to_msg);
+  auto& from = static_cast<const ServerStats&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.ServerStats)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.operations_.MergeFrom(from._impl_.operations_);
+  _this->_impl_.responses_.MergeFrom(from._impl_.responses_);
+  if (from._internal_has_queue_depth()) {
+    _this->_internal_mutable_queue_depth()->::chat::Distribution::MergeFrom(
+        from._internal_queue_depth());
+  }
+  if (from._internal_has_broadcast_fanout()) {
+    _this->_internal_mutable_broadcast_fanout()->::chat::Distribution::MergeFrom(
+        from._internal_broadcast_fanout());
+  }
+  if (from._internal_has_room_fanout()) {
+    _this->_internal_mutable_room_fanout()->::chat::Distribution::MergeFrom(
+        from._internal_room_fanout());
+  }
+  if (from._internal_has_pipeline_depth()) {
+    _this->_internal_mutable_pipeline_depth()->::chat::Distribution::MergeFrom(
+        from._internal_pipeline_depth());
+  }
+  if (from._internal_uptime_ms() != 0) {
+    _this->_internal_set_uptime_ms(from._internal_uptime_ms());
+  }
+  if (from._internal_bytes_in() != 0) {
+    _this->_internal_set_bytes_in(from._internal_bytes_in());
+  }
+  if (from._internal_bytes_out() != 0) {
+    _this->_internal_set_bytes_out(from._internal_bytes_out());
+  }
+  if (from._internal_active_connections() != 0) {
+    _this->_internal_set_active_connections(from._internal_active_connections());
+  }
+  if (from._internal_total_connections() != 0) {
+    _this->_internal_set_total_connections(from._internal_total_connections());
+  }
+  if (from._internal_queued_frames() != 0) {
+    _this->_internal_set_queued_frames(from._internal_queued_frames());
+  }
+  if (from._internal_queued_bytes() != 0) {
+    _this->_internal_set_queued_bytes(from._internal_queued_bytes());
+  }
+  if (from._internal_heap_allocations() != 0) {
+    _this->_internal_set_heap_allocations(from._internal_heap_allocations());
+  }
+  if (from._internal_read_calls() != 0) {
+    _this->_internal_set_read_calls(from._internal_read_calls());
+  }
+  if (from._internal_write_calls() != 0) {
+    _this->_internal_set_write_calls(from._internal_write_calls());
+  }
+  if (from._internal_packed_frames() != 0) {
+    _this->_internal_set_packed_frames(from._internal_packed_frames());
+  }
+  if (from._internal_offline_queued() != 0) {
+    _this->_internal_set_offline_queued(from._internal_offline_queued());
+  }
+  if (from._internal_offline_delivered() != 0) {
+    _this->_internal_set_offline_delivered(from._internal_offline_delivered());
+  }
+  if (from._internal_offline_pending() != 0) {
+    _this->_internal_set_offline_pending(from._internal_offline_pending());
+  }
+  if (from._internal_offline_syncs() != 0) {
+    _this->_internal_set_offline_syncs(from._internal_offline_syncs());
+  }
+  if (from._internal_routed_frames() != 0) {
+    _this->_internal_set_routed_frames(from._internal_routed_frames());
+  }
+  if (from._internal_active_rooms() != 0) {
+    _this->_internal_set_active_rooms(from._internal_active_rooms());
+  }
+  if (from._internal_slow_consumers() != 0) {
+    _this->_internal_set_slow_consumers(from._internal_slow_consumers());
+  }
+  if (from._internal_dropped_frames() != 0) {
+    _this->_internal_set_dropped_frames(from._internal_dropped_frames());
+  }
+  if (from._internal_overflow_disconnects() != 0) {
+    _this->_internal_set_overflow_disconnects(from._internal_overflow_disconnects());
+  }
+  if (from._internal_compressed_frames() != 0) {
+    _this->_internal_set_compressed_frames(from._internal_compressed_frames());
+  }
+  if (from._internal_compression_in_bytes() != 0) {
+    _this->_internal_set_compression_in_bytes(from._internal_compression_in_bytes());
+  }
+  if (from._internal_compression_out_bytes() != 0) {
+    _this->_internal_set_compression_out_bytes(from._internal_compression_out_bytes());
+  }
+  if (from._internal_compression_cpu_ns() != 0) {
+    _this->_internal_set_compression_cpu_ns(from._internal_compression_cpu_ns());
+  }
+  if (from._internal_presence_subscribers() != 0) {
+    _this->_internal_set_presence_subscribers(from._internal_presence_subscribers());
+  }
+  if (from._internal_presence_changes() != 0) {
+    _this->_internal_set_presence_changes(from._internal_presence_changes());
+  }
+  if (from._internal_presence_events() != 0) {
+    _this->_internal_set_presence_events(from._internal_presence_events());
+  }
+  if (from._internal_presence_updates() != 0) {
+    _this->_internal_set_presence_updates(from._internal_presence_updates());
+  }
+  if (from._internal_sessions() != 0) {
+    _this->_internal_set_sessions(from._internal_sessions());
+  }
+  if (from._internal_session_bytes() != 0) {
+    _this->_internal_set_session_bytes(from._internal_session_bytes());
+  }
+  if (from._internal_worker_jobs() != 0) {
+    _this->_internal_set_worker_jobs(from._internal_worker_jobs());
+  }
+  if (from._internal_stolen_jobs() != 0) {
+    _this->_internal_set_stolen_jobs(from._internal_stolen_jobs());
+  }
+  if (from._internal_detached_sessions() != 0) {
+    _this->_internal_set_detached_sessions(from._internal_detached_sessions());
+  }
+  if (from._internal_resumed_sessions() != 0) {
+    _this->_internal_set_resumed_sessions(from._internal_resumed_sessions());
+  }
+  if (from._internal_expired_sessions() != 0) {
+    _this->_internal_set_expired_sessions(from._internal_expired_sessions());
+  }
+  if (from._internal_resumed_frames() != 0) {
+    _this->_internal_set_resumed_frames(from._internal_resumed_frames());
+  }
+  if (from._internal_roster_builds() != 0) {
+    _this->_internal_set_roster_builds(from._internal_roster_builds());
+  }
+  if (from._internal_roster_served() != 0) {
+    _this->_internal_set_roster_served(from._internal_roster_served());
+  }
+  if (from._internal_file_transfers() != 0) {
+    _this->_internal_set_file_transfers(from._internal_file_transfers());
+  }
+  if (from._internal_active_transfers() != 0) {
+    _this->_internal_set_active_transfers(from._internal_active_transfers());
+  }
+  if (from._internal_file_bytes() != 0) {
+    _this->_internal_set_file_bytes(from._internal_file_bytes());
+  }
+  if (from._internal_file_bytes_spooled() != 0) {
+    _this->_internal_set_file_bytes_spooled(from._internal_file_bytes_spooled());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ServerStats::CopyFrom(const ServerStats& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chat.ServerStats)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ServerStats::IsInitialized() const {
+  return true;
+}
+
+void ServerStats::InternalSwap(ServerStats* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.operations_.InternalSwap(&other->_impl_.operations_);
+  _impl_.responses_.InternalSwap(&other->_impl_.responses_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(ServerStats, _impl_.file_bytes_spooled_)
+      + sizeof(ServerStats::_impl_.file_bytes_spooled_)
+      - PROTOBUF_FIELD_OFFSET(ServerStats, _impl_.queue_depth_)>(
+          reinterpret_cast<char*>(&_impl_.queue_depth_),
+          reinterpret_cast<char*>(&other->_impl_.queue_depth_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ServerStats::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_chat_2eproto_getter, &descriptor_table_chat_2eproto_once,
+      file_level_metadata_chat_2eproto[21]);
+}
+
+// ===================================================================
+
+class Response::_Internal {
+ public:
+  static const ::chat::UserListResponse& user_list(const Response* msg);
+  static const ::chat::IncomingMessageResponse& incoming_message(const Response* msg);
+  static const ::chat::ServerStats& stats(const Response* msg);
+  static const ::chat::SendMessageBatchResponse& message_batch(const Response* msg);
+  static const ::chat::RoomResponse& room(const Response* msg);
+  static const ::chat::PresenceUpdate& presence(const Response* msg);
+  static const ::chat::FileTransfer& transfer(const Response* msg);
+};
+
+const ::chat::UserListResponse&
+Response::_Internal::user_list(const Response* msg) {
+  return *msg->_impl_.result_.user_list_;
+}
+const ::chat::IncomingMessageResponse&
+Response::_Internal::incoming_message(const Response* msg) {
+  return *msg->_impl_.result_.incoming_message_;
+}
+const ::chat::ServerStats&
+Response::_Internal::stats(const Response* msg) {
+  return *msg->_impl_.result_.stats_;
+}
+const ::chat::SendMessageBatchResponse&
+Response::_Internal::message_batch(const Response* msg) {
+  return *msg->_impl_.result_.message_batch_;
+}
+const ::chat::RoomResponse&
+Response::_Internal::room(const Response* msg) {
+  return *msg->_impl_.result_.room_;
+}
+const ::chat::PresenceUpdate&
+Response::_Internal::presence(const Response* msg) {
+  return *msg->_impl_.result_.presence_;
+}
+const ::chat::FileTransfer&
+Response::_Internal::transfer(const Response* msg) {
+  return *msg->_impl_.result_.transfer_;
+}
+void Response::set_allocated_user_list(::chat::UserListResponse* user_list) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_result();
+  if (user_list) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(user_list);
+    if (message_arena != submessage_arena) {
+      user_list = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, user_list, submessage_arena);
+    }
+    set_has_user_list();
+    _impl_.result_.user_list_ = user_list;
+  }
+  // @@protoc_insertion_point(field_set_allocated:chat.Response.user_list)
+}
+void Response::set_allocated_incoming_message(::chat::IncomingMessageResponse* incoming_message) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_result();
+  if (incoming_message) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(incoming_message);
+    if (message_arena != submessage_arena) {
+      incoming_message = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, incoming_message, submessage_arena);
+    }
+    set_has_incoming_message();
+    _impl_.result_.incoming_message_ = incoming_message;
+  }
+  // @@protoc_insertion_point(field_set_allocated:chat.Response.incoming_message)
+}
+void Response::set_allocated_stats(::chat::ServerStats* stats) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_result();
+  if (stats) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(stats);
+    if (message_arena != submessage_arena) {
+      stats = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, stats, submessage_arena);
+    }
+    set_has_stats();
+    _impl_.result_.stats_ = stats;
+  }
+  // @@protoc_insertion_point(field_set_allocated:chat.Response.stats)
+}
+void Response::set_allocated_message_batch(::chat::SendMessageBatchResponse* message_batch) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_result();
+  if (message_batch) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(message_batch);
+    if (message_arena != submessage_arena) {
+      message_batch = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, message_batch, submessage_arena);
+    }
+    set_has_message_batch();
+    _impl_.result_.message_batch_ = message_batch;
+  }
+  // @@protoc_insertion_point(field_set_allocated:chat.Response.message_batch)
+}
+void Response::set_allocated_room(::chat::RoomResponse* room) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_result();
+  if (room) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(room);
+    if (message_arena != submessage_arena) {
+      room = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, room, submessage_arena);
+    }
+    set_has_room();
+    _impl_.result_.room_ = room;
+  }
+  // @@protoc_insertion_point(field_set_allocated:chat.Response.room)
+}
+void Response::set_allocated_presence(::chat::PresenceUpdate* presence) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_result();
+  if (presence) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(presence);
+    if (message_arena != submessage_arena) {
+      presence = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, presence, submessage_arena);
+    }
+    set_has_presence();
+    _impl_.result_.presence_ = presence;
+  }
+  // @@protoc_insertion_point(field_set_allocated:chat.Response.presence)
+}
+void Response::set_allocated_transfer(::chat::FileTransfer* transfer) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_result();
+  if (transfer) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(transfer);
+    if (message_arena != submessage_arena) {
+      transfer = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, transfer, submessage_arena);
+    }
+    set_has_transfer();
+    _impl_.result_.transfer_ = transfer;
+  }
+  // @@protoc_insertion_point(field_set_allocated:chat.Response.transfer)
+}
+Response::Response(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:chat.Response)
+}
+Response::Response(const Response& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Response* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.incoming_messages_){from._impl_.incoming_messages_}
+    , decltype(_impl_.message_){}
+    , decltype(_impl_.resume_token_){}
+    , decltype(_impl_.operation_){}
+    , decltype(_impl_.status_code_){}
+    , decltype(_impl_.request_id_){}
+    , decltype(_impl_.user_id_){}
+    , decltype(_impl_.compression_threshold_){}
+    , decltype(_impl_.result_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.message_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.message_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_message().empty()) {
+    _this->_impl_.message_.Set(from._internal_message(), 
+      _this->GetArenaForAllocation());
+  }
+  _impl_.resume_token_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.resume_token_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_resume_token().empty()) {
+    _this->_impl_.resume_token_.Set(from._internal_resume_token(), 
+      _this->GetArenaForAllocation());
+  }
+  ::memcpy(&_impl_.operation_, &from._impl_.operation_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.compression_threshold_) -
+    reinterpret_cast<char*>(&_impl_.operation_)) + sizeof(_impl_.compression_threshold_));
+  clear_has_result();
+  switch (from.result_case()) {
+    case kUserList: {
+      _this->_internal_mutable_user_list()->::chat::UserListResponse::MergeFrom(
+          from._internal_user_list());
+      break;
+    }
+    case kIncomingMessage: {
+      _this->_internal_mutable_incoming_message()->::chat::IncomingMessageResponse::MergeFrom(
+          from._internal_incoming_message());
+      break;
+    }
+    case kStats: {
+      _this->_internal_mutable_stats()->::chat::ServerStats::MergeFrom(
+          from._internal_stats());
+      break;
+    }
+    case kMessageBatch: {
+      _this->_internal_mutable_message_batch()->::chat::SendMessageBatchResponse::MergeFrom(
+          from._internal_message_batch());
+      break;
+    }
+    case kRoom: {
+      _this->_internal_mutable_room()->::chat::RoomResponse::MergeFrom(
+          from._internal_room());
+      break;
+    }
+    case kPresence: {
+      _this->_internal_mutable_presence()->::chat::PresenceUpdate::MergeFrom(
+          from._internal_presence());
+      break;
+    }
+    case kTransfer: {
+      _this->_internal_mutable_transfer()->::chat::FileTransfer::MergeFrom(
+          from._internal_transfer());
+      break;
+    }
+    case RESULT_NOT_SET: {
+      break;
+    }
+  }
+  // @@protoc_insertion_point(copy_constructor:chat.Response)
+}
+
+inline void Response::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.incoming_messages_){arena}
+    , decltype(_impl_.message_){}
+    , decltype(_impl_.resume_token_){}
+    , decltype(_impl_.operation_){0}
+    , decltype(_impl_.status_code_){0}
+    , decltype(_impl_.request_id_){uint64_t{0u}}
+    , decltype(_impl_.user_id_){uint64_t{0u}}
+    , decltype(_impl_.compression_threshold_){0u}
+    , decltype(_impl_.result_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}
+  };
+  _impl_.message_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.message_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  _impl_.resume_token_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.resume_token_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  clear_has_result();
+}
+
+Response::~Response() {
+  // @@protoc_insertion_point(destructor:chat.Response)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Response::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.incoming_messages_.~RepeatedPtrField();
+  _impl_.message_.Destroy();
+  _impl_.resume_token_.Destroy();
+  if (has_result()) {
+    clear_result();
+  }
+}
+
+void Response::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Response::clear_result() {
+// @@protoc_insertion_point(one_of_clear_start:chat.Response)
+  switch (result_case()) {
+    case kUserList: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.result_.user_list_;
+      }
+      break;
+    }
+    case kIncomingMessage: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.result_.incoming_message_;
+      }
+      break;
+    }
+    case kStats: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.result_.stats_;
+      }
+      break;
+    }
+    case kMessageBatch: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.result_.message_batch_;
+      }
+      break;
+    }
+    case kRoom: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.result_.room_;
+      }
+      break;
+    }
+    case kPresence: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.result_.presence_;
+      }
+      break;
+    }
+    case kTransfer: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.result_.transfer_;
+      }
+      break;
+    }
+    case RESULT_NOT_SET: {
+      break;
+    }
+  }
+  _impl_._oneof_case_[0] = RESULT_NOT_SET;
+}
+
+
+void Response::Clear() {
+// @@protoc_insertion_point(message_clear_start:chat.Response)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.incoming_messages_.Clear();
+  _impl_.message_.ClearToEmpty();
+  _impl_.resume_token_.ClearToEmpty();
+  ::memset(&_impl_.operation_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.compression_threshold_) -
+      reinterpret_cast<char*>(&_impl_.operation_)) + sizeof(_impl_.compression_threshold_));
+  clear_result();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Response::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .chat.Operation operation = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_operation(static_cast<::chat::Operation>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // .chat.StatusCode status_code = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_status_code(static_cast<::chat::StatusCode>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // string message = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_message();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "chat.Response.message"));
+        } else
+          goto handle_unusual;
+        continue;
+      // .chat.UserListResponse user_list = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_user_list(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .chat.IncomingMessageResponse incoming_message = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_incoming_message(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .chat.ServerStats stats = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr = ctx->ParseMessage(_internal_mutable_stats(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .chat.SendMessageBatchResponse message_batch = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr = ctx->ParseMessage(_internal_mutable_message_batch(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .chat.IncomingMessageResponse incoming_messages = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_incoming_messages(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<66>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // .chat.RoomResponse room = 9;
+      case 9:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 74)) {
+          ptr = ctx->ParseMessage(_internal_mutable_room(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 compression_threshold = 10;
+      case 10:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 80)) {
+          _impl_.compression_threshold_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 request_id = 11;
+      case 11:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 88)) {
+          _impl_.request_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .chat.PresenceUpdate presence = 12;
+      case 12:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 98)) {
+          ptr = ctx->ParseMessage(_internal_mutable_presence(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 user_id = 13;
+      case 13:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 104)) {
+          _impl_.user_id_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // bytes resume_token = 14;
+      case 14:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 114)) {
+          auto str = _internal_mutable_resume_token();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .chat.FileTransfer transfer = 15;
+      case 15:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 122)) {
+          ptr = ctx->ParseMessage(_internal_mutable_transfer(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Response::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:chat.Response)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .chat.Operation operation = 1;
+  if (this->_internal_operation() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      1, this->_internal_operation(), target);
+  }
+
+  // .chat.StatusCode status_code = 2;
+  if (this->_internal_status_code() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      2, this->_internal_status_code(), target);
+  }
+
+  // string message = 3;
+  if (!this->_internal_message().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_message().data(), static_cast<int>(this->_internal_message().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "chat.Response.message");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_message(), target);
+  }
+
+  // .chat.UserListResponse user_list = 4;
+  if (_internal_has_user_list()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(4, _Internal::user_list(this),
+        _Internal::user_list(this).GetCachedSize(), target, stream);
+  }
+
+  // .chat.IncomingMessageResponse incoming_message = 5;
+  if (_internal_has_incoming_message()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(5, _Internal::incoming_message(this),
+        _Internal::incoming_message(this).GetCachedSize(), target, stream);
+  }
+
+  // .chat.ServerStats stats = 6;
+  if (_internal_has_stats()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(6, _Internal::stats(this),
+        _Internal::stats(this).GetCachedSize(), target, stream);
+  }
+
+  // .chat.SendMessageBatchResponse message_batch = 7;
+  if (_internal_has_message_batch()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(7, _Internal::message_batch(this),
+        _Internal::message_batch(this).GetCachedSize(), target, stream);
+  }
+
+  // repeated .chat.IncomingMessageResponse incoming_messages = 8;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_incoming_messages_size()); i < n; i++) {
+    const auto& repfield = this->_internal_incoming_messages(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(8, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // .chat.RoomResponse room = 9;
+  if (_internal_has_room()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(9, _Internal::room(this),
+        _Internal::room(this).GetCachedSize(), target, stream);
+  }
+
+  // uint32 compression_threshold = 10;
+  if (this->_internal_compression_threshold() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(10, this->_internal_compression_threshold(), target);
+  }
+
+  // uint64 request_id = 11;
+  if (this->_internal_request_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(11, this->_internal_request_id(), target);
+  }
+
+  // .chat.PresenceUpdate presence = 12;
+  if (_internal_has_presence()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(12, _Internal::presence(this),
+        _Internal::presence(this).GetCachedSize(), target, stream);
+  }
+
+  // uint64 user_id = 13;
+  if (this->_internal_user_id() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(13, this->_internal_user_id(), target);
+  }
+
+  // bytes resume_token = 14;
+  if (!this->_internal_resume_token().empty()) {
+    target = stream->WriteBytesMaybeAliased(
+        14, this->_internal_resume_token(), target);
+  }
+
+  // .chat.FileTransfer transfer = 15;
+  if (_internal_has_transfer()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(15, _Internal::transfer(this),
+        _Internal::transfer(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:chat.Response)
+  return target;
+}
+
+size_t Response::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:chat.Response)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .chat.IncomingMessageResponse incoming_messages = 8;
+  total_size += 1UL * this->_internal_incoming_messages_size();
+  for (const auto& msg : this->_impl_.incoming_messages_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // string message = 3;
+  if (!this->_internal_message().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_message());
+  }
+
+  // bytes resume_token = 14;
+  if (!this->_internal_resume_token().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::BytesSize(
+        this->_internal_resume_token());
+  }
+
+  // .chat.Operation operation = 1;
+  if (this->_internal_operation() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_operation());
+  }
+
+  // .chat.StatusCode status_code = 2;
+  if (this->_internal_status_code() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_status_code());
+  }
+
+  // uint64 request_id = 11;
+  if (this->_internal_request_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_request_id());
+  }
+
+  // uint64 user_id = 13;
+  if (this->_internal_user_id() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_user_id());
+  }
+
+  // uint32 compression_threshold = 10;
+  if (this->_internal_compression_threshold() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_compression_threshold());
+  }
+
+  switch (result_case()) {
+    // .chat.UserListResponse user_list = 4;
+    case kUserList: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.result_.user_list_);
+      break;
+    }
+    // .chat.IncomingMessageResponse incoming_message = 5;
+    case kIncomingMessage: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.result_.incoming_message_);
+      break;
+    }
+    // .chat.ServerStats stats = 6;
+    case kStats: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.result_.stats_);
+      break;
+    }
+    // .chat.SendMessageBatchResponse message_batch = 7;
+    case kMessageBatch: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.result_.message_batch_);
+      break;
+    }
+    // .chat.RoomResponse room = 9;
+    case kRoom: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.result_.room_);
+      break;
+    }
+    // .chat.PresenceUpdate presence = 12;
+    case kPresence: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.result_.presence_);
+      break;
+    }
+    // .chat.FileTransfer transfer = 15;
+    case kTransfer: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.result_.transfer_);
+      break;
+    }
+    case RESULT_NOT_SET: {
+      break;
+    }
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Response::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Response::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Response::GetClassData() const { return &_class_data_; }
+
+
+void Response::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Response*>(&to_msg);
+  auto& from = static_cast<const Response&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:chat.Response)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.incoming_messages_.MergeFrom(from._impl_.incoming_messages_);
+  if (!from._internal_message().empty()) {
+    _this->_internal_set_message(from._internal_message());
+  }
+  if (!from._internal_resume_token().empty()) {
+    _this->_internal_set_resume_token(from._internal_resume_token());
+  }
+  if (from._internal_operation() != 0) {
+    _this->_internal_set_operation(from._internal_operation());
+  }
+  if (from._internal_status_code() != 0) {
+    _this->_internal_set_status_code(from._internal_status_code());
+  }
+  if (from._internal_request_id() != 0) {
+    _this->_internal_set_request_id(from._internal_request_id());
+  }
+  if (from._internal_user_id() != 0) {
+    _this->_internal_set_user_id(from._internal_user_id());
+  }
+  if (from._internal_compression_threshold() != 0) {
+    _this->_internal_set_compression_threshold(from._internal_compression_threshold());
+  }
+  switch (from.result_case()) {
+    case kUserList: {
+      _this->_internal_mutable_user_list()->::chat::UserListResponse::MergeFrom(
+          from._internal_user_list());
+      break;
+    }
+    case kIncomingMessage: {
+      _this->_internal_mutable_incoming_message()->::chat::IncomingMessageResponse::MergeFrom(
+          from._internal_incoming_message());
+      break;
+    }
+    case kStats: {
+      _this->_internal_mutable_stats()->::chat::ServerStats::MergeFrom(
+          from._internal_stats());
+      break;
+    }
+    case kMessageBatch: {
+      _this->_internal_mutable_message_batch()->::chat::SendMessageBatchResponse::MergeFrom(
+          from._internal_message_batch());
+      break;
+    }
+    case kRoom: {
+      _this->_internal_mutable_room()->::chat::RoomResponse::MergeFrom(
+          from._internal_room());
+      break;
+    }
+    case kPresence: {
+      _this->_internal_mutable_presence()->::chat::PresenceUpdate::MergeFrom(
+          from._internal_presence());
+      break;
+    }
+    case kTransfer: {
+      _this->_internal_mutable_transfer()->::chat::FileTransfer::MergeFrom(
+          from._internal_transfer());
+      break;
+    }
+    case RESULT_NOT_SET: {
+      break;
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Response::CopyFrom(const Response& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:chat.Response)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Response::IsInitialized() const {
+  return true;
+}
+
+void Response::InternalSwap(Response* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.incoming_messages_.InternalSwap(&other->_impl_.incoming_messages_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.message_, lhs_arena,
+      &other->_impl_.message_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.resume_token_, lhs_arena,
+      &other->_impl_.resume_token_, rhs_arena
+  );
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Response, _impl_.compression_threshold_)
+      + sizeof(Response::_impl_.compression_threshold_)
+      - PROTOBUF_FIELD_OFFSET(Response, _impl_.operation_)>(
+          reinterpret_cast<char*>(&_impl_.operation_),
+          reinterpret_cast<char*>(&other->_impl_.operation_));
+  swap(_impl_.result_, other->_impl_.result_);
+  swap(_impl_._oneof_case_[0], other->_impl_._oneof_case_[0]);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Response::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_chat_2eproto_getter, &descriptor_table_chat_2eproto_once,
+      file_level_metadata_chat_2eproto[22]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace chat
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::chat::User*
+Arena::CreateMaybeMessage< ::chat::User >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chat::User >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chat::NewUserRequest*
+Arena::CreateMaybeMessage< ::chat::NewUserRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chat::NewUserRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chat::ResumeRequest*
+Arena::CreateMaybeMessage< ::chat::ResumeRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chat::ResumeRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chat::FileOffer*
+Arena::CreateMaybeMessage< ::chat::FileOffer >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chat::FileOffer >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chat::FileWindow*
+Arena::CreateMaybeMessage< ::chat::FileWindow >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chat::FileWindow >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chat::SendMessageRequest*
+Arena::CreateMaybeMessage< ::chat::SendMessageRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chat::SendMessageRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chat::SendMessageBatchRequest*
+Arena::CreateMaybeMessage< ::chat::SendMessageBatchRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chat::SendMessageBatchRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chat::IncomingMessageResponse*
+Arena::CreateMaybeMessage< ::chat::IncomingMessageResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chat::IncomingMessageResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chat::RoomRequest*
+Arena::CreateMaybeMessage< ::chat::RoomRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chat::RoomRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chat::RoomResponse*
+Arena::CreateMaybeMessage< ::chat::RoomResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chat::RoomResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chat::SendMessageBatchResponse*
+Arena::CreateMaybeMessage< ::chat::SendMessageBatchResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chat::SendMessageBatchResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chat::UserListRequest*
+Arena::CreateMaybeMessage< ::chat::UserListRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chat::UserListRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chat::UserListResponse*
+Arena::CreateMaybeMessage< ::chat::UserListResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chat::UserListResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chat::PresenceEvent*
+Arena::CreateMaybeMessage< ::chat::PresenceEvent >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chat::PresenceEvent >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chat::PresenceUpdate*
+Arena::CreateMaybeMessage< ::chat::PresenceUpdate >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chat::PresenceUpdate >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chat::FileTransfer*
+Arena::CreateMaybeMessage< ::chat::FileTransfer >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chat::FileTransfer >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chat::UpdateStatusRequest*
+Arena::CreateMaybeMessage< ::chat::UpdateStatusRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chat::UpdateStatusRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chat::Request*
+Arena::CreateMaybeMessage< ::chat::Request >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chat::Request >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chat::Distribution*
+Arena::CreateMaybeMessage< ::chat::Distribution >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chat::Distribution >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chat::OperationStats*
+Arena::CreateMaybeMessage< ::chat::OperationStats >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chat::OperationStats >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chat::StatusCodeCount*
+Arena::CreateMaybeMessage< ::chat::StatusCodeCount >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chat::StatusCodeCount >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chat::ServerStats*
+Arena::CreateMaybeMessage< ::chat::ServerStats >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chat::ServerStats >(arena);
+}
+template<> PROTOBUF_NOINLINE ::chat::Response*
+Arena::CreateMaybeMessage< ::chat::Response >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::chat::Response >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
@@ -0,0 +1,10462 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: chat.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_chat_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_chat_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/generated_enum_reflection.h>
+#include <google/protobuf/unknown_field_set.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_chat_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_chat_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_chat_2eproto;
+namespace chat {
+class Distribution;
+struct DistributionDefaultTypeInternal;
+extern DistributionDefaultTypeInternal _Distribution_default_instance_;
+class FileOffer;
+struct FileOfferDefaultTypeInternal;
+extern FileOfferDefaultTypeInternal _FileOffer_default_instance_;
+class FileTransfer;
+struct FileTransferDefaultTypeInternal;
+extern FileTransferDefaultTypeInternal _FileTransfer_default_instance_;
+class FileWindow;
+struct FileWindowDefaultTypeInternal;
+extern FileWindowDefaultTypeInternal _FileWindow_default_instance_;
+class IncomingMessageResponse;
+struct IncomingMessageResponseDefaultTypeInternal;
+extern IncomingMessageResponseDefaultTypeInternal _IncomingMessageResponse_default_instance_;
+class NewUserRequest;
+struct NewUserRequestDefaultTypeInternal;
+extern NewUserRequestDefaultTypeInternal _NewUserRequest_default_instance_;
+class OperationStats;
+struct OperationStatsDefaultTypeInternal;
+extern OperationStatsDefaultTypeInternal _OperationStats_default_instance_;
+class PresenceEvent;
+struct PresenceEventDefaultTypeInternal;
+extern PresenceEventDefaultTypeInternal _PresenceEvent_default_instance_;
+class PresenceUpdate;
+struct PresenceUpdateDefaultTypeInternal;
+extern PresenceUpdateDefaultTypeInternal _PresenceUpdate_default_instance_;
+class Request;
+struct RequestDefaultTypeInternal;
+extern RequestDefaultTypeInternal _Request_default_instance_;
+class Response;
+struct ResponseDefaultTypeInternal;
+extern ResponseDefaultTypeInternal _Response_default_instance_;
+class ResumeRequest;
+struct ResumeRequestDefaultTypeInternal;
+extern ResumeRequestDefaultTypeInternal _ResumeRequest_default_instance_;
+class RoomRequest;
+struct RoomRequestDefaultTypeInternal;
+extern RoomRequestDefaultTypeInternal _RoomRequest_default_instance_;
+class RoomResponse;
+struct RoomResponseDefaultTypeInternal;
+extern RoomResponseDefaultTypeInternal _RoomResponse_default_instance_;
+class SendMessageBatchRequest;
+struct SendMessageBatchRequestDefaultTypeInternal;
+extern SendMessageBatchRequestDefaultTypeInternal _SendMessageBatchRequest_default_instance_;
+class SendMessageBatchResponse;
+struct SendMessageBatchResponseDefaultTypeInternal;
+extern SendMessageBatchResponseDefaultTypeInternal _SendMessageBatchResponse_default_instance_;
+class SendMessageRequest;
+struct SendMessageRequestDefaultTypeInternal;
+extern SendMessageRequestDefaultTypeInternal _SendMessageRequest_default_instance_;
+class ServerStats;
+struct ServerStatsDefaultTypeInternal;
+extern ServerStatsDefaultTypeInternal _ServerStats_default_instance_;
+class StatusCodeCount;
+struct StatusCodeCountDefaultTypeInternal;
+extern StatusCodeCountDefaultTypeInternal _StatusCodeCount_default_instance_;
+class UpdateStatusRequest;
+struct UpdateStatusRequestDefaultTypeInternal;
+extern UpdateStatusRequestDefaultTypeInternal _UpdateStatusRequest_default_instance_;
+class User;
+struct UserDefaultTypeInternal;
+extern UserDefaultTypeInternal _User_default_instance_;
+class UserListRequest;
+struct UserListRequestDefaultTypeInternal;
+extern UserListRequestDefaultTypeInternal _UserListRequest_default_instance_;
+class UserListResponse;
+struct UserListResponseDefaultTypeInternal;
+extern UserListResponseDefaultTypeInternal _UserListResponse_default_instance_;
+}  // namespace chat
+PROTOBUF_NAMESPACE_OPEN
+template<> ::chat::Distribution* Arena::CreateMaybeMessage<::chat::Distribution>(Arena*);
+template<> ::chat::FileOffer* Arena::CreateMaybeMessage<::chat::FileOffer>(Arena*);
+template<> ::chat::FileTransfer* Arena::CreateMaybeMessage<::chat::FileTransfer>(Arena*);
+template<> ::chat::FileWindow* Arena::CreateMaybeMessage<::chat::FileWindow>(Arena*);
+template<> ::chat::IncomingMessageResponse* Arena::CreateMaybeMessage<::chat::IncomingMessageResponse>(Arena*);
+template<> ::chat::NewUserRequest* Arena::CreateMaybeMessage<::chat::NewUserRequest>(Arena*);
+template<> ::chat::OperationStats* Arena::CreateMaybeMessage<::chat::OperationStats>(Arena*);
+template<> ::chat::PresenceEvent* Arena::CreateMaybeMessage<::chat::PresenceEvent>(Arena*);
+template<> ::chat::PresenceUpdate* Arena::CreateMaybeMessage<::chat::PresenceUpdate>(Arena*);
+template<> ::chat::Request* Arena::CreateMaybeMessage<::chat::Request>(Arena*);
+template<> ::chat::Response* Arena::CreateMaybeMessage<::chat::Response>(Arena*);
+template<> ::chat::ResumeRequest* Arena::CreateMaybeMessage<::chat::ResumeRequest>(Arena*);
+template<> ::chat::RoomRequest* Arena::CreateMaybeMessage<::chat::RoomRequest>(Arena*);
+template<> ::chat::RoomResponse* Arena::CreateMaybeMessage<::chat::RoomResponse>(Arena*);
+template<> ::chat::SendMessageBatchRequest* Arena::CreateMaybeMessage<::chat::SendMessageBatchRequest>(Arena*);
+template<> ::chat::SendMessageBatchResponse* Arena::CreateMaybeMessage<::chat::SendMessageBatchResponse>(Arena*);
+template<> ::chat::SendMessageRequest* Arena::CreateMaybeMessage<::chat::SendMessageRequest>(Arena*);
+template<> ::chat::ServerStats* Arena::CreateMaybeMessage<::chat::ServerStats>(Arena*);
+template<> ::chat::StatusCodeCount* Arena::CreateMaybeMessage<::chat::StatusCodeCount>(Arena*);
+template<> ::chat::UpdateStatusRequest* Arena::CreateMaybeMessage<::chat::UpdateStatusRequest>(Arena*);
+template<> ::chat::User* Arena::CreateMaybeMessage<::chat::User>(Arena*);
+template<> ::chat::UserListRequest* Arena::CreateMaybeMessage<::chat::UserListRequest>(Arena*);
+template<> ::chat::UserListResponse* Arena::CreateMaybeMessage<::chat::UserListResponse>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace chat {
+
+enum UserStatus : int {
+  ONLINE = 0,
+  BUSY = 1,
+  OFFLINE = 2,
+  UserStatus_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  UserStatus_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool UserStatus_IsValid(int value);
+constexpr UserStatus UserStatus_MIN = ONLINE;
+constexpr UserStatus UserStatus_MAX = OFFLINE;
+constexpr int UserStatus_ARRAYSIZE = UserStatus_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* UserStatus_descriptor();
+template<typename T>
+inline const std::string& UserStatus_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, UserStatus>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function UserStatus_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    UserStatus_descriptor(), enum_t_value);
+}
+inline bool UserStatus_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, UserStatus* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<UserStatus>(
+    UserStatus_descriptor(), name, value);
+}
+enum MessageType : int {
+  BROADCAST = 0,
+  DIRECT = 1,
+  ROOM = 2,
+  MessageType_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  MessageType_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool MessageType_IsValid(int value);
+constexpr MessageType MessageType_MIN = BROADCAST;
+constexpr MessageType MessageType_MAX = ROOM;
+constexpr int MessageType_ARRAYSIZE = MessageType_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* MessageType_descriptor();
+template<typename T>
+inline const std::string& MessageType_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, MessageType>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function MessageType_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    MessageType_descriptor(), enum_t_value);
+}
+inline bool MessageType_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, MessageType* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<MessageType>(
+    MessageType_descriptor(), name, value);
+}
+enum UserListType : int {
+  ALL = 0,
+  SINGLE = 1,
+  UserListType_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  UserListType_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool UserListType_IsValid(int value);
+constexpr UserListType UserListType_MIN = ALL;
+constexpr UserListType UserListType_MAX = SINGLE;
+constexpr int UserListType_ARRAYSIZE = UserListType_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* UserListType_descriptor();
+template<typename T>
+inline const std::string& UserListType_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, UserListType>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function UserListType_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    UserListType_descriptor(), enum_t_value);
+}
+inline bool UserListType_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, UserListType* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<UserListType>(
+    UserListType_descriptor(), name, value);
+}
+enum PresenceChange : int {
+  JOINED = 0,
+  LEFT = 1,
+  STATUS_CHANGED = 2,
+  PresenceChange_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  PresenceChange_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool PresenceChange_IsValid(int value);
+constexpr PresenceChange PresenceChange_MIN = JOINED;
+constexpr PresenceChange PresenceChange_MAX = STATUS_CHANGED;
+constexpr int PresenceChange_ARRAYSIZE = PresenceChange_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* PresenceChange_descriptor();
+template<typename T>
+inline const std::string& PresenceChange_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, PresenceChange>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function PresenceChange_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    PresenceChange_descriptor(), enum_t_value);
+}
+inline bool PresenceChange_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, PresenceChange* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<PresenceChange>(
+    PresenceChange_descriptor(), name, value);
+}
+enum Operation : int {
+  REGISTER_USER = 0,
+  SEND_MESSAGE = 1,
+  UPDATE_STATUS = 2,
+  GET_USERS = 3,
+  UNREGISTER_USER = 4,
+  INCOMING_MESSAGE = 5,
+  GET_STATS = 6,
+  SEND_MESSAGE_BATCH = 7,
+  INCOMING_MESSAGE_BATCH = 8,
+  JOIN_ROOM = 9,
+  LEAVE_ROOM = 10,
+  SUBSCRIBE_PRESENCE = 11,
+  UNSUBSCRIBE_PRESENCE = 12,
+  PRESENCE_UPDATE = 13,
+  RESUME = 14,
+  FILE_OFFER = 15,
+  FILE_ACCEPT = 16,
+  FILE_WINDOW = 17,
+  FILE_CANCEL = 18,
+  Operation_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  Operation_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool Operation_IsValid(int value);
+constexpr Operation Operation_MIN = REGISTER_USER;
+constexpr Operation Operation_MAX = FILE_CANCEL;
+constexpr int Operation_ARRAYSIZE = Operation_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* Operation_descriptor();
+template<typename T>
+inline const std::string& Operation_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, Operation>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function Operation_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    Operation_descriptor(), enum_t_value);
+}
+inline bool Operation_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, Operation* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<Operation>(
+    Operation_descriptor(), name, value);
+}
+enum StatusCode : int {
+  UNKNOWN_STATUS = 0,
+  OK = 200,
+  BAD_REQUEST = 400,
+  UNAUTHORIZED = 401,
+  FORBIDDEN = 403,
+  NOT_FOUND = 404,
+  CONFLICT = 409,
+  INTERNAL_SERVER_ERROR = 500,
+  NOT_IMPLEMENTED = 501,
+  StatusCode_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  StatusCode_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool StatusCode_IsValid(int value);
+constexpr StatusCode StatusCode_MIN = UNKNOWN_STATUS;
+constexpr StatusCode StatusCode_MAX = NOT_IMPLEMENTED;
+constexpr int StatusCode_ARRAYSIZE = StatusCode_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* StatusCode_descriptor();
+template<typename T>
+inline const std::string& StatusCode_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, StatusCode>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function StatusCode_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    StatusCode_descriptor(), enum_t_value);
+}
+inline bool StatusCode_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, StatusCode* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<StatusCode>(
+    StatusCode_descriptor(), name, value);
+}
+// ===================================================================
+
+class User final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.User) */ {
+ public:
+  inline User() : User(nullptr) {}
+  ~User() override;
+  explicit PROTOBUF_CONSTEXPR User(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  User(const User& from);
+  User(User&& from) noexcept
+    : User() {
+    *this = ::std::move(from);
+  }
+
+  inline User& operator=(const User& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline User& operator=(User&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const User& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const User* internal_default_instance() {
+    return reinterpret_cast<const User*>(
+               &_User_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(User& a, User& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(User* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(User* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  User* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<User>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const User& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const User& from) {
+    User::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(User* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.User";
+  }
+  protected:
+  explicit User(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kUsernameFieldNumber = 1,
+    kIpAddressFieldNumber = 2,
+    kIdFieldNumber = 4,
+    kStatusFieldNumber = 3,
+  };
+  // string username = 1;
+  void clear_username();
+  const std::string& username() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_username(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_username();
+  PROTOBUF_NODISCARD std::string* release_username();
+  void set_allocated_username(std::string* username);
+  private:
+  const std::string& _internal_username() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_username(const std::string& value);
+  std::string* _internal_mutable_username();
+  public:
+
+  // string ip_address = 2;
+  void clear_ip_address();
+  const std::string& ip_address() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_ip_address(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_ip_address();
+  PROTOBUF_NODISCARD std::string* release_ip_address();
+  void set_allocated_ip_address(std::string* ip_address);
+  private:
+  const std::string& _internal_ip_address() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_ip_address(const std::string& value);
+  std::string* _internal_mutable_ip_address();
+  public:
+
+  // uint64 id = 4;
+  void clear_id();
+  uint64_t id() const;
+  void set_id(uint64_t value);
+  private:
+  uint64_t _internal_id() const;
+  void _internal_set_id(uint64_t value);
+  public:
+
+  // .chat.UserStatus status = 3;
+  void clear_status();
+  ::chat::UserStatus status() const;
+  void set_status(::chat::UserStatus value);
+  private:
+  ::chat::UserStatus _internal_status() const;
+  void _internal_set_status(::chat::UserStatus value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:chat.User)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr username_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr ip_address_;
+    uint64_t id_;
+    int status_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_chat_2eproto;
+};
+// -------------------------------------------------------------------
+
+class NewUserRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.NewUserRequest) */ {
+ public:
+  inline NewUserRequest() : NewUserRequest(nullptr) {}
+  ~NewUserRequest() override;
+  explicit PROTOBUF_CONSTEXPR NewUserRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  NewUserRequest(const NewUserRequest& from);
+  NewUserRequest(NewUserRequest&& from) noexcept
+    : NewUserRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline NewUserRequest& operator=(const NewUserRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline NewUserRequest& operator=(NewUserRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const NewUserRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const NewUserRequest* internal_default_instance() {
+    return reinterpret_cast<const NewUserRequest*>(
+               &_NewUserRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(NewUserRequest& a, NewUserRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(NewUserRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(NewUserRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  NewUserRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<NewUserRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const NewUserRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const NewUserRequest& from) {
+    NewUserRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(NewUserRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.NewUserRequest";
+  }
+  protected:
+  explicit NewUserRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kUsernameFieldNumber = 1,
+    kAcceptBatchedDeliveryFieldNumber = 2,
+    kAcceptCompressionFieldNumber = 3,
+  };
+  // string username = 1;
+  void clear_username();
+  const std::string& username() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_username(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_username();
+  PROTOBUF_NODISCARD std::string* release_username();
+  void set_allocated_username(std::string* username);
+  private:
+  const std::string& _internal_username() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_username(const std::string& value);
+  std::string* _internal_mutable_username();
+  public:
+
+  // bool accept_batched_delivery = 2;
+  void clear_accept_batched_delivery();
+  bool accept_batched_delivery() const;
+  void set_accept_batched_delivery(bool value);
+  private:
+  bool _internal_accept_batched_delivery() const;
+  void _internal_set_accept_batched_delivery(bool value);
+  public:
+
+  // bool accept_compression = 3;
+  void clear_accept_compression();
+  bool accept_compression() const;
+  void set_accept_compression(bool value);
+  private:
+  bool _internal_accept_compression() const;
+  void _internal_set_accept_compression(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:chat.NewUserRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr username_;
+    bool accept_batched_delivery_;
+    bool accept_compression_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_chat_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ResumeRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.ResumeRequest) */ {
+ public:
+  inline ResumeRequest() : ResumeRequest(nullptr) {}
+  ~ResumeRequest() override;
+  explicit PROTOBUF_CONSTEXPR ResumeRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ResumeRequest(const ResumeRequest& from);
+  ResumeRequest(ResumeRequest&& from) noexcept
+    : ResumeRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline ResumeRequest& operator=(const ResumeRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ResumeRequest& operator=(ResumeRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ResumeRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ResumeRequest* internal_default_instance() {
+    return reinterpret_cast<const ResumeRequest*>(
+               &_ResumeRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(ResumeRequest& a, ResumeRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ResumeRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ResumeRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ResumeRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ResumeRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ResumeRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ResumeRequest& from) {
+    ResumeRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ResumeRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.ResumeRequest";
+  }
+  protected:
+  explicit ResumeRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTokenFieldNumber = 1,
+  };
+  // bytes token = 1;
+  void clear_token();
+  const std::string& token() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_token(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_token();
+  PROTOBUF_NODISCARD std::string* release_token();
+  void set_allocated_token(std::string* token);
+  private:
+  const std::string& _internal_token() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_token(const std::string& value);
+  std::string* _internal_mutable_token();
+  public:
+
+  // @@protoc_insertion_point(class_scope:chat.ResumeRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr token_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_chat_2eproto;
+};
+// -------------------------------------------------------------------
+
+class FileOffer final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.FileOffer) */ {
+ public:
+  inline FileOffer() : FileOffer(nullptr) {}
+  ~FileOffer() override;
+  explicit PROTOBUF_CONSTEXPR FileOffer(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  FileOffer(const FileOffer& from);
+  FileOffer(FileOffer&& from) noexcept
+    : FileOffer() {
+    *this = ::std::move(from);
+  }
+
+  inline FileOffer& operator=(const FileOffer& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline FileOffer& operator=(FileOffer&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const FileOffer& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const FileOffer* internal_default_instance() {
+    return reinterpret_cast<const FileOffer*>(
+               &_FileOffer_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(FileOffer& a, FileOffer& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(FileOffer* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(FileOffer* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  FileOffer* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<FileOffer>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const FileOffer& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const FileOffer& from) {
+    FileOffer::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(FileOffer* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.FileOffer";
+  }
+  protected:
+  explicit FileOffer(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRecipientFieldNumber = 1,
+    kNameFieldNumber = 3,
+    kRecipientIdFieldNumber = 2,
+    kSizeFieldNumber = 4,
+  };
+  // string recipient = 1;
+  void clear_recipient();
+  const std::string& recipient() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_recipient(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_recipient();
+  PROTOBUF_NODISCARD std::string* release_recipient();
+  void set_allocated_recipient(std::string* recipient);
+  private:
+  const std::string& _internal_recipient() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_recipient(const std::string& value);
+  std::string* _internal_mutable_recipient();
+  public:
+
+  // string name = 3;
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // uint64 recipient_id = 2;
+  void clear_recipient_id();
+  uint64_t recipient_id() const;
+  void set_recipient_id(uint64_t value);
+  private:
+  uint64_t _internal_recipient_id() const;
+  void _internal_set_recipient_id(uint64_t value);
+  public:
+
+  // uint64 size = 4;
+  void clear_size();
+  uint64_t size() const;
+  void set_size(uint64_t value);
+  private:
+  uint64_t _internal_size() const;
+  void _internal_set_size(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:chat.FileOffer)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr recipient_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    uint64_t recipient_id_;
+    uint64_t size_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_chat_2eproto;
+};
+// -------------------------------------------------------------------
+
+class FileWindow final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.FileWindow) */ {
+ public:
+  inline FileWindow() : FileWindow(nullptr) {}
+  ~FileWindow() override;
+  explicit PROTOBUF_CONSTEXPR FileWindow(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  FileWindow(const FileWindow& from);
+  FileWindow(FileWindow&& from) noexcept
+    : FileWindow() {
+    *this = ::std::move(from);
+  }
+
+  inline FileWindow& operator=(const FileWindow& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline FileWindow& operator=(FileWindow&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const FileWindow& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const FileWindow* internal_default_instance() {
+    return reinterpret_cast<const FileWindow*>(
+               &_FileWindow_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
+
+  friend void swap(FileWindow& a, FileWindow& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(FileWindow* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(FileWindow* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  FileWindow* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<FileWindow>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const FileWindow& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const FileWindow& from) {
+    FileWindow::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(FileWindow* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.FileWindow";
+  }
+  protected:
+  explicit FileWindow(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTransferIdFieldNumber = 1,
+    kBytesFieldNumber = 2,
+  };
+  // uint64 transfer_id = 1;
+  void clear_transfer_id();
+  uint64_t transfer_id() const;
+  void set_transfer_id(uint64_t value);
+  private:
+  uint64_t _internal_transfer_id() const;
+  void _internal_set_transfer_id(uint64_t value);
+  public:
+
+  // uint64 bytes = 2;
+  void clear_bytes();
+  uint64_t bytes() const;
+  void set_bytes(uint64_t value);
+  private:
+  uint64_t _internal_bytes() const;
+  void _internal_set_bytes(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:chat.FileWindow)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    uint64_t transfer_id_;
+    uint64_t bytes_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_chat_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SendMessageRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.SendMessageRequest) */ {
+ public:
+  inline SendMessageRequest() : SendMessageRequest(nullptr) {}
+  ~SendMessageRequest() override;
+  explicit PROTOBUF_CONSTEXPR SendMessageRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SendMessageRequest(const SendMessageRequest& from);
+  SendMessageRequest(SendMessageRequest&& from) noexcept
+    : SendMessageRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline SendMessageRequest& operator=(const SendMessageRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SendMessageRequest& operator=(SendMessageRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SendMessageRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SendMessageRequest* internal_default_instance() {
+    return reinterpret_cast<const SendMessageRequest*>(
+               &_SendMessageRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    5;
+
+  friend void swap(SendMessageRequest& a, SendMessageRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SendMessageRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SendMessageRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SendMessageRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SendMessageRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SendMessageRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SendMessageRequest& from) {
+    SendMessageRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SendMessageRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.SendMessageRequest";
+  }
+  protected:
+  explicit SendMessageRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRecipientFieldNumber = 1,
+    kContentFieldNumber = 2,
+    kRoomFieldNumber = 3,
+    kRecipientIdFieldNumber = 4,
+  };
+  // string recipient = 1;
+  void clear_recipient();
+  const std::string& recipient() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_recipient(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_recipient();
+  PROTOBUF_NODISCARD std::string* release_recipient();
+  void set_allocated_recipient(std::string* recipient);
+  private:
+  const std::string& _internal_recipient() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_recipient(const std::string& value);
+  std::string* _internal_mutable_recipient();
+  public:
+
+  // string content = 2;
+  void clear_content();
+  const std::string& content() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_content(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_content();
+  PROTOBUF_NODISCARD std::string* release_content();
+  void set_allocated_content(std::string* content);
+  private:
+  const std::string& _internal_content() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_content(const std::string& value);
+  std::string* _internal_mutable_content();
+  public:
+
+  // string room = 3;
+  void clear_room();
+  const std::string& room() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_room(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_room();
+  PROTOBUF_NODISCARD std::string* release_room();
+  void set_allocated_room(std::string* room);
+  private:
+  const std::string& _internal_room() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_room(const std::string& value);
+  std::string* _internal_mutable_room();
+  public:
+
+  // uint64 recipient_id = 4;
+  void clear_recipient_id();
+  uint64_t recipient_id() const;
+  void set_recipient_id(uint64_t value);
+  private:
+  uint64_t _internal_recipient_id() const;
+  void _internal_set_recipient_id(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:chat.SendMessageRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr recipient_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr content_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr room_;
+    uint64_t recipient_id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_chat_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SendMessageBatchRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.SendMessageBatchRequest) */ {
+ public:
+  inline SendMessageBatchRequest() : SendMessageBatchRequest(nullptr) {}
+  ~SendMessageBatchRequest() override;
+  explicit PROTOBUF_CONSTEXPR SendMessageBatchRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SendMessageBatchRequest(const SendMessageBatchRequest& from);
+  SendMessageBatchRequest(SendMessageBatchRequest&& from) noexcept
+    : SendMessageBatchRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline SendMessageBatchRequest& operator=(const SendMessageBatchRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SendMessageBatchRequest& operator=(SendMessageBatchRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SendMessageBatchRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SendMessageBatchRequest* internal_default_instance() {
+    return reinterpret_cast<const SendMessageBatchRequest*>(
+               &_SendMessageBatchRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    6;
+
+  friend void swap(SendMessageBatchRequest& a, SendMessageBatchRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SendMessageBatchRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SendMessageBatchRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SendMessageBatchRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SendMessageBatchRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SendMessageBatchRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SendMessageBatchRequest& from) {
+    SendMessageBatchRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SendMessageBatchRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.SendMessageBatchRequest";
+  }
+  protected:
+  explicit SendMessageBatchRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kMessagesFieldNumber = 1,
+  };
+  // repeated .chat.SendMessageRequest messages = 1;
+  int messages_size() const;
+  private:
+  int _internal_messages_size() const;
+  public:
+  void clear_messages();
+  ::chat::SendMessageRequest* mutable_messages(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::SendMessageRequest >*
+      mutable_messages();
+  private:
+  const ::chat::SendMessageRequest& _internal_messages(int index) const;
+  ::chat::SendMessageRequest* _internal_add_messages();
+  public:
+  const ::chat::SendMessageRequest& messages(int index) const;
+  ::chat::SendMessageRequest* add_messages();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::SendMessageRequest >&
+      messages() const;
+
+  // @@protoc_insertion_point(class_scope:chat.SendMessageBatchRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::SendMessageRequest > messages_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_chat_2eproto;
+};
+// -------------------------------------------------------------------
+
+class IncomingMessageResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.IncomingMessageResponse) */ {
+ public:
+  inline IncomingMessageResponse() : IncomingMessageResponse(nullptr) {}
+  ~IncomingMessageResponse() override;
+  explicit PROTOBUF_CONSTEXPR IncomingMessageResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  IncomingMessageResponse(const IncomingMessageResponse& from);
+  IncomingMessageResponse(IncomingMessageResponse&& from) noexcept
+    : IncomingMessageResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline IncomingMessageResponse& operator=(const IncomingMessageResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline IncomingMessageResponse& operator=(IncomingMessageResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const IncomingMessageResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const IncomingMessageResponse* internal_default_instance() {
+    return reinterpret_cast<const IncomingMessageResponse*>(
+               &_IncomingMessageResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    7;
+
+  friend void swap(IncomingMessageResponse& a, IncomingMessageResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(IncomingMessageResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(IncomingMessageResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  IncomingMessageResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<IncomingMessageResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const IncomingMessageResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const IncomingMessageResponse& from) {
+    IncomingMessageResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(IncomingMessageResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.IncomingMessageResponse";
+  }
+  protected:
+  explicit IncomingMessageResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSenderFieldNumber = 1,
+    kContentFieldNumber = 2,
+    kRoomFieldNumber = 4,
+    kSenderIdFieldNumber = 5,
+    kTypeFieldNumber = 3,
+  };
+  // string sender = 1;
+  void clear_sender();
+  const std::string& sender() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_sender(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_sender();
+  PROTOBUF_NODISCARD std::string* release_sender();
+  void set_allocated_sender(std::string* sender);
+  private:
+  const std::string& _internal_sender() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_sender(const std::string& value);
+  std::string* _internal_mutable_sender();
+  public:
+
+  // string content = 2;
+  void clear_content();
+  const std::string& content() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_content(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_content();
+  PROTOBUF_NODISCARD std::string* release_content();
+  void set_allocated_content(std::string* content);
+  private:
+  const std::string& _internal_content() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_content(const std::string& value);
+  std::string* _internal_mutable_content();
+  public:
+
+  // string room = 4;
+  void clear_room();
+  const std::string& room() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_room(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_room();
+  PROTOBUF_NODISCARD std::string* release_room();
+  void set_allocated_room(std::string* room);
+  private:
+  const std::string& _internal_room() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_room(const std::string& value);
+  std::string* _internal_mutable_room();
+  public:
+
+  // uint64 sender_id = 5;
+  void clear_sender_id();
+  uint64_t sender_id() const;
+  void set_sender_id(uint64_t value);
+  private:
+  uint64_t _internal_sender_id() const;
+  void _internal_set_sender_id(uint64_t value);
+  public:
+
+  // .chat.MessageType type = 3;
+  void clear_type();
+  ::chat::MessageType type() const;
+  void set_type(::chat::MessageType value);
+  private:
+  ::chat::MessageType _internal_type() const;
+  void _internal_set_type(::chat::MessageType value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:chat.IncomingMessageResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr sender_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr content_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr room_;
+    uint64_t sender_id_;
+    int type_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_chat_2eproto;
+};
+// -------------------------------------------------------------------
+
+class RoomRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.RoomRequest) */ {
+ public:
+  inline RoomRequest() : RoomRequest(nullptr) {}
+  ~RoomRequest() override;
+  explicit PROTOBUF_CONSTEXPR RoomRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  RoomRequest(const RoomRequest& from);
+  RoomRequest(RoomRequest&& from) noexcept
+    : RoomRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline RoomRequest& operator=(const RoomRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RoomRequest& operator=(RoomRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RoomRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RoomRequest* internal_default_instance() {
+    return reinterpret_cast<const RoomRequest*>(
+               &_RoomRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    8;
+
+  friend void swap(RoomRequest& a, RoomRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RoomRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RoomRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  RoomRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RoomRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const RoomRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RoomRequest& from) {
+    RoomRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(RoomRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.RoomRequest";
+  }
+  protected:
+  explicit RoomRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRoomFieldNumber = 1,
+  };
+  // string room = 1;
+  void clear_room();
+  const std::string& room() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_room(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_room();
+  PROTOBUF_NODISCARD std::string* release_room();
+  void set_allocated_room(std::string* room);
+  private:
+  const std::string& _internal_room() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_room(const std::string& value);
+  std::string* _internal_mutable_room();
+  public:
+
+  // @@protoc_insertion_point(class_scope:chat.RoomRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr room_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_chat_2eproto;
+};
+// -------------------------------------------------------------------
+
+class RoomResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.RoomResponse) */ {
+ public:
+  inline RoomResponse() : RoomResponse(nullptr) {}
+  ~RoomResponse() override;
+  explicit PROTOBUF_CONSTEXPR RoomResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  RoomResponse(const RoomResponse& from);
+  RoomResponse(RoomResponse&& from) noexcept
+    : RoomResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline RoomResponse& operator=(const RoomResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RoomResponse& operator=(RoomResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RoomResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RoomResponse* internal_default_instance() {
+    return reinterpret_cast<const RoomResponse*>(
+               &_RoomResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    9;
+
+  friend void swap(RoomResponse& a, RoomResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RoomResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RoomResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  RoomResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RoomResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const RoomResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RoomResponse& from) {
+    RoomResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(RoomResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.RoomResponse";
+  }
+  protected:
+  explicit RoomResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRoomFieldNumber = 1,
+    kMembersFieldNumber = 2,
+  };
+  // string room = 1;
+  void clear_room();
+  const std::string& room() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_room(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_room();
+  PROTOBUF_NODISCARD std::string* release_room();
+  void set_allocated_room(std::string* room);
+  private:
+  const std::string& _internal_room() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_room(const std::string& value);
+  std::string* _internal_mutable_room();
+  public:
+
+  // uint32 members = 2;
+  void clear_members();
+  uint32_t members() const;
+  void set_members(uint32_t value);
+  private:
+  uint32_t _internal_members() const;
+  void _internal_set_members(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:chat.RoomResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr room_;
+    uint32_t members_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_chat_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SendMessageBatchResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.SendMessageBatchResponse) */ {
+ public:
+  inline SendMessageBatchResponse() : SendMessageBatchResponse(nullptr) {}
+  ~SendMessageBatchResponse() override;
+  explicit PROTOBUF_CONSTEXPR SendMessageBatchResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  SendMessageBatchResponse(const SendMessageBatchResponse& from);
+  SendMessageBatchResponse(SendMessageBatchResponse&& from) noexcept
+    : SendMessageBatchResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline SendMessageBatchResponse& operator=(const SendMessageBatchResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SendMessageBatchResponse& operator=(SendMessageBatchResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const SendMessageBatchResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const SendMessageBatchResponse* internal_default_instance() {
+    return reinterpret_cast<const SendMessageBatchResponse*>(
+               &_SendMessageBatchResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    10;
+
+  friend void swap(SendMessageBatchResponse& a, SendMessageBatchResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SendMessageBatchResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SendMessageBatchResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  SendMessageBatchResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<SendMessageBatchResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const SendMessageBatchResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const SendMessageBatchResponse& from) {
+    SendMessageBatchResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SendMessageBatchResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.SendMessageBatchResponse";
+  }
+  protected:
+  explicit SendMessageBatchResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kResultsFieldNumber = 1,
+  };
+  // repeated .chat.StatusCode results = 1;
+  int results_size() const;
+  private:
+  int _internal_results_size() const;
+  public:
+  void clear_results();
+  private:
+  ::chat::StatusCode _internal_results(int index) const;
+  void _internal_add_results(::chat::StatusCode value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>* _internal_mutable_results();
+  public:
+  ::chat::StatusCode results(int index) const;
+  void set_results(int index, ::chat::StatusCode value);
+  void add_results(::chat::StatusCode value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>& results() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>* mutable_results();
+
+  // @@protoc_insertion_point(class_scope:chat.SendMessageBatchResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField<int> results_;
+    mutable std::atomic<int> _results_cached_byte_size_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_chat_2eproto;
+};
+// -------------------------------------------------------------------
+
+class UserListRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.UserListRequest) */ {
+ public:
+  inline UserListRequest() : UserListRequest(nullptr) {}
+  ~UserListRequest() override;
+  explicit PROTOBUF_CONSTEXPR UserListRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  UserListRequest(const UserListRequest& from);
+  UserListRequest(UserListRequest&& from) noexcept
+    : UserListRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline UserListRequest& operator=(const UserListRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline UserListRequest& operator=(UserListRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const UserListRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const UserListRequest* internal_default_instance() {
+    return reinterpret_cast<const UserListRequest*>(
+               &_UserListRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    11;
+
+  friend void swap(UserListRequest& a, UserListRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(UserListRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(UserListRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  UserListRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<UserListRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const UserListRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const UserListRequest& from) {
+    UserListRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(UserListRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.UserListRequest";
+  }
+  protected:
+  explicit UserListRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kUsernameFieldNumber = 1,
+  };
+  // string username = 1;
+  void clear_username();
+  const std::string& username() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_username(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_username();
+  PROTOBUF_NODISCARD std::string* release_username();
+  void set_allocated_username(std::string* username);
+  private:
+  const std::string& _internal_username() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_username(const std::string& value);
+  std::string* _internal_mutable_username();
+  public:
+
+  // @@protoc_insertion_point(class_scope:chat.UserListRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr username_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_chat_2eproto;
+};
+// -------------------------------------------------------------------
+
+class UserListResponse final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.UserListResponse) */ {
+ public:
+  inline UserListResponse() : UserListResponse(nullptr) {}
+  ~UserListResponse() override;
+  explicit PROTOBUF_CONSTEXPR UserListResponse(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  UserListResponse(const UserListResponse& from);
+  UserListResponse(UserListResponse&& from) noexcept
+    : UserListResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline UserListResponse& operator=(const UserListResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline UserListResponse& operator=(UserListResponse&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const UserListResponse& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const UserListResponse* internal_default_instance() {
+    return reinterpret_cast<const UserListResponse*>(
+               &_UserListResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    12;
+
+  friend void swap(UserListResponse& a, UserListResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(UserListResponse* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(UserListResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  UserListResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<UserListResponse>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const UserListResponse& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const UserListResponse& from) {
+    UserListResponse::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(UserListResponse* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.UserListResponse";
+  }
+  protected:
+  explicit UserListResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kUsersFieldNumber = 1,
+    kTypeFieldNumber = 2,
+  };
+  // repeated .chat.User users = 1;
+  int users_size() const;
+  private:
+  int _internal_users_size() const;
+  public:
+  void clear_users();
+  ::chat::User* mutable_users(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::User >*
+      mutable_users();
+  private:
+  const ::chat::User& _internal_users(int index) const;
+  ::chat::User* _internal_add_users();
+  public:
+  const ::chat::User& users(int index) const;
+  ::chat::User* add_users();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::User >&
+      users() const;
+
+  // .chat.UserListType type = 2;
+  void clear_type();
+  ::chat::UserListType type() const;
+  void set_type(::chat::UserListType value);
+  private:
+  ::chat::UserListType _internal_type() const;
+  void _internal_set_type(::chat::UserListType value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:chat.UserListResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::User > users_;
+    int type_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_chat_2eproto;
+};
+// -------------------------------------------------------------------
+
+class PresenceEvent final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.PresenceEvent) */ {
+ public:
+  inline PresenceEvent() : PresenceEvent(nullptr) {}
+  ~PresenceEvent() override;
+  explicit PROTOBUF_CONSTEXPR PresenceEvent(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  PresenceEvent(const PresenceEvent& from);
+  PresenceEvent(PresenceEvent&& from) noexcept
+    : PresenceEvent() {
+    *this = ::std::move(from);
+  }
+
+  inline PresenceEvent& operator=(const PresenceEvent& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PresenceEvent& operator=(PresenceEvent&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PresenceEvent& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PresenceEvent* internal_default_instance() {
+    return reinterpret_cast<const PresenceEvent*>(
+               &_PresenceEvent_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    13;
+
+  friend void swap(PresenceEvent& a, PresenceEvent& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PresenceEvent* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PresenceEvent* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  PresenceEvent* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PresenceEvent>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PresenceEvent& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PresenceEvent& from) {
+    PresenceEvent::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PresenceEvent* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.PresenceEvent";
+  }
+  protected:
+  explicit PresenceEvent(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kUsernameFieldNumber = 1,
+    kChangeFieldNumber = 2,
+    kStatusFieldNumber = 3,
+    kUserIdFieldNumber = 4,
+  };
+  // string username = 1;
+  void clear_username();
+  const std::string& username() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_username(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_username();
+  PROTOBUF_NODISCARD std::string* release_username();
+  void set_allocated_username(std::string* username);
+  private:
+  const std::string& _internal_username() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_username(const std::string& value);
+  std::string* _internal_mutable_username();
+  public:
+
+  // .chat.PresenceChange change = 2;
+  void clear_change();
+  ::chat::PresenceChange change() const;
+  void set_change(::chat::PresenceChange value);
+  private:
+  ::chat::PresenceChange _internal_change() const;
+  void _internal_set_change(::chat::PresenceChange value);
+  public:
+
+  // .chat.UserStatus status = 3;
+  void clear_status();
+  ::chat::UserStatus status() const;
+  void set_status(::chat::UserStatus value);
+  private:
+  ::chat::UserStatus _internal_status() const;
+  void _internal_set_status(::chat::UserStatus value);
+  public:
+
+  // uint64 user_id = 4;
+  void clear_user_id();
+  uint64_t user_id() const;
+  void set_user_id(uint64_t value);
+  private:
+  uint64_t _internal_user_id() const;
+  void _internal_set_user_id(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:chat.PresenceEvent)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr username_;
+    int change_;
+    int status_;
+    uint64_t user_id_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_chat_2eproto;
+};
+// -------------------------------------------------------------------
+
+class PresenceUpdate final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.PresenceUpdate) */ {
+ public:
+  inline PresenceUpdate() : PresenceUpdate(nullptr) {}
+  ~PresenceUpdate() override;
+  explicit PROTOBUF_CONSTEXPR PresenceUpdate(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  PresenceUpdate(const PresenceUpdate& from);
+  PresenceUpdate(PresenceUpdate&& from) noexcept
+    : PresenceUpdate() {
+    *this = ::std::move(from);
+  }
+
+  inline PresenceUpdate& operator=(const PresenceUpdate& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline PresenceUpdate& operator=(PresenceUpdate&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const PresenceUpdate& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const PresenceUpdate* internal_default_instance() {
+    return reinterpret_cast<const PresenceUpdate*>(
+               &_PresenceUpdate_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    14;
+
+  friend void swap(PresenceUpdate& a, PresenceUpdate& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(PresenceUpdate* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(PresenceUpdate* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  PresenceUpdate* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<PresenceUpdate>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const PresenceUpdate& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const PresenceUpdate& from) {
+    PresenceUpdate::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(PresenceUpdate* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.PresenceUpdate";
+  }
+  protected:
+  explicit PresenceUpdate(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kUsersFieldNumber = 4,
+    kEventsFieldNumber = 5,
+    kVersionFieldNumber = 2,
+    kSinceVersionFieldNumber = 3,
+    kSnapshotFieldNumber = 1,
+  };
+  // repeated .chat.User users = 4;
+  int users_size() const;
+  private:
+  int _internal_users_size() const;
+  public:
+  void clear_users();
+  ::chat::User* mutable_users(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::User >*
+      mutable_users();
+  private:
+  const ::chat::User& _internal_users(int index) const;
+  ::chat::User* _internal_add_users();
+  public:
+  const ::chat::User& users(int index) const;
+  ::chat::User* add_users();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::User >&
+      users() const;
+
+  // repeated .chat.PresenceEvent events = 5;
+  int events_size() const;
+  private:
+  int _internal_events_size() const;
+  public:
+  void clear_events();
+  ::chat::PresenceEvent* mutable_events(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::PresenceEvent >*
+      mutable_events();
+  private:
+  const ::chat::PresenceEvent& _internal_events(int index) const;
+  ::chat::PresenceEvent* _internal_add_events();
+  public:
+  const ::chat::PresenceEvent& events(int index) const;
+  ::chat::PresenceEvent* add_events();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::PresenceEvent >&
+      events() const;
+
+  // uint64 version = 2;
+  void clear_version();
+  uint64_t version() const;
+  void set_version(uint64_t value);
+  private:
+  uint64_t _internal_version() const;
+  void _internal_set_version(uint64_t value);
+  public:
+
+  // uint64 since_version = 3;
+  void clear_since_version();
+  uint64_t since_version() const;
+  void set_since_version(uint64_t value);
+  private:
+  uint64_t _internal_since_version() const;
+  void _internal_set_since_version(uint64_t value);
+  public:
+
+  // bool snapshot = 1;
+  void clear_snapshot();
+  bool snapshot() const;
+  void set_snapshot(bool value);
+  private:
+  bool _internal_snapshot() const;
+  void _internal_set_snapshot(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:chat.PresenceUpdate)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::User > users_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::PresenceEvent > events_;
+    uint64_t version_;
+    uint64_t since_version_;
+    bool snapshot_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_chat_2eproto;
+};
+// -------------------------------------------------------------------
+
+class FileTransfer final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.FileTransfer) */ {
+ public:
+  inline FileTransfer() : FileTransfer(nullptr) {}
+  ~FileTransfer() override;
+  explicit PROTOBUF_CONSTEXPR FileTransfer(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  FileTransfer(const FileTransfer& from);
+  FileTransfer(FileTransfer&& from) noexcept
+    : FileTransfer() {
+    *this = ::std::move(from);
+  }
+
+  inline FileTransfer& operator=(const FileTransfer& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline FileTransfer& operator=(FileTransfer&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const FileTransfer& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const FileTransfer* internal_default_instance() {
+    return reinterpret_cast<const FileTransfer*>(
+               &_FileTransfer_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    15;
+
+  friend void swap(FileTransfer& a, FileTransfer& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(FileTransfer* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(FileTransfer* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  FileTransfer* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<FileTransfer>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const FileTransfer& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const FileTransfer& from) {
+    FileTransfer::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(FileTransfer* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.FileTransfer";
+  }
+  protected:
+  explicit FileTransfer(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSenderFieldNumber = 2,
+    kNameFieldNumber = 4,
+    kTransferIdFieldNumber = 1,
+    kSenderIdFieldNumber = 3,
+    kSizeFieldNumber = 5,
+    kWindowFieldNumber = 6,
+  };
+  // string sender = 2;
+  void clear_sender();
+  const std::string& sender() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_sender(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_sender();
+  PROTOBUF_NODISCARD std::string* release_sender();
+  void set_allocated_sender(std::string* sender);
+  private:
+  const std::string& _internal_sender() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_sender(const std::string& value);
+  std::string* _internal_mutable_sender();
+  public:
+
+  // string name = 4;
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // uint64 transfer_id = 1;
+  void clear_transfer_id();
+  uint64_t transfer_id() const;
+  void set_transfer_id(uint64_t value);
+  private:
+  uint64_t _internal_transfer_id() const;
+  void _internal_set_transfer_id(uint64_t value);
+  public:
+
+  // uint64 sender_id = 3;
+  void clear_sender_id();
+  uint64_t sender_id() const;
+  void set_sender_id(uint64_t value);
+  private:
+  uint64_t _internal_sender_id() const;
+  void _internal_set_sender_id(uint64_t value);
+  public:
+
+  // uint64 size = 5;
+  void clear_size();
+  uint64_t size() const;
+  void set_size(uint64_t value);
+  private:
+  uint64_t _internal_size() const;
+  void _internal_set_size(uint64_t value);
+  public:
+
+  // uint64 window = 6;
+  void clear_window();
+  uint64_t window() const;
+  void set_window(uint64_t value);
+  private:
+  uint64_t _internal_window() const;
+  void _internal_set_window(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:chat.FileTransfer)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr sender_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    uint64_t transfer_id_;
+    uint64_t sender_id_;
+    uint64_t size_;
+    uint64_t window_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_chat_2eproto;
+};
+// -------------------------------------------------------------------
+
+class UpdateStatusRequest final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.UpdateStatusRequest) */ {
+ public:
+  inline UpdateStatusRequest() : UpdateStatusRequest(nullptr) {}
+  ~UpdateStatusRequest() override;
+  explicit PROTOBUF_CONSTEXPR UpdateStatusRequest(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  UpdateStatusRequest(const UpdateStatusRequest& from);
+  UpdateStatusRequest(UpdateStatusRequest&& from) noexcept
+    : UpdateStatusRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline UpdateStatusRequest& operator=(const UpdateStatusRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline UpdateStatusRequest& operator=(UpdateStatusRequest&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const UpdateStatusRequest& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const UpdateStatusRequest* internal_default_instance() {
+    return reinterpret_cast<const UpdateStatusRequest*>(
+               &_UpdateStatusRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    16;
+
+  friend void swap(UpdateStatusRequest& a, UpdateStatusRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(UpdateStatusRequest* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(UpdateStatusRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  UpdateStatusRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<UpdateStatusRequest>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const UpdateStatusRequest& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const UpdateStatusRequest& from) {
+    UpdateStatusRequest::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(UpdateStatusRequest* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.UpdateStatusRequest";
+  }
+  protected:
+  explicit UpdateStatusRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kUsernameFieldNumber = 1,
+    kNewStatusFieldNumber = 2,
+  };
+  // string username = 1;
+  void clear_username();
+  const std::string& username() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_username(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_username();
+  PROTOBUF_NODISCARD std::string* release_username();
+  void set_allocated_username(std::string* username);
+  private:
+  const std::string& _internal_username() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_username(const std::string& value);
+  std::string* _internal_mutable_username();
+  public:
+
+  // .chat.UserStatus new_status = 2;
+  void clear_new_status();
+  ::chat::UserStatus new_status() const;
+  void set_new_status(::chat::UserStatus value);
+  private:
+  ::chat::UserStatus _internal_new_status() const;
+  void _internal_set_new_status(::chat::UserStatus value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:chat.UpdateStatusRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr username_;
+    int new_status_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_chat_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Request final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.Request) */ {
+ public:
+  inline Request() : Request(nullptr) {}
+  ~Request() override;
+  explicit PROTOBUF_CONSTEXPR Request(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Request(const Request& from);
+  Request(Request&& from) noexcept
+    : Request() {
+    *this = ::std::move(from);
+  }
+
+  inline Request& operator=(const Request& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Request& operator=(Request&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Request& default_instance() {
+    return *internal_default_instance();
+  }
+  enum PayloadCase {
+    kRegisterUser = 2,
+    kSendMessage = 3,
+    kUpdateStatus = 4,
+    kGetUsers = 5,
+    kUnregisterUser = 6,
+    kSendMessageBatch = 7,
+    kJoinRoom = 8,
+    kLeaveRoom = 9,
+    kResume = 11,
+    kFileOffer = 12,
+    kFileWindow = 13,
+    PAYLOAD_NOT_SET = 0,
+  };
+
+  static inline const Request* internal_default_instance() {
+    return reinterpret_cast<const Request*>(
+               &_Request_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    17;
+
+  friend void swap(Request& a, Request& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Request* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Request* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Request* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Request>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Request& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Request& from) {
+    Request::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Request* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.Request";
+  }
+  protected:
+  explicit Request(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRequestIdFieldNumber = 10,
+    kOperationFieldNumber = 1,
+    kRegisterUserFieldNumber = 2,
+    kSendMessageFieldNumber = 3,
+    kUpdateStatusFieldNumber = 4,
+    kGetUsersFieldNumber = 5,
+    kUnregisterUserFieldNumber = 6,
+    kSendMessageBatchFieldNumber = 7,
+    kJoinRoomFieldNumber = 8,
+    kLeaveRoomFieldNumber = 9,
+    kResumeFieldNumber = 11,
+    kFileOfferFieldNumber = 12,
+    kFileWindowFieldNumber = 13,
+  };
+  // uint64 request_id = 10;
+  void clear_request_id();
+  uint64_t request_id() const;
+  void set_request_id(uint64_t value);
+  private:
+  uint64_t _internal_request_id() const;
+  void _internal_set_request_id(uint64_t value);
+  public:
+
+  // .chat.Operation operation = 1;
+  void clear_operation();
+  ::chat::Operation operation() const;
+  void set_operation(::chat::Operation value);
+  private:
+  ::chat::Operation _internal_operation() const;
+  void _internal_set_operation(::chat::Operation value);
+  public:
+
+  // .chat.NewUserRequest register_user = 2;
+  bool has_register_user() const;
+  private:
+  bool _internal_has_register_user() const;
+  public:
+  void clear_register_user();
+  const ::chat::NewUserRequest& register_user() const;
+  PROTOBUF_NODISCARD ::chat::NewUserRequest* release_register_user();
+  ::chat::NewUserRequest* mutable_register_user();
+  void set_allocated_register_user(::chat::NewUserRequest* register_user);
+  private:
+  const ::chat::NewUserRequest& _internal_register_user() const;
+  ::chat::NewUserRequest* _internal_mutable_register_user();
+  public:
+  void unsafe_arena_set_allocated_register_user(
+      ::chat::NewUserRequest* register_user);
+  ::chat::NewUserRequest* unsafe_arena_release_register_user();
+
+  // .chat.SendMessageRequest send_message = 3;
+  bool has_send_message() const;
+  private:
+  bool _internal_has_send_message() const;
+  public:
+  void clear_send_message();
+  const ::chat::SendMessageRequest& send_message() const;
+  PROTOBUF_NODISCARD ::chat::SendMessageRequest* release_send_message();
+  ::chat::SendMessageRequest* mutable_send_message();
+  void set_allocated_send_message(::chat::SendMessageRequest* send_message);
+  private:
+  const ::chat::SendMessageRequest& _internal_send_message() const;
+  ::chat::SendMessageRequest* _internal_mutable_send_message();
+  public:
+  void unsafe_arena_set_allocated_send_message(
+      ::chat::SendMessageRequest* send_message);
+  ::chat::SendMessageRequest* unsafe_arena_release_send_message();
+
+  // .chat.UpdateStatusRequest update_status = 4;
+  bool has_update_status() const;
+  private:
+  bool _internal_has_update_status() const;
+  public:
+  void clear_update_status();
+  const ::chat::UpdateStatusRequest& update_status() const;
+  PROTOBUF_NODISCARD ::chat::UpdateStatusRequest* release_update_status();
+  ::chat::UpdateStatusRequest* mutable_update_status();
+  void set_allocated_update_status(::chat::UpdateStatusRequest* update_status);
+  private:
+  const ::chat::UpdateStatusRequest& _internal_update_status() const;
+  ::chat::UpdateStatusRequest* _internal_mutable_update_status();
+  public:
+  void unsafe_arena_set_allocated_update_status(
+      ::chat::UpdateStatusRequest* update_status);
+  ::chat::UpdateStatusRequest* unsafe_arena_release_update_status();
+
+  // .chat.UserListRequest get_users = 5;
+  bool has_get_users() const;
+  private:
+  bool _internal_has_get_users() const;
+  public:
+  void clear_get_users();
+  const ::chat::UserListRequest& get_users() const;
+  PROTOBUF_NODISCARD ::chat::UserListRequest* release_get_users();
+  ::chat::UserListRequest* mutable_get_users();
+  void set_allocated_get_users(::chat::UserListRequest* get_users);
+  private:
+  const ::chat::UserListRequest& _internal_get_users() const;
+  ::chat::UserListRequest* _internal_mutable_get_users();
+  public:
+  void unsafe_arena_set_allocated_get_users(
+      ::chat::UserListRequest* get_users);
+  ::chat::UserListRequest* unsafe_arena_release_get_users();
+
+  // .chat.User unregister_user = 6;
+  bool has_unregister_user() const;
+  private:
+  bool _internal_has_unregister_user() const;
+  public:
+  void clear_unregister_user();
+  const ::chat::User& unregister_user() const;
+  PROTOBUF_NODISCARD ::chat::User* release_unregister_user();
+  ::chat::User* mutable_unregister_user();
+  void set_allocated_unregister_user(::chat::User* unregister_user);
+  private:
+  const ::chat::User& _internal_unregister_user() const;
+  ::chat::User* _internal_mutable_unregister_user();
+  public:
+  void unsafe_arena_set_allocated_unregister_user(
+      ::chat::User* unregister_user);
+  ::chat::User* unsafe_arena_release_unregister_user();
+
+  // .chat.SendMessageBatchRequest send_message_batch = 7;
+  bool has_send_message_batch() const;
+  private:
+  bool _internal_has_send_message_batch() const;
+  public:
+  void clear_send_message_batch();
+  const ::chat::SendMessageBatchRequest& send_message_batch() const;
+  PROTOBUF_NODISCARD ::chat::SendMessageBatchRequest* release_send_message_batch();
+  ::chat::SendMessageBatchRequest* mutable_send_message_batch();
+  void set_allocated_send_message_batch(::chat::SendMessageBatchRequest* send_message_batch);
+  private:
+  const ::chat::SendMessageBatchRequest& _internal_send_message_batch() const;
+  ::chat::SendMessageBatchRequest* _internal_mutable_send_message_batch();
+  public:
+  void unsafe_arena_set_allocated_send_message_batch(
+      ::chat::SendMessageBatchRequest* send_message_batch);
+  ::chat::SendMessageBatchRequest* unsafe_arena_release_send_message_batch();
+
+  // .chat.RoomRequest join_room = 8;
+  bool has_join_room() const;
+  private:
+  bool _internal_has_join_room() const;
+  public:
+  void clear_join_room();
+  const ::chat::RoomRequest& join_room() const;
+  PROTOBUF_NODISCARD ::chat::RoomRequest* release_join_room();
+  ::chat::RoomRequest* mutable_join_room();
+  void set_allocated_join_room(::chat::RoomRequest* join_room);
+  private:
+  const ::chat::RoomRequest& _internal_join_room() const;
+  ::chat::RoomRequest* _internal_mutable_join_room();
+  public:
+  void unsafe_arena_set_allocated_join_room(
+      ::chat::RoomRequest* join_room);
+  ::chat::RoomRequest* unsafe_arena_release_join_room();
+
+  // .chat.RoomRequest leave_room = 9;
+  bool has_leave_room() const;
+  private:
+  bool _internal_has_leave_room() const;
+  public:
+  void clear_leave_room();
+  const ::chat::RoomRequest& leave_room() const;
+  PROTOBUF_NODISCARD ::chat::RoomRequest* release_leave_room();
+  ::chat::RoomRequest* mutable_leave_room();
+  void set_allocated_leave_room(::chat::RoomRequest* leave_room);
+  private:
+  const ::chat::RoomRequest& _internal_leave_room() const;
+  ::chat::RoomRequest* _internal_mutable_leave_room();
+  public:
+  void unsafe_arena_set_allocated_leave_room(
+      ::chat::RoomRequest* leave_room);
+  ::chat::RoomRequest* unsafe_arena_release_leave_room();
+
+  // .chat.ResumeRequest resume = 11;
+  bool has_resume() const;
+  private:
+  bool _internal_has_resume() const;
+  public:
+  void clear_resume();
+  const ::chat::ResumeRequest& resume() const;
+  PROTOBUF_NODISCARD ::chat::ResumeRequest* release_resume();
+  ::chat::ResumeRequest* mutable_resume();
+  void set_allocated_resume(::chat::ResumeRequest* resume);
+  private:
+  const ::chat::ResumeRequest& _internal_resume() const;
+  ::chat::ResumeRequest* _internal_mutable_resume();
+  public:
+  void unsafe_arena_set_allocated_resume(
+      ::chat::ResumeRequest* resume);
+  ::chat::ResumeRequest* unsafe_arena_release_resume();
+
+  // .chat.FileOffer file_offer = 12;
+  bool has_file_offer() const;
+  private:
+  bool _internal_has_file_offer() const;
+  public:
+  void clear_file_offer();
+  const ::chat::FileOffer& file_offer() const;
+  PROTOBUF_NODISCARD ::chat::FileOffer* release_file_offer();
+  ::chat::FileOffer* mutable_file_offer();
+  void set_allocated_file_offer(::chat::FileOffer* file_offer);
+  private:
+  const ::chat::FileOffer& _internal_file_offer() const;
+  ::chat::FileOffer* _internal_mutable_file_offer();
+  public:
+  void unsafe_arena_set_allocated_file_offer(
+      ::chat::FileOffer* file_offer);
+  ::chat::FileOffer* unsafe_arena_release_file_offer();
+
+  // .chat.FileWindow file_window = 13;
+  bool has_file_window() const;
+  private:
+  bool _internal_has_file_window() const;
+  public:
+  void clear_file_window();
+  const ::chat::FileWindow& file_window() const;
+  PROTOBUF_NODISCARD ::chat::FileWindow* release_file_window();
+  ::chat::FileWindow* mutable_file_window();
+  void set_allocated_file_window(::chat::FileWindow* file_window);
+  private:
+  const ::chat::FileWindow& _internal_file_window() const;
+  ::chat::FileWindow* _internal_mutable_file_window();
+  public:
+  void unsafe_arena_set_allocated_file_window(
+      ::chat::FileWindow* file_window);
+  ::chat::FileWindow* unsafe_arena_release_file_window();
+
+  void clear_payload();
+  PayloadCase payload_case() const;
+  // @@protoc_insertion_point(class_scope:chat.Request)
+ private:
+  class _Internal;
+  void set_has_register_user();
+  void set_has_send_message();
+  void set_has_update_status();
+  void set_has_get_users();
+  void set_has_unregister_user();
+  void set_has_send_message_batch();
+  void set_has_join_room();
+  void set_has_leave_room();
+  void set_has_resume();
+  void set_has_file_offer();
+  void set_has_file_window();
+
+  inline bool has_payload() const;
+  inline void clear_has_payload();
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    uint64_t request_id_;
+    int operation_;
+    union PayloadUnion {
+      constexpr PayloadUnion() : _constinit_{} {}
+        ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized _constinit_;
+      ::chat::NewUserRequest* register_user_;
+      ::chat::SendMessageRequest* send_message_;
+      ::chat::UpdateStatusRequest* update_status_;
+      ::chat::UserListRequest* get_users_;
+      ::chat::User* unregister_user_;
+      ::chat::SendMessageBatchRequest* send_message_batch_;
+      ::chat::RoomRequest* join_room_;
+      ::chat::RoomRequest* leave_room_;
+      ::chat::ResumeRequest* resume_;
+      ::chat::FileOffer* file_offer_;
+      ::chat::FileWindow* file_window_;
+    } payload_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t _oneof_case_[1];
+
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_chat_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Distribution final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.Distribution) */ {
+ public:
+  inline Distribution() : Distribution(nullptr) {}
+  ~Distribution() override;
+  explicit PROTOBUF_CONSTEXPR Distribution(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Distribution(const Distribution& from);
+  Distribution(Distribution&& from) noexcept
+    : Distribution() {
+    *this = ::std::move(from);
+  }
+
+  inline Distribution& operator=(const Distribution& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Distribution& operator=(Distribution&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Distribution& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Distribution* internal_default_instance() {
+    return reinterpret_cast<const Distribution*>(
+               &_Distribution_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    18;
+
+  friend void swap(Distribution& a, Distribution& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Distribution* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Distribution* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Distribution* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Distribution>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Distribution& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Distribution& from) {
+    Distribution::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Distribution* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.Distribution";
+  }
+  protected:
+  explicit Distribution(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kCountFieldNumber = 1,
+    kMeanFieldNumber = 2,
+    kP50FieldNumber = 3,
+    kP90FieldNumber = 4,
+    kP99FieldNumber = 5,
+    kP999FieldNumber = 6,
+    kMaxFieldNumber = 7,
+  };
+  // uint64 count = 1;
+  void clear_count();
+  uint64_t count() const;
+  void set_count(uint64_t value);
+  private:
+  uint64_t _internal_count() const;
+  void _internal_set_count(uint64_t value);
+  public:
+
+  // double mean = 2;
+  void clear_mean();
+  double mean() const;
+  void set_mean(double value);
+  private:
+  double _internal_mean() const;
+  void _internal_set_mean(double value);
+  public:
+
+  // uint64 p50 = 3;
+  void clear_p50();
+  uint64_t p50() const;
+  void set_p50(uint64_t value);
+  private:
+  uint64_t _internal_p50() const;
+  void _internal_set_p50(uint64_t value);
+  public:
+
+  // uint64 p90 = 4;
+  void clear_p90();
+  uint64_t p90() const;
+  void set_p90(uint64_t value);
+  private:
+  uint64_t _internal_p90() const;
+  void _internal_set_p90(uint64_t value);
+  public:
+
+  // uint64 p99 = 5;
+  void clear_p99();
+  uint64_t p99() const;
+  void set_p99(uint64_t value);
+  private:
+  uint64_t _internal_p99() const;
+  void _internal_set_p99(uint64_t value);
+  public:
+
+  // uint64 p999 = 6;
+  void clear_p999();
+  uint64_t p999() const;
+  void set_p999(uint64_t value);
+  private:
+  uint64_t _internal_p999() const;
+  void _internal_set_p999(uint64_t value);
+  public:
+
+  // uint64 max = 7;
+  void clear_max();
+  uint64_t max() const;
+  void set_max(uint64_t value);
+  private:
+  uint64_t _internal_max() const;
+  void _internal_set_max(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:chat.Distribution)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    uint64_t count_;
+    double mean_;
+    uint64_t p50_;
+    uint64_t p90_;
+    uint64_t p99_;
+    uint64_t p999_;
+    uint64_t max_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_chat_2eproto;
+};
+// -------------------------------------------------------------------
+
+class OperationStats final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.OperationStats) */ {
+ public:
+  inline OperationStats() : OperationStats(nullptr) {}
+  ~OperationStats() override;
+  explicit PROTOBUF_CONSTEXPR OperationStats(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  OperationStats(const OperationStats& from);
+  OperationStats(OperationStats&& from) noexcept
+    : OperationStats() {
+    *this = ::std::move(from);
+  }
+
+  inline OperationStats& operator=(const OperationStats& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline OperationStats& operator=(OperationStats&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const OperationStats& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const OperationStats* internal_default_instance() {
+    return reinterpret_cast<const OperationStats*>(
+               &_OperationStats_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    19;
+
+  friend void swap(OperationStats& a, OperationStats& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(OperationStats* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(OperationStats* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  OperationStats* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<OperationStats>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const OperationStats& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const OperationStats& from) {
+    OperationStats::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(OperationStats* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.OperationStats";
+  }
+  protected:
+  explicit OperationStats(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kLatencyFieldNumber = 3,
+    kRequestsFieldNumber = 2,
+    kOperationFieldNumber = 1,
+  };
+  // .chat.Distribution latency = 3;
+  bool has_latency() const;
+  private:
+  bool _internal_has_latency() const;
+  public:
+  void clear_latency();
+  const ::chat::Distribution& latency() const;
+  PROTOBUF_NODISCARD ::chat::Distribution* release_latency();
+  ::chat::Distribution* mutable_latency();
+  void set_allocated_latency(::chat::Distribution* latency);
+  private:
+  const ::chat::Distribution& _internal_latency() const;
+  ::chat::Distribution* _internal_mutable_latency();
+  public:
+  void unsafe_arena_set_allocated_latency(
+      ::chat::Distribution* latency);
+  ::chat::Distribution* unsafe_arena_release_latency();
+
+  // uint64 requests = 2;
+  void clear_requests();
+  uint64_t requests() const;
+  void set_requests(uint64_t value);
+  private:
+  uint64_t _internal_requests() const;
+  void _internal_set_requests(uint64_t value);
+  public:
+
+  // .chat.Operation operation = 1;
+  void clear_operation();
+  ::chat::Operation operation() const;
+  void set_operation(::chat::Operation value);
+  private:
+  ::chat::Operation _internal_operation() const;
+  void _internal_set_operation(::chat::Operation value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:chat.OperationStats)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::chat::Distribution* latency_;
+    uint64_t requests_;
+    int operation_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_chat_2eproto;
+};
+// -------------------------------------------------------------------
+
+class StatusCodeCount final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.StatusCodeCount) */ {
+ public:
+  inline StatusCodeCount() : StatusCodeCount(nullptr) {}
+  ~StatusCodeCount() override;
+  explicit PROTOBUF_CONSTEXPR StatusCodeCount(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  StatusCodeCount(const StatusCodeCount& from);
+  StatusCodeCount(StatusCodeCount&& from) noexcept
+    : StatusCodeCount() {
+    *this = ::std::move(from);
+  }
+
+  inline StatusCodeCount& operator=(const StatusCodeCount& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline StatusCodeCount& operator=(StatusCodeCount&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const StatusCodeCount& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const StatusCodeCount* internal_default_instance() {
+    return reinterpret_cast<const StatusCodeCount*>(
+               &_StatusCodeCount_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    20;
+
+  friend void swap(StatusCodeCount& a, StatusCodeCount& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(StatusCodeCount* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(StatusCodeCount* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  StatusCodeCount* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<StatusCodeCount>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const StatusCodeCount& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const StatusCodeCount& from) {
+    StatusCodeCount::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(StatusCodeCount* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.StatusCodeCount";
+  }
+  protected:
+  explicit StatusCodeCount(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kCountFieldNumber = 2,
+    kStatusCodeFieldNumber = 1,
+  };
+  // uint64 count = 2;
+  void clear_count();
+  uint64_t count() const;
+  void set_count(uint64_t value);
+  private:
+  uint64_t _internal_count() const;
+  void _internal_set_count(uint64_t value);
+  public:
+
+  // .chat.StatusCode status_code = 1;
+  void clear_status_code();
+  ::chat::StatusCode status_code() const;
+  void set_status_code(::chat::StatusCode value);
+  private:
+  ::chat::StatusCode _internal_status_code() const;
+  void _internal_set_status_code(::chat::StatusCode value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:chat.StatusCodeCount)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    uint64_t count_;
+    int status_code_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_chat_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ServerStats final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.ServerStats) */ {
+ public:
+  inline ServerStats() : ServerStats(nullptr) {}
+  ~ServerStats() override;
+  explicit PROTOBUF_CONSTEXPR ServerStats(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ServerStats(const ServerStats& from);
+  ServerStats(ServerStats&& from) noexcept
+    : ServerStats() {
+    *this = ::std::move(from);
+  }
+
+  inline ServerStats& operator=(const ServerStats& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ServerStats& operator=(ServerStats&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ServerStats& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ServerStats* internal_default_instance() {
+    return reinterpret_cast<const ServerStats*>(
+               &_ServerStats_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    21;
+
+  friend void swap(ServerStats& a, ServerStats& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ServerStats* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ServerStats* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ServerStats* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ServerStats>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ServerStats& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ServerStats& from) {
+    ServerStats::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ServerStats* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.ServerStats";
+  }
+  protected:
+  explicit ServerStats(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kOperationsFieldNumber = 2,
+    kResponsesFieldNumber = 3,
+    kQueueDepthFieldNumber = 10,
+    kBroadcastFanoutFieldNumber = 11,
+    kRoomFanoutFieldNumber = 22,
+    kPipelineDepthFieldNumber = 30,
+    kUptimeMsFieldNumber = 1,
+    kBytesInFieldNumber = 4,
+    kBytesOutFieldNumber = 5,
+    kActiveConnectionsFieldNumber = 6,
+    kTotalConnectionsFieldNumber = 7,
+    kQueuedFramesFieldNumber = 8,
+    kQueuedBytesFieldNumber = 9,
+    kHeapAllocationsFieldNumber = 12,
+    kReadCallsFieldNumber = 13,
+    kWriteCallsFieldNumber = 14,
+    kPackedFramesFieldNumber = 15,
+    kOfflineQueuedFieldNumber = 16,
+    kOfflineDeliveredFieldNumber = 17,
+    kOfflinePendingFieldNumber = 18,
+    kOfflineSyncsFieldNumber = 19,
+    kRoutedFramesFieldNumber = 20,
+    kActiveRoomsFieldNumber = 21,
+    kSlowConsumersFieldNumber = 23,
+    kDroppedFramesFieldNumber = 24,
+    kOverflowDisconnectsFieldNumber = 25,
+    kCompressedFramesFieldNumber = 26,
+    kCompressionInBytesFieldNumber = 27,
+    kCompressionOutBytesFieldNumber = 28,
+    kCompressionCpuNsFieldNumber = 29,
+    kPresenceSubscribersFieldNumber = 31,
+    kPresenceChangesFieldNumber = 32,
+    kPresenceEventsFieldNumber = 33,
+    kPresenceUpdatesFieldNumber = 34,
+    kSessionsFieldNumber = 35,
+    kSessionBytesFieldNumber = 36,
+    kWorkerJobsFieldNumber = 37,
+    kStolenJobsFieldNumber = 38,
+    kDetachedSessionsFieldNumber = 39,
+    kResumedSessionsFieldNumber = 40,
+    kExpiredSessionsFieldNumber = 41,
+    kResumedFramesFieldNumber = 42,
+    kRosterBuildsFieldNumber = 43,
+    kRosterServedFieldNumber = 44,
+    kFileTransfersFieldNumber = 45,
+    kActiveTransfersFieldNumber = 46,
+    kFileBytesFieldNumber = 47,
+    kFileBytesSpooledFieldNumber = 48,
+  };
+  // repeated .chat.OperationStats operations = 2;
+  int operations_size() const;
+  private:
+  int _internal_operations_size() const;
+  public:
+  void clear_operations();
+  ::chat::OperationStats* mutable_operations(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::OperationStats >*
+      mutable_operations();
+  private:
+  const ::chat::OperationStats& _internal_operations(int index) const;
+  ::chat::OperationStats* _internal_add_operations();
+  public:
+  const ::chat::OperationStats& operations(int index) const;
+  ::chat::OperationStats* add_operations();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::OperationStats >&
+      operations() const;
+
+  // repeated .chat.StatusCodeCount responses = 3;
+  int responses_size() const;
+  private:
+  int _internal_responses_size() const;
+  public:
+  void clear_responses();
+  ::chat::StatusCodeCount* mutable_responses(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::StatusCodeCount >*
+      mutable_responses();
+  private:
+  const ::chat::StatusCodeCount& _internal_responses(int index) const;
+  ::chat::StatusCodeCount* _internal_add_responses();
+  public:
+  const ::chat::StatusCodeCount& responses(int index) const;
+  ::chat::StatusCodeCount* add_responses();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::StatusCodeCount >&
+      responses() const;
+
+  // .chat.Distribution queue_depth = 10;
+  bool has_queue_depth() const;
+  private:
+  bool _internal_has_queue_depth() const;
+  public:
+  void clear_queue_depth();
+  const ::chat::Distribution& queue_depth() const;
+  PROTOBUF_NODISCARD ::chat::Distribution* release_queue_depth();
+  ::chat::Distribution* mutable_queue_depth();
+  void set_allocated_queue_depth(::chat::Distribution* queue_depth);
+  private:
+  const ::chat::Distribution& _internal_queue_depth() const;
+  ::chat::Distribution* _internal_mutable_queue_depth();
+  public:
+  void unsafe_arena_set_allocated_queue_depth(
+      ::chat::Distribution* queue_depth);
+  ::chat::Distribution* unsafe_arena_release_queue_depth();
+
+  // .chat.Distribution broadcast_fanout = 11;
+  bool has_broadcast_fanout() const;
+  private:
+  bool _internal_has_broadcast_fanout() const;
+  public:
+  void clear_broadcast_fanout();
+  const ::chat::Distribution& broadcast_fanout() const;
+  PROTOBUF_NODISCARD ::chat::Distribution* release_broadcast_fanout();
+  ::chat::Distribution* mutable_broadcast_fanout();
+  void set_allocated_broadcast_fanout(::chat::Distribution* broadcast_fanout);
+  private:
+  const ::chat::Distribution& _internal_broadcast_fanout() const;
+  ::chat::Distribution* _internal_mutable_broadcast_fanout();
+  public:
+  void unsafe_arena_set_allocated_broadcast_fanout(
+      ::chat::Distribution* broadcast_fanout);
+  ::chat::Distribution* unsafe_arena_release_broadcast_fanout();
+
+  // .chat.Distribution room_fanout = 22;
+  bool has_room_fanout() const;
+  private:
+  bool _internal_has_room_fanout() const;
+  public:
+  void clear_room_fanout();
+  const ::chat::Distribution& room_fanout() const;
+  PROTOBUF_NODISCARD ::chat::Distribution* release_room_fanout();
+  ::chat::Distribution* mutable_room_fanout();
+  void set_allocated_room_fanout(::chat::Distribution* room_fanout);
+  private:
+  const ::chat::Distribution& _internal_room_fanout() const;
+  ::chat::Distribution* _internal_mutable_room_fanout();
+  public:
+  void unsafe_arena_set_allocated_room_fanout(
+      ::chat::Distribution* room_fanout);
+  ::chat::Distribution* unsafe_arena_release_room_fanout();
+
+  // .chat.Distribution pipeline_depth = 30;
+  bool has_pipeline_depth() const;
+  private:
+  bool _internal_has_pipeline_depth() const;
+  public:
+  void clear_pipeline_depth();
+  const ::chat::Distribution& pipeline_depth() const;
+  PROTOBUF_NODISCARD ::chat::Distribution* release_pipeline_depth();
+  ::chat::Distribution* mutable_pipeline_depth();
+  void set_allocated_pipeline_depth(::chat::Distribution* pipeline_depth);
+  private:
+  const ::chat::Distribution& _internal_pipeline_depth() const;
+  ::chat::Distribution* _internal_mutable_pipeline_depth();
+  public:
+  void unsafe_arena_set_allocated_pipeline_depth(
+      ::chat::Distribution* pipeline_depth);
+  ::chat::Distribution* unsafe_arena_release_pipeline_depth();
+
+  // uint64 uptime_ms = 1;
+  void clear_uptime_ms();
+  uint64_t uptime_ms() const;
+  void set_uptime_ms(uint64_t value);
+  private:
+  uint64_t _internal_uptime_ms() const;
+  void _internal_set_uptime_ms(uint64_t value);
+  public:
+
+  // uint64 bytes_in = 4;
+  void clear_bytes_in();
+  uint64_t bytes_in() const;
+  void set_bytes_in(uint64_t value);
+  private:
+  uint64_t _internal_bytes_in() const;
+  void _internal_set_bytes_in(uint64_t value);
+  public:
+
+  // uint64 bytes_out = 5;
+  void clear_bytes_out();
+  uint64_t bytes_out() const;
+  void set_bytes_out(uint64_t value);
+  private:
+  uint64_t _internal_bytes_out() const;
+  void _internal_set_bytes_out(uint64_t value);
+  public:
+
+  // uint64 active_connections = 6;
+  void clear_active_connections();
+  uint64_t active_connections() const;
+  void set_active_connections(uint64_t value);
+  private:
+  uint64_t _internal_active_connections() const;
+  void _internal_set_active_connections(uint64_t value);
+  public:
+
+  // uint64 total_connections = 7;
+  void clear_total_connections();
+  uint64_t total_connections() const;
+  void set_total_connections(uint64_t value);
+  private:
+  uint64_t _internal_total_connections() const;
+  void _internal_set_total_connections(uint64_t value);
+  public:
+
+  // uint64 queued_frames = 8;
+  void clear_queued_frames();
+  uint64_t queued_frames() const;
+  void set_queued_frames(uint64_t value);
+  private:
+  uint64_t _internal_queued_frames() const;
+  void _internal_set_queued_frames(uint64_t value);
+  public:
+
+  // uint64 queued_bytes = 9;
+  void clear_queued_bytes();
+  uint64_t queued_bytes() const;
+  void set_queued_bytes(uint64_t value);
+  private:
+  uint64_t _internal_queued_bytes() const;
+  void _internal_set_queued_bytes(uint64_t value);
+  public:
+
+  // uint64 heap_allocations = 12;
+  void clear_heap_allocations();
+  uint64_t heap_allocations() const;
+  void set_heap_allocations(uint64_t value);
+  private:
+  uint64_t _internal_heap_allocations() const;
+  void _internal_set_heap_allocations(uint64_t value);
+  public:
+
+  // uint64 read_calls = 13;
+  void clear_read_calls();
+  uint64_t read_calls() const;
+  void set_read_calls(uint64_t value);
+  private:
+  uint64_t _internal_read_calls() const;
+  void _internal_set_read_calls(uint64_t value);
+  public:
+
+  // uint64 write_calls = 14;
+  void clear_write_calls();
+  uint64_t write_calls() const;
+  void set_write_calls(uint64_t value);
+  private:
+  uint64_t _internal_write_calls() const;
+  void _internal_set_write_calls(uint64_t value);
+  public:
+
+  // uint64 packed_frames = 15;
+  void clear_packed_frames();
+  uint64_t packed_frames() const;
+  void set_packed_frames(uint64_t value);
+  private:
+  uint64_t _internal_packed_frames() const;
+  void _internal_set_packed_frames(uint64_t value);
+  public:
+
+  // uint64 offline_queued = 16;
+  void clear_offline_queued();
+  uint64_t offline_queued() const;
+  void set_offline_queued(uint64_t value);
+  private:
+  uint64_t _internal_offline_queued() const;
+  void _internal_set_offline_queued(uint64_t value);
+  public:
+
+  // uint64 offline_delivered = 17;
+  void clear_offline_delivered();
+  uint64_t offline_delivered() const;
+  void set_offline_delivered(uint64_t value);
+  private:
+  uint64_t _internal_offline_delivered() const;
+  void _internal_set_offline_delivered(uint64_t value);
+  public:
+
+  // uint64 offline_pending = 18;
+  void clear_offline_pending();
+  uint64_t offline_pending() const;
+  void set_offline_pending(uint64_t value);
+  private:
+  uint64_t _internal_offline_pending() const;
+  void _internal_set_offline_pending(uint64_t value);
+  public:
+
+  // uint64 offline_syncs = 19;
+  void clear_offline_syncs();
+  uint64_t offline_syncs() const;
+  void set_offline_syncs(uint64_t value);
+  private:
+  uint64_t _internal_offline_syncs() const;
+  void _internal_set_offline_syncs(uint64_t value);
+  public:
+
+  // uint64 routed_frames = 20;
+  void clear_routed_frames();
+  uint64_t routed_frames() const;
+  void set_routed_frames(uint64_t value);
+  private:
+  uint64_t _internal_routed_frames() const;
+  void _internal_set_routed_frames(uint64_t value);
+  public:
+
+  // uint64 active_rooms = 21;
+  void clear_active_rooms();
+  uint64_t active_rooms() const;
+  void set_active_rooms(uint64_t value);
+  private:
+  uint64_t _internal_active_rooms() const;
+  void _internal_set_active_rooms(uint64_t value);
+  public:
+
+  // uint64 slow_consumers = 23;
+  void clear_slow_consumers();
+  uint64_t slow_consumers() const;
+  void set_slow_consumers(uint64_t value);
+  private:
+  uint64_t _internal_slow_consumers() const;
+  void _internal_set_slow_consumers(uint64_t value);
+  public:
+
+  // uint64 dropped_frames = 24;
+  void clear_dropped_frames();
+  uint64_t dropped_frames() const;
+  void set_dropped_frames(uint64_t value);
+  private:
+  uint64_t _internal_dropped_frames() const;
+  void _internal_set_dropped_frames(uint64_t value);
+  public:
+
+  // uint64 overflow_disconnects = 25;
+  void clear_overflow_disconnects();
+  uint64_t overflow_disconnects() const;
+  void set_overflow_disconnects(uint64_t value);
+  private:
+  uint64_t _internal_overflow_disconnects() const;
+  void _internal_set_overflow_disconnects(uint64_t value);
+  public:
+
+  // uint64 compressed_frames = 26;
+  void clear_compressed_frames();
+  uint64_t compressed_frames() const;
+  void set_compressed_frames(uint64_t value);
+  private:
+  uint64_t _internal_compressed_frames() const;
+  void _internal_set_compressed_frames(uint64_t value);
+  public:
+
+  // uint64 compression_in_bytes = 27;
+  void clear_compression_in_bytes();
+  uint64_t compression_in_bytes() const;
+  void set_compression_in_bytes(uint64_t value);
+  private:
+  uint64_t _internal_compression_in_bytes() const;
+  void _internal_set_compression_in_bytes(uint64_t value);
+  public:
+
+  // uint64 compression_out_bytes = 28;
+  void clear_compression_out_bytes();
+  uint64_t compression_out_bytes() const;
+  void set_compression_out_bytes(uint64_t value);
+  private:
+  uint64_t _internal_compression_out_bytes() const;
+  void _internal_set_compression_out_bytes(uint64_t value);
+  public:
+
+  // uint64 compression_cpu_ns = 29;
+  void clear_compression_cpu_ns();
+  uint64_t compression_cpu_ns() const;
+  void set_compression_cpu_ns(uint64_t value);
+  private:
+  uint64_t _internal_compression_cpu_ns() const;
+  void _internal_set_compression_cpu_ns(uint64_t value);
+  public:
+
+  // uint64 presence_subscribers = 31;
+  void clear_presence_subscribers();
+  uint64_t presence_subscribers() const;
+  void set_presence_subscribers(uint64_t value);
+  private:
+  uint64_t _internal_presence_subscribers() const;
+  void _internal_set_presence_subscribers(uint64_t value);
+  public:
+
+  // uint64 presence_changes = 32;
+  void clear_presence_changes();
+  uint64_t presence_changes() const;
+  void set_presence_changes(uint64_t value);
+  private:
+  uint64_t _internal_presence_changes() const;
+  void _internal_set_presence_changes(uint64_t value);
+  public:
+
+  // uint64 presence_events = 33;
+  void clear_presence_events();
+  uint64_t presence_events() const;
+  void set_presence_events(uint64_t value);
+  private:
+  uint64_t _internal_presence_events() const;
+  void _internal_set_presence_events(uint64_t value);
+  public:
+
+  // uint64 presence_updates = 34;
+  void clear_presence_updates();
+  uint64_t presence_updates() const;
+  void set_presence_updates(uint64_t value);
+  private:
+  uint64_t _internal_presence_updates() const;
+  void _internal_set_presence_updates(uint64_t value);
+  public:
+
+  // uint64 sessions = 35;
+  void clear_sessions();
+  uint64_t sessions() const;
+  void set_sessions(uint64_t value);
+  private:
+  uint64_t _internal_sessions() const;
+  void _internal_set_sessions(uint64_t value);
+  public:
+
+  // uint64 session_bytes = 36;
+  void clear_session_bytes();
+  uint64_t session_bytes() const;
+  void set_session_bytes(uint64_t value);
+  private:
+  uint64_t _internal_session_bytes() const;
+  void _internal_set_session_bytes(uint64_t value);
+  public:
+
+  // uint64 worker_jobs = 37;
+  void clear_worker_jobs();
+  uint64_t worker_jobs() const;
+  void set_worker_jobs(uint64_t value);
+  private:
+  uint64_t _internal_worker_jobs() const;
+  void _internal_set_worker_jobs(uint64_t value);
+  public:
+
+  // uint64 stolen_jobs = 38;
+  void clear_stolen_jobs();
+  uint64_t stolen_jobs() const;
+  void set_stolen_jobs(uint64_t value);
+  private:
+  uint64_t _internal_stolen_jobs() const;
+  void _internal_set_stolen_jobs(uint64_t value);
+  public:
+
+  // uint64 detached_sessions = 39;
+  void clear_detached_sessions();
+  uint64_t detached_sessions() const;
+  void set_detached_sessions(uint64_t value);
+  private:
+  uint64_t _internal_detached_sessions() const;
+  void _internal_set_detached_sessions(uint64_t value);
+  public:
+
+  // uint64 resumed_sessions = 40;
+  void clear_resumed_sessions();
+  uint64_t resumed_sessions() const;
+  void set_resumed_sessions(uint64_t value);
+  private:
+  uint64_t _internal_resumed_sessions() const;
+  void _internal_set_resumed_sessions(uint64_t value);
+  public:
+
+  // uint64 expired_sessions = 41;
+  void clear_expired_sessions();
+  uint64_t expired_sessions() const;
+  void set_expired_sessions(uint64_t value);
+  private:
+  uint64_t _internal_expired_sessions() const;
+  void _internal_set_expired_sessions(uint64_t value);
+  public:
+
+  // uint64 resumed_frames = 42;
+  void clear_resumed_frames();
+  uint64_t resumed_frames() const;
+  void set_resumed_frames(uint64_t value);
+  private:
+  uint64_t _internal_resumed_frames() const;
+  void _internal_set_resumed_frames(uint64_t value);
+  public:
+
+  // uint64 roster_builds = 43;
+  void clear_roster_builds();
+  uint64_t roster_builds() const;
+  void set_roster_builds(uint64_t value);
+  private:
+  uint64_t _internal_roster_builds() const;
+  void _internal_set_roster_builds(uint64_t value);
+  public:
+
+  // uint64 roster_served = 44;
+  void clear_roster_served();
+  uint64_t roster_served() const;
+  void set_roster_served(uint64_t value);
+  private:
+  uint64_t _internal_roster_served() const;
+  void _internal_set_roster_served(uint64_t value);
+  public:
+
+  // uint64 file_transfers = 45;
+  void clear_file_transfers();
+  uint64_t file_transfers() const;
+  void set_file_transfers(uint64_t value);
+  private:
+  uint64_t _internal_file_transfers() const;
+  void _internal_set_file_transfers(uint64_t value);
+  public:
+
+  // uint64 active_transfers = 46;
+  void clear_active_transfers();
+  uint64_t active_transfers() const;
+  void set_active_transfers(uint64_t value);
+  private:
+  uint64_t _internal_active_transfers() const;
+  void _internal_set_active_transfers(uint64_t value);
+  public:
+
+  // uint64 file_bytes = 47;
+  void clear_file_bytes();
+  uint64_t file_bytes() const;
+  void set_file_bytes(uint64_t value);
+  private:
+  uint64_t _internal_file_bytes() const;
+  void _internal_set_file_bytes(uint64_t value);
+  public:
+
+  // uint64 file_bytes_spooled = 48;
+  void clear_file_bytes_spooled();
+  uint64_t file_bytes_spooled() const;
+  void set_file_bytes_spooled(uint64_t value);
+  private:
+  uint64_t _internal_file_bytes_spooled() const;
+  void _internal_set_file_bytes_spooled(uint64_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:chat.ServerStats)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::OperationStats > operations_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::StatusCodeCount > responses_;
+    ::chat::Distribution* queue_depth_;
+    ::chat::Distribution* broadcast_fanout_;
+    ::chat::Distribution* room_fanout_;
+    ::chat::Distribution* pipeline_depth_;
+    uint64_t uptime_ms_;
+    uint64_t bytes_in_;
+    uint64_t bytes_out_;
+    uint64_t active_connections_;
+    uint64_t total_connections_;
+    uint64_t queued_frames_;
+    uint64_t queued_bytes_;
+    uint64_t heap_allocations_;
+    uint64_t read_calls_;
+    uint64_t write_calls_;
+    uint64_t packed_frames_;
+    uint64_t offline_queued_;
+    uint64_t offline_delivered_;
+    uint64_t offline_pending_;
+    uint64_t offline_syncs_;
+    uint64_t routed_frames_;
+    uint64_t active_rooms_;
+    uint64_t slow_consumers_;
+    uint64_t dropped_frames_;
+    uint64_t overflow_disconnects_;
+    uint64_t compressed_frames_;
+    uint64_t compression_in_bytes_;
+    uint64_t compression_out_bytes_;
+    uint64_t compression_cpu_ns_;
+    uint64_t presence_subscribers_;
+    uint64_t presence_changes_;
+    uint64_t presence_events_;
+    uint64_t presence_updates_;
+    uint64_t sessions_;
+    uint64_t session_bytes_;
+    uint64_t worker_jobs_;
+    uint64_t stolen_jobs_;
+    uint64_t detached_sessions_;
+    uint64_t resumed_sessions_;
+    uint64_t expired_sessions_;
+    uint64_t resumed_frames_;
+    uint64_t roster_builds_;
+    uint64_t roster_served_;
+    uint64_t file_transfers_;
+    uint64_t active_transfers_;
+    uint64_t file_bytes_;
+    uint64_t file_bytes_spooled_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_chat_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Response final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:chat.Response) */ {
+ public:
+  inline Response() : Response(nullptr) {}
+  ~Response() override;
+  explicit PROTOBUF_CONSTEXPR Response(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Response(const Response& from);
+  Response(Response&& from) noexcept
+    : Response() {
+    *this = ::std::move(from);
+  }
+
+  inline Response& operator=(const Response& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Response& operator=(Response&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Response& default_instance() {
+    return *internal_default_instance();
+  }
+  enum ResultCase {
+    kUserList = 4,
+    kIncomingMessage = 5,
+    kStats = 6,
+    kMessageBatch = 7,
+    kRoom = 9,
+    kPresence = 12,
+    kTransfer = 15,
+    RESULT_NOT_SET = 0,
+  };
+
+  static inline const Response* internal_default_instance() {
+    return reinterpret_cast<const Response*>(
+               &_Response_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    22;
+
+  friend void swap(Response& a, Response& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Response* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Response* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Response* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Response>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Response& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Response& from) {
+    Response::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Response* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "chat.Response";
+  }
+  protected:
+  explicit Response(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kIncomingMessagesFieldNumber = 8,
+    kMessageFieldNumber = 3,
+    kResumeTokenFieldNumber = 14,
+    kOperationFieldNumber = 1,
+    kStatusCodeFieldNumber = 2,
+    kRequestIdFieldNumber = 11,
+    kUserIdFieldNumber = 13,
+    kCompressionThresholdFieldNumber = 10,
+    kUserListFieldNumber = 4,
+    kIncomingMessageFieldNumber = 5,
+    kStatsFieldNumber = 6,
+    kMessageBatchFieldNumber = 7,
+    kRoomFieldNumber = 9,
+    kPresenceFieldNumber = 12,
+    kTransferFieldNumber = 15,
+  };
+  // repeated .chat.IncomingMessageResponse incoming_messages = 8;
+  int incoming_messages_size() const;
+  private:
+  int _internal_incoming_messages_size() const;
+  public:
+  void clear_incoming_messages();
+  ::chat::IncomingMessageResponse* mutable_incoming_messages(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::IncomingMessageResponse >*
+      mutable_incoming_messages();
+  private:
+  const ::chat::IncomingMessageResponse& _internal_incoming_messages(int index) const;
+  ::chat::IncomingMessageResponse* _internal_add_incoming_messages();
+  public:
+  const ::chat::IncomingMessageResponse& incoming_messages(int index) const;
+  ::chat::IncomingMessageResponse* add_incoming_messages();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::IncomingMessageResponse >&
+      incoming_messages() const;
+
+  // string message = 3;
+  void clear_message();
+  const std::string& message() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_message(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_message();
+  PROTOBUF_NODISCARD std::string* release_message();
+  void set_allocated_message(std::string* message);
+  private:
+  const std::string& _internal_message() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_message(const std::string& value);
+  std::string* _internal_mutable_message();
+  public:
+
+  // bytes resume_token = 14;
+  void clear_resume_token();
+  const std::string& resume_token() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_resume_token(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_resume_token();
+  PROTOBUF_NODISCARD std::string* release_resume_token();
+  void set_allocated_resume_token(std::string* resume_token);
+  private:
+  const std::string& _internal_resume_token() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_resume_token(const std::string& value);
+  std::string* _internal_mutable_resume_token();
+  public:
+
+  // .chat.Operation operation = 1;
+  void clear_operation();
+  ::chat::Operation operation() const;
+  void set_operation(::chat::Operation value);
+  private:
+  ::chat::Operation _internal_operation() const;
+  void _internal_set_operation(::chat::Operation value);
+  public:
+
+  // .chat.StatusCode status_code = 2;
+  void clear_status_code();
+  ::chat::StatusCode status_code() const;
+  void set_status_code(::chat::StatusCode value);
+  private:
+  ::chat::StatusCode _internal_status_code() const;
+  void _internal_set_status_code(::chat::StatusCode value);
+  public:
+
+  // uint64 request_id = 11;
+  void clear_request_id();
+  uint64_t request_id() const;
+  void set_request_id(uint64_t value);
+  private:
+  uint64_t _internal_request_id() const;
+  void _internal_set_request_id(uint64_t value);
+  public:
+
+  // uint64 user_id = 13;
+  void clear_user_id();
+  uint64_t user_id() const;
+  void set_user_id(uint64_t value);
+  private:
+  uint64_t _internal_user_id() const;
+  void _internal_set_user_id(uint64_t value);
+  public:
+
+  // uint32 compression_threshold = 10;
+  void clear_compression_threshold();
+  uint32_t compression_threshold() const;
+  void set_compression_threshold(uint32_t value);
+  private:
+  uint32_t _internal_compression_threshold() const;
+  void _internal_set_compression_threshold(uint32_t value);
+  public:
+
+  // .chat.UserListResponse user_list = 4;
+  bool has_user_list() const;
+  private:
+  bool _internal_has_user_list() const;
+  public:
+  void clear_user_list();
+  const ::chat::UserListResponse& user_list() const;
+  PROTOBUF_NODISCARD ::chat::UserListResponse* release_user_list();
+  ::chat::UserListResponse* mutable_user_list();
+  void set_allocated_user_list(::chat::UserListResponse* user_list);
+  private:
+  const ::chat::UserListResponse& _internal_user_list() const;
+  ::chat::UserListResponse* _internal_mutable_user_list();
+  public:
+  void unsafe_arena_set_allocated_user_list(
+      ::chat::UserListResponse* user_list);
+  ::chat::UserListResponse* unsafe_arena_release_user_list();
+
+  // .chat.IncomingMessageResponse incoming_message = 5;
+  bool has_incoming_message() const;
+  private:
+  bool _internal_has_incoming_message() const;
+  public:
+  void clear_incoming_message();
+  const ::chat::IncomingMessageResponse& incoming_message() const;
+  PROTOBUF_NODISCARD ::chat::IncomingMessageResponse* release_incoming_message();
+  ::chat::IncomingMessageResponse* mutable_incoming_message();
+  void set_allocated_incoming_message(::chat::IncomingMessageResponse* incoming_message);
+  private:
+  const ::chat::IncomingMessageResponse& _internal_incoming_message() const;
+  ::chat::IncomingMessageResponse* _internal_mutable_incoming_message();
+  public:
+  void unsafe_arena_set_allocated_incoming_message(
+      ::chat::IncomingMessageResponse* incoming_message);
+  ::chat::IncomingMessageResponse* unsafe_arena_release_incoming_message();
+
+  // .chat.ServerStats stats = 6;
+  bool has_stats() const;
+  private:
+  bool _internal_has_stats() const;
+  public:
+  void clear_stats();
+  const ::chat::ServerStats& stats() const;
+  PROTOBUF_NODISCARD ::chat::ServerStats* release_stats();
+  ::chat::ServerStats* mutable_stats();
+  void set_allocated_stats(::chat::ServerStats* stats);
+  private:
+  const ::chat::ServerStats& _internal_stats() const;
+  ::chat::ServerStats* _internal_mutable_stats();
+  public:
+  void unsafe_arena_set_allocated_stats(
+      ::chat::ServerStats* stats);
+  ::chat::ServerStats* unsafe_arena_release_stats();
+
+  // .chat.SendMessageBatchResponse message_batch = 7;
+  bool has_message_batch() const;
+  private:
+  bool _internal_has_message_batch() const;
+  public:
+  void clear_message_batch();
+  const ::chat::SendMessageBatchResponse& message_batch() const;
+  PROTOBUF_NODISCARD ::chat::SendMessageBatchResponse* release_message_batch();
+  ::chat::SendMessageBatchResponse* mutable_message_batch();
+  void set_allocated_message_batch(::chat::SendMessageBatchResponse* message_batch);
+  private:
+  const ::chat::SendMessageBatchResponse& _internal_message_batch() const;
+  ::chat::SendMessageBatchResponse* _internal_mutable_message_batch();
+  public:
+  void unsafe_arena_set_allocated_message_batch(
+      ::chat::SendMessageBatchResponse* message_batch);
+  ::chat::SendMessageBatchResponse* unsafe_arena_release_message_batch();
+
+  // .chat.RoomResponse room = 9;
+  bool has_room() const;
+  private:
+  bool _internal_has_room() const;
+  public:
+  void clear_room();
+  const ::chat::RoomResponse& room() const;
+  PROTOBUF_NODISCARD ::chat::RoomResponse* release_room();
+  ::chat::RoomResponse* mutable_room();
+  void set_allocated_room(::chat::RoomResponse* room);
+  private:
+  const ::chat::RoomResponse& _internal_room() const;
+  ::chat::RoomResponse* _internal_mutable_room();
+  public:
+  void unsafe_arena_set_allocated_room(
+      ::chat::RoomResponse* room);
+  ::chat::RoomResponse* unsafe_arena_release_room();
+
+  // .chat.PresenceUpdate presence = 12;
+  bool has_presence() const;
+  private:
+  bool _internal_has_presence() const;
+  public:
+  void clear_presence();
+  const ::chat::PresenceUpdate& presence() const;
+  PROTOBUF_NODISCARD ::chat::PresenceUpdate* release_presence();
+  ::chat::PresenceUpdate* mutable_presence();
+  void set_allocated_presence(::chat::PresenceUpdate* presence);
+  private:
+  const ::chat::PresenceUpdate& _internal_presence() const;
+  ::chat::PresenceUpdate* _internal_mutable_presence();
+  public:
+  void unsafe_arena_set_allocated_presence(
+      ::chat::PresenceUpdate* presence);
+  ::chat::PresenceUpdate* unsafe_arena_release_presence();
+
+  // .chat.FileTransfer transfer = 15;
+  bool has_transfer() const;
+  private:
+  bool _internal_has_transfer() const;
+  public:
+  void clear_transfer();
+  const ::chat::FileTransfer& transfer() const;
+  PROTOBUF_NODISCARD ::chat::FileTransfer* release_transfer();
+  ::chat::FileTransfer* mutable_transfer();
+  void set_allocated_transfer(::chat::FileTransfer* transfer);
+  private:
+  const ::chat::FileTransfer& _internal_transfer() const;
+  ::chat::FileTransfer* _internal_mutable_transfer();
+  public:
+  void unsafe_arena_set_allocated_transfer(
+      ::chat::FileTransfer* transfer);
+  ::chat::FileTransfer* unsafe_arena_release_transfer();
+
+  void clear_result();
+  ResultCase result_case() const;
+  // @@protoc_insertion_point(class_scope:chat.Response)
+ private:
+  class _Internal;
+  void set_has_user_list();
+  void set_has_incoming_message();
+  void set_has_stats();
+  void set_has_message_batch();
+  void set_has_room();
+  void set_has_presence();
+  void set_has_transfer();
+
+  inline bool has_result() const;
+  inline void clear_has_result();
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::IncomingMessageResponse > incoming_messages_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr message_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr resume_token_;
+    int operation_;
+    int status_code_;
+    uint64_t request_id_;
+    uint64_t user_id_;
+    uint32_t compression_threshold_;
+    union ResultUnion {
+      constexpr ResultUnion() : _constinit_{} {}
+        ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized _constinit_;
+      ::chat::UserListResponse* user_list_;
+      ::chat::IncomingMessageResponse* incoming_message_;
+      ::chat::ServerStats* stats_;
+      ::chat::SendMessageBatchResponse* message_batch_;
+      ::chat::RoomResponse* room_;
+      ::chat::PresenceUpdate* presence_;
+      ::chat::FileTransfer* transfer_;
+    } result_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t _oneof_case_[1];
+
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_chat_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// User
+
+// string username = 1;
+inline void User::clear_username() {
+  _impl_.username_.ClearToEmpty();
+}
+inline const std::string& User::username() const {
+  // @@protoc_insertion_point(field_get:chat.User.username)
+  return _internal_username();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void User::set_username(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.username_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.User.username)
+}
+inline std::string* User::mutable_username() {
+  std::string* _s = _internal_mutable_username();
+  // @@protoc_insertion_point(field_mutable:chat.User.username)
+  return _s;
+}
+inline const std::string& User::_internal_username() const {
+  return _impl_.username_.Get();
+}
+inline void User::_internal_set_username(const std::string& value) {
+  
+  _impl_.username_.Set(value, GetArenaForAllocation());
+}
+inline std::string* User::_internal_mutable_username() {
+  
+  return _impl_.username_.Mutable(GetArenaForAllocation());
+}
+inline std::string* User::release_username() {
+  // @@protoc_insertion_point(field_release:chat.User.username)
+  return _impl_.username_.Release();
+}
+inline void User::set_allocated_username(std::string* username) {
+  if (username != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.username_.SetAllocated(username, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.username_.IsDefault()) {
+    _impl_.username_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.User.username)
+}
+
+// string ip_address = 2;
+inline void User::clear_ip_address() {
+  _impl_.ip_address_.ClearToEmpty();
+}
+inline const std::string& User::ip_address() const {
+  // @@protoc_insertion_point(field_get:chat.User.ip_address)
+  return _internal_ip_address();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void User::set_ip_address(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.ip_address_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.User.ip_address)
+}
+inline std::string* User::mutable_ip_address() {
+  std::string* _s = _internal_mutable_ip_address();
+  // @@protoc_insertion_point(field_mutable:chat.User.ip_address)
+  return _s;
+}
+inline const std::string& User::_internal_ip_address() const {
+  return _impl_.ip_address_.Get();
+}
+inline void User::_internal_set_ip_address(const std::string& value) {
+  
+  _impl_.ip_address_.Set(value, GetArenaForAllocation());
+}
+inline std::string* User::_internal_mutable_ip_address() {
+  
+  return _impl_.ip_address_.Mutable(GetArenaForAllocation());
+}
+inline std::string* User::release_ip_address() {
+  // @@protoc_insertion_point(field_release:chat.User.ip_address)
+  return _impl_.ip_address_.Release();
+}
+inline void User::set_allocated_ip_address(std::string* ip_address) {
+  if (ip_address != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.ip_address_.SetAllocated(ip_address, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.ip_address_.IsDefault()) {
+    _impl_.ip_address_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.User.ip_address)
+}
+
+// .chat.UserStatus status = 3;
+inline void User::clear_status() {
+  _impl_.status_ = 0;
+}
+inline ::chat::UserStatus User::_internal_status() const {
+  return static_cast< ::chat::UserStatus >(_impl_.status_);
+}
+inline ::chat::UserStatus User::status() const {
+  // @@protoc_insertion_point(field_get:chat.User.status)
+  return _internal_status();
+}
+inline void User::_internal_set_status(::chat::UserStatus value) {
+  
+  _impl_.status_ = value;
+}
+inline void User::set_status(::chat::UserStatus value) {
+  _internal_set_status(value);
+  // @@protoc_insertion_point(field_set:chat.User.status)
+}
+
+// uint64 id = 4;
+inline void User::clear_id() {
+  _impl_.id_ = uint64_t{0u};
+}
+inline uint64_t User::_internal_id() const {
+  return _impl_.id_;
+}
+inline uint64_t User::id() const {
+  // @@protoc_insertion_point(field_get:chat.User.id)
+  return _internal_id();
+}
+inline void User::_internal_set_id(uint64_t value) {
+  
+  _impl_.id_ = value;
+}
+inline void User::set_id(uint64_t value) {
+  _internal_set_id(value);
+  // @@protoc_insertion_point(field_set:chat.User.id)
+}
+
+// -------------------------------------------------------------------
+
+// NewUserRequest
+
+// string username = 1;
+inline void NewUserRequest::clear_username() {
+  _impl_.username_.ClearToEmpty();
+}
+inline const std::string& NewUserRequest::username() const {
+  // @@protoc_insertion_point(field_get:chat.NewUserRequest.username)
+  return _internal_username();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void NewUserRequest::set_username(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.username_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.NewUserRequest.username)
+}
+inline std::string* NewUserRequest::mutable_username() {
+  std::string* _s = _internal_mutable_username();
+  // @@protoc_insertion_point(field_mutable:chat.NewUserRequest.username)
+  return _s;
+}
+inline const std::string& NewUserRequest::_internal_username() const {
+  return _impl_.username_.Get();
+}
+inline void NewUserRequest::_internal_set_username(const std::string& value) {
+  
+  _impl_.username_.Set(value, GetArenaForAllocation());
+}
+inline std::string* NewUserRequest::_internal_mutable_username() {
+  
+  return _impl_.username_.Mutable(GetArenaForAllocation());
+}
+inline std::string* NewUserRequest::release_username() {
+  // @@protoc_insertion_point(field_release:chat.NewUserRequest.username)
+  return _impl_.username_.Release();
+}
+inline void NewUserRequest::set_allocated_username(std::string* username) {
+  if (username != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.username_.SetAllocated(username, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.username_.IsDefault()) {
+    _impl_.username_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.NewUserRequest.username)
+}
+
+// bool accept_batched_delivery = 2;
+inline void NewUserRequest::clear_accept_batched_delivery() {
+  _impl_.accept_batched_delivery_ = false;
+}
+inline bool NewUserRequest::_internal_accept_batched_delivery() const {
+  return _impl_.accept_batched_delivery_;
+}
+inline bool NewUserRequest::accept_batched_delivery() const {
+  // @@protoc_insertion_point(field_get:chat.NewUserRequest.accept_batched_delivery)
+  return _internal_accept_batched_delivery();
+}
+inline void NewUserRequest::_internal_set_accept_batched_delivery(bool value) {
+  
+  _impl_.accept_batched_delivery_ = value;
+}
+inline void NewUserRequest::set_accept_batched_delivery(bool value) {
+  _internal_set_accept_batched_delivery(value);
+  // @@protoc_insertion_point(field_set:chat.NewUserRequest.accept_batched_delivery)
+}
+
+// bool accept_compression = 3;
+inline void NewUserRequest::clear_accept_compression() {
+  _impl_.accept_compression_ = false;
+}
+inline bool NewUserRequest::_internal_accept_compression() const {
+  return _impl_.accept_compression_;
+}
+inline bool NewUserRequest::accept_compression() const {
+  // @@protoc_insertion_point(field_get:chat.NewUserRequest.accept_compression)
+  return _internal_accept_compression();
+}
+inline void NewUserRequest::_internal_set_accept_compression(bool value) {
+  
+  _impl_.accept_compression_ = value;
+}
+inline void NewUserRequest::set_accept_compression(bool value) {
+  _internal_set_accept_compression(value);
+  // @@protoc_insertion_point(field_set:chat.NewUserRequest.accept_compression)
+}
+
+// -------------------------------------------------------------------
+
+// ResumeRequest
+
+// bytes token = 1;
+inline void ResumeRequest::clear_token() {
+  _impl_.token_.ClearToEmpty();
+}
+inline const std::string& ResumeRequest::token() const {
+  // @@protoc_insertion_point(field_get:chat.ResumeRequest.token)
+  return _internal_token();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void ResumeRequest::set_token(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.token_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.ResumeRequest.token)
+}
+inline std::string* ResumeRequest::mutable_token() {
+  std::string* _s = _internal_mutable_token();
+  // @@protoc_insertion_point(field_mutable:chat.ResumeRequest.token)
+  return _s;
+}
+inline const std::string& ResumeRequest::_internal_token() const {
+  return _impl_.token_.Get();
+}
+inline void ResumeRequest::_internal_set_token(const std::string& value) {
+  
+  _impl_.token_.Set(value, GetArenaForAllocation());
+}
+inline std::string* ResumeRequest::_internal_mutable_token() {
+  
+  return _impl_.token_.Mutable(GetArenaForAllocation());
+}
+inline std::string* ResumeRequest::release_token() {
+  // @@protoc_insertion_point(field_release:chat.ResumeRequest.token)
+  return _impl_.token_.Release();
+}
+inline void ResumeRequest::set_allocated_token(std::string* token) {
+  if (token != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.token_.SetAllocated(token, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.token_.IsDefault()) {
+    _impl_.token_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.ResumeRequest.token)
+}
+
+// -------------------------------------------------------------------
+
+// FileOffer
+
+// string recipient = 1;
+inline void FileOffer::clear_recipient() {
+  _impl_.recipient_.ClearToEmpty();
+}
+inline const std::string& FileOffer::recipient() const {
+  // @@protoc_insertion_point(field_get:chat.FileOffer.recipient)
+  return _internal_recipient();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void FileOffer::set_recipient(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.recipient_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.FileOffer.recipient)
+}
+inline std::string* FileOffer::mutable_recipient() {
+  std::string* _s = _internal_mutable_recipient();
+  // @@protoc_insertion_point(field_mutable:chat.FileOffer.recipient)
+  return _s;
+}
+inline const std::string& FileOffer::_internal_recipient() const {
+  return _impl_.recipient_.Get();
+}
+inline void FileOffer::_internal_set_recipient(const std::string& value) {
+  
+  _impl_.recipient_.Set(value, GetArenaForAllocation());
+}
+inline std::string* FileOffer::_internal_mutable_recipient() {
+  
+  return _impl_.recipient_.Mutable(GetArenaForAllocation());
+}
+inline std::string* FileOffer::release_recipient() {
+  // @@protoc_insertion_point(field_release:chat.FileOffer.recipient)
+  return _impl_.recipient_.Release();
+}
+inline void FileOffer::set_allocated_recipient(std::string* recipient) {
+  if (recipient != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.recipient_.SetAllocated(recipient, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.recipient_.IsDefault()) {
+    _impl_.recipient_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.FileOffer.recipient)
+}
+
+// uint64 recipient_id = 2;
+inline void FileOffer::clear_recipient_id() {
+  _impl_.recipient_id_ = uint64_t{0u};
+}
+inline uint64_t FileOffer::_internal_recipient_id() const {
+  return _impl_.recipient_id_;
+}
+inline uint64_t FileOffer::recipient_id() const {
+  // @@protoc_insertion_point(field_get:chat.FileOffer.recipient_id)
+  return _internal_recipient_id();
+}
+inline void FileOffer::_internal_set_recipient_id(uint64_t value) {
+  
+  _impl_.recipient_id_ = value;
+}
+inline void FileOffer::set_recipient_id(uint64_t value) {
+  _internal_set_recipient_id(value);
+  // @@protoc_insertion_point(field_set:chat.FileOffer.recipient_id)
+}
+
+// string name = 3;
+inline void FileOffer::clear_name() {
+  _impl_.name_.ClearToEmpty();
+}
+inline const std::string& FileOffer::name() const {
+  // @@protoc_insertion_point(field_get:chat.FileOffer.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void FileOffer::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.FileOffer.name)
+}
+inline std::string* FileOffer::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:chat.FileOffer.name)
+  return _s;
+}
+inline const std::string& FileOffer::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void FileOffer::_internal_set_name(const std::string& value) {
+  
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* FileOffer::_internal_mutable_name() {
+  
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* FileOffer::release_name() {
+  // @@protoc_insertion_point(field_release:chat.FileOffer.name)
+  return _impl_.name_.Release();
+}
+inline void FileOffer::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.FileOffer.name)
+}
+
+// uint64 size = 4;
+inline void FileOffer::clear_size() {
+  _impl_.size_ = uint64_t{0u};
+}
+inline uint64_t FileOffer::_internal_size() const {
+  return _impl_.size_;
+}
+inline uint64_t FileOffer::size() const {
+  // @@protoc_insertion_point(field_get:chat.FileOffer.size)
+  return _internal_size();
+}
+inline void FileOffer::_internal_set_size(uint64_t value) {
+  
+  _impl_.size_ = value;
+}
+inline void FileOffer::set_size(uint64_t value) {
+  _internal_set_size(value);
+  // @@protoc_insertion_point(field_set:chat.FileOffer.size)
+}
+
+// -------------------------------------------------------------------
+
+// FileWindow
+
+// uint64 transfer_id = 1;
+inline void FileWindow::clear_transfer_id() {
+  _impl_.transfer_id_ = uint64_t{0u};
+}
+inline uint64_t FileWindow::_internal_transfer_id() const {
+  return _impl_.transfer_id_;
+}
+inline uint64_t FileWindow::transfer_id() const {
+  // @@protoc_insertion_point(field_get:chat.FileWindow.transfer_id)
+  return _internal_transfer_id();
+}
+inline void FileWindow::_internal_set_transfer_id(uint64_t value) {
+  
+  _impl_.transfer_id_ = value;
+}
+inline void FileWindow::set_transfer_id(uint64_t value) {
+  _internal_set_transfer_id(value);
+  // @@protoc_insertion_point(field_set:chat.FileWindow.transfer_id)
+}
+
+// uint64 bytes = 2;
+inline void FileWindow::clear_bytes() {
+  _impl_.bytes_ = uint64_t{0u};
+}
+inline uint64_t FileWindow::_internal_bytes() const {
+  return _impl_.bytes_;
+}
+inline uint64_t FileWindow::bytes() const {
+  // @@protoc_insertion_point(field_get:chat.FileWindow.bytes)
+  return _internal_bytes();
+}
+inline void FileWindow::_internal_set_bytes(uint64_t value) {
+  
+  _impl_.bytes_ = value;
+}
+inline void FileWindow::set_bytes(uint64_t value) {
+  _internal_set_bytes(value);
+  // @@protoc_insertion_point(field_set:chat.FileWindow.bytes)
+}
+
+// -------------------------------------------------------------------
+
+// SendMessageRequest
+
+// string recipient = 1;
+inline void SendMessageRequest::clear_recipient() {
+  _impl_.recipient_.ClearToEmpty();
+}
+inline const std::string& SendMessageRequest::recipient() const {
+  // @@protoc_insertion_point(field_get:chat.SendMessageRequest.recipient)
+  return _internal_recipient();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SendMessageRequest::set_recipient(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.recipient_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.SendMessageRequest.recipient)
+}
+inline std::string* SendMessageRequest::mutable_recipient() {
+  std::string* _s = _internal_mutable_recipient();
+  // @@protoc_insertion_point(field_mutable:chat.SendMessageRequest.recipient)
+  return _s;
+}
+inline const std::string& SendMessageRequest::_internal_recipient() const {
+  return _impl_.recipient_.Get();
+}
+inline void SendMessageRequest::_internal_set_recipient(const std::string& value) {
+  
+  _impl_.recipient_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SendMessageRequest::_internal_mutable_recipient() {
+  
+  return _impl_.recipient_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SendMessageRequest::release_recipient() {
+  // @@protoc_insertion_point(field_release:chat.SendMessageRequest.recipient)
+  return _impl_.recipient_.Release();
+}
+inline void SendMessageRequest::set_allocated_recipient(std::string* recipient) {
+  if (recipient != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.recipient_.SetAllocated(recipient, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.recipient_.IsDefault()) {
+    _impl_.recipient_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.SendMessageRequest.recipient)
+}
+
+// string content = 2;
+inline void SendMessageRequest::clear_content() {
+  _impl_.content_.ClearToEmpty();
+}
+inline const std::string& SendMessageRequest::content() const {
+  // @@protoc_insertion_point(field_get:chat.SendMessageRequest.content)
+  return _internal_content();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SendMessageRequest::set_content(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.content_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.SendMessageRequest.content)
+}
+inline std::string* SendMessageRequest::mutable_content() {
+  std::string* _s = _internal_mutable_content();
+  // @@protoc_insertion_point(field_mutable:chat.SendMessageRequest.content)
+  return _s;
+}
+inline const std::string& SendMessageRequest::_internal_content() const {
+  return _impl_.content_.Get();
+}
+inline void SendMessageRequest::_internal_set_content(const std::string& value) {
+  
+  _impl_.content_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SendMessageRequest::_internal_mutable_content() {
+  
+  return _impl_.content_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SendMessageRequest::release_content() {
+  // @@protoc_insertion_point(field_release:chat.SendMessageRequest.content)
+  return _impl_.content_.Release();
+}
+inline void SendMessageRequest::set_allocated_content(std::string* content) {
+  if (content != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.content_.SetAllocated(content, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.content_.IsDefault()) {
+    _impl_.content_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.SendMessageRequest.content)
+}
+
+// string room = 3;
+inline void SendMessageRequest::clear_room() {
+  _impl_.room_.ClearToEmpty();
+}
+inline const std::string& SendMessageRequest::room() const {
+  // @@protoc_insertion_point(field_get:chat.SendMessageRequest.room)
+  return _internal_room();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void SendMessageRequest::set_room(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.room_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.SendMessageRequest.room)
+}
+inline std::string* SendMessageRequest::mutable_room() {
+  std::string* _s = _internal_mutable_room();
+  // @@protoc_insertion_point(field_mutable:chat.SendMessageRequest.room)
+  return _s;
+}
+inline const std::string& SendMessageRequest::_internal_room() const {
+  return _impl_.room_.Get();
+}
+inline void SendMessageRequest::_internal_set_room(const std::string& value) {
+  
+  _impl_.room_.Set(value, GetArenaForAllocation());
+}
+inline std::string* SendMessageRequest::_internal_mutable_room() {
+  
+  return _impl_.room_.Mutable(GetArenaForAllocation());
+}
+inline std::string* SendMessageRequest::release_room() {
+  // @@protoc_insertion_point(field_release:chat.SendMessageRequest.room)
+  return _impl_.room_.Release();
+}
+inline void SendMessageRequest::set_allocated_room(std::string* room) {
+  if (room != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.room_.SetAllocated(room, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.room_.IsDefault()) {
+    _impl_.room_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.SendMessageRequest.room)
+}
+
+// uint64 recipient_id = 4;
+inline void SendMessageRequest::clear_recipient_id() {
+  _impl_.recipient_id_ = uint64_t{0u};
+}
+inline uint64_t SendMessageRequest::_internal_recipient_id() const {
+  return _impl_.recipient_id_;
+}
+inline uint64_t SendMessageRequest::recipient_id() const {
+  // @@protoc_insertion_point(field_get:chat.SendMessageRequest.recipient_id)
+  return _internal_recipient_id();
+}
+inline void SendMessageRequest::_internal_set_recipient_id(uint64_t value) {
+  
+  _impl_.recipient_id_ = value;
+}
+inline void SendMessageRequest::set_recipient_id(uint64_t value) {
+  _internal_set_recipient_id(value);
+  // @@protoc_insertion_point(field_set:chat.SendMessageRequest.recipient_id)
+}
+
+// -------------------------------------------------------------------
+
+// SendMessageBatchRequest
+
+// repeated .chat.SendMessageRequest messages = 1;
+inline int SendMessageBatchRequest::_internal_messages_size() const {
+  return _impl_.messages_.size();
+}
+inline int SendMessageBatchRequest::messages_size() const {
+  return _internal_messages_size();
+}
+inline void SendMessageBatchRequest::clear_messages() {
+  _impl_.messages_.Clear();
+}
+inline ::chat::SendMessageRequest* SendMessageBatchRequest::mutable_messages(int index) {
+  // @@protoc_insertion_point(field_mutable:chat.SendMessageBatchRequest.messages)
+  return _impl_.messages_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::SendMessageRequest >*
+SendMessageBatchRequest::mutable_messages() {
+  // @@protoc_insertion_point(field_mutable_list:chat.SendMessageBatchRequest.messages)
+  return &_impl_.messages_;
+}
+inline const ::chat::SendMessageRequest& SendMessageBatchRequest::_internal_messages(int index) const {
+  return _impl_.messages_.Get(index);
+}
+inline const ::chat::SendMessageRequest& SendMessageBatchRequest::messages(int index) const {
+  // @@protoc_insertion_point(field_get:chat.SendMessageBatchRequest.messages)
+  return _internal_messages(index);
+}
+inline ::chat::SendMessageRequest* SendMessageBatchRequest::_internal_add_messages() {
+  return _impl_.messages_.Add();
+}
+inline ::chat::SendMessageRequest* SendMessageBatchRequest::add_messages() {
+  ::chat::SendMessageRequest* _add = _internal_add_messages();
+  // @@protoc_insertion_point(field_add:chat.SendMessageBatchRequest.messages)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::SendMessageRequest >&
+SendMessageBatchRequest::messages() const {
+  // @@protoc_insertion_point(field_list:chat.SendMessageBatchRequest.messages)
+  return _impl_.messages_;
+}
+
+// -------------------------------------------------------------------
+
+// IncomingMessageResponse
+
+// string sender = 1;
+inline void IncomingMessageResponse::clear_sender() {
+  _impl_.sender_.ClearToEmpty();
+}
+inline const std::string& IncomingMessageResponse::sender() const {
+  // @@protoc_insertion_point(field_get:chat.IncomingMessageResponse.sender)
+  return _internal_sender();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void IncomingMessageResponse::set_sender(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.sender_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.IncomingMessageResponse.sender)
+}
+inline std::string* IncomingMessageResponse::mutable_sender() {
+  std::string* _s = _internal_mutable_sender();
+  // @@protoc_insertion_point(field_mutable:chat.IncomingMessageResponse.sender)
+  return _s;
+}
+inline const std::string& IncomingMessageResponse::_internal_sender() const {
+  return _impl_.sender_.Get();
+}
+inline void IncomingMessageResponse::_internal_set_sender(const std::string& value) {
+  
+  _impl_.sender_.Set(value, GetArenaForAllocation());
+}
+inline std::string* IncomingMessageResponse::_internal_mutable_sender() {
+  
+  return _impl_.sender_.Mutable(GetArenaForAllocation());
+}
+inline std::string* IncomingMessageResponse::release_sender() {
+  // @@protoc_insertion_point(field_release:chat.IncomingMessageResponse.sender)
+  return _impl_.sender_.Release();
+}
+inline void IncomingMessageResponse::set_allocated_sender(std::string* sender) {
+  if (sender != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.sender_.SetAllocated(sender, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.sender_.IsDefault()) {
+    _impl_.sender_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.IncomingMessageResponse.sender)
+}
+
+// string content = 2;
+inline void IncomingMessageResponse::clear_content() {
+  _impl_.content_.ClearToEmpty();
+}
+inline const std::string& IncomingMessageResponse::content() const {
+  // @@protoc_insertion_point(field_get:chat.IncomingMessageResponse.content)
+  return _internal_content();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void IncomingMessageResponse::set_content(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.content_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.IncomingMessageResponse.content)
+}
+inline std::string* IncomingMessageResponse::mutable_content() {
+  std::string* _s = _internal_mutable_content();
+  // @@protoc_insertion_point(field_mutable:chat.IncomingMessageResponse.content)
+  return _s;
+}
+inline const std::string& IncomingMessageResponse::_internal_content() const {
+  return _impl_.content_.Get();
+}
+inline void IncomingMessageResponse::_internal_set_content(const std::string& value) {
+  
+  _impl_.content_.Set(value, GetArenaForAllocation());
+}
+inline std::string* IncomingMessageResponse::_internal_mutable_content() {
+  
+  return _impl_.content_.Mutable(GetArenaForAllocation());
+}
+inline std::string* IncomingMessageResponse::release_content() {
+  // @@protoc_insertion_point(field_release:chat.IncomingMessageResponse.content)
+  return _impl_.content_.Release();
+}
+inline void IncomingMessageResponse::set_allocated_content(std::string* content) {
+  if (content != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.content_.SetAllocated(content, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.content_.IsDefault()) {
+    _impl_.content_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.IncomingMessageResponse.content)
+}
+
+// .chat.MessageType type = 3;
+inline void IncomingMessageResponse::clear_type() {
+  _impl_.type_ = 0;
+}
+inline ::chat::MessageType IncomingMessageResponse::_internal_type() const {
+  return static_cast< ::chat::MessageType >(_impl_.type_);
+}
+inline ::chat::MessageType IncomingMessageResponse::type() const {
+  // @@protoc_insertion_point(field_get:chat.IncomingMessageResponse.type)
+  return _internal_type();
+}
+inline void IncomingMessageResponse::_internal_set_type(::chat::MessageType value) {
+  
+  _impl_.type_ = value;
+}
+inline void IncomingMessageResponse::set_type(::chat::MessageType value) {
+  _internal_set_type(value);
+  // @@protoc_insertion_point(field_set:chat.IncomingMessageResponse.type)
+}
+
+// string room = 4;
+inline void IncomingMessageResponse::clear_room() {
+  _impl_.room_.ClearToEmpty();
+}
+inline const std::string& IncomingMessageResponse::room() const {
+  // @@protoc_insertion_point(field_get:chat.IncomingMessageResponse.room)
+  return _internal_room();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void IncomingMessageResponse::set_room(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.room_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.IncomingMessageResponse.room)
+}
+inline std::string* IncomingMessageResponse::mutable_room() {
+  std::string* _s = _internal_mutable_room();
+  // @@protoc_insertion_point(field_mutable:chat.IncomingMessageResponse.room)
+  return _s;
+}
+inline const std::string& IncomingMessageResponse::_internal_room() const {
+  return _impl_.room_.Get();
+}
+inline void IncomingMessageResponse::_internal_set_room(const std::string& value) {
+  
+  _impl_.room_.Set(value, GetArenaForAllocation());
+}
+inline std::string* IncomingMessageResponse::_internal_mutable_room() {
+  
+  return _impl_.room_.Mutable(GetArenaForAllocation());
+}
+inline std::string* IncomingMessageResponse::release_room() {
+  // @@protoc_insertion_point(field_release:chat.IncomingMessageResponse.room)
+  return _impl_.room_.Release();
+}
+inline void IncomingMessageResponse::set_allocated_room(std::string* room) {
+  if (room != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.room_.SetAllocated(room, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.room_.IsDefault()) {
+    _impl_.room_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.IncomingMessageResponse.room)
+}
+
+// uint64 sender_id = 5;
+inline void IncomingMessageResponse::clear_sender_id() {
+  _impl_.sender_id_ = uint64_t{0u};
+}
+inline uint64_t IncomingMessageResponse::_internal_sender_id() const {
+  return _impl_.sender_id_;
+}
+inline uint64_t IncomingMessageResponse::sender_id() const {
+  // @@protoc_insertion_point(field_get:chat.IncomingMessageResponse.sender_id)
+  return _internal_sender_id();
+}
+inline void IncomingMessageResponse::_internal_set_sender_id(uint64_t value) {
+  
+  _impl_.sender_id_ = value;
+}
+inline void IncomingMessageResponse::set_sender_id(uint64_t value) {
+  _internal_set_sender_id(value);
+  // @@protoc_insertion_point(field_set:chat.IncomingMessageResponse.sender_id)
+}
+
+// -------------------------------------------------------------------
+
+// RoomRequest
+
+// string room = 1;
+inline void RoomRequest::clear_room() {
+  _impl_.room_.ClearToEmpty();
+}
+inline const std::string& RoomRequest::room() const {
+  // @@protoc_insertion_point(field_get:chat.RoomRequest.room)
+  return _internal_room();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void RoomRequest::set_room(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.room_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.RoomRequest.room)
+}
+inline std::string* RoomRequest::mutable_room() {
+  std::string* _s = _internal_mutable_room();
+  // @@protoc_insertion_point(field_mutable:chat.RoomRequest.room)
+  return _s;
+}
+inline const std::string& RoomRequest::_internal_room() const {
+  return _impl_.room_.Get();
+}
+inline void RoomRequest::_internal_set_room(const std::string& value) {
+  
+  _impl_.room_.Set(value, GetArenaForAllocation());
+}
+inline std::string* RoomRequest::_internal_mutable_room() {
+  
+  return _impl_.room_.Mutable(GetArenaForAllocation());
+}
+inline std::string* RoomRequest::release_room() {
+  // @@protoc_insertion_point(field_release:chat.RoomRequest.room)
+  return _impl_.room_.Release();
+}
+inline void RoomRequest::set_allocated_room(std::string* room) {
+  if (room != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.room_.SetAllocated(room, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.room_.IsDefault()) {
+    _impl_.room_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.RoomRequest.room)
+}
+
+// -------------------------------------------------------------------
+
+// RoomResponse
+
+// string room = 1;
+inline void RoomResponse::clear_room() {
+  _impl_.room_.ClearToEmpty();
+}
+inline const std::string& RoomResponse::room() const {
+  // @@protoc_insertion_point(field_get:chat.RoomResponse.room)
+  return _internal_room();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void RoomResponse::set_room(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.room_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.RoomResponse.room)
+}
+inline std::string* RoomResponse::mutable_room() {
+  std::string* _s = _internal_mutable_room();
+  // @@protoc_insertion_point(field_mutable:chat.RoomResponse.room)
+  return _s;
+}
+inline const std::string& RoomResponse::_internal_room() const {
+  return _impl_.room_.Get();
+}
+inline void RoomResponse::_internal_set_room(const std::string& value) {
+  
+  _impl_.room_.Set(value, GetArenaForAllocation());
+}
+inline std::string* RoomResponse::_internal_mutable_room() {
+  
+  return _impl_.room_.Mutable(GetArenaForAllocation());
+}
+inline std::string* RoomResponse::release_room() {
+  // @@protoc_insertion_point(field_release:chat.RoomResponse.room)
+  return _impl_.room_.Release();
+}
+inline void RoomResponse::set_allocated_room(std::string* room) {
+  if (room != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.room_.SetAllocated(room, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.room_.IsDefault()) {
+    _impl_.room_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.RoomResponse.room)
+}
+
+// uint32 members = 2;
+inline void RoomResponse::clear_members() {
+  _impl_.members_ = 0u;
+}
+inline uint32_t RoomResponse::_internal_members() const {
+  return _impl_.members_;
+}
+inline uint32_t RoomResponse::members() const {
+  // @@protoc_insertion_point(field_get:chat.RoomResponse.members)
+  return _internal_members();
+}
+inline void RoomResponse::_internal_set_members(uint32_t value) {
+  
+  _impl_.members_ = value;
+}
+inline void RoomResponse::set_members(uint32_t value) {
+  _internal_set_members(value);
+  // @@protoc_insertion_point(field_set:chat.RoomResponse.members)
+}
+
+// -------------------------------------------------------------------
+
+// SendMessageBatchResponse
+
+// repeated .chat.StatusCode results = 1;
+inline int SendMessageBatchResponse::_internal_results_size() const {
+  return _impl_.results_.size();
+}
+inline int SendMessageBatchResponse::results_size() const {
+  return _internal_results_size();
+}
+inline void SendMessageBatchResponse::clear_results() {
+  _impl_.results_.Clear();
+}
+inline ::chat::StatusCode SendMessageBatchResponse::_internal_results(int index) const {
+  return static_cast< ::chat::StatusCode >(_impl_.results_.Get(index));
+}
+inline ::chat::StatusCode SendMessageBatchResponse::results(int index) const {
+  // @@protoc_insertion_point(field_get:chat.SendMessageBatchResponse.results)
+  return _internal_results(index);
+}
+inline void SendMessageBatchResponse::set_results(int index, ::chat::StatusCode value) {
+  _impl_.results_.Set(index, value);
+  // @@protoc_insertion_point(field_set:chat.SendMessageBatchResponse.results)
+}
+inline void SendMessageBatchResponse::_internal_add_results(::chat::StatusCode value) {
+  _impl_.results_.Add(value);
+}
+inline void SendMessageBatchResponse::add_results(::chat::StatusCode value) {
+  _internal_add_results(value);
+  // @@protoc_insertion_point(field_add:chat.SendMessageBatchResponse.results)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>&
+SendMessageBatchResponse::results() const {
+  // @@protoc_insertion_point(field_list:chat.SendMessageBatchResponse.results)
+  return _impl_.results_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>*
+SendMessageBatchResponse::_internal_mutable_results() {
+  return &_impl_.results_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField<int>*
+SendMessageBatchResponse::mutable_results() {
+  // @@protoc_insertion_point(field_mutable_list:chat.SendMessageBatchResponse.results)
+  return _internal_mutable_results();
+}
+
+// -------------------------------------------------------------------
+
+// UserListRequest
+
+// string username = 1;
+inline void UserListRequest::clear_username() {
+  _impl_.username_.ClearToEmpty();
+}
+inline const std::string& UserListRequest::username() const {
+  // @@protoc_insertion_point(field_get:chat.UserListRequest.username)
+  return _internal_username();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void UserListRequest::set_username(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.username_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.UserListRequest.username)
+}
+inline std::string* UserListRequest::mutable_username() {
+  std::string* _s = _internal_mutable_username();
+  // @@protoc_insertion_point(field_mutable:chat.UserListRequest.username)
+  return _s;
+}
+inline const std::string& UserListRequest::_internal_username() const {
+  return _impl_.username_.Get();
+}
+inline void UserListRequest::_internal_set_username(const std::string& value) {
+  
+  _impl_.username_.Set(value, GetArenaForAllocation());
+}
+inline std::string* UserListRequest::_internal_mutable_username() {
+  
+  return _impl_.username_.Mutable(GetArenaForAllocation());
+}
+inline std::string* UserListRequest::release_username() {
+  // @@protoc_insertion_point(field_release:chat.UserListRequest.username)
+  return _impl_.username_.Release();
+}
+inline void UserListRequest::set_allocated_username(std::string* username) {
+  if (username != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.username_.SetAllocated(username, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.username_.IsDefault()) {
+    _impl_.username_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.UserListRequest.username)
+}
+
+// -------------------------------------------------------------------
+
+// UserListResponse
+
+// repeated .chat.User users = 1;
+inline int UserListResponse::_internal_users_size() const {
+  return _impl_.users_.size();
+}
+inline int UserListResponse::users_size() const {
+  return _internal_users_size();
+}
+inline void UserListResponse::clear_users() {
+  _impl_.users_.Clear();
+}
+inline ::chat::User* UserListResponse::mutable_users(int index) {
+  // @@protoc_insertion_point(field_mutable:chat.UserListResponse.users)
+  return _impl_.users_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::User >*
+UserListResponse::mutable_users() {
+  // @@protoc_insertion_point(field_mutable_list:chat.UserListResponse.users)
+  return &_impl_.users_;
+}
+inline const ::chat::User& UserListResponse::_internal_users(int index) const {
+  return _impl_.users_.Get(index);
+}
+inline const ::chat::User& UserListResponse::users(int index) const {
+  // @@protoc_insertion_point(field_get:chat.UserListResponse.users)
+  return _internal_users(index);
+}
+inline ::chat::User* UserListResponse::_internal_add_users() {
+  return _impl_.users_.Add();
+}
+inline ::chat::User* UserListResponse::add_users() {
+  ::chat::User* _add = _internal_add_users();
+  // @@protoc_insertion_point(field_add:chat.UserListResponse.users)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::User >&
+UserListResponse::users() const {
+  // @@protoc_insertion_point(field_list:chat.UserListResponse.users)
+  return _impl_.users_;
+}
+
+// .chat.UserListType type = 2;
+inline void UserListResponse::clear_type() {
+  _impl_.type_ = 0;
+}
+inline ::chat::UserListType UserListResponse::_internal_type() const {
+  return static_cast< ::chat::UserListType >(_impl_.type_);
+}
+inline ::chat::UserListType UserListResponse::type() const {
+  // @@protoc_insertion_point(field_get:chat.UserListResponse.type)
+  return _internal_type();
+}
+inline void UserListResponse::_internal_set_type(::chat::UserListType value) {
+  
+  _impl_.type_ = value;
+}
+inline void UserListResponse::set_type(::chat::UserListType value) {
+  _internal_set_type(value);
+  // @@protoc_insertion_point(field_set:chat.UserListResponse.type)
+}
+
+// -------------------------------------------------------------------
+
+// PresenceEvent
+
+// string username = 1;
+inline void PresenceEvent::clear_username() {
+  _impl_.username_.ClearToEmpty();
+}
+inline const std::string& PresenceEvent::username() const {
+  // @@protoc_insertion_point(field_get:chat.PresenceEvent.username)
+  return _internal_username();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void PresenceEvent::set_username(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.username_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.PresenceEvent.username)
+}
+inline std::string* PresenceEvent::mutable_username() {
+  std::string* _s = _internal_mutable_username();
+  // @@protoc_insertion_point(field_mutable:chat.PresenceEvent.username)
+  return _s;
+}
+inline const std::string& PresenceEvent::_internal_username() const {
+  return _impl_.username_.Get();
+}
+inline void PresenceEvent::_internal_set_username(const std::string& value) {
+  
+  _impl_.username_.Set(value, GetArenaForAllocation());
+}
+inline std::string* PresenceEvent::_internal_mutable_username() {
+  
+  return _impl_.username_.Mutable(GetArenaForAllocation());
+}
+inline std::string* PresenceEvent::release_username() {
+  // @@protoc_insertion_point(field_release:chat.PresenceEvent.username)
+  return _impl_.username_.Release();
+}
+inline void PresenceEvent::set_allocated_username(std::string* username) {
+  if (username != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.username_.SetAllocated(username, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.username_.IsDefault()) {
+    _impl_.username_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.PresenceEvent.username)
+}
+
+// .chat.PresenceChange change = 2;
+inline void PresenceEvent::clear_change() {
+  _impl_.change_ = 0;
+}
+inline ::chat::PresenceChange PresenceEvent::_internal_change() const {
+  return static_cast< ::chat::PresenceChange >(_impl_.change_);
+}
+inline ::chat::PresenceChange PresenceEvent::change() const {
+  // @@protoc_insertion_point(field_get:chat.PresenceEvent.change)
+  return _internal_change();
+}
+inline void PresenceEvent::_internal_set_change(::chat::PresenceChange value) {
+  
+  _impl_.change_ = value;
+}
+inline void PresenceEvent::set_change(::chat::PresenceChange value) {
+  _internal_set_change(value);
+  // @@protoc_insertion_point(field_set:chat.PresenceEvent.change)
+}
+
+// .chat.UserStatus status = 3;
+inline void PresenceEvent::clear_status() {
+  _impl_.status_ = 0;
+}
+inline ::chat::UserStatus PresenceEvent::_internal_status() const {
+  return static_cast< ::chat::UserStatus >(_impl_.status_);
+}
+inline ::chat::UserStatus PresenceEvent::status() const {
+  // @@protoc_insertion_point(field_get:chat.PresenceEvent.status)
+  return _internal_status();
+}
+inline void PresenceEvent::_internal_set_status(::chat::UserStatus value) {
+  
+  _impl_.status_ = value;
+}
+inline void PresenceEvent::set_status(::chat::UserStatus value) {
+  _internal_set_status(value);
+  // @@protoc_insertion_point(field_set:chat.PresenceEvent.status)
+}
+
+// uint64 user_id = 4;
+inline void PresenceEvent::clear_user_id() {
+  _impl_.user_id_ = uint64_t{0u};
+}
+inline uint64_t PresenceEvent::_internal_user_id() const {
+  return _impl_.user_id_;
+}
+inline uint64_t PresenceEvent::user_id() const {
+  // @@protoc_insertion_point(field_get:chat.PresenceEvent.user_id)
+  return _internal_user_id();
+}
+inline void PresenceEvent::_internal_set_user_id(uint64_t value) {
+  
+  _impl_.user_id_ = value;
+}
+inline void PresenceEvent::set_user_id(uint64_t value) {
+  _internal_set_user_id(value);
+  // @@protoc_insertion_point(field_set:chat.PresenceEvent.user_id)
+}
+
+// -------------------------------------------------------------------
+
+// PresenceUpdate
+
+// bool snapshot = 1;
+inline void PresenceUpdate::clear_snapshot() {
+  _impl_.snapshot_ = false;
+}
+inline bool PresenceUpdate::_internal_snapshot() const {
+  return _impl_.snapshot_;
+}
+inline bool PresenceUpdate::snapshot() const {
+  // @@protoc_insertion_point(field_get:chat.PresenceUpdate.snapshot)
+  return _internal_snapshot();
+}
+inline void PresenceUpdate::_internal_set_snapshot(bool value) {
+  
+  _impl_.snapshot_ = value;
+}
+inline void PresenceUpdate::set_snapshot(bool value) {
+  _internal_set_snapshot(value);
+  // @@protoc_insertion_point(field_set:chat.PresenceUpdate.snapshot)
+}
+
+// uint64 version = 2;
+inline void PresenceUpdate::clear_version() {
+  _impl_.version_ = uint64_t{0u};
+}
+inline uint64_t PresenceUpdate::_internal_version() const {
+  return _impl_.version_;
+}
+inline uint64_t PresenceUpdate::version() const {
+  // @@protoc_insertion_point(field_get:chat.PresenceUpdate.version)
+  return _internal_version();
+}
+inline void PresenceUpdate::_internal_set_version(uint64_t value) {
+  
+  _impl_.version_ = value;
+}
+inline void PresenceUpdate::set_version(uint64_t value) {
+  _internal_set_version(value);
+  // @@protoc_insertion_point(field_set:chat.PresenceUpdate.version)
+}
+
+// uint64 since_version = 3;
+inline void PresenceUpdate::clear_since_version() {
+  _impl_.since_version_ = uint64_t{0u};
+}
+inline uint64_t PresenceUpdate::_internal_since_version() const {
+  return _impl_.since_version_;
+}
+inline uint64_t PresenceUpdate::since_version() const {
+  // @@protoc_insertion_point(field_get:chat.PresenceUpdate.since_version)
+  return _internal_since_version();
+}
+inline void PresenceUpdate::_internal_set_since_version(uint64_t value) {
+  
+  _impl_.since_version_ = value;
+}
+inline void PresenceUpdate::set_since_version(uint64_t value) {
+  _internal_set_since_version(value);
+  // @@protoc_insertion_point(field_set:chat.PresenceUpdate.since_version)
+}
+
+// repeated .chat.User users = 4;
+inline int PresenceUpdate::_internal_users_size() const {
+  return _impl_.users_.size();
+}
+inline int PresenceUpdate::users_size() const {
+  return _internal_users_size();
+}
+inline void PresenceUpdate::clear_users() {
+  _impl_.users_.Clear();
+}
+inline ::chat::User* PresenceUpdate::mutable_users(int index) {
+  // @@protoc_insertion_point(field_mutable:chat.PresenceUpdate.users)
+  return _impl_.users_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::User >*
+PresenceUpdate::mutable_users() {
+  // @@protoc_insertion_point(field_mutable_list:chat.PresenceUpdate.users)
+  return &_impl_.users_;
+}
+inline const ::chat::User& PresenceUpdate::_internal_users(int index) const {
+  return _impl_.users_.Get(index);
+}
+inline const ::chat::User& PresenceUpdate::users(int index) const {
+  // @@protoc_insertion_point(field_get:chat.PresenceUpdate.users)
+  return _internal_users(index);
+}
+inline ::chat::User* PresenceUpdate::_internal_add_users() {
+  return _impl_.users_.Add();
+}
+inline ::chat::User* PresenceUpdate::add_users() {
+  ::chat::User* _add = _internal_add_users();
+  // @@protoc_insertion_point(field_add:chat.PresenceUpdate.users)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::User >&
+PresenceUpdate::users() const {
+  // @@protoc_insertion_point(field_list:chat.PresenceUpdate.users)
+  return _impl_.users_;
+}
+
+// repeated .chat.PresenceEvent events = 5;
+inline int PresenceUpdate::_internal_events_size() const {
+  return _impl_.events_.size();
+}
+inline int PresenceUpdate::events_size() const {
+  return _internal_events_size();
+}
+inline void PresenceUpdate::clear_events() {
+  _impl_.events_.Clear();
+}
+inline ::chat::PresenceEvent* PresenceUpdate::mutable_events(int index) {
+  // @@protoc_insertion_point(field_mutable:chat.PresenceUpdate.events)
+  return _impl_.events_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::PresenceEvent >*
+PresenceUpdate::mutable_events() {
+  // @@protoc_insertion_point(field_mutable_list:chat.PresenceUpdate.events)
+  return &_impl_.events_;
+}
+inline const ::chat::PresenceEvent& PresenceUpdate::_internal_events(int index) const {
+  return _impl_.events_.Get(index);
+}
+inline const ::chat::PresenceEvent& PresenceUpdate::events(int index) const {
+  // @@protoc_insertion_point(field_get:chat.PresenceUpdate.events)
+  return _internal_events(index);
+}
+inline ::chat::PresenceEvent* PresenceUpdate::_internal_add_events() {
+  return _impl_.events_.Add();
+}
+inline ::chat::PresenceEvent* PresenceUpdate::add_events() {
+  ::chat::PresenceEvent* _add = _internal_add_events();
+  // @@protoc_insertion_point(field_add:chat.PresenceUpdate.events)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::PresenceEvent >&
+PresenceUpdate::events() const {
+  // @@protoc_insertion_point(field_list:chat.PresenceUpdate.events)
+  return _impl_.events_;
+}
+
+// -------------------------------------------------------------------
+
+// FileTransfer
+
+// uint64 transfer_id = 1;
+inline void FileTransfer::clear_transfer_id() {
+  _impl_.transfer_id_ = uint64_t{0u};
+}
+inline uint64_t FileTransfer::_internal_transfer_id() const {
+  return _impl_.transfer_id_;
+}
+inline uint64_t FileTransfer::transfer_id() const {
+  // @@protoc_insertion_point(field_get:chat.FileTransfer.transfer_id)
+  return _internal_transfer_id();
+}
+inline void FileTransfer::_internal_set_transfer_id(uint64_t value) {
+  
+  _impl_.transfer_id_ = value;
+}
+inline void FileTransfer::set_transfer_id(uint64_t value) {
+  _internal_set_transfer_id(value);
+  // @@protoc_insertion_point(field_set:chat.FileTransfer.transfer_id)
+}
+
+// string sender = 2;
+inline void FileTransfer::clear_sender() {
+  _impl_.sender_.ClearToEmpty();
+}
+inline const std::string& FileTransfer::sender() const {
+  // @@protoc_insertion_point(field_get:chat.FileTransfer.sender)
+  return _internal_sender();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void FileTransfer::set_sender(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.sender_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.FileTransfer.sender)
+}
+inline std::string* FileTransfer::mutable_sender() {
+  std::string* _s = _internal_mutable_sender();
+  // @@protoc_insertion_point(field_mutable:chat.FileTransfer.sender)
+  return _s;
+}
+inline const std::string& FileTransfer::_internal_sender() const {
+  return _impl_.sender_.Get();
+}
+inline void FileTransfer::_internal_set_sender(const std::string& value) {
+  
+  _impl_.sender_.Set(value, GetArenaForAllocation());
+}
+inline std::string* FileTransfer::_internal_mutable_sender() {
+  
+  return _impl_.sender_.Mutable(GetArenaForAllocation());
+}
+inline std::string* FileTransfer::release_sender() {
+  // @@protoc_insertion_point(field_release:chat.FileTransfer.sender)
+  return _impl_.sender_.Release();
+}
+inline void FileTransfer::set_allocated_sender(std::string* sender) {
+  if (sender != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.sender_.SetAllocated(sender, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.sender_.IsDefault()) {
+    _impl_.sender_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.FileTransfer.sender)
+}
+
+// uint64 sender_id = 3;
+inline void FileTransfer::clear_sender_id() {
+  _impl_.sender_id_ = uint64_t{0u};
+}
+inline uint64_t FileTransfer::_internal_sender_id() const {
+  return _impl_.sender_id_;
+}
+inline uint64_t FileTransfer::sender_id() const {
+  // @@protoc_insertion_point(field_get:chat.FileTransfer.sender_id)
+  return _internal_sender_id();
+}
+inline void FileTransfer::_internal_set_sender_id(uint64_t value) {
+  
+  _impl_.sender_id_ = value;
+}
+inline void FileTransfer::set_sender_id(uint64_t value) {
+  _internal_set_sender_id(value);
+  // @@protoc_insertion_point(field_set:chat.FileTransfer.sender_id)
+}
+
+// string name = 4;
+inline void FileTransfer::clear_name() {
+  _impl_.name_.ClearToEmpty();
+}
+inline const std::string& FileTransfer::name() const {
+  // @@protoc_insertion_point(field_get:chat.FileTransfer.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void FileTransfer::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.FileTransfer.name)
+}
+inline std::string* FileTransfer::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:chat.FileTransfer.name)
+  return _s;
+}
+inline const std::string& FileTransfer::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void FileTransfer::_internal_set_name(const std::string& value) {
+  
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* FileTransfer::_internal_mutable_name() {
+  
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* FileTransfer::release_name() {
+  // @@protoc_insertion_point(field_release:chat.FileTransfer.name)
+  return _impl_.name_.Release();
+}
+inline void FileTransfer::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.FileTransfer.name)
+}
+
+// uint64 size = 5;
+inline void FileTransfer::clear_size() {
+  _impl_.size_ = uint64_t{0u};
+}
+inline uint64_t FileTransfer::_internal_size() const {
+  return _impl_.size_;
+}
+inline uint64_t FileTransfer::size() const {
+  // @@protoc_insertion_point(field_get:chat.FileTransfer.size)
+  return _internal_size();
+}
+inline void FileTransfer::_internal_set_size(uint64_t value) {
+  
+  _impl_.size_ = value;
+}
+inline void FileTransfer::set_size(uint64_t value) {
+  _internal_set_size(value);
+  // @@protoc_insertion_point(field_set:chat.FileTransfer.size)
+}
+
+// uint64 window = 6;
+inline void FileTransfer::clear_window() {
+  _impl_.window_ = uint64_t{0u};
+}
+inline uint64_t FileTransfer::_internal_window() const {
+  return _impl_.window_;
+}
+inline uint64_t FileTransfer::window() const {
+  // @@protoc_insertion_point(field_get:chat.FileTransfer.window)
+  return _internal_window();
+}
+inline void FileTransfer::_internal_set_window(uint64_t value) {
+  
+  _impl_.window_ = value;
+}
+inline void FileTransfer::set_window(uint64_t value) {
+  _internal_set_window(value);
+  // @@protoc_insertion_point(field_set:chat.FileTransfer.window)
+}
+
+// -------------------------------------------------------------------
+
+// UpdateStatusRequest
+
+// string username = 1;
+inline void UpdateStatusRequest::clear_username() {
+  _impl_.username_.ClearToEmpty();
+}
+inline const std::string& UpdateStatusRequest::username() const {
+  // @@protoc_insertion_point(field_get:chat.UpdateStatusRequest.username)
+  return _internal_username();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void UpdateStatusRequest::set_username(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.username_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.UpdateStatusRequest.username)
+}
+inline std::string* UpdateStatusRequest::mutable_username() {
+  std::string* _s = _internal_mutable_username();
+  // @@protoc_insertion_point(field_mutable:chat.UpdateStatusRequest.username)
+  return _s;
+}
+inline const std::string& UpdateStatusRequest::_internal_username() const {
+  return _impl_.username_.Get();
+}
+inline void UpdateStatusRequest::_internal_set_username(const std::string& value) {
+  
+  _impl_.username_.Set(value, GetArenaForAllocation());
+}
+inline std::string* UpdateStatusRequest::_internal_mutable_username() {
+  
+  return _impl_.username_.Mutable(GetArenaForAllocation());
+}
+inline std::string* UpdateStatusRequest::release_username() {
+  // @@protoc_insertion_point(field_release:chat.UpdateStatusRequest.username)
+  return _impl_.username_.Release();
+}
+inline void UpdateStatusRequest::set_allocated_username(std::string* username) {
+  if (username != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.username_.SetAllocated(username, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.username_.IsDefault()) {
+    _impl_.username_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.UpdateStatusRequest.username)
+}
+
+// .chat.UserStatus new_status = 2;
+inline void UpdateStatusRequest::clear_new_status() {
+  _impl_.new_status_ = 0;
+}
+inline ::chat::UserStatus UpdateStatusRequest::_internal_new_status() const {
+  return static_cast< ::chat::UserStatus >(_impl_.new_status_);
+}
+inline ::chat::UserStatus UpdateStatusRequest::new_status() const {
+  // @@protoc_insertion_point(field_get:chat.UpdateStatusRequest.new_status)
+  return _internal_new_status();
+}
+inline void UpdateStatusRequest::_internal_set_new_status(::chat::UserStatus value) {
+  
+  _impl_.new_status_ = value;
+}
+inline void UpdateStatusRequest::set_new_status(::chat::UserStatus value) {
+  _internal_set_new_status(value);
+  // @@protoc_insertion_point(field_set:chat.UpdateStatusRequest.new_status)
+}
+
+// -------------------------------------------------------------------
+
+// Request
+
+// .chat.Operation operation = 1;
+inline void Request::clear_operation() {
+  _impl_.operation_ = 0;
+}
+inline ::chat::Operation Request::_internal_operation() const {
+  return static_cast< ::chat::Operation >(_impl_.operation_);
+}
+inline ::chat::Operation Request::operation() const {
+  // @@protoc_insertion_point(field_get:chat.Request.operation)
+  return _internal_operation();
+}
+inline void Request::_internal_set_operation(::chat::Operation value) {
+  
+  _impl_.operation_ = value;
+}
+inline void Request::set_operation(::chat::Operation value) {
+  _internal_set_operation(value);
+  // @@protoc_insertion_point(field_set:chat.Request.operation)
+}
+
+// .chat.NewUserRequest register_user = 2;
+inline bool Request::_internal_has_register_user() const {
+  return payload_case() == kRegisterUser;
+}
+inline bool Request::has_register_user() const {
+  return _internal_has_register_user();
+}
+inline void Request::set_has_register_user() {
+  _impl_._oneof_case_[0] = kRegisterUser;
+}
+inline void Request::clear_register_user() {
+  if (_internal_has_register_user()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.payload_.register_user_;
+    }
+    clear_has_payload();
+  }
+}
+inline ::chat::NewUserRequest* Request::release_register_user() {
+  // @@protoc_insertion_point(field_release:chat.Request.register_user)
+  if (_internal_has_register_user()) {
+    clear_has_payload();
+    ::chat::NewUserRequest* temp = _impl_.payload_.register_user_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.payload_.register_user_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::chat::NewUserRequest& Request::_internal_register_user() const {
+  return _internal_has_register_user()
+      ? *_impl_.payload_.register_user_
+      : reinterpret_cast< ::chat::NewUserRequest&>(::chat::_NewUserRequest_default_instance_);
+}
+inline const ::chat::NewUserRequest& Request::register_user() const {
+  // @@protoc_insertion_point(field_get:chat.Request.register_user)
+  return _internal_register_user();
+}
+inline ::chat::NewUserRequest* Request::unsafe_arena_release_register_user() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:chat.Request.register_user)
+  if (_internal_has_register_user()) {
+    clear_has_payload();
+    ::chat::NewUserRequest* temp = _impl_.payload_.register_user_;
+    _impl_.payload_.register_user_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void Request::unsafe_arena_set_allocated_register_user(::chat::NewUserRequest* register_user) {
+  clear_payload();
+  if (register_user) {
+    set_has_register_user();
+    _impl_.payload_.register_user_ = register_user;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.Request.register_user)
+}
+inline ::chat::NewUserRequest* Request::_internal_mutable_register_user() {
+  if (!_internal_has_register_user()) {
+    clear_payload();
+    set_has_register_user();
+    _impl_.payload_.register_user_ = CreateMaybeMessage< ::chat::NewUserRequest >(GetArenaForAllocation());
+  }
+  return _impl_.payload_.register_user_;
+}
+inline ::chat::NewUserRequest* Request::mutable_register_user() {
+  ::chat::NewUserRequest* _msg = _internal_mutable_register_user();
+  // @@protoc_insertion_point(field_mutable:chat.Request.register_user)
+  return _msg;
+}
+
+// .chat.SendMessageRequest send_message = 3;
+inline bool Request::_internal_has_send_message() const {
+  return payload_case() == kSendMessage;
+}
+inline bool Request::has_send_message() const {
+  return _internal_has_send_message();
+}
+inline void Request::set_has_send_message() {
+  _impl_._oneof_case_[0] = kSendMessage;
+}
+inline void Request::clear_send_message() {
+  if (_internal_has_send_message()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.payload_.send_message_;
+    }
+    clear_has_payload();
+  }
+}
+inline ::chat::SendMessageRequest* Request::release_send_message() {
+  // @@protoc_insertion_point(field_release:chat.Request.send_message)
+  if (_internal_has_send_message()) {
+    clear_has_payload();
+    ::chat::SendMessageRequest* temp = _impl_.payload_.send_message_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.payload_.send_message_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::chat::SendMessageRequest& Request::_internal_send_message() const {
+  return _internal_has_send_message()
+      ? *_impl_.payload_.send_message_
+      : reinterpret_cast< ::chat::SendMessageRequest&>(::chat::_SendMessageRequest_default_instance_);
+}
+inline const ::chat::SendMessageRequest& Request::send_message() const {
+  // @@protoc_insertion_point(field_get:chat.Request.send_message)
+  return _internal_send_message();
+}
+inline ::chat::SendMessageRequest* Request::unsafe_arena_release_send_message() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:chat.Request.send_message)
+  if (_internal_has_send_message()) {
+    clear_has_payload();
+    ::chat::SendMessageRequest* temp = _impl_.payload_.send_message_;
+    _impl_.payload_.send_message_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void Request::unsafe_arena_set_allocated_send_message(::chat::SendMessageRequest* send_message) {
+  clear_payload();
+  if (send_message) {
+    set_has_send_message();
+    _impl_.payload_.send_message_ = send_message;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.Request.send_message)
+}
+inline ::chat::SendMessageRequest* Request::_internal_mutable_send_message() {
+  if (!_internal_has_send_message()) {
+    clear_payload();
+    set_has_send_message();
+    _impl_.payload_.send_message_ = CreateMaybeMessage< ::chat::SendMessageRequest >(GetArenaForAllocation());
+  }
+  return _impl_.payload_.send_message_;
+}
+inline ::chat::SendMessageRequest* Request::mutable_send_message() {
+  ::chat::SendMessageRequest* _msg = _internal_mutable_send_message();
+  // @@protoc_insertion_point(field_mutable:chat.Request.send_message)
+  return _msg;
+}
+
+// .chat.UpdateStatusRequest update_status = 4;
+inline bool Request::_internal_has_update_status() const {
+  return payload_case() == kUpdateStatus;
+}
+inline bool Request::has_update_status() const {
+  return _internal_has_update_status();
+}
+inline void Request::set_has_update_status() {
+  _impl_._oneof_case_[0] = kUpdateStatus;
+}
+inline void Request::clear_update_status() {
+  if (_internal_has_update_status()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.payload_.update_status_;
+    }
+    clear_has_payload();
+  }
+}
+inline ::chat::UpdateStatusRequest* Request::release_update_status() {
+  // @@protoc_insertion_point(field_release:chat.Request.update_status)
+  if (_internal_has_update_status()) {
+    clear_has_payload();
+    ::chat::UpdateStatusRequest* temp = _impl_.payload_.update_status_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.payload_.update_status_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::chat::UpdateStatusRequest& Request::_internal_update_status() const {
+  return _internal_has_update_status()
+      ? *_impl_.payload_.update_status_
+      : reinterpret_cast< ::chat::UpdateStatusRequest&>(::chat::_UpdateStatusRequest_default_instance_);
+}
+inline const ::chat::UpdateStatusRequest& Request::update_status() const {
+  // @@protoc_insertion_point(field_get:chat.Request.update_status)
+  return _internal_update_status();
+}
+inline ::chat::UpdateStatusRequest* Request::unsafe_arena_release_update_status() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:chat.Request.update_status)
+  if (_internal_has_update_status()) {
+    clear_has_payload();
+    ::chat::UpdateStatusRequest* temp = _impl_.payload_.update_status_;
+    _impl_.payload_.update_status_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void Request::unsafe_arena_set_allocated_update_status(::chat::UpdateStatusRequest* update_status) {
+  clear_payload();
+  if (update_status) {
+    set_has_update_status();
+    _impl_.payload_.update_status_ = update_status;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.Request.update_status)
+}
+inline ::chat::UpdateStatusRequest* Request::_internal_mutable_update_status() {
+  if (!_internal_has_update_status()) {
+    clear_payload();
+    set_has_update_status();
+    _impl_.payload_.update_status_ = CreateMaybeMessage< ::chat::UpdateStatusRequest >(GetArenaForAllocation());
+  }
+  return _impl_.payload_.update_status_;
+}
+inline ::chat::UpdateStatusRequest* Request::mutable_update_status() {
+  ::chat::UpdateStatusRequest* _msg = _internal_mutable_update_status();
+  // @@protoc_insertion_point(field_mutable:chat.Request.update_status)
+  return _msg;
+}
+
+// .chat.UserListRequest get_users = 5;
+inline bool Request::_internal_has_get_users() const {
+  return payload_case() == kGetUsers;
+}
+inline bool Request::has_get_users() const {
+  return _internal_has_get_users();
+}
+inline void Request::set_has_get_users() {
+  _impl_._oneof_case_[0] = kGetUsers;
+}
+inline void Request::clear_get_users() {
+  if (_internal_has_get_users()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.payload_.get_users_;
+    }
+    clear_has_payload();
+  }
+}
+inline ::chat::UserListRequest* Request::release_get_users() {
+  // @@protoc_insertion_point(field_release:chat.Request.get_users)
+  if (_internal_has_get_users()) {
+    clear_has_payload();
+    ::chat::UserListRequest* temp = _impl_.payload_.get_users_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.payload_.get_users_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::chat::UserListRequest& Request::_internal_get_users() const {
+  return _internal_has_get_users()
+      ? *_impl_.payload_.get_users_
+      : reinterpret_cast< ::chat::UserListRequest&>(::chat::_UserListRequest_default_instance_);
+}
+inline const ::chat::UserListRequest& Request::get_users() const {
+  // @@protoc_insertion_point(field_get:chat.Request.get_users)
+  return _internal_get_users();
+}
+inline ::chat::UserListRequest* Request::unsafe_arena_release_get_users() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:chat.Request.get_users)
+  if (_internal_has_get_users()) {
+    clear_has_payload();
+    ::chat::UserListRequest* temp = _impl_.payload_.get_users_;
+    _impl_.payload_.get_users_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void Request::unsafe_arena_set_allocated_get_users(::chat::UserListRequest* get_users) {
+  clear_payload();
+  if (get_users) {
+    set_has_get_users();
+    _impl_.payload_.get_users_ = get_users;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.Request.get_users)
+}
+inline ::chat::UserListRequest* Request::_internal_mutable_get_users() {
+  if (!_internal_has_get_users()) {
+    clear_payload();
+    set_has_get_users();
+    _impl_.payload_.get_users_ = CreateMaybeMessage< ::chat::UserListRequest >(GetArenaForAllocation());
+  }
+  return _impl_.payload_.get_users_;
+}
+inline ::chat::UserListRequest* Request::mutable_get_users() {
+  ::chat::UserListRequest* _msg = _internal_mutable_get_users();
+  // @@protoc_insertion_point(field_mutable:chat.Request.get_users)
+  return _msg;
+}
+
+// .chat.User unregister_user = 6;
+inline bool Request::_internal_has_unregister_user() const {
+  return payload_case() == kUnregisterUser;
+}
+inline bool Request::has_unregister_user() const {
+  return _internal_has_unregister_user();
+}
+inline void Request::set_has_unregister_user() {
+  _impl_._oneof_case_[0] = kUnregisterUser;
+}
+inline void Request::clear_unregister_user() {
+  if (_internal_has_unregister_user()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.payload_.unregister_user_;
+    }
+    clear_has_payload();
+  }
+}
+inline ::chat::User* Request::release_unregister_user() {
+  // @@protoc_insertion_point(field_release:chat.Request.unregister_user)
+  if (_internal_has_unregister_user()) {
+    clear_has_payload();
+    ::chat::User* temp = _impl_.payload_.unregister_user_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.payload_.unregister_user_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::chat::User& Request::_internal_unregister_user() const {
+  return _internal_has_unregister_user()
+      ? *_impl_.payload_.unregister_user_
+      : reinterpret_cast< ::chat::User&>(::chat::_User_default_instance_);
+}
+inline const ::chat::User& Request::unregister_user() const {
+  // @@protoc_insertion_point(field_get:chat.Request.unregister_user)
+  return _internal_unregister_user();
+}
+inline ::chat::User* Request::unsafe_arena_release_unregister_user() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:chat.Request.unregister_user)
+  if (_internal_has_unregister_user()) {
+    clear_has_payload();
+    ::chat::User* temp = _impl_.payload_.unregister_user_;
+    _impl_.payload_.unregister_user_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void Request::unsafe_arena_set_allocated_unregister_user(::chat::User* unregister_user) {
+  clear_payload();
+  if (unregister_user) {
+    set_has_unregister_user();
+    _impl_.payload_.unregister_user_ = unregister_user;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.Request.unregister_user)
+}
+inline ::chat::User* Request::_internal_mutable_unregister_user() {
+  if (!_internal_has_unregister_user()) {
+    clear_payload();
+    set_has_unregister_user();
+    _impl_.payload_.unregister_user_ = CreateMaybeMessage< ::chat::User >(GetArenaForAllocation());
+  }
+  return _impl_.payload_.unregister_user_;
+}
+inline ::chat::User* Request::mutable_unregister_user() {
+  ::chat::User* _msg = _internal_mutable_unregister_user();
+  // @@protoc_insertion_point(field_mutable:chat.Request.unregister_user)
+  return _msg;
+}
+
+// .chat.SendMessageBatchRequest send_message_batch = 7;
+inline bool Request::_internal_has_send_message_batch() const {
+  return payload_case() == kSendMessageBatch;
+}
+inline bool Request::has_send_message_batch() const {
+  return _internal_has_send_message_batch();
+}
+inline void Request::set_has_send_message_batch() {
+  _impl_._oneof_case_[0] = kSendMessageBatch;
+}
+inline void Request::clear_send_message_batch() {
+  if (_internal_has_send_message_batch()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.payload_.send_message_batch_;
+    }
+    clear_has_payload();
+  }
+}
+inline ::chat::SendMessageBatchRequest* Request::release_send_message_batch() {
+  // @@protoc_insertion_point(field_release:chat.Request.send_message_batch)
+  if (_internal_has_send_message_batch()) {
+    clear_has_payload();
+    ::chat::SendMessageBatchRequest* temp = _impl_.payload_.send_message_batch_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.payload_.send_message_batch_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::chat::SendMessageBatchRequest& Request::_internal_send_message_batch() const {
+  return _internal_has_send_message_batch()
+      ? *_impl_.payload_.send_message_batch_
+      : reinterpret_cast< ::chat::SendMessageBatchRequest&>(::chat::_SendMessageBatchRequest_default_instance_);
+}
+inline const ::chat::SendMessageBatchRequest& Request::send_message_batch() const {
+  // @@protoc_insertion_point(field_get:chat.Request.send_message_batch)
+  return _internal_send_message_batch();
+}
+inline ::chat::SendMessageBatchRequest* Request::unsafe_arena_release_send_message_batch() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:chat.Request.send_message_batch)
+  if (_internal_has_send_message_batch()) {
+    clear_has_payload();
+    ::chat::SendMessageBatchRequest* temp = _impl_.payload_.send_message_batch_;
+    _impl_.payload_.send_message_batch_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void Request::unsafe_arena_set_allocated_send_message_batch(::chat::SendMessageBatchRequest* send_message_batch) {
+  clear_payload();
+  if (send_message_batch) {
+    set_has_send_message_batch();
+    _impl_.payload_.send_message_batch_ = send_message_batch;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.Request.send_message_batch)
+}
+inline ::chat::SendMessageBatchRequest* Request::_internal_mutable_send_message_batch() {
+  if (!_internal_has_send_message_batch()) {
+    clear_payload();
+    set_has_send_message_batch();
+    _impl_.payload_.send_message_batch_ = CreateMaybeMessage< ::chat::SendMessageBatchRequest >(GetArenaForAllocation());
+  }
+  return _impl_.payload_.send_message_batch_;
+}
+inline ::chat::SendMessageBatchRequest* Request::mutable_send_message_batch() {
+  ::chat::SendMessageBatchRequest* _msg = _internal_mutable_send_message_batch();
+  // @@protoc_insertion_point(field_mutable:chat.Request.send_message_batch)
+  return _msg;
+}
+
+// .chat.RoomRequest join_room = 8;
+inline bool Request::_internal_has_join_room() const {
+  return payload_case() == kJoinRoom;
+}
+inline bool Request::has_join_room() const {
+  return _internal_has_join_room();
+}
+inline void Request::set_has_join_room() {
+  _impl_._oneof_case_[0] = kJoinRoom;
+}
+inline void Request::clear_join_room() {
+  if (_internal_has_join_room()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.payload_.join_room_;
+    }
+    clear_has_payload();
+  }
+}
+inline ::chat::RoomRequest* Request::release_join_room() {
+  // @@protoc_insertion_point(field_release:chat.Request.join_room)
+  if (_internal_has_join_room()) {
+    clear_has_payload();
+    ::chat::RoomRequest* temp = _impl_.payload_.join_room_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.payload_.join_room_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::chat::RoomRequest& Request::_internal_join_room() const {
+  return _internal_has_join_room()
+      ? *_impl_.payload_.join_room_
+      : reinterpret_cast< ::chat::RoomRequest&>(::chat::_RoomRequest_default_instance_);
+}
+inline const ::chat::RoomRequest& Request::join_room() const {
+  // @@protoc_insertion_point(field_get:chat.Request.join_room)
+  return _internal_join_room();
+}
+inline ::chat::RoomRequest* Request::unsafe_arena_release_join_room() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:chat.Request.join_room)
+  if (_internal_has_join_room()) {
+    clear_has_payload();
+    ::chat::RoomRequest* temp = _impl_.payload_.join_room_;
+    _impl_.payload_.join_room_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void Request::unsafe_arena_set_allocated_join_room(::chat::RoomRequest* join_room) {
+  clear_payload();
+  if (join_room) {
+    set_has_join_room();
+    _impl_.payload_.join_room_ = join_room;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.Request.join_room)
+}
+inline ::chat::RoomRequest* Request::_internal_mutable_join_room() {
+  if (!_internal_has_join_room()) {
+    clear_payload();
+    set_has_join_room();
+    _impl_.payload_.join_room_ = CreateMaybeMessage< ::chat::RoomRequest >(GetArenaForAllocation());
+  }
+  return _impl_.payload_.join_room_;
+}
+inline ::chat::RoomRequest* Request::mutable_join_room() {
+  ::chat::RoomRequest* _msg = _internal_mutable_join_room();
+  // @@protoc_insertion_point(field_mutable:chat.Request.join_room)
+  return _msg;
+}
+
+// .chat.RoomRequest leave_room = 9;
+inline bool Request::_internal_has_leave_room() const {
+  return payload_case() == kLeaveRoom;
+}
+inline bool Request::has_leave_room() const {
+  return _internal_has_leave_room();
+}
+inline void Request::set_has_leave_room() {
+  _impl_._oneof_case_[0] = kLeaveRoom;
+}
+inline void Request::clear_leave_room() {
+  if (_internal_has_leave_room()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.payload_.leave_room_;
+    }
+    clear_has_payload();
+  }
+}
+inline ::chat::RoomRequest* Request::release_leave_room() {
+  // @@protoc_insertion_point(field_release:chat.Request.leave_room)
+  if (_internal_has_leave_room()) {
+    clear_has_payload();
+    ::chat::RoomRequest* temp = _impl_.payload_.leave_room_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.payload_.leave_room_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::chat::RoomRequest& Request::_internal_leave_room() const {
+  return _internal_has_leave_room()
+      ? *_impl_.payload_.leave_room_
+      : reinterpret_cast< ::chat::RoomRequest&>(::chat::_RoomRequest_default_instance_);
+}
+inline const ::chat::RoomRequest& Request::leave_room() const {
+  // @@protoc_insertion_point(field_get:chat.Request.leave_room)
+  return _internal_leave_room();
+}
+inline ::chat::RoomRequest* Request::unsafe_arena_release_leave_room() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:chat.Request.leave_room)
+  if (_internal_has_leave_room()) {
+    clear_has_payload();
+    ::chat::RoomRequest* temp = _impl_.payload_.leave_room_;
+    _impl_.payload_.leave_room_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void Request::unsafe_arena_set_allocated_leave_room(::chat::RoomRequest* leave_room) {
+  clear_payload();
+  if (leave_room) {
+    set_has_leave_room();
+    _impl_.payload_.leave_room_ = leave_room;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.Request.leave_room)
+}
+inline ::chat::RoomRequest* Request::_internal_mutable_leave_room() {
+  if (!_internal_has_leave_room()) {
+    clear_payload();
+    set_has_leave_room();
+    _impl_.payload_.leave_room_ = CreateMaybeMessage< ::chat::RoomRequest >(GetArenaForAllocation());
+  }
+  return _impl_.payload_.leave_room_;
+}
+inline ::chat::RoomRequest* Request::mutable_leave_room() {
+  ::chat::RoomRequest* _msg = _internal_mutable_leave_room();
+  // @@protoc_insertion_point(field_mutable:chat.Request.leave_room)
+  return _msg;
+}
+
+// .chat.ResumeRequest resume = 11;
+inline bool Request::_internal_has_resume() const {
+  return payload_case() == kResume;
+}
+inline bool Request::has_resume() const {
+  return _internal_has_resume();
+}
+inline void Request::set_has_resume() {
+  _impl_._oneof_case_[0] = kResume;
+}
+inline void Request::clear_resume() {
+  if (_internal_has_resume()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.payload_.resume_;
+    }
+    clear_has_payload();
+  }
+}
+inline ::chat::ResumeRequest* Request::release_resume() {
+  // @@protoc_insertion_point(field_release:chat.Request.resume)
+  if (_internal_has_resume()) {
+    clear_has_payload();
+    ::chat::ResumeRequest* temp = _impl_.payload_.resume_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.payload_.resume_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::chat::ResumeRequest& Request::_internal_resume() const {
+  return _internal_has_resume()
+      ? *_impl_.payload_.resume_
+      : reinterpret_cast< ::chat::ResumeRequest&>(::chat::_ResumeRequest_default_instance_);
+}
+inline const ::chat::ResumeRequest& Request::resume() const {
+  // @@protoc_insertion_point(field_get:chat.Request.resume)
+  return _internal_resume();
+}
+inline ::chat::ResumeRequest* Request::unsafe_arena_release_resume() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:chat.Request.resume)
+  if (_internal_has_resume()) {
+    clear_has_payload();
+    ::chat::ResumeRequest* temp = _impl_.payload_.resume_;
+    _impl_.payload_.resume_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void Request::unsafe_arena_set_allocated_resume(::chat::ResumeRequest* resume) {
+  clear_payload();
+  if (resume) {
+    set_has_resume();
+    _impl_.payload_.resume_ = resume;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.Request.resume)
+}
+inline ::chat::ResumeRequest* Request::_internal_mutable_resume() {
+  if (!_internal_has_resume()) {
+    clear_payload();
+    set_has_resume();
+    _impl_.payload_.resume_ = CreateMaybeMessage< ::chat::ResumeRequest >(GetArenaForAllocation());
+  }
+  return _impl_.payload_.resume_;
+}
+inline ::chat::ResumeRequest* Request::mutable_resume() {
+  ::chat::ResumeRequest* _msg = _internal_mutable_resume();
+  // @@protoc_insertion_point(field_mutable:chat.Request.resume)
+  return _msg;
+}
+
+// .chat.FileOffer file_offer = 12;
+inline bool Request::_internal_has_file_offer() const {
+  return payload_case() == kFileOffer;
+}
+inline bool Request::has_file_offer() const {
+  return _internal_has_file_offer();
+}
+inline void Request::set_has_file_offer() {
+  _impl_._oneof_case_[0] = kFileOffer;
+}
+inline void Request::clear_file_offer() {
+  if (_internal_has_file_offer()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.payload_.file_offer_;
+    }
+    clear_has_payload();
+  }
+}
+inline ::chat::FileOffer* Request::release_file_offer() {
+  // @@protoc_insertion_point(field_release:chat.Request.file_offer)
+  if (_internal_has_file_offer()) {
+    clear_has_payload();
+    ::chat::FileOffer* temp = _impl_.payload_.file_offer_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.payload_.file_offer_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::chat::FileOffer& Request::_internal_file_offer() const {
+  return _internal_has_file_offer()
+      ? *_impl_.payload_.file_offer_
+      : reinterpret_cast< ::chat::FileOffer&>(::chat::_FileOffer_default_instance_);
+}
+inline const ::chat::FileOffer& Request::file_offer() const {
+  // @@protoc_insertion_point(field_get:chat.Request.file_offer)
+  return _internal_file_offer();
+}
+inline ::chat::FileOffer* Request::unsafe_arena_release_file_offer() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:chat.Request.file_offer)
+  if (_internal_has_file_offer()) {
+    clear_has_payload();
+    ::chat::FileOffer* temp = _impl_.payload_.file_offer_;
+    _impl_.payload_.file_offer_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void Request::unsafe_arena_set_allocated_file_offer(::chat::FileOffer* file_offer) {
+  clear_payload();
+  if (file_offer) {
+    set_has_file_offer();
+    _impl_.payload_.file_offer_ = file_offer;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.Request.file_offer)
+}
+inline ::chat::FileOffer* Request::_internal_mutable_file_offer() {
+  if (!_internal_has_file_offer()) {
+    clear_payload();
+    set_has_file_offer();
+    _impl_.payload_.file_offer_ = CreateMaybeMessage< ::chat::FileOffer >(GetArenaForAllocation());
+  }
+  return _impl_.payload_.file_offer_;
+}
+inline ::chat::FileOffer* Request::mutable_file_offer() {
+  ::chat::FileOffer* _msg = _internal_mutable_file_offer();
+  // @@protoc_insertion_point(field_mutable:chat.Request.file_offer)
+  return _msg;
+}
+
+// .chat.FileWindow file_window = 13;
+inline bool Request::_internal_has_file_window() const {
+  return payload_case() == kFileWindow;
+}
+inline bool Request::has_file_window() const {
+  return _internal_has_file_window();
+}
+inline void Request::set_has_file_window() {
+  _impl_._oneof_case_[0] = kFileWindow;
+}
+inline void Request::clear_file_window() {
+  if (_internal_has_file_window()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.payload_.file_window_;
+    }
+    clear_has_payload();
+  }
+}
+inline ::chat::FileWindow* Request::release_file_window() {
+  // @@protoc_insertion_point(field_release:chat.Request.file_window)
+  if (_internal_has_file_window()) {
+    clear_has_payload();
+    ::chat::FileWindow* temp = _impl_.payload_.file_window_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.payload_.file_window_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::chat::FileWindow& Request::_internal_file_window() const {
+  return _internal_has_file_window()
+      ? *_impl_.payload_.file_window_
+      : reinterpret_cast< ::chat::FileWindow&>(::chat::_FileWindow_default_instance_);
+}
+inline const ::chat::FileWindow& Request::file_window() const {
+  // @@protoc_insertion_point(field_get:chat.Request.file_window)
+  return _internal_file_window();
+}
+inline ::chat::FileWindow* Request::unsafe_arena_release_file_window() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:chat.Request.file_window)
+  if (_internal_has_file_window()) {
+    clear_has_payload();
+    ::chat::FileWindow* temp = _impl_.payload_.file_window_;
+    _impl_.payload_.file_window_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void Request::unsafe_arena_set_allocated_file_window(::chat::FileWindow* file_window) {
+  clear_payload();
+  if (file_window) {
+    set_has_file_window();
+    _impl_.payload_.file_window_ = file_window;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.Request.file_window)
+}
+inline ::chat::FileWindow* Request::_internal_mutable_file_window() {
+  if (!_internal_has_file_window()) {
+    clear_payload();
+    set_has_file_window();
+    _impl_.payload_.file_window_ = CreateMaybeMessage< ::chat::FileWindow >(GetArenaForAllocation());
+  }
+  return _impl_.payload_.file_window_;
+}
+inline ::chat::FileWindow* Request::mutable_file_window() {
+  ::chat::FileWindow* _msg = _internal_mutable_file_window();
+  // @@protoc_insertion_point(field_mutable:chat.Request.file_window)
+  return _msg;
+}
+
+// uint64 request_id = 10;
+inline void Request::clear_request_id() {
+  _impl_.request_id_ = uint64_t{0u};
+}
+inline uint64_t Request::_internal_request_id() const {
+  return _impl_.request_id_;
+}
+inline uint64_t Request::request_id() const {
+  // @@protoc_insertion_point(field_get:chat.Request.request_id)
+  return _internal_request_id();
+}
+inline void Request::_internal_set_request_id(uint64_t value) {
+  
+  _impl_.request_id_ = value;
+}
+inline void Request::set_request_id(uint64_t value) {
+  _internal_set_request_id(value);
+  // @@protoc_insertion_point(field_set:chat.Request.request_id)
+}
+
+inline bool Request::has_payload() const {
+  return payload_case() != PAYLOAD_NOT_SET;
+}
+inline void Request::clear_has_payload() {
+  _impl_._oneof_case_[0] = PAYLOAD_NOT_SET;
+}
+inline Request::PayloadCase Request::payload_case() const {
+  return Request::PayloadCase(_impl_._oneof_case_[0]);
+}
+// -------------------------------------------------------------------
+
+// Distribution
+
+// uint64 count = 1;
+inline void Distribution::clear_count() {
+  _impl_.count_ = uint64_t{0u};
+}
+inline uint64_t Distribution::_internal_count() const {
+  return _impl_.count_;
+}
+inline uint64_t Distribution::count() const {
+  // @@protoc_insertion_point(field_get:chat.Distribution.count)
+  return _internal_count();
+}
+inline void Distribution::_internal_set_count(uint64_t value) {
+  
+  _impl_.count_ = value;
+}
+inline void Distribution::set_count(uint64_t value) {
+  _internal_set_count(value);
+  // @@protoc_insertion_point(field_set:chat.Distribution.count)
+}
+
+// double mean = 2;
+inline void Distribution::clear_mean() {
+  _impl_.mean_ = 0;
+}
+inline double Distribution::_internal_mean() const {
+  return _impl_.mean_;
+}
+inline double Distribution::mean() const {
+  // @@protoc_insertion_point(field_get:chat.Distribution.mean)
+  return _internal_mean();
+}
+inline void Distribution::_internal_set_mean(double value) {
+  
+  _impl_.mean_ = value;
+}
+inline void Distribution::set_mean(double value) {
+  _internal_set_mean(value);
+  // @@protoc_insertion_point(field_set:chat.Distribution.mean)
+}
+
+// uint64 p50 = 3;
+inline void Distribution::clear_p50() {
+  _impl_.p50_ = uint64_t{0u};
+}
+inline uint64_t Distribution::_internal_p50() const {
+  return _impl_.p50_;
+}
+inline uint64_t Distribution::p50() const {
+  // @@protoc_insertion_point(field_get:chat.Distribution.p50)
+  return _internal_p50();
+}
+inline void Distribution::_internal_set_p50(uint64_t value) {
+  
+  _impl_.p50_ = value;
+}
+inline void Distribution::set_p50(uint64_t value) {
+  _internal_set_p50(value);
+  // @@protoc_insertion_point(field_set:chat.Distribution.p50)
+}
+
+// uint64 p90 = 4;
+inline void Distribution::clear_p90() {
+  _impl_.p90_ = uint64_t{0u};
+}
+inline uint64_t Distribution::_internal_p90() const {
+  return _impl_.p90_;
+}
+inline uint64_t Distribution::p90() const {
+  // @@protoc_insertion_point(field_get:chat.Distribution.p90)
+  return _internal_p90();
+}
+inline void Distribution::_internal_set_p90(uint64_t value) {
+  
+  _impl_.p90_ = value;
+}
+inline void Distribution::set_p90(uint64_t value) {
+  _internal_set_p90(value);
+  // @@protoc_insertion_point(field_set:chat.Distribution.p90)
+}
+
+// uint64 p99 = 5;
+inline void Distribution::clear_p99() {
+  _impl_.p99_ = uint64_t{0u};
+}
+inline uint64_t Distribution::_internal_p99() const {
+  return _impl_.p99_;
+}
+inline uint64_t Distribution::p99() const {
+  // @@protoc_insertion_point(field_get:chat.Distribution.p99)
+  return _internal_p99();
+}
+inline void Distribution::_internal_set_p99(uint64_t value) {
+  
+  _impl_.p99_ = value;
+}
+inline void Distribution::set_p99(uint64_t value) {
+  _internal_set_p99(value);
+  // @@protoc_insertion_point(field_set:chat.Distribution.p99)
+}
+
+// uint64 p999 = 6;
+inline void Distribution::clear_p999() {
+  _impl_.p999_ = uint64_t{0u};
+}
+inline uint64_t Distribution::_internal_p999() const {
+  return _impl_.p999_;
+}
+inline uint64_t Distribution::p999() const {
+  // @@protoc_insertion_point(field_get:chat.Distribution.p999)
+  return _internal_p999();
+}
+inline void Distribution::_internal_set_p999(uint64_t value) {
+  
+  _impl_.p999_ = value;
+}
+inline void Distribution::set_p999(uint64_t value) {
+  _internal_set_p999(value);
+  // @@protoc_insertion_point(field_set:chat.Distribution.p999)
+}
+
+// uint64 max = 7;
+inline void Distribution::clear_max() {
+  _impl_.max_ = uint64_t{0u};
+}
+inline uint64_t Distribution::_internal_max() const {
+  return _impl_.max_;
+}
+inline uint64_t Distribution::max() const {
+  // @@protoc_insertion_point(field_get:chat.Distribution.max)
+  return _internal_max();
+}
+inline void Distribution::_internal_set_max(uint64_t value) {
+  
+  _impl_.max_ = value;
+}
+inline void Distribution::set_max(uint64_t value) {
+  _internal_set_max(value);
+  // @@protoc_insertion_point(field_set:chat.Distribution.max)
+}
+
+// -------------------------------------------------------------------
+
+// OperationStats
+
+// .chat.Operation operation = 1;
+inline void OperationStats::clear_operation() {
+  _impl_.operation_ = 0;
+}
+inline ::chat::Operation OperationStats::_internal_operation() const {
+  return static_cast< ::chat::Operation >(_impl_.operation_);
+}
+inline ::chat::Operation OperationStats::operation() const {
+  // @@protoc_insertion_point(field_get:chat.OperationStats.operation)
+  return _internal_operation();
+}
+inline void OperationStats::_internal_set_operation(::chat::Operation value) {
+  
+  _impl_.operation_ = value;
+}
+inline void OperationStats::set_operation(::chat::Operation value) {
+  _internal_set_operation(value);
+  // @@protoc_insertion_point(field_set:chat.OperationStats.operation)
+}
+
+// uint64 requests = 2;
+inline void OperationStats::clear_requests() {
+  _impl_.requests_ = uint64_t{0u};
+}
+inline uint64_t OperationStats::_internal_requests() const {
+  return _impl_.requests_;
+}
+inline uint64_t OperationStats::requests() const {
+  // @@protoc_insertion_point(field_get:chat.OperationStats.requests)
+  return _internal_requests();
+}
+inline void OperationStats::_internal_set_requests(uint64_t value) {
+  
+  _impl_.requests_ = value;
+}
+inline void OperationStats::set_requests(uint64_t value) {
+  _internal_set_requests(value);
+  // @@protoc_insertion_point(field_set:chat.OperationStats.requests)
+}
+
+// .chat.Distribution latency = 3;
+inline bool OperationStats::_internal_has_latency() const {
+  return this != internal_default_instance() && _impl_.latency_ != nullptr;
+}
+inline bool OperationStats::has_latency() const {
+  return _internal_has_latency();
+}
+inline void OperationStats::clear_latency() {
+  if (GetArenaForAllocation() == nullptr && _impl_.latency_ != nullptr) {
+    delete _impl_.latency_;
+  }
+  _impl_.latency_ = nullptr;
+}
+inline const ::chat::Distribution& OperationStats::_internal_latency() const {
+  const ::chat::Distribution* p = _impl_.latency_;
+  return p != nullptr ? *p : reinterpret_cast<const ::chat::Distribution&>(
+      ::chat::_Distribution_default_instance_);
+}
+inline const ::chat::Distribution& OperationStats::latency() const {
+  // @@protoc_insertion_point(field_get:chat.OperationStats.latency)
+  return _internal_latency();
+}
+inline void OperationStats::unsafe_arena_set_allocated_latency(
+    ::chat::Distribution* latency) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.latency_);
+  }
+  _impl_.latency_ = latency;
+  if (latency) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.OperationStats.latency)
+}
+inline ::chat::Distribution* OperationStats::release_latency() {
+  
+  ::chat::Distribution* temp = _impl_.latency_;
+  _impl_.latency_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::chat::Distribution* OperationStats::unsafe_arena_release_latency() {
+  // @@protoc_insertion_point(field_release:chat.OperationStats.latency)
+  
+  ::chat::Distribution* temp = _impl_.latency_;
+  _impl_.latency_ = nullptr;
+  return temp;
+}
+inline ::chat::Distribution* OperationStats::_internal_mutable_latency() {
+  
+  if (_impl_.latency_ == nullptr) {
+    auto* p = CreateMaybeMessage<::chat::Distribution>(GetArenaForAllocation());
+    _impl_.latency_ = p;
+  }
+  return _impl_.latency_;
+}
+inline ::chat::Distribution* OperationStats::mutable_latency() {
+  ::chat::Distribution* _msg = _internal_mutable_latency();
+  // @@protoc_insertion_point(field_mutable:chat.OperationStats.latency)
+  return _msg;
+}
+inline void OperationStats::set_allocated_latency(::chat::Distribution* latency) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.latency_;
+  }
+  if (latency) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(latency);
+    if (message_arena != submessage_arena) {
+      latency = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, latency, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.latency_ = latency;
+  // @@protoc_insertion_point(field_set_allocated:chat.OperationStats.latency)
+}
+
+// -------------------------------------------------------------------
+
+// StatusCodeCount
+
+// .chat.StatusCode status_code = 1;
+inline void StatusCodeCount::clear_status_code() {
+  _impl_.status_code_ = 0;
+}
+inline ::chat::StatusCode StatusCodeCount::_internal_status_code() const {
+  return static_cast< ::chat::StatusCode >(_impl_.status_code_);
+}
+inline ::chat::StatusCode StatusCodeCount::status_code() const {
+  // @@protoc_insertion_point(field_get:chat.StatusCodeCount.status_code)
+  return _internal_status_code();
+}
+inline void StatusCodeCount::_internal_set_status_code(::chat::StatusCode value) {
+  
+  _impl_.status_code_ = value;
+}
+inline void StatusCodeCount::set_status_code(::chat::StatusCode value) {
+  _internal_set_status_code(value);
+  // @@protoc_insertion_point(field_set:chat.StatusCodeCount.status_code)
+}
+
+// uint64 count = 2;
+inline void StatusCodeCount::clear_count() {
+  _impl_.count_ = uint64_t{0u};
+}
+inline uint64_t StatusCodeCount::_internal_count() const {
+  return _impl_.count_;
+}
+inline uint64_t StatusCodeCount::count() const {
+  // @@protoc_insertion_point(field_get:chat.StatusCodeCount.count)
+  return _internal_count();
+}
+inline void StatusCodeCount::_internal_set_count(uint64_t value) {
+  
+  _impl_.count_ = value;
+}
+inline void StatusCodeCount::set_count(uint64_t value) {
+  _internal_set_count(value);
+  // @@protoc_insertion_point(field_set:chat.StatusCodeCount.count)
+}
+
+// -------------------------------------------------------------------
+
+// ServerStats
+
+// uint64 uptime_ms = 1;
+inline void ServerStats::clear_uptime_ms() {
+  _impl_.uptime_ms_ = uint64_t{0u};
+}
+inline uint64_t ServerStats::_internal_uptime_ms() const {
+  return _impl_.uptime_ms_;
+}
+inline uint64_t ServerStats::uptime_ms() const {
+  // @@protoc_insertion_point(field_get:chat.ServerStats.uptime_ms)
+  return _internal_uptime_ms();
+}
+inline void ServerStats::_internal_set_uptime_ms(uint64_t value) {
+  
+  _impl_.uptime_ms_ = value;
+}
+inline void ServerStats::set_uptime_ms(uint64_t value) {
+  _internal_set_uptime_ms(value);
+  // @@protoc_insertion_point(field_set:chat.ServerStats.uptime_ms)
+}
+
+// repeated .chat.OperationStats operations = 2;
+inline int ServerStats::_internal_operations_size() const {
+  return _impl_.operations_.size();
+}
+inline int ServerStats::operations_size() const {
+  return _internal_operations_size();
+}
+inline void ServerStats::clear_operations() {
+  _impl_.operations_.Clear();
+}
+inline ::chat::OperationStats* ServerStats::mutable_operations(int index) {
+  // @@protoc_insertion_point(field_mutable:chat.ServerStats.operations)
+  return _impl_.operations_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::OperationStats >*
+ServerStats::mutable_operations() {
+  // @@protoc_insertion_point(field_mutable_list:chat.ServerStats.operations)
+  return &_impl_.operations_;
+}
+inline const ::chat::OperationStats& ServerStats::_internal_operations(int index) const {
+  return _impl_.operations_.Get(index);
+}
+inline const ::chat::OperationStats& ServerStats::operations(int index) const {
+  // @@protoc_insertion_point(field_get:chat.ServerStats.operations)
+  return _internal_operations(index);
+}
+inline ::chat::OperationStats* ServerStats::_internal_add_operations() {
+  return _impl_.operations_.Add();
+}
+inline ::chat::OperationStats* ServerStats::add_operations() {
+  ::chat::OperationStats* _add = _internal_add_operations();
+  // @@protoc_insertion_point(field_add:chat.ServerStats.operations)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::OperationStats >&
+ServerStats::operations() const {
+  // @@protoc_insertion_point(field_list:chat.ServerStats.operations)
+  return _impl_.operations_;
+}
+
+// repeated .chat.StatusCodeCount responses = 3;
+inline int ServerStats::_internal_responses_size() const {
+  return _impl_.responses_.size();
+}
+inline int ServerStats::responses_size() const {
+  return _internal_responses_size();
+}
+inline void ServerStats::clear_responses() {
+  _impl_.responses_.Clear();
+}
+inline ::chat::StatusCodeCount* ServerStats::mutable_responses(int index) {
+  // @@protoc_insertion_point(field_mutable:chat.ServerStats.responses)
+  return _impl_.responses_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::StatusCodeCount >*
+ServerStats::mutable_responses() {
+  // @@protoc_insertion_point(field_mutable_list:chat.ServerStats.responses)
+  return &_impl_.responses_;
+}
+inline const ::chat::StatusCodeCount& ServerStats::_internal_responses(int index) const {
+  return _impl_.responses_.Get(index);
+}
+inline const ::chat::StatusCodeCount& ServerStats::responses(int index) const {
+  // @@protoc_insertion_point(field_get:chat.ServerStats.responses)
+  return _internal_responses(index);
+}
+inline ::chat::StatusCodeCount* ServerStats::_internal_add_responses() {
+  return _impl_.responses_.Add();
+}
+inline ::chat::StatusCodeCount* ServerStats::add_responses() {
+  ::chat::StatusCodeCount* _add = _internal_add_responses();
+  // @@protoc_insertion_point(field_add:chat.ServerStats.responses)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::StatusCodeCount >&
+ServerStats::responses() const {
+  // @@protoc_insertion_point(field_list:chat.ServerStats.responses)
+  return _impl_.responses_;
+}
+
+// uint64 bytes_in = 4;
+inline void ServerStats::clear_bytes_in() {
+  _impl_.bytes_in_ = uint64_t{0u};
+}
+inline uint64_t ServerStats::_internal_bytes_in() const {
+  return _impl_.bytes_in_;
+}
+inline uint64_t ServerStats::bytes_in() const {
+  // @@protoc_insertion_point(field_get:chat.ServerStats.bytes_in)
+  return _internal_bytes_in();
+}
+inline void ServerStats::_internal_set_bytes_in(uint64_t value) {
+  
+  _impl_.bytes_in_ = value;
+}
+inline void ServerStats::set_bytes_in(uint64_t value) {
+  _internal_set_bytes_in(value);
+  // @@protoc_insertion_point(field_set:chat.ServerStats.bytes_in)
+}
+
+// uint64 bytes_out = 5;
+inline void ServerStats::clear_bytes_out() {
+  _impl_.bytes_out_ = uint64_t{0u};
+}
+inline uint64_t ServerStats::_internal_bytes_out() const {
+  return _impl_.bytes_out_;
+}
+inline uint64_t ServerStats::bytes_out() const {
+  // @@protoc_insertion_point(field_get:chat.ServerStats.bytes_out)
+  return _internal_bytes_out();
+}
+inline void ServerStats::_internal_set_bytes_out(uint64_t value) {
+  
+  _impl_.bytes_out_ = value;
+}
+inline void ServerStats::set_bytes_out(uint64_t value) {
+  _internal_set_bytes_out(value);
+  // @@protoc_insertion_point(field_set:chat.ServerStats.bytes_out)
+}
+
+// uint64 active_connections = 6;
+inline void ServerStats::clear_active_connections() {
+  _impl_.active_connections_ = uint64_t{0u};
+}
+inline uint64_t ServerStats::_internal_active_connections() const {
+  return _impl_.active_connections_;
+}
+inline uint64_t ServerStats::active_connections() const {
+  // @@protoc_insertion_point(field_get:chat.ServerStats.active_connections)
+  return _internal_active_connections();
+}
+inline void ServerStats::_internal_set_active_connections(uint64_t value) {
+  
+  _impl_.active_connections_ = value;
+}
+inline void ServerStats::set_active_connections(uint64_t value) {
+  _internal_set_active_connections(value);
+  // @@protoc_insertion_point(field_set:chat.ServerStats.active_connections)
+}
+
+// uint64 total_connections = 7;
+inline void ServerStats::clear_total_connections() {
+  _impl_.total_connections_ = uint64_t{0u};
+}
+inline uint64_t ServerStats::_internal_total_connections() const {
+  return _impl_.total_connections_;
+}
+inline uint64_t ServerStats::total_connections() const {
+  // @@protoc_insertion_point(field_get:chat.ServerStats.total_connections)
+  return _internal_total_connections();
+}
+inline void ServerStats::_internal_set_total_connections(uint64_t value) {
+  
+  _impl_.total_connections_ = value;
+}
+inline void ServerStats::set_total_connections(uint64_t value) {
+  _internal_set_total_connections(value);
+  // @@protoc_insertion_point(field_set:chat.ServerStats.total_connections)
+}
+
+// uint64 queued_frames = 8;
+inline void ServerStats::clear_queued_frames() {
+  _impl_.queued_frames_ = uint64_t{0u};
+}
+inline uint64_t ServerStats::_internal_queued_frames() const {
+  return _impl_.queued_frames_;
+}
+inline uint64_t ServerStats::queued_frames() const {
+  // @@protoc_insertion_point(field_get:chat.ServerStats.queued_frames)
+  return _internal_queued_frames();
+}
+inline void ServerStats::_internal_set_queued_frames(uint64_t value) {
+  
+  _impl_.queued_frames_ = value;
+}
+inline void ServerStats::set_queued_frames(uint64_t value) {
+  _internal_set_queued_frames(value);
+  // @@protoc_insertion_point(field_set:chat.ServerStats.queued_frames)
+}
+
+// uint64 queued_bytes = 9;
+inline void ServerStats::clear_queued_bytes() {
+  _impl_.queued_bytes_ = uint64_t{0u};
+}
+inline uint64_t ServerStats::_internal_queued_bytes() const {
+  return _impl_.queued_bytes_;
+}
+inline uint64_t ServerStats::queued_bytes() const {
+  // @@protoc_insertion_point(field_get:chat.ServerStats.queued_bytes)
+  return _internal_queued_bytes();
+}
+inline void ServerStats::_internal_set_queued_bytes(uint64_t value) {
+  
+  _impl_.queued_bytes_ = value;
+}
+inline void ServerStats::set_queued_bytes(uint64_t value) {
+  _internal_set_queued_bytes(value);
+  // @@protoc_insertion_point(field_set:chat.ServerStats.queued_bytes)
+}
+
+// .chat.Distribution queue_depth = 10;
+inline bool ServerStats::_internal_has_queue_depth() const {
+  return this != internal_default_instance() && _impl_.queue_depth_ != nullptr;
+}
+inline bool ServerStats::has_queue_depth() const {
+  return _internal_has_queue_depth();
+}
+inline void ServerStats::clear_queue_depth() {
+  if (GetArenaForAllocation() == nullptr && _impl_.queue_depth_ != nullptr) {
+    delete _impl_.queue_depth_;
+  }
+  _impl_.queue_depth_ = nullptr;
+}
+inline const ::chat::Distribution& ServerStats::_internal_queue_depth() const {
+  const ::chat::Distribution* p = _impl_.queue_depth_;
+  return p != nullptr ? *p : reinterpret_cast<const ::chat::Distribution&>(
+      ::chat::_Distribution_default_instance_);
+}
+inline const ::chat::Distribution& ServerStats::queue_depth() const {
+  // @@protoc_insertion_point(field_get:chat.ServerStats.queue_depth)
+  return _internal_queue_depth();
+}
+inline void ServerStats::unsafe_arena_set_allocated_queue_depth(
+    ::chat::Distribution* queue_depth) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.queue_depth_);
+  }
+  _impl_.queue_depth_ = queue_depth;
+  if (queue_depth) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.ServerStats.queue_depth)
+}
+inline ::chat::Distribution* ServerStats::release_queue_depth() {
+  
+  ::chat::Distribution* temp = _impl_.queue_depth_;
+  _impl_.queue_depth_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::chat::Distribution* ServerStats::unsafe_arena_release_queue_depth() {
+  // @@protoc_insertion_point(field_release:chat.ServerStats.queue_depth)
+  
+  ::chat::Distribution* temp = _impl_.queue_depth_;
+  _impl_.queue_depth_ = nullptr;
+  return temp;
+}
+inline ::chat::Distribution* ServerStats::_internal_mutable_queue_depth() {
+  
+  if (_impl_.queue_depth_ == nullptr) {
+    auto* p = CreateMaybeMessage<::chat::Distribution>(GetArenaForAllocation());
+    _impl_.queue_depth_ = p;
+  }
+  return _impl_.queue_depth_;
+}
+inline ::chat::Distribution* ServerStats::mutable_queue_depth() {
+  ::chat::Distribution* _msg = _internal_mutable_queue_depth();
+  // @@protoc_insertion_point(field_mutable:chat.ServerStats.queue_depth)
+  return _msg;
+}
+inline void ServerStats::set_allocated_queue_depth(::chat::Distribution* queue_depth) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.queue_depth_;
+  }
+  if (queue_depth) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(queue_depth);
+    if (message_arena != submessage_arena) {
+      queue_depth = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, queue_depth, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.queue_depth_ = queue_depth;
+  // @@protoc_insertion_point(field_set_allocated:chat.ServerStats.queue_depth)
+}
+
+// .chat.Distribution broadcast_fanout = 11;
+inline bool ServerStats::_internal_has_broadcast_fanout() const {
+  return this != internal_default_instance() && _impl_.broadcast_fanout_ != nullptr;
+}
+inline bool ServerStats::has_broadcast_fanout() const {
+  return _internal_has_broadcast_fanout();
+}
+inline void ServerStats::clear_broadcast_fanout() {
+  if (GetArenaForAllocation() == nullptr && _impl_.broadcast_fanout_ != nullptr) {
+    delete _impl_.broadcast_fanout_;
+  }
+  _impl_.broadcast_fanout_ = nullptr;
+}
+inline const ::chat::Distribution& ServerStats::_internal_broadcast_fanout() const {
+  const ::chat::Distribution* p = _impl_.broadcast_fanout_;
+  return p != nullptr ? *p : reinterpret_cast<const ::chat::Distribution&>(
+      ::chat::_Distribution_default_instance_);
+}
+inline const ::chat::Distribution& ServerStats::broadcast_fanout() const {
+  // @@protoc_insertion_point(field_get:chat.ServerStats.broadcast_fanout)
+  return _internal_broadcast_fanout();
+}
+inline void ServerStats::unsafe_arena_set_allocated_broadcast_fanout(
+    ::chat::Distribution* broadcast_fanout) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.broadcast_fanout_);
+  }
+  _impl_.broadcast_fanout_ = broadcast_fanout;
+  if (broadcast_fanout) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.ServerStats.broadcast_fanout)
+}
+inline ::chat::Distribution* ServerStats::release_broadcast_fanout() {
+  
+  ::chat::Distribution* temp = _impl_.broadcast_fanout_;
+  _impl_.broadcast_fanout_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::chat::Distribution* ServerStats::unsafe_arena_release_broadcast_fanout() {
+  // @@protoc_insertion_point(field_release:chat.ServerStats.broadcast_fanout)
+  
+  ::chat::Distribution* temp = _impl_.broadcast_fanout_;
+  _impl_.broadcast_fanout_ = nullptr;
+  return temp;
+}
+inline ::chat::Distribution* ServerStats::_internal_mutable_broadcast_fanout() {
+  
+  if (_impl_.broadcast_fanout_ == nullptr) {
+    auto* p = CreateMaybeMessage<::chat::Distribution>(GetArenaForAllocation());
+    _impl_.broadcast_fanout_ = p;
+  }
+  return _impl_.broadcast_fanout_;
+}
+inline ::chat::Distribution* ServerStats::mutable_broadcast_fanout() {
+  ::chat::Distribution* _msg = _internal_mutable_broadcast_fanout();
+  // @@protoc_insertion_point(field_mutable:chat.ServerStats.broadcast_fanout)
+  return _msg;
+}
+inline void ServerStats::set_allocated_broadcast_fanout(::chat::Distribution* broadcast_fanout) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.broadcast_fanout_;
+  }
+  if (broadcast_fanout) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(broadcast_fanout);
+    if (message_arena != submessage_arena) {
+      broadcast_fanout = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, broadcast_fanout, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.broadcast_fanout_ = broadcast_fanout;
+  // @@protoc_insertion_point(field_set_allocated:chat.ServerStats.broadcast_fanout)
+}
+
+// uint64 heap_allocations = 12;
+inline void ServerStats::clear_heap_allocations() {
+  _impl_.heap_allocations_ = uint64_t{0u};
+}
+inline uint64_t ServerStats::_internal_heap_allocations() const {
+  return _impl_.heap_allocations_;
+}
+inline uint64_t ServerStats::heap_allocations() const {
+  // @@protoc_insertion_point(field_get:chat.ServerStats.heap_allocations)
+  return _internal_heap_allocations();
+}
+inline void ServerStats::_internal_set_heap_allocations(uint64_t value) {
+  
+  _impl_.heap_allocations_ = value;
+}
+inline void ServerStats::set_heap_allocations(uint64_t value) {
+  _internal_set_heap_allocations(value);
+  // @@protoc_insertion_point(field_set:chat.ServerStats.heap_allocations)
+}
+
+// uint64 read_calls = 13;
+inline void ServerStats::clear_read_calls() {
+  _impl_.read_calls_ = uint64_t{0u};
+}
+inline uint64_t ServerStats::_internal_read_calls() const {
+  return _impl_.read_calls_;
+}
+inline uint64_t ServerStats::read_calls() const {
+  // @@protoc_insertion_point(field_get:chat.ServerStats.read_calls)
+  return _internal_read_calls();
+}
+inline void ServerStats::_internal_set_read_calls(uint64_t value) {
+  
+  _impl_.read_calls_ = value;
+}
+inline void ServerStats::set_read_calls(uint64_t value) {
+  _internal_set_read_calls(value);
+  // @@protoc_insertion_point(field_set:chat.ServerStats.read_calls)
+}
+
+// uint64 write_calls = 14;
+inline void ServerStats::clear_write_calls() {
+  _impl_.write_calls_ = uint64_t{0u};
+}
+inline uint64_t ServerStats::_internal_write_calls() const {
+  return _impl_.write_calls_;
+}
+inline uint64_t ServerStats::write_calls() const {
+  // @@protoc_insertion_point(field_get:chat.ServerStats.write_calls)
+  return _internal_write_calls();
+}
+inline void ServerStats::_internal_set_write_calls(uint64_t value) {
+  
+  _impl_.write_calls_ = value;
+}
+inline void ServerStats::set_write_calls(uint64_t value) {
+  _internal_set_write_calls(value);
+  // @@protoc_insertion_point(field_set:chat.ServerStats.write_calls)
+}
+
+// uint64 packed_frames = 15;
+inline void ServerStats::clear_packed_frames() {
+  _impl_.packed_frames_ = uint64_t{0u};
+}
+inline uint64_t ServerStats::_internal_packed_frames() const {
+  return _impl_.packed_frames_;
+}
+inline uint64_t ServerStats::packed_frames() const {
+  // @@protoc_insertion_point(field_get:chat.ServerStats.packed_frames)
+  return _internal_packed_frames();
+}
+inline void ServerStats::_internal_set_packed_frames(uint64_t value) {
+  
+  _impl_.packed_frames_ = value;
+}
+inline void ServerStats::set_packed_frames(uint64_t value) {
+  _internal_set_packed_frames(value);
+  // @@protoc_insertion_point(field_set:chat.ServerStats.packed_frames)
+}
+
+// uint64 offline_queued = 16;
+inline void ServerStats::clear_offline_queued() {
+  _impl_.offline_queued_ = uint64_t{0u};
+}
+inline uint64_t ServerStats::_internal_offline_queued() const {
+  return _impl_.offline_queued_;
+}
+inline uint64_t ServerStats::offline_queued() const {
+  // @@protoc_insertion_point(field_get:chat.ServerStats.offline_queued)
+  return _internal_offline_queued();
+}
+inline void ServerStats::_internal_set_offline_queued(uint64_t value) {
+  
+  _impl_.offline_queued_ = value;
+}
+inline void ServerStats::set_offline_queued(uint64_t value) {
+  _internal_set_offline_queued(value);
+  // @@protoc_insertion_point(field_set:chat.ServerStats.offline_queued)
+}
+
+// uint64 offline_delivered = 17;
+inline void ServerStats::clear_offline_delivered() {
+  _impl_.offline_delivered_ = uint64_t{0u};
+}
+inline uint64_t ServerStats::_internal_offline_delivered() const {
+  return _impl_.offline_delivered_;
+}
+inline uint64_t ServerStats::offline_delivered() const {
+  // @@protoc_insertion_point(field_get:chat.ServerStats.offline_delivered)
+  return _internal_offline_delivered();
+}
+inline void ServerStats::_internal_set_offline_delivered(uint64_t value) {
+  
+  _impl_.offline_delivered_ = value;
+}
+inline void ServerStats::set_offline_delivered(uint64_t value) {
+  _internal_set_offline_delivered(value);
+  // @@protoc_insertion_point(field_set:chat.ServerStats.offline_delivered)
+}
+
+// uint64 offline_pending = 18;
+inline void ServerStats::clear_offline_pending() {
+  _impl_.offline_pending_ = uint64_t{0u};
+}
+inline uint64_t ServerStats::_internal_offline_pending() const {
+  return _impl_.offline_pending_;
+}
+inline uint64_t ServerStats::offline_pending() const {
+  // @@protoc_insertion_point(field_get:chat.ServerStats.offline_pending)
+  return _internal_offline_pending();
+}
+inline void ServerStats::_internal_set_offline_pending(uint64_t value) {
+  
+  _impl_.offline_pending_ = value;
+}
+inline void ServerStats::set_offline_pending(uint64_t value) {
+  _internal_set_offline_pending(value);
+  // @@protoc_insertion_point(field_set:chat.ServerStats.offline_pending)
+}
+
+// uint64 offline_syncs = 19;
+inline void ServerStats::clear_offline_syncs() {
+  _impl_.offline_syncs_ = uint64_t{0u};
+}
+inline uint64_t ServerStats::_internal_offline_syncs() const {
+  return _impl_.offline_syncs_;
+}
+inline uint64_t ServerStats::offline_syncs() const {
+  // @@protoc_insertion_point(field_get:chat.ServerStats.offline_syncs)
+  return _internal_offline_syncs();
+}
+inline void ServerStats::_internal_set_offline_syncs(uint64_t value) {
+  
+  _impl_.offline_syncs_ = value;
+}
+inline void ServerStats::set_offline_syncs(uint64_t value) {
+  _internal_set_offline_syncs(value);
+  // @@protoc_insertion_point(field_set:chat.ServerStats.offline_syncs)
+}
+
+// uint64 routed_frames = 20;
+inline void ServerStats::clear_routed_frames() {
+  _impl_.routed_frames_ = uint64_t{0u};
+}
+inline uint64_t ServerStats::_internal_routed_frames() const {
+  return _impl_.routed_frames_;
+}
+inline uint64_t ServerStats::routed_frames() const {
+  // @@protoc_insertion_point(field_get:chat.ServerStats.routed_frames)
+  return _internal_routed_frames();
+}
+inline void ServerStats::_internal_set_routed_frames(uint64_t value) {
+  
+  _impl_.routed_frames_ = value;
+}
+inline void ServerStats::set_routed_frames(uint64_t value) {
+  _internal_set_routed_frames(value);
+  // @@protoc_insertion_point(field_set:chat.ServerStats.routed_frames)
+}
+
+// uint64 active_rooms = 21;
+inline void ServerStats::clear_active_rooms() {
+  _impl_.active_rooms_ = uint64_t{0u};
+}
+inline uint64_t ServerStats::_internal_active_rooms() const {
+  return _impl_.active_rooms_;
+}
+inline uint64_t ServerStats::active_rooms() const {
+  // @@protoc_insertion_point(field_get:chat.ServerStats.active_rooms)
+  return _internal_active_rooms();
+}
+inline void ServerStats::_internal_set_active_rooms(uint64_t value) {
+  
+  _impl_.active_rooms_ = value;
+}
+inline void ServerStats::set_active_rooms(uint64_t value) {
+  _internal_set_active_rooms(value);
+  // @@protoc_insertion_point(field_set:chat.ServerStats.active_rooms)
+}
+
+// .chat.Distribution room_fanout = 22;
+inline bool ServerStats::_internal_has_room_fanout() const {
+  return this != internal_default_instance() && _impl_.room_fanout_ != nullptr;
+}
+inline bool ServerStats::has_room_fanout() const {
+  return _internal_has_room_fanout();
+}
+inline void ServerStats::clear_room_fanout() {
+  if (GetArenaForAllocation() == nullptr && _impl_.room_fanout_ != nullptr) {
+    delete _impl_.room_fanout_;
+  }
+  _impl_.room_fanout_ = nullptr;
+}
+inline const ::chat::Distribution& ServerStats::_internal_room_fanout() const {
+  const ::chat::Distribution* p = _impl_.room_fanout_;
+  return p != nullptr ? *p : reinterpret_cast<const ::chat::Distribution&>(
+      ::chat::_Distribution_default_instance_);
+}
+inline const ::chat::Distribution& ServerStats::room_fanout() const {
+  // @@protoc_insertion_point(field_get:chat.ServerStats.room_fanout)
+  return _internal_room_fanout();
+}
+inline void ServerStats::unsafe_arena_set_allocated_room_fanout(
+    ::chat::Distribution* room_fanout) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.room_fanout_);
+  }
+  _impl_.room_fanout_ = room_fanout;
+  if (room_fanout) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.ServerStats.room_fanout)
+}
+inline ::chat::Distribution* ServerStats::release_room_fanout() {
+  
+  ::chat::Distribution* temp = _impl_.room_fanout_;
+  _impl_.room_fanout_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::chat::Distribution* ServerStats::unsafe_arena_release_room_fanout() {
+  // @@protoc_insertion_point(field_release:chat.ServerStats.room_fanout)
+  
+  ::chat::Distribution* temp = _impl_.room_fanout_;
+  _impl_.room_fanout_ = nullptr;
+  return temp;
+}
+inline ::chat::Distribution* ServerStats::_internal_mutable_room_fanout() {
+  
+  if (_impl_.room_fanout_ == nullptr) {
+    auto* p = CreateMaybeMessage<::chat::Distribution>(GetArenaForAllocation());
+    _impl_.room_fanout_ = p;
+  }
+  return _impl_.room_fanout_;
+}
+inline ::chat::Distribution* ServerStats::mutable_room_fanout() {
+  ::chat::Distribution* _msg = _internal_mutable_room_fanout();
+  // @@protoc_insertion_point(field_mutable:chat.ServerStats.room_fanout)
+  return _msg;
+}
+inline void ServerStats::set_allocated_room_fanout(::chat::Distribution* room_fanout) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.room_fanout_;
+  }
+  if (room_fanout) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(room_fanout);
+    if (message_arena != submessage_arena) {
+      room_fanout = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, room_fanout, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.room_fanout_ = room_fanout;
+  // @@protoc_insertion_point(field_set_allocated:chat.ServerStats.room_fanout)
+}
+
+// uint64 slow_consumers = 23;
+inline void ServerStats::clear_slow_consumers() {
+  _impl_.slow_consumers_ = uint64_t{0u};
+}
+inline uint64_t ServerStats::_internal_slow_consumers() const {
+  return _impl_.slow_consumers_;
+}
+inline uint64_t ServerStats::slow_consumers() const {
+  // @@protoc_insertion_point(field_get:chat.ServerStats.slow_consumers)
+  return _internal_slow_consumers();
+}
+inline void ServerStats::_internal_set_slow_consumers(uint64_t value) {
+  
+  _impl_.slow_consumers_ = value;
+}
+inline void ServerStats::set_slow_consumers(uint64_t value) {
+  _internal_set_slow_consumers(value);
+  // @@protoc_insertion_point(field_set:chat.ServerStats.slow_consumers)
+}
+
+// uint64 dropped_frames = 24;
+inline void ServerStats::clear_dropped_frames() {
+  _impl_.dropped_frames_ = uint64_t{0u};
+}
+inline uint64_t ServerStats::_internal_dropped_frames() const {
+  return _impl_.dropped_frames_;
+}
+inline uint64_t ServerStats::dropped_frames() const {
+  // @@protoc_insertion_point(field_get:chat.ServerStats.dropped_frames)
+  return _internal_dropped_frames();
+}
+inline void ServerStats::_internal_set_dropped_frames(uint64_t value) {
+  
+  _impl_.dropped_frames_ = value;
+}
+inline void ServerStats::set_dropped_frames(uint64_t value) {
+  _internal_set_dropped_frames(value);
+  // @@protoc_insertion_point(field_set:chat.ServerStats.dropped_frames)
+}
+
+// uint64 overflow_disconnects = 25;
+inline void ServerStats::clear_overflow_disconnects() {
+  _impl_.overflow_disconnects_ = uint64_t{0u};
+}
+inline uint64_t ServerStats::_internal_overflow_disconnects() const {
+  return _impl_.overflow_disconnects_;
+}
+inline uint64_t ServerStats::overflow_disconnects() const {
+  // @@protoc_insertion_point(field_get:chat.ServerStats.overflow_disconnects)
+  return _internal_overflow_disconnects();
+}
+inline void ServerStats::_internal_set_overflow_disconnects(uint64_t value) {
+  
+  _impl_.overflow_disconnects_ = value;
+}
+inline void ServerStats::set_overflow_disconnects(uint64_t value) {
+  _internal_set_overflow_disconnects(value);
+  // @@protoc_insertion_point(field_set:chat.ServerStats.overflow_disconnects)
+}
+
+// uint64 compressed_frames = 26;
+inline void ServerStats::clear_compressed_frames() {
+  _impl_.compressed_frames_ = uint64_t{0u};
+}
+inline uint64_t ServerStats::_internal_compressed_frames() const {
+  return _impl_.compressed_frames_;
+}
+inline uint64_t ServerStats::compressed_frames() const {
+  // @@protoc_insertion_point(field_get:chat.ServerStats.compressed_frames)
+  return _internal_compressed_frames();
+}
+inline void ServerStats::_internal_set_compressed_frames(uint64_t value) {
+  
+  _impl_.compressed_frames_ = value;
+}
+inline void ServerStats::set_compressed_frames(uint64_t value) {
+  _internal_set_compressed_frames(value);
+  // @@protoc_insertion_point(field_set:chat.ServerStats.compressed_frames)
+}
+
+// uint64 compression_in_bytes = 27;
+inline void ServerStats::clear_compression_in_bytes() {
+  _impl_.compression_in_bytes_ = uint64_t{0u};
+}
+inline uint64_t ServerStats::_internal_compression_in_bytes() const {
+  return _impl_.compression_in_bytes_;
+}
+inline uint64_t ServerStats::compression_in_bytes() const {
+  // @@protoc_insertion_point(field_get:chat.ServerStats.compression_in_bytes)
+  return _internal_compression_in_bytes();
+}
+inline void ServerStats::_internal_set_compression_in_bytes(uint64_t value) {
+  
+  _impl_.compression_in_bytes_ = value;
+}
+inline void ServerStats::set_compression_in_bytes(uint64_t value) {
+  _internal_set_compression_in_bytes(value);
+  // @@protoc_insertion_point(field_set:chat.ServerStats.compression_in_bytes)
+}
+
+// uint64 compression_out_bytes = 28;
+inline void ServerStats::clear_compression_out_bytes() {
+  _impl_.compression_out_bytes_ = uint64_t{0u};
+}
+inline uint64_t ServerStats::_internal_compression_out_bytes() const {
+  return _impl_.compression_out_bytes_;
+}
+inline uint64_t ServerStats::compression_out_bytes() const {
+  // @@protoc_insertion_point(field_get:chat.ServerStats.compression_out_bytes)
+  return _internal_compression_out_bytes();
+}
+inline void ServerStats::_internal_set_compression_out_bytes(uint64_t value) {
+  
+  _impl_.compression_out_bytes_ = value;
+}
+inline void ServerStats::set_compression_out_bytes(uint64_t value) {
+  _internal_set_compression_out_bytes(value);
+  // @@protoc_insertion_point(field_set:chat.ServerStats.compression_out_bytes)
+}
+
+// uint64 compression_cpu_ns = 29;
+inline void ServerStats::clear_compression_cpu_ns() {
+  _impl_.compression_cpu_ns_ = uint64_t{0u};
+}
+inline uint64_t ServerStats::_internal_compression_cpu_ns() const {
+  return _impl_.compression_cpu_ns_;
+}
+inline uint64_t ServerStats::compression_cpu_ns() const {
+  // @@protoc_insertion_point(field_get:chat.ServerStats.compression_cpu_ns)
+  return _internal_compression_cpu_ns();
+}
+inline void ServerStats::_internal_set_compression_cpu_ns(uint64_t value) {
+  
+  _impl_.compression_cpu_ns_ = value;
+}
+inline void ServerStats::set_compression_cpu_ns(uint64_t value) {
+  _internal_set_compression_cpu_ns(value);
+  // @@protoc_insertion_point(field_set:chat.ServerStats.compression_cpu_ns)
+}
+
+// .chat.Distribution pipeline_depth = 30;
+inline bool ServerStats::_internal_has_pipeline_depth() const {
+  return this != internal_default_instance() && _impl_.pipeline_depth_ != nullptr;
+}
+inline bool ServerStats::has_pipeline_depth() const {
+  return _internal_has_pipeline_depth();
+}
+inline void ServerStats::clear_pipeline_depth() {
+  if (GetArenaForAllocation() == nullptr && _impl_.pipeline_depth_ != nullptr) {
+    delete _impl_.pipeline_depth_;
+  }
+  _impl_.pipeline_depth_ = nullptr;
+}
+inline const ::chat::Distribution& ServerStats::_internal_pipeline_depth() const {
+  const ::chat::Distribution* p = _impl_.pipeline_depth_;
+  return p != nullptr ? *p : reinterpret_cast<const ::chat::Distribution&>(
+      ::chat::_Distribution_default_instance_);
+}
+inline const ::chat::Distribution& ServerStats::pipeline_depth() const {
+  // @@protoc_insertion_point(field_get:chat.ServerStats.pipeline_depth)
+  return _internal_pipeline_depth();
+}
+inline void ServerStats::unsafe_arena_set_allocated_pipeline_depth(
+    ::chat::Distribution* pipeline_depth) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.pipeline_depth_);
+  }
+  _impl_.pipeline_depth_ = pipeline_depth;
+  if (pipeline_depth) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.ServerStats.pipeline_depth)
+}
+inline ::chat::Distribution* ServerStats::release_pipeline_depth() {
+  
+  ::chat::Distribution* temp = _impl_.pipeline_depth_;
+  _impl_.pipeline_depth_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::chat::Distribution* ServerStats::unsafe_arena_release_pipeline_depth() {
+  // @@protoc_insertion_point(field_release:chat.ServerStats.pipeline_depth)
+  
+  ::chat::Distribution* temp = _impl_.pipeline_depth_;
+  _impl_.pipeline_depth_ = nullptr;
+  return temp;
+}
+inline ::chat::Distribution* ServerStats::_internal_mutable_pipeline_depth() {
+  
+  if (_impl_.pipeline_depth_ == nullptr) {
+    auto* p = CreateMaybeMessage<::chat::Distribution>(GetArenaForAllocation());
+    _impl_.pipeline_depth_ = p;
+  }
+  return _impl_.pipeline_depth_;
+}
+inline ::chat::Distribution* ServerStats::mutable_pipeline_depth() {
+  ::chat::Distribution* _msg = _internal_mutable_pipeline_depth();
+  // @@protoc_insertion_point(field_mutable:chat.ServerStats.pipeline_depth)
+  return _msg;
+}
+inline void ServerStats::set_allocated_pipeline_depth(::chat::Distribution* pipeline_depth) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.pipeline_depth_;
+  }
+  if (pipeline_depth) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(pipeline_depth);
+    if (message_arena != submessage_arena) {
+      pipeline_depth = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, pipeline_depth, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.pipeline_depth_ = pipeline_depth;
+  // @@protoc_insertion_point(field_set_allocated:chat.ServerStats.pipeline_depth)
+}
+
+// uint64 presence_subscribers = 31;
+inline void ServerStats::clear_presence_subscribers() {
+  _impl_.presence_subscribers_ = uint64_t{0u};
+}
+inline uint64_t ServerStats::_internal_presence_subscribers() const {
+  return _impl_.presence_subscribers_;
+}
+inline uint64_t ServerStats::presence_subscribers() const {
+  // @@protoc_insertion_point(field_get:chat.ServerStats.presence_subscribers)
+  return _internal_presence_subscribers();
+}
+inline void ServerStats::_internal_set_presence_subscribers(uint64_t value) {
+  
+  _impl_.presence_subscribers_ = value;
+}
+inline void ServerStats::set_presence_subscribers(uint64_t value) {
+  _internal_set_presence_subscribers(value);
+  // @@protoc_insertion_point(field_set:chat.ServerStats.presence_subscribers)
+}
+
+// uint64 presence_changes = 32;
+inline void ServerStats::clear_presence_changes() {
+  _impl_.presence_changes_ = uint64_t{0u};
+}
+inline uint64_t ServerStats::_internal_presence_changes() const {
+  return _impl_.presence_changes_;
+}
+inline uint64_t ServerStats::presence_changes() const {
+  // @@protoc_insertion_point(field_get:chat.ServerStats.presence_changes)
+  return _internal_presence_changes();
+}
+inline void ServerStats::_internal_set_presence_changes(uint64_t value) {
+  
+  _impl_.presence_changes_ = value;
+}
+inline void ServerStats::set_presence_changes(uint64_t value) {
+  _internal_set_presence_changes(value);
+  // @@protoc_insertion_point(field_set:chat.ServerStats.presence_changes)
+}
+
+// uint64 presence_events = 33;
+inline void ServerStats::clear_presence_events() {
+  _impl_.presence_events_ = uint64_t{0u};
+}
+inline uint64_t ServerStats::_internal_presence_events() const {
+  return _impl_.presence_events_;
+}
+inline uint64_t ServerStats::presence_events() const {
+  // @@protoc_insertion_point(field_get:chat.ServerStats.presence_events)
+  return _internal_presence_events();
+}
+inline void ServerStats::_internal_set_presence_events(uint64_t value) {
+  
+  _impl_.presence_events_ = value;
+}
+inline void ServerStats::set_presence_events(uint64_t value) {
+  _internal_set_presence_events(value);
+  // @@protoc_insertion_point(field_set:chat.ServerStats.presence_events)
+}
+
+// uint64 presence_updates = 34;
+inline void ServerStats::clear_presence_updates() {
+  _impl_.presence_updates_ = uint64_t{0u};
+}
+inline uint64_t ServerStats::_internal_presence_updates() const {
+  return _impl_.presence_updates_;
+}
+inline uint64_t ServerStats::presence_updates() const {
+  // @@protoc_insertion_point(field_get:chat.ServerStats.presence_updates)
+  return _internal_presence_updates();
+}
+inline void ServerStats::_internal_set_presence_updates(uint64_t value) {
+  
+  _impl_.presence_updates_ = value;
+}
+inline void ServerStats::set_presence_updates(uint64_t value) {
+  _internal_set_presence_updates(value);
+  // @@protoc_insertion_point(field_set:chat.ServerStats.presence_updates)
+}
+
+// uint64 sessions = 35;
+inline void ServerStats::clear_sessions() {
+  _impl_.sessions_ = uint64_t{0u};
+}
+inline uint64_t ServerStats::_internal_sessions() const {
+  return _impl_.sessions_;
+}
+inline uint64_t ServerStats::sessions() const {
+  // @@protoc_insertion_point(field_get:chat.ServerStats.sessions)
+  return _internal_sessions();
+}
+inline void ServerStats::_internal_set_sessions(uint64_t value) {
+  
+  _impl_.sessions_ = value;
+}
+inline void ServerStats::set_sessions(uint64_t value) {
+  _internal_set_sessions(value);
+  // @@protoc_insertion_point(field_set:chat.ServerStats.sessions)
+}
+
+// uint64 session_bytes = 36;
+inline void ServerStats::clear_session_bytes() {
+  _impl_.session_bytes_ = uint64_t{0u};
+}
+inline uint64_t ServerStats::_internal_session_bytes() const {
+  return _impl_.session_bytes_;
+}
+inline uint64_t ServerStats::session_bytes() const {
+  // @@protoc_insertion_point(field_get:chat.ServerStats.session_bytes)
+  return _internal_session_bytes();
+}
+inline void ServerStats::_internal_set_session_bytes(uint64_t value) {
+  
+  _impl_.session_bytes_ = value;
+}
+inline void ServerStats::set_session_bytes(uint64_t value) {
+  _internal_set_session_bytes(value);
+  // @@protoc_insertion_point(field_set:chat.ServerStats.session_bytes)
+}
+
+// uint64 worker_jobs = 37;
+inline void ServerStats::clear_worker_jobs() {
+  _impl_.worker_jobs_ = uint64_t{0u};
+}
+inline uint64_t ServerStats::_internal_worker_jobs() const {
+  return _impl_.worker_jobs_;
+}
+inline uint64_t ServerStats::worker_jobs() const {
+  // @@protoc_insertion_point(field_get:chat.ServerStats.worker_jobs)
+  return _internal_worker_jobs();
+}
+inline void ServerStats::_internal_set_worker_jobs(uint64_t value) {
+  
+  _impl_.worker_jobs_ = value;
+}
+inline void ServerStats::set_worker_jobs(uint64_t value) {
+  _internal_set_worker_jobs(value);
+  // @@protoc_insertion_point(field_set:chat.ServerStats.worker_jobs)
+}
+
+// uint64 stolen_jobs = 38;
+inline void ServerStats::clear_stolen_jobs() {
+  _impl_.stolen_jobs_ = uint64_t{0u};
+}
+inline uint64_t ServerStats::_internal_stolen_jobs() const {
+  return _impl_.stolen_jobs_;
+}
+inline uint64_t ServerStats::stolen_jobs() const {
+  // @@protoc_insertion_point(field_get:chat.ServerStats.stolen_jobs)
+  return _internal_stolen_jobs();
+}
+inline void ServerStats::_internal_set_stolen_jobs(uint64_t value) {
+  
+  _impl_.stolen_jobs_ = value;
+}
+inline void ServerStats::set_stolen_jobs(uint64_t value) {
+  _internal_set_stolen_jobs(value);
+  // @@protoc_insertion_point(field_set:chat.ServerStats.stolen_jobs)
+}
+
+// uint64 detached_sessions = 39;
+inline void ServerStats::clear_detached_sessions() {
+  _impl_.detached_sessions_ = uint64_t{0u};
+}
+inline uint64_t ServerStats::_internal_detached_sessions() const {
+  return _impl_.detached_sessions_;
+}
+inline uint64_t ServerStats::detached_sessions() const {
+  // @@protoc_insertion_point(field_get:chat.ServerStats.detached_sessions)
+  return _internal_detached_sessions();
+}
+inline void ServerStats::_internal_set_detached_sessions(uint64_t value) {
+  
+  _impl_.detached_sessions_ = value;
+}
+inline void ServerStats::set_detached_sessions(uint64_t value) {
+  _internal_set_detached_sessions(value);
+  // @@protoc_insertion_point(field_set:chat.ServerStats.detached_sessions)
+}
+
+// uint64 resumed_sessions = 40;
+inline void ServerStats::clear_resumed_sessions() {
+  _impl_.resumed_sessions_ = uint64_t{0u};
+}
+inline uint64_t ServerStats::_internal_resumed_sessions() const {
+  return _impl_.resumed_sessions_;
+}
+inline uint64_t ServerStats::resumed_sessions() const {
+  // @@protoc_insertion_point(field_get:chat.ServerStats.resumed_sessions)
+  return _internal_resumed_sessions();
+}
+inline void ServerStats::_internal_set_resumed_sessions(uint64_t value) {
+  
+  _impl_.resumed_sessions_ = value;
+}
+inline void ServerStats::set_resumed_sessions(uint64_t value) {
+  _internal_set_resumed_sessions(value);
+  // @@protoc_insertion_point(field_set:chat.ServerStats.resumed_sessions)
+}
+
+// uint64 expired_sessions = 41;
+inline void ServerStats::clear_expired_sessions() {
+  _impl_.expired_sessions_ = uint64_t{0u};
+}
+inline uint64_t ServerStats::_internal_expired_sessions() const {
+  return _impl_.expired_sessions_;
+}
+inline uint64_t ServerStats::expired_sessions() const {
+  // @@protoc_insertion_point(field_get:chat.ServerStats.expired_sessions)
+  return _internal_expired_sessions();
+}
+inline void ServerStats::_internal_set_expired_sessions(uint64_t value) {
+  
+  _impl_.expired_sessions_ = value;
+}
+inline void ServerStats::set_expired_sessions(uint64_t value) {
+  _internal_set_expired_sessions(value);
+  // @@protoc_insertion_point(field_set:chat.ServerStats.expired_sessions)
+}
+
+// uint64 resumed_frames = 42;
+inline void ServerStats::clear_resumed_frames() {
+  _impl_.resumed_frames_ = uint64_t{0u};
+}
+inline uint64_t ServerStats::_internal_resumed_frames() const {
+  return _impl_.resumed_frames_;
+}
+inline uint64_t ServerStats::resumed_frames() const {
+  // @@protoc_insertion_point(field_get:chat.ServerStats.resumed_frames)
+  return _internal_resumed_frames();
+}
+inline void ServerStats::_internal_set_resumed_frames(uint64_t value) {
+  
+  _impl_.resumed_frames_ = value;
+}
+inline void ServerStats::set_resumed_frames(uint64_t value) {
+  _internal_set_resumed_frames(value);
+  // @@protoc_insertion_point(field_set:chat.ServerStats.resumed_frames)
+}
+
+// uint64 roster_builds = 43;
+inline void ServerStats::clear_roster_builds() {
+  _impl_.roster_builds_ = uint64_t{0u};
+}
+inline uint64_t ServerStats::_internal_roster_builds() const {
+  return _impl_.roster_builds_;
+}
+inline uint64_t ServerStats::roster_builds() const {
+  // @@protoc_insertion_point(field_get:chat.ServerStats.roster_builds)
+  return _internal_roster_builds();
+}
+inline void ServerStats::_internal_set_roster_builds(uint64_t value) {
+  
+  _impl_.roster_builds_ = value;
+}
+inline void ServerStats::set_roster_builds(uint64_t value) {
+  _internal_set_roster_builds(value);
+  // @@protoc_insertion_point(field_set:chat.ServerStats.roster_builds)
+}
+
+// uint64 roster_served = 44;
+inline void ServerStats::clear_roster_served() {
+  _impl_.roster_served_ = uint64_t{0u};
+}
+inline uint64_t ServerStats::_internal_roster_served() const {
+  return _impl_.roster_served_;
+}
+inline uint64_t ServerStats::roster_served() const {
+  // @@protoc_insertion_point(field_get:chat.ServerStats.roster_served)
+  return _internal_roster_served();
+}
+inline void ServerStats::_internal_set_roster_served(uint64_t value) {
+  
+  _impl_.roster_served_ = value;
+}
+inline void ServerStats::set_roster_served(uint64_t value) {
+  _internal_set_roster_served(value);
+  // @@protoc_insertion_point(field_set:chat.ServerStats.roster_served)
+}
+
+// uint64 file_transfers = 45;
+inline void ServerStats::clear_file_transfers() {
+  _impl_.file_transfers_ = uint64_t{0u};
+}
+inline uint64_t ServerStats::_internal_file_transfers() const {
+  return _impl_.file_transfers_;
+}
+inline uint64_t ServerStats::file_transfers() const {
+  // @@protoc_insertion_point(field_get:chat.ServerStats.file_transfers)
+  return _internal_file_transfers();
+}
+inline void ServerStats::_internal_set_file_transfers(uint64_t value) {
+  
+  _impl_.file_transfers_ = value;
+}
+inline void ServerStats::set_file_transfers(uint64_t value) {
+  _internal_set_file_transfers(value);
+  // @@protoc_insertion_point(field_set:chat.ServerStats.file_transfers)
+}
+
+// uint64 active_transfers = 46;
+inline void ServerStats::clear_active_transfers() {
+  _impl_.active_transfers_ = uint64_t{0u};
+}
+inline uint64_t ServerStats::_internal_active_transfers() const {
+  return _impl_.active_transfers_;
+}
+inline uint64_t ServerStats::active_transfers() const {
+  // @@protoc_insertion_point(field_get:chat.ServerStats.active_transfers)
+  return _internal_active_transfers();
+}
+inline void ServerStats::_internal_set_active_transfers(uint64_t value) {
+  
+  _impl_.active_transfers_ = value;
+}
+inline void ServerStats::set_active_transfers(uint64_t value) {
+  _internal_set_active_transfers(value);
+  // @@protoc_insertion_point(field_set:chat.ServerStats.active_transfers)
+}
+
+// uint64 file_bytes = 47;
+inline void ServerStats::clear_file_bytes() {
+  _impl_.file_bytes_ = uint64_t{0u};
+}
+inline uint64_t ServerStats::_internal_file_bytes() const {
+  return _impl_.file_bytes_;
+}
+inline uint64_t ServerStats::file_bytes() const {
+  // @@protoc_insertion_point(field_get:chat.ServerStats.file_bytes)
+  return _internal_file_bytes();
+}
+inline void ServerStats::_internal_set_file_bytes(uint64_t value) {
+  
+  _impl_.file_bytes_ = value;
+}
+inline void ServerStats::set_file_bytes(uint64_t value) {
+  _internal_set_file_bytes(value);
+  // @@protoc_insertion_point(field_set:chat.ServerStats.file_bytes)
+}
+
+// uint64 file_bytes_spooled = 48;
+inline void ServerStats::clear_file_bytes_spooled() {
+  _impl_.file_bytes_spooled_ = uint64_t{0u};
+}
+inline uint64_t ServerStats::_internal_file_bytes_spooled() const {
+  return _impl_.file_bytes_spooled_;
+}
+inline uint64_t ServerStats::file_bytes_spooled() const {
+  // @@protoc_insertion_point(field_get:chat.ServerStats.file_bytes_spooled)
+  return _internal_file_bytes_spooled();
+}
+inline void ServerStats::_internal_set_file_bytes_spooled(uint64_t value) {
+  
+  _impl_.file_bytes_spooled_ = value;
+}
+inline void ServerStats::set_file_bytes_spooled(uint64_t value) {
+  _internal_set_file_bytes_spooled(value);
+  // @@protoc_insertion_point(field_set:chat.ServerStats.file_bytes_spooled)
+}
+
+// -------------------------------------------------------------------
+
+// Response
+
+// .chat.Operation operation = 1;
+inline void Response::clear_operation() {
+  _impl_.operation_ = 0;
+}
+inline ::chat::Operation Response::_internal_operation() const {
+  return static_cast< ::chat::Operation >(_impl_.operation_);
+}
+inline ::chat::Operation Response::operation() const {
+  // @@protoc_insertion_point(field_get:chat.Response.operation)
+  return _internal_operation();
+}
+inline void Response::_internal_set_operation(::chat::Operation value) {
+  
+  _impl_.operation_ = value;
+}
+inline void Response::set_operation(::chat::Operation value) {
+  _internal_set_operation(value);
+  // @@protoc_insertion_point(field_set:chat.Response.operation)
+}
+
+// .chat.StatusCode status_code = 2;
+inline void Response::clear_status_code() {
+  _impl_.status_code_ = 0;
+}
+inline ::chat::StatusCode Response::_internal_status_code() const {
+  return static_cast< ::chat::StatusCode >(_impl_.status_code_);
+}
+inline ::chat::StatusCode Response::status_code() const {
+  // @@protoc_insertion_point(field_get:chat.Response.status_code)
+  return _internal_status_code();
+}
+inline void Response::_internal_set_status_code(::chat::StatusCode value) {
+  
+  _impl_.status_code_ = value;
+}
+inline void Response::set_status_code(::chat::StatusCode value) {
+  _internal_set_status_code(value);
+  // @@protoc_insertion_point(field_set:chat.Response.status_code)
+}
+
+// string message = 3;
+inline void Response::clear_message() {
+  _impl_.message_.ClearToEmpty();
+}
+inline const std::string& Response::message() const {
+  // @@protoc_insertion_point(field_get:chat.Response.message)
+  return _internal_message();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Response::set_message(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.message_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.Response.message)
+}
+inline std::string* Response::mutable_message() {
+  std::string* _s = _internal_mutable_message();
+  // @@protoc_insertion_point(field_mutable:chat.Response.message)
+  return _s;
+}
+inline const std::string& Response::_internal_message() const {
+  return _impl_.message_.Get();
+}
+inline void Response::_internal_set_message(const std::string& value) {
+  
+  _impl_.message_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Response::_internal_mutable_message() {
+  
+  return _impl_.message_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Response::release_message() {
+  // @@protoc_insertion_point(field_release:chat.Response.message)
+  return _impl_.message_.Release();
+}
+inline void Response::set_allocated_message(std::string* message) {
+  if (message != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.message_.SetAllocated(message, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.message_.IsDefault()) {
+    _impl_.message_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.Response.message)
+}
+
+// .chat.UserListResponse user_list = 4;
+inline bool Response::_internal_has_user_list() const {
+  return result_case() == kUserList;
+}
+inline bool Response::has_user_list() const {
+  return _internal_has_user_list();
+}
+inline void Response::set_has_user_list() {
+  _impl_._oneof_case_[0] = kUserList;
+}
+inline void Response::clear_user_list() {
+  if (_internal_has_user_list()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.result_.user_list_;
+    }
+    clear_has_result();
+  }
+}
+inline ::chat::UserListResponse* Response::release_user_list() {
+  // @@protoc_insertion_point(field_release:chat.Response.user_list)
+  if (_internal_has_user_list()) {
+    clear_has_result();
+    ::chat::UserListResponse* temp = _impl_.result_.user_list_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.result_.user_list_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::chat::UserListResponse& Response::_internal_user_list() const {
+  return _internal_has_user_list()
+      ? *_impl_.result_.user_list_
+      : reinterpret_cast< ::chat::UserListResponse&>(::chat::_UserListResponse_default_instance_);
+}
+inline const ::chat::UserListResponse& Response::user_list() const {
+  // @@protoc_insertion_point(field_get:chat.Response.user_list)
+  return _internal_user_list();
+}
+inline ::chat::UserListResponse* Response::unsafe_arena_release_user_list() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:chat.Response.user_list)
+  if (_internal_has_user_list()) {
+    clear_has_result();
+    ::chat::UserListResponse* temp = _impl_.result_.user_list_;
+    _impl_.result_.user_list_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void Response::unsafe_arena_set_allocated_user_list(::chat::UserListResponse* user_list) {
+  clear_result();
+  if (user_list) {
+    set_has_user_list();
+    _impl_.result_.user_list_ = user_list;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.Response.user_list)
+}
+inline ::chat::UserListResponse* Response::_internal_mutable_user_list() {
+  if (!_internal_has_user_list()) {
+    clear_result();
+    set_has_user_list();
+    _impl_.result_.user_list_ = CreateMaybeMessage< ::chat::UserListResponse >(GetArenaForAllocation());
+  }
+  return _impl_.result_.user_list_;
+}
+inline ::chat::UserListResponse* Response::mutable_user_list() {
+  ::chat::UserListResponse* _msg = _internal_mutable_user_list();
+  // @@protoc_insertion_point(field_mutable:chat.Response.user_list)
+  return _msg;
+}
+
+// .chat.IncomingMessageResponse incoming_message = 5;
+inline bool Response::_internal_has_incoming_message() const {
+  return result_case() == kIncomingMessage;
+}
+inline bool Response::has_incoming_message() const {
+  return _internal_has_incoming_message();
+}
+inline void Response::set_has_incoming_message() {
+  _impl_._oneof_case_[0] = kIncomingMessage;
+}
+inline void Response::clear_incoming_message() {
+  if (_internal_has_incoming_message()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.result_.incoming_message_;
+    }
+    clear_has_result();
+  }
+}
+inline ::chat::IncomingMessageResponse* Response::release_incoming_message() {
+  // @@protoc_insertion_point(field_release:chat.Response.incoming_message)
+  if (_internal_has_incoming_message()) {
+    clear_has_result();
+    ::chat::IncomingMessageResponse* temp = _impl_.result_.incoming_message_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.result_.incoming_message_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::chat::IncomingMessageResponse& Response::_internal_incoming_message() const {
+  return _internal_has_incoming_message()
+      ? *_impl_.result_.incoming_message_
+      : reinterpret_cast< ::chat::IncomingMessageResponse&>(::chat::_IncomingMessageResponse_default_instance_);
+}
+inline const ::chat::IncomingMessageResponse& Response::incoming_message() const {
+  // @@protoc_insertion_point(field_get:chat.Response.incoming_message)
+  return _internal_incoming_message();
+}
+inline ::chat::IncomingMessageResponse* Response::unsafe_arena_release_incoming_message() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:chat.Response.incoming_message)
+  if (_internal_has_incoming_message()) {
+    clear_has_result();
+    ::chat::IncomingMessageResponse* temp = _impl_.result_.incoming_message_;
+    _impl_.result_.incoming_message_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void Response::unsafe_arena_set_allocated_incoming_message(::chat::IncomingMessageResponse* incoming_message) {
+  clear_result();
+  if (incoming_message) {
+    set_has_incoming_message();
+    _impl_.result_.incoming_message_ = incoming_message;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.Response.incoming_message)
+}
+inline ::chat::IncomingMessageResponse* Response::_internal_mutable_incoming_message() {
+  if (!_internal_has_incoming_message()) {
+    clear_result();
+    set_has_incoming_message();
+    _impl_.result_.incoming_message_ = CreateMaybeMessage< ::chat::IncomingMessageResponse >(GetArenaForAllocation());
+  }
+  return _impl_.result_.incoming_message_;
+}
+inline ::chat::IncomingMessageResponse* Response::mutable_incoming_message() {
+  ::chat::IncomingMessageResponse* _msg = _internal_mutable_incoming_message();
+  // @@protoc_insertion_point(field_mutable:chat.Response.incoming_message)
+  return _msg;
+}
+
+// .chat.ServerStats stats = 6;
+inline bool Response::_internal_has_stats() const {
+  return result_case() == kStats;
+}
+inline bool Response::has_stats() const {
+  return _internal_has_stats();
+}
+inline void Response::set_has_stats() {
+  _impl_._oneof_case_[0] = kStats;
+}
+inline void Response::clear_stats() {
+  if (_internal_has_stats()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.result_.stats_;
+    }
+    clear_has_result();
+  }
+}
+inline ::chat::ServerStats* Response::release_stats() {
+  // @@protoc_insertion_point(field_release:chat.Response.stats)
+  if (_internal_has_stats()) {
+    clear_has_result();
+    ::chat::ServerStats* temp = _impl_.result_.stats_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.result_.stats_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::chat::ServerStats& Response::_internal_stats() const {
+  return _internal_has_stats()
+      ? *_impl_.result_.stats_
+      : reinterpret_cast< ::chat::ServerStats&>(::chat::_ServerStats_default_instance_);
+}
+inline const ::chat::ServerStats& Response::stats() const {
+  // @@protoc_insertion_point(field_get:chat.Response.stats)
+  return _internal_stats();
+}
+inline ::chat::ServerStats* Response::unsafe_arena_release_stats() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:chat.Response.stats)
+  if (_internal_has_stats()) {
+    clear_has_result();
+    ::chat::ServerStats* temp = _impl_.result_.stats_;
+    _impl_.result_.stats_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void Response::unsafe_arena_set_allocated_stats(::chat::ServerStats* stats) {
+  clear_result();
+  if (stats) {
+    set_has_stats();
+    _impl_.result_.stats_ = stats;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.Response.stats)
+}
+inline ::chat::ServerStats* Response::_internal_mutable_stats() {
+  if (!_internal_has_stats()) {
+    clear_result();
+    set_has_stats();
+    _impl_.result_.stats_ = CreateMaybeMessage< ::chat::ServerStats >(GetArenaForAllocation());
+  }
+  return _impl_.result_.stats_;
+}
+inline ::chat::ServerStats* Response::mutable_stats() {
+  ::chat::ServerStats* _msg = _internal_mutable_stats();
+  // @@protoc_insertion_point(field_mutable:chat.Response.stats)
+  return _msg;
+}
+
+// .chat.SendMessageBatchResponse message_batch = 7;
+inline bool Response::_internal_has_message_batch() const {
+  return result_case() == kMessageBatch;
+}
+inline bool Response::has_message_batch() const {
+  return _internal_has_message_batch();
+}
+inline void Response::set_has_message_batch() {
+  _impl_._oneof_case_[0] = kMessageBatch;
+}
+inline void Response::clear_message_batch() {
+  if (_internal_has_message_batch()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.result_.message_batch_;
+    }
+    clear_has_result();
+  }
+}
+inline ::chat::SendMessageBatchResponse* Response::release_message_batch() {
+  // @@protoc_insertion_point(field_release:chat.Response.message_batch)
+  if (_internal_has_message_batch()) {
+    clear_has_result();
+    ::chat::SendMessageBatchResponse* temp = _impl_.result_.message_batch_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.result_.message_batch_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::chat::SendMessageBatchResponse& Response::_internal_message_batch() const {
+  return _internal_has_message_batch()
+      ? *_impl_.result_.message_batch_
+      : reinterpret_cast< ::chat::SendMessageBatchResponse&>(::chat::_SendMessageBatchResponse_default_instance_);
+}
+inline const ::chat::SendMessageBatchResponse& Response::message_batch() const {
+  // @@protoc_insertion_point(field_get:chat.Response.message_batch)
+  return _internal_message_batch();
+}
+inline ::chat::SendMessageBatchResponse* Response::unsafe_arena_release_message_batch() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:chat.Response.message_batch)
+  if (_internal_has_message_batch()) {
+    clear_has_result();
+    ::chat::SendMessageBatchResponse* temp = _impl_.result_.message_batch_;
+    _impl_.result_.message_batch_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void Response::unsafe_arena_set_allocated_message_batch(::chat::SendMessageBatchResponse* message_batch) {
+  clear_result();
+  if (message_batch) {
+    set_has_message_batch();
+    _impl_.result_.message_batch_ = message_batch;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.Response.message_batch)
+}
+inline ::chat::SendMessageBatchResponse* Response::_internal_mutable_message_batch() {
+  if (!_internal_has_message_batch()) {
+    clear_result();
+    set_has_message_batch();
+    _impl_.result_.message_batch_ = CreateMaybeMessage< ::chat::SendMessageBatchResponse >(GetArenaForAllocation());
+  }
+  return _impl_.result_.message_batch_;
+}
+inline ::chat::SendMessageBatchResponse* Response::mutable_message_batch() {
+  ::chat::SendMessageBatchResponse* _msg = _internal_mutable_message_batch();
+  // @@protoc_insertion_point(field_mutable:chat.Response.message_batch)
+  return _msg;
+}
+
+// .chat.RoomResponse room = 9;
+inline bool Response::_internal_has_room() const {
+  return result_case() == kRoom;
+}
+inline bool Response::has_room() const {
+  return _internal_has_room();
+}
+inline void Response::set_has_room() {
+  _impl_._oneof_case_[0] = kRoom;
+}
+inline void Response::clear_room() {
+  if (_internal_has_room()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.result_.room_;
+    }
+    clear_has_result();
+  }
+}
+inline ::chat::RoomResponse* Response::release_room() {
+  // @@protoc_insertion_point(field_release:chat.Response.room)
+  if (_internal_has_room()) {
+    clear_has_result();
+    ::chat::RoomResponse* temp = _impl_.result_.room_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.result_.room_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::chat::RoomResponse& Response::_internal_room() const {
+  return _internal_has_room()
+      ? *_impl_.result_.room_
+      : reinterpret_cast< ::chat::RoomResponse&>(::chat::_RoomResponse_default_instance_);
+}
+inline const ::chat::RoomResponse& Response::room() const {
+  // @@protoc_insertion_point(field_get:chat.Response.room)
+  return _internal_room();
+}
+inline ::chat::RoomResponse* Response::unsafe_arena_release_room() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:chat.Response.room)
+  if (_internal_has_room()) {
+    clear_has_result();
+    ::chat::RoomResponse* temp = _impl_.result_.room_;
+    _impl_.result_.room_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void Response::unsafe_arena_set_allocated_room(::chat::RoomResponse* room) {
+  clear_result();
+  if (room) {
+    set_has_room();
+    _impl_.result_.room_ = room;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.Response.room)
+}
+inline ::chat::RoomResponse* Response::_internal_mutable_room() {
+  if (!_internal_has_room()) {
+    clear_result();
+    set_has_room();
+    _impl_.result_.room_ = CreateMaybeMessage< ::chat::RoomResponse >(GetArenaForAllocation());
+  }
+  return _impl_.result_.room_;
+}
+inline ::chat::RoomResponse* Response::mutable_room() {
+  ::chat::RoomResponse* _msg = _internal_mutable_room();
+  // @@protoc_insertion_point(field_mutable:chat.Response.room)
+  return _msg;
+}
+
+// .chat.PresenceUpdate presence = 12;
+inline bool Response::_internal_has_presence() const {
+  return result_case() == kPresence;
+}
+inline bool Response::has_presence() const {
+  return _internal_has_presence();
+}
+inline void Response::set_has_presence() {
+  _impl_._oneof_case_[0] = kPresence;
+}
+inline void Response::clear_presence() {
+  if (_internal_has_presence()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.result_.presence_;
+    }
+    clear_has_result();
+  }
+}
+inline ::chat::PresenceUpdate* Response::release_presence() {
+  // @@protoc_insertion_point(field_release:chat.Response.presence)
+  if (_internal_has_presence()) {
+    clear_has_result();
+    ::chat::PresenceUpdate* temp = _impl_.result_.presence_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.result_.presence_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::chat::PresenceUpdate& Response::_internal_presence() const {
+  return _internal_has_presence()
+      ? *_impl_.result_.presence_
+      : reinterpret_cast< ::chat::PresenceUpdate&>(::chat::_PresenceUpdate_default_instance_);
+}
+inline const ::chat::PresenceUpdate& Response::presence() const {
+  // @@protoc_insertion_point(field_get:chat.Response.presence)
+  return _internal_presence();
+}
+inline ::chat::PresenceUpdate* Response::unsafe_arena_release_presence() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:chat.Response.presence)
+  if (_internal_has_presence()) {
+    clear_has_result();
+    ::chat::PresenceUpdate* temp = _impl_.result_.presence_;
+    _impl_.result_.presence_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void Response::unsafe_arena_set_allocated_presence(::chat::PresenceUpdate* presence) {
+  clear_result();
+  if (presence) {
+    set_has_presence();
+    _impl_.result_.presence_ = presence;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.Response.presence)
+}
+inline ::chat::PresenceUpdate* Response::_internal_mutable_presence() {
+  if (!_internal_has_presence()) {
+    clear_result();
+    set_has_presence();
+    _impl_.result_.presence_ = CreateMaybeMessage< ::chat::PresenceUpdate >(GetArenaForAllocation());
+  }
+  return _impl_.result_.presence_;
+}
+inline ::chat::PresenceUpdate* Response::mutable_presence() {
+  ::chat::PresenceUpdate* _msg = _internal_mutable_presence();
+  // @@protoc_insertion_point(field_mutable:chat.Response.presence)
+  return _msg;
+}
+
+// .chat.FileTransfer transfer = 15;
+inline bool Response::_internal_has_transfer() const {
+  return result_case() == kTransfer;
+}
+inline bool Response::has_transfer() const {
+  return _internal_has_transfer();
+}
+inline void Response::set_has_transfer() {
+  _impl_._oneof_case_[0] = kTransfer;
+}
+inline void Response::clear_transfer() {
+  if (_internal_has_transfer()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.result_.transfer_;
+    }
+    clear_has_result();
+  }
+}
+inline ::chat::FileTransfer* Response::release_transfer() {
+  // @@protoc_insertion_point(field_release:chat.Response.transfer)
+  if (_internal_has_transfer()) {
+    clear_has_result();
+    ::chat::FileTransfer* temp = _impl_.result_.transfer_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.result_.transfer_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::chat::FileTransfer& Response::_internal_transfer() const {
+  return _internal_has_transfer()
+      ? *_impl_.result_.transfer_
+      : reinterpret_cast< ::chat::FileTransfer&>(::chat::_FileTransfer_default_instance_);
+}
+inline const ::chat::FileTransfer& Response::transfer() const {
+  // @@protoc_insertion_point(field_get:chat.Response.transfer)
+  return _internal_transfer();
+}
+inline ::chat::FileTransfer* Response::unsafe_arena_release_transfer() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:chat.Response.transfer)
+  if (_internal_has_transfer()) {
+    clear_has_result();
+    ::chat::FileTransfer* temp = _impl_.result_.transfer_;
+    _impl_.result_.transfer_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void Response::unsafe_arena_set_allocated_transfer(::chat::FileTransfer* transfer) {
+  clear_result();
+  if (transfer) {
+    set_has_transfer();
+    _impl_.result_.transfer_ = transfer;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:chat.Response.transfer)
+}
+inline ::chat::FileTransfer* Response::_internal_mutable_transfer() {
+  if (!_internal_has_transfer()) {
+    clear_result();
+    set_has_transfer();
+    _impl_.result_.transfer_ = CreateMaybeMessage< ::chat::FileTransfer >(GetArenaForAllocation());
+  }
+  return _impl_.result_.transfer_;
+}
+inline ::chat::FileTransfer* Response::mutable_transfer() {
+  ::chat::FileTransfer* _msg = _internal_mutable_transfer();
+  // @@protoc_insertion_point(field_mutable:chat.Response.transfer)
+  return _msg;
+}
+
+// repeated .chat.IncomingMessageResponse incoming_messages = 8;
+inline int Response::_internal_incoming_messages_size() const {
+  return _impl_.incoming_messages_.size();
+}
+inline int Response::incoming_messages_size() const {
+  return _internal_incoming_messages_size();
+}
+inline void Response::clear_incoming_messages() {
+  _impl_.incoming_messages_.Clear();
+}
+inline ::chat::IncomingMessageResponse* Response::mutable_incoming_messages(int index) {
+  // @@protoc_insertion_point(field_mutable:chat.Response.incoming_messages)
+  return _impl_.incoming_messages_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::IncomingMessageResponse >*
+Response::mutable_incoming_messages() {
+  // @@protoc_insertion_point(field_mutable_list:chat.Response.incoming_messages)
+  return &_impl_.incoming_messages_;
+}
+inline const ::chat::IncomingMessageResponse& Response::_internal_incoming_messages(int index) const {
+  return _impl_.incoming_messages_.Get(index);
+}
+inline const ::chat::IncomingMessageResponse& Response::incoming_messages(int index) const {
+  // @@protoc_insertion_point(field_get:chat.Response.incoming_messages)
+  return _internal_incoming_messages(index);
+}
+inline ::chat::IncomingMessageResponse* Response::_internal_add_incoming_messages() {
+  return _impl_.incoming_messages_.Add();
+}
+inline ::chat::IncomingMessageResponse* Response::add_incoming_messages() {
+  ::chat::IncomingMessageResponse* _add = _internal_add_incoming_messages();
+  // @@protoc_insertion_point(field_add:chat.Response.incoming_messages)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::chat::IncomingMessageResponse >&
+Response::incoming_messages() const {
+  // @@protoc_insertion_point(field_list:chat.Response.incoming_messages)
+  return _impl_.incoming_messages_;
+}
+
+// uint32 compression_threshold = 10;
+inline void Response::clear_compression_threshold() {
+  _impl_.compression_threshold_ = 0u;
+}
+inline uint32_t Response::_internal_compression_threshold() const {
+  return _impl_.compression_threshold_;
+}
+inline uint32_t Response::compression_threshold() const {
+  // @@protoc_insertion_point(field_get:chat.Response.compression_threshold)
+  return _internal_compression_threshold();
+}
+inline void Response::_internal_set_compression_threshold(uint32_t value) {
+  
+  _impl_.compression_threshold_ = value;
+}
+inline void Response::set_compression_threshold(uint32_t value) {
+  _internal_set_compression_threshold(value);
+  // @@protoc_insertion_point(field_set:chat.Response.compression_threshold)
+}
+
+// uint64 request_id = 11;
+inline void Response::clear_request_id() {
+  _impl_.request_id_ = uint64_t{0u};
+}
+inline uint64_t Response::_internal_request_id() const {
+  return _impl_.request_id_;
+}
+inline uint64_t Response::request_id() const {
+  // @@protoc_insertion_point(field_get:chat.Response.request_id)
+  return _internal_request_id();
+}
+inline void Response::_internal_set_request_id(uint64_t value) {
+  
+  _impl_.request_id_ = value;
+}
+inline void Response::set_request_id(uint64_t value) {
+  _internal_set_request_id(value);
+  // @@protoc_insertion_point(field_set:chat.Response.request_id)
+}
+
+// uint64 user_id = 13;
+inline void Response::clear_user_id() {
+  _impl_.user_id_ = uint64_t{0u};
+}
+inline uint64_t Response::_internal_user_id() const {
+  return _impl_.user_id_;
+}
+inline uint64_t Response::user_id() const {
+  // @@protoc_insertion_point(field_get:chat.Response.user_id)
+  return _internal_user_id();
+}
+inline void Response::_internal_set_user_id(uint64_t value) {
+  
+  _impl_.user_id_ = value;
+}
+inline void Response::set_user_id(uint64_t value) {
+  _internal_set_user_id(value);
+  // @@protoc_insertion_point(field_set:chat.Response.user_id)
+}
+
+// bytes resume_token = 14;
+inline void Response::clear_resume_token() {
+  _impl_.resume_token_.ClearToEmpty();
+}
+inline const std::string& Response::resume_token() const {
+  // @@protoc_insertion_point(field_get:chat.Response.resume_token)
+  return _internal_resume_token();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Response::set_resume_token(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.resume_token_.SetBytes(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:chat.Response.resume_token)
+}
+inline std::string* Response::mutable_resume_token() {
+  std::string* _s = _internal_mutable_resume_token();
+  // @@protoc_insertion_point(field_mutable:chat.Response.resume_token)
+  return _s;
+}
+inline const std::string& Response::_internal_resume_token() const {
+  return _impl_.resume_token_.Get();
+}
+inline void Response::_internal_set_resume_token(const std::string& value) {
+  
+  _impl_.resume_token_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Response::_internal_mutable_resume_token() {
+  
+  return _impl_.resume_token_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Response::release_resume_token() {
+  // @@protoc_insertion_point(field_release:chat.Response.resume_token)
+  return _impl_.resume_token_.Release();
+}
+inline void Response::set_allocated_resume_token(std::string* resume_token) {
+  if (resume_token != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.resume_token_.SetAllocated(resume_token, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.resume_token_.IsDefault()) {
+    _impl_.resume_token_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:chat.Response.resume_token)
+}
+
+inline bool Response::has_result() const {
+  return result_case() != RESULT_NOT_SET;
+}
+inline void Response::clear_has_result() {
+  _impl_._oneof_case_[0] = RESULT_NOT_SET;
+}
+inline Response::ResultCase Response::result_case() const {
+  return Response::ResultCase(_impl_._oneof_case_[0]);
+}
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace chat
+
+PROTOBUF_NAMESPACE_OPEN
+
+template <> struct is_proto_enum< ::chat::UserStatus> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::chat::UserStatus>() {
+  return ::chat::UserStatus_descriptor();
+}
+template <> struct is_proto_enum< ::chat::MessageType> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::chat::MessageType>() {
+  return ::chat::MessageType_descriptor();
+}
+template <> struct is_proto_enum< ::chat::UserListType> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::chat::UserListType>() {
+  return ::chat::UserListType_descriptor();
+}
+template <> struct is_proto_enum< ::chat::PresenceChange> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::chat::PresenceChange>() {
+  return ::chat::PresenceChange_descriptor();
+}
+template <> struct is_proto_enum< ::chat::Operation> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::chat::Operation>() {
+  return ::chat::Operation_descriptor();
+}
+template <> struct is_proto_enum< ::chat::StatusCode> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::chat::StatusCode>() {
+  return ::chat::StatusCode_descriptor();
+}
+
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_chat_2eproto
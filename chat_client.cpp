@@ -0,0 +1,319 @@
+#include "chat_client.h"
+
+#include <memory>
+#include <thread>
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/eventfd.h>
+
+ChatClient::ChatClient()
+    : port_(0), sock_(-1), wakeup_fd_(-1), started_(false), connected_(false), closing_(false), next_request_id_(1),
+      compress_threshold_(0),
+      outbox_([this](chat::Request& request) { return send(request, nullptr); }, kBatchMessages, kBatchBytes,
+              kBatchWindowMs) {
+    pthread_mutex_init(&write_mutex_, NULL);
+    pthread_mutex_init(&pending_mutex_, NULL);
+}
+
+ChatClient::~ChatClient() {
+    close();
+    pthread_mutex_destroy(&write_mutex_);
+    pthread_mutex_destroy(&pending_mutex_);
+}
+
+bool ChatClient::connect(const std::string& host, int port, const std::string& username, chat::Response* answer,
+                         int timeout_ms) {
+    answer->Clear();
+    host_ = host;
+    port_ = port;
+    if (!open(answer)) {
+        return false;
+    }
+
+    chat::Request request;
+    request.set_operation(chat::Operation::REGISTER_USER);
+    request.mutable_register_user()->set_username(username);
+    request.mutable_register_user()->set_accept_batched_delivery(true);
+    request.mutable_register_user()->set_accept_compression(true);
+    std::future<chat::Response> reply = call(request);
+    if (reply.wait_for(std::chrono::milliseconds(timeout_ms)) != std::future_status::ready) {
+        answer->set_message("Registration timed out");
+        close();
+        return false;
+    }
+    *answer = reply.get();
+    if (answer->status_code() != chat::StatusCode::OK) {
+        close();
+        return false;
+    }
+    compress_threshold_ = answer->compression_threshold();
+    resume_token_ = answer->resume_token();
+    return true;
+}
+
+bool ChatClient::resume(chat::Response* answer, int timeout_ms) {
+    close();
+    answer->Clear();
+    if (resume_token_.empty()) {
+        answer->set_message("No session to resume");
+        return false;
+    }
+    auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout_ms);
+    while (open(answer)) {
+        chat::Request request;
+        request.set_operation(chat::Operation::RESUME);
+        request.mutable_resume()->set_token(resume_token_);
+        std::future<chat::Response> reply = call(request);
+        if (reply.wait_until(deadline) != std::future_status::ready) {
+            answer->set_message("Resume timed out");
+            close();
+            return false;
+        }
+        *answer = reply.get();
+        if (answer->status_code() == chat::StatusCode::OK) {
+            compress_threshold_ = answer->compression_threshold();
+            resume_token_ = answer->resume_token();
+            return true;
+        }
+        close();
+        if (answer->status_code() != chat::StatusCode::CONFLICT || std::chrono::steady_clock::now() >= deadline) {
+            break;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    }
+    return false;
+}
+
+// Connects to host_:port_ and starts the I/O thread.
+bool ChatClient::open(chat::Response* answer) {
+    sockaddr_in address = {};
+    address.sin_family = AF_INET;
+    address.sin_port = htons(port_);
+    if (inet_pton(AF_INET, host_.c_str(), &address.sin_addr) <= 0) {
+        answer->set_message("Invalid address");
+        return false;
+    }
+    sock_ = socket(AF_INET, SOCK_STREAM, 0);
+    if (sock_ < 0 || ::connect(sock_, (sockaddr*)&address, sizeof(address)) < 0) {
+        answer->set_message("Connection failed");
+        if (sock_ >= 0) {
+            ::close(sock_);
+            sock_ = -1;
+        }
+        return false;
+    }
+    int one = 1;
+    setsockopt(sock_, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+    fcntl(sock_, F_SETFL, fcntl(sock_, F_GETFL, 0) | O_NONBLOCK);
+    wakeup_fd_ = eventfd(0, EFD_NONBLOCK);
+    inbound_.reset();  // The rest of a frame from a previous connection.
+
+    closing_ = false;
+    connected_ = true;
+    started_ = pthread_create(&thread_, NULL, io_thread, this) == 0;
+    if (!started_) {
+        connected_ = false;
+        answer->set_message("Could not start the I/O thread");
+        return false;
+    }
+    return true;
+}
+
+bool ChatClient::send(chat::Request& request, ResponseCallback callback) {
+    pthread_mutex_lock(&write_mutex_);
+    uint64_t id = next_request_id_++;
+    request.set_request_id(id);
+
+    // Registered before writing: the answer may arrive before write returns.
+    // The I/O thread clears connected_ under the same lock before failing
+    // what is pending, so nothing registered here is ever missed.
+    pthread_mutex_lock(&pending_mutex_);
+    bool open = connected_.load();
+    if (open && callback) {
+        pending_[id] = callback;
+    }
+    pthread_mutex_unlock(&pending_mutex_);
+
+    bool ok = false;
+    if (open) {
+        serialize_frame(request, &frame_);
+        const std::string& frame = compress_frame(frame_, compress_threshold_, Z_BEST_SPEED, &compressed_) ? compressed_ : frame_;
+        ok = write_all(sock_, frame.data(), frame.size());
+    }
+    pthread_mutex_unlock(&write_mutex_);
+    if (ok || !callback) {
+        return ok;
+    }
+
+    // Not sent. Unless the I/O thread already failed it, answer it here.
+    pthread_mutex_lock(&pending_mutex_);
+    bool owned = !open || pending_.erase(id) > 0;
+    pthread_mutex_unlock(&pending_mutex_);
+    if (owned) {
+        chat::Response failure;
+        failure.set_operation(request.operation());
+        failure.set_request_id(id);
+        failure.set_message("Not connected");
+        callback(failure);
+    }
+    return false;
+}
+
+std::future<chat::Response> ChatClient::call(chat::Request& request) {
+    std::shared_ptr<std::promise<chat::Response>> promise = std::make_shared<std::promise<chat::Response>>();
+    std::future<chat::Response> future = promise->get_future();
+    send(request, [promise](const chat::Response& response) { promise->set_value(response); });
+    return future;
+}
+
+bool ChatClient::send_message(const std::string& recipient, const std::string& content, const std::string& room) {
+    // The I/O thread only times the batch window once it knows a batch is open.
+    bool opens_batch = outbox_.due_in_ms() < 0;
+    bool ok = outbox_.add(recipient, content, room);
+    if (opens_batch) {
+        wake();
+    }
+    return ok;
+}
+
+void ChatClient::flush() {
+    outbox_.flush();
+}
+
+bool ChatClient::send_chunk(uint64_t transfer_id, const char* data, size_t size) {
+    if (size > kMaxChunkData) {
+        return false;
+    }
+    pthread_mutex_lock(&write_mutex_);
+    bool ok = connected_.load();
+    if (ok) {
+        chunk_.resize(kFrameHeaderSize + kChunkHeaderSize);
+        write_chunk_header(&chunk_[0], transfer_id, static_cast<uint32_t>(size));
+        chunk_.append(data, size);
+        ok = write_all(sock_, chunk_.data(), chunk_.size());
+    }
+    pthread_mutex_unlock(&write_mutex_);
+    return ok;
+}
+
+void ChatClient::close() {
+    if (!started_) {
+        return;
+    }
+    outbox_.flush();
+    closing_ = true;
+    wake();
+    pthread_join(thread_, NULL);
+    started_ = false;
+    ::close(sock_);
+    ::close(wakeup_fd_);
+    sock_ = wakeup_fd_ = -1;
+}
+
+void ChatClient::wake() {
+    uint64_t one = 1;
+    write(wakeup_fd_, &one, sizeof(one));
+}
+
+void* ChatClient::io_thread(void* client) {
+    static_cast<ChatClient*>(client)->run();
+    return NULL;
+}
+
+void ChatClient::run() {
+    while (!closing_) {
+        pollfd fds[2] = {{sock_, POLLIN, 0}, {wakeup_fd_, POLLIN, 0}};
+        int ready = poll(fds, 2, outbox_.due_in_ms());
+        if (ready < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            break;
+        }
+        if (fds[1].revents & POLLIN) {
+            uint64_t count;
+            read(wakeup_fd_, &count, sizeof(count));
+        }
+        outbox_.flush_if_due();
+        if (fds[0].revents & (POLLIN | POLLHUP | POLLERR)) {
+            ssize_t bytes_read = inbound_.read_from(sock_);
+            if (bytes_read == 0 || (bytes_read < 0 && errno != EAGAIN && errno != EINTR)) {
+                break;
+            }
+            const char* payload;
+            uint32_t size;
+            bool chunk;
+            chat::Response response;
+            while (inbound_.next_frame(&payload, &size, &chunk)) {
+                if (chunk) {
+                    if (chunk_handler_) {
+                        chunk_handler_(read_chunk_transfer(payload), payload + kChunkHeaderSize, size - kChunkHeaderSize);
+                    }
+                } else if (response.ParseFromArray(payload, size)) {
+                    dispatch(response);
+                }
+            }
+            if (inbound_.error()) {
+                break;
+            }
+        }
+    }
+    fail_pending();
+    if (!closing_ && disconnect_handler_) {
+        disconnect_handler_();
+    }
+}
+
+void ChatClient::dispatch(const chat::Response& response) {
+    if (response.operation() == chat::Operation::INCOMING_MESSAGE) {
+        if (message_handler_) {
+            message_handler_(response.incoming_message());
+        }
+        return;
+    }
+    if (response.operation() == chat::Operation::INCOMING_MESSAGE_BATCH) {
+        if (message_handler_) {
+            for (const chat::IncomingMessageResponse& message : response.incoming_messages()) {
+                message_handler_(message);
+            }
+        }
+        return;
+    }
+
+    ResponseCallback callback;
+    if (response.request_id() != 0) {
+        pthread_mutex_lock(&pending_mutex_);
+        auto it = pending_.find(response.request_id());
+        if (it != pending_.end()) {
+            callback.swap(it->second);
+            pending_.erase(it);
+        }
+        pthread_mutex_unlock(&pending_mutex_);
+    }
+    if (callback) {
+        callback(response);
+    } else if (response_handler_) {
+        response_handler_(response);
+    }
+}
+
+// Answers every request still waiting once the connection is gone.
+void ChatClient::fail_pending() {
+    std::unordered_map<uint64_t, ResponseCallback> waiting;
+    pthread_mutex_lock(&pending_mutex_);
+    connected_ = false;
+    waiting.swap(pending_);
+    pthread_mutex_unlock(&pending_mutex_);
+
+    chat::Response failure;
+    failure.set_message("Connection closed");
+    for (auto& entry : waiting) {
+        failure.set_request_id(entry.first);
+        entry.second(failure);
+    }
+}
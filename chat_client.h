@@ -0,0 +1,131 @@
+#ifndef CHAT_CLIENT_H
+#define CHAT_CLIENT_H
+
+// Asynchronous client for the chat server, usable as a library.
+//
+// One I/O thread owns the read side of the socket. It splits the stream
+// into frames and hands each response to whoever sent the request, matched
+// by request_id, so any number of requests can be in flight at once, from
+// any thread:
+//
+//     ChatClient client;
+//     client.set_message_handler([](const chat::IncomingMessageResponse& m) { ... });
+//     client.connect("127.0.0.1", 8080, "alice", &answer);
+//     client.send(request, [](const chat::Response& r) { ... });  // callback
+//     chat::Response users = client.call(list_request).get();        // future
+//
+// Deliveries (INCOMING_MESSAGE and INCOMING_MESSAGE_BATCH, unpacked) go to
+// the message handler, file data (see FileOffer in chat.proto) to the chunk
+// handler, and responses sent without a callback (such as the answers to
+// coalesced chat messages, or the FILE_* notices) go to the response
+// handler. All of these run on the I/O thread, so they must not wait for
+// another response.
+
+#include <atomic>
+#include <functional>
+#include <future>
+#include <string>
+#include <unordered_map>
+#include <pthread.h>
+#include "chat.pb.h"
+#include "framing.h"
+#include "batcher.h"
+
+class ChatClient {
+public:
+    typedef std::function<void(const chat::Response&)> ResponseCallback;
+    typedef std::function<void(const chat::IncomingMessageResponse&)> MessageHandler;
+    typedef std::function<void(uint64_t transfer_id, const char* data, size_t size)> ChunkHandler;
+
+    ChatClient();
+    ~ChatClient();
+
+    ChatClient(const ChatClient&) = delete;
+    ChatClient& operator=(const ChatClient&) = delete;
+
+    // Handlers must be set before connect().
+    void set_message_handler(MessageHandler handler) { message_handler_ = handler; }
+    void set_response_handler(ResponseCallback handler) { response_handler_ = handler; }
+    void set_disconnect_handler(std::function<void()> handler) { disconnect_handler_ = handler; }
+    void set_chunk_handler(ChunkHandler handler) { chunk_handler_ = handler; }
+
+    // Connects, starts the I/O thread and registers `username`, waiting up
+    // to timeout_ms for the answer, which is stored in `answer`. Returns
+    // true once registered.
+    bool connect(const std::string& host, int port, const std::string& username, chat::Response* answer,
+                 int timeout_ms = 5000);
+
+    // Once the connection dropped: connects again and resumes the session
+    // with the token from the last REGISTER_USER or RESUME answer, so the
+    // name, rooms and presence subscription carry over and what was sent
+    // meanwhile arrives. While the server still holds the old connection
+    // (CONFLICT) it retries until timeout_ms runs out. Returns true once
+    // resumed; false means registering again.
+    bool resume(chat::Response* answer, int timeout_ms = 5000);
+
+    // Sends `request`, assigning its request_id. `callback` runs exactly
+    // once: with the response, or with an UNKNOWN_STATUS response if the
+    // connection is lost first (on the calling thread if the request could
+    // not even be written). Returns false in that last case.
+    bool send(chat::Request& request, ResponseCallback callback);
+
+    // Like send(), but the response arrives through a future.
+    std::future<chat::Response> call(chat::Request& request);
+
+    // Queues a chat message; messages sent within a few milliseconds of each
+    // other go out as one SEND_MESSAGE_BATCH. The answers go to the response
+    // handler.
+    bool send_message(const std::string& recipient, const std::string& content, const std::string& room = "");
+    void flush();
+
+    // Sends up to kMaxChunkData bytes of a transfer's data, within the
+    // window the recipient granted.
+    bool send_chunk(uint64_t transfer_id, const char* data, size_t size);
+
+    bool connected() const { return connected_.load(); }
+
+    // Flushes pending messages and disconnects. Must not be called from a
+    // handler.
+    void close();
+
+private:
+    static const size_t kBatchMessages = 64;
+    static const size_t kBatchBytes = 16 * 1024;
+    static const int kBatchWindowMs = 10;
+
+    bool open(chat::Response* answer);
+    static void* io_thread(void* client);
+    void run();
+    void dispatch(const chat::Response& response);
+    void fail_pending();
+    void wake();
+
+    std::string host_;
+    int port_;
+    std::string resume_token_;  // From the last REGISTER_USER or RESUME answer.
+    int sock_;
+    int wakeup_fd_;
+    pthread_t thread_;
+    bool started_;
+    std::atomic<bool> connected_;
+    std::atomic<bool> closing_;
+
+    pthread_mutex_t write_mutex_;  // Serializes whole frames onto the socket.
+    uint64_t next_request_id_;
+    size_t compress_threshold_;  // From the REGISTER_USER answer.
+    std::string frame_;
+    std::string compressed_;
+    std::string chunk_;
+
+    pthread_mutex_t pending_mutex_;
+    std::unordered_map<uint64_t, ResponseCallback> pending_;
+
+    FrameBuffer inbound_;  // I/O thread only.
+    MessageBatcher outbox_;
+    MessageHandler message_handler_;
+    ChunkHandler chunk_handler_;
+    ResponseCallback response_handler_;
+    std::function<void()> disconnect_handler_;
+};
+
+#endif
@@ -1,23 +1,60 @@
 #include <iostream>
 #include <string>
+#include <chrono>
+#include <future>
+#include <cstdlib>
+#include <cstdio>
+#include <mutex>
 #include <unordered_map>
-#include <pthread.h>
-#include <netinet/in.h>
-#include <unistd.h>
-#include <arpa/inet.h>
-#include <fcntl.h>
 #include "chat.pb.h"
+#include "chat_client.h"
 
-void broadcast_message(int sock);
-void send_private_message(int sock);
-void change_status(int sock);
-void list_users(int sock);
-void display_user_info(int sock);
+void broadcast_message();
+void send_private_message();
+void change_status();
+void list_users();
+void display_user_info();
 void display_help();
-void exit_chat(int sock);
+void exit_chat();
+void show_server_stats();
+void join_room();
+void leave_room();
+void send_room_message();
+void toggle_presence();
+void send_file();
+void answer_file_offer();
 
 std::string username;
-pthread_mutex_t lock;
+
+// Owns the connection. Its I/O thread prints incoming messages as they
+// arrive while the menu waits for the answers to its own requests.
+ChatClient chat_client;
+const int kResponseTimeoutMs = 5000;
+bool following_presence = false;
+
+// File transfers. The data is read and written on the client's I/O thread,
+// as the recipient's window and the chunks arrive, so the menu stays usable
+// while a file goes through.
+const uint64_t kFileWindow = 1024 * 1024;  // Bytes granted to a sender at a time.
+
+struct OutgoingFile {
+    FILE* file;
+    std::string name;
+    uint64_t left;
+};
+
+struct IncomingFile {
+    FILE* file;
+    std::string path;
+    uint64_t size;
+    uint64_t received;
+    uint64_t unacknowledged;  // Received since the last window granted.
+};
+
+std::mutex files_mutex;
+std::unordered_map<uint64_t, OutgoingFile> outgoing_files;
+std::unordered_map<uint64_t, chat::FileTransfer> file_offers;  // Not answered yet.
+std::unordered_map<uint64_t, IncomingFile> incoming_files;
 
 
 void display_help() {
@@ -29,20 +66,138 @@ void display_help() {
     std::cout << "5. Display user information: Get detailed information about a specific user." << std::endl;
     std::cout << "6. Help: Display this help message." << std::endl;
     std::cout << "7. Exit: Leave the chat application." << std::endl;
+    std::cout << "8. Server statistics: Show the server's request counts, latencies and traffic." << std::endl;
+    std::cout << "9. Join a room: Start receiving the messages sent to a room." << std::endl;
+    std::cout << "10. Leave a room: Stop receiving a room's messages." << std::endl;
+    std::cout << "11. Send to a room: Send a message to everyone in a room you joined." << std::endl;
+    std::cout << "12. Follow presence: Get notified as users join, leave or change status (choose again to stop)." << std::endl;
+    std::cout << "13. Send a file: Offer a file to a user; it is sent once they accept." << std::endl;
+    std::cout << "14. Answer a file offer: Accept (saving it as received_<name>) or decline a file offered to you." << std::endl;
+}
+
+void print_incoming_message(const chat::IncomingMessageResponse& msg) {
+    std::string message_type = (msg.type() == chat::MessageType::BROADCAST) ? "Broadcast" : "Direct";
+    if (msg.type() == chat::MessageType::ROOM) {
+        message_type = "Room " + msg.room();
+    }
+    std::cout << "-----New Message Incoming-----\n";
+    std::cout << "From: " << msg.sender() << "\n";
+    std::cout << "Type: " << message_type << "\n";
+    std::cout << "Content: " << msg.content() << "\n";
+    std::cout << "----------------------\n";
+}
+
+// Sends as much of an outgoing file as the recipient just allowed.
+void send_file_data(uint64_t transfer_id, uint64_t window) {
+    std::lock_guard<std::mutex> lock(files_mutex);
+    auto it = outgoing_files.find(transfer_id);
+    if (it == outgoing_files.end()) {
+        return;
+    }
+    OutgoingFile& outgoing = it->second;
+    static char buffer[kMaxChunkData];
+    window = std::min(window, outgoing.left);
+    while (window > 0) {
+        size_t size = fread(buffer, 1, std::min<uint64_t>(window, sizeof(buffer)), outgoing.file);
+        if (size == 0 || !chat_client.send_chunk(transfer_id, buffer, size)) {
+            std::cout << "Could not send " << outgoing.name << std::endl;
+            chat::Request request;
+            request.set_operation(chat::Operation::FILE_CANCEL);
+            request.mutable_file_window()->set_transfer_id(transfer_id);
+            chat_client.send(request, nullptr);
+            fclose(outgoing.file);
+            outgoing_files.erase(it);
+            return;
+        }
+        window -= size;
+        outgoing.left -= size;
+    }
+    if (outgoing.left == 0) {
+        std::cout << "File sent: " << outgoing.name << std::endl;
+        fclose(outgoing.file);
+        outgoing_files.erase(it);
+    }
+}
+
+void receive_file_data(uint64_t transfer_id, const char* data, size_t size) {
+    std::lock_guard<std::mutex> lock(files_mutex);
+    auto it = incoming_files.find(transfer_id);
+    if (it == incoming_files.end()) {
+        return;  // Cancelled.
+    }
+    IncomingFile& incoming = it->second;
+    fwrite(data, 1, size, incoming.file);
+    incoming.received += size;
+    incoming.unacknowledged += size;
+    if (incoming.received >= incoming.size) {
+        std::cout << "File received: " << incoming.path << " (" << incoming.received << " bytes)" << std::endl;
+        fclose(incoming.file);
+        incoming_files.erase(it);
+    } else if (incoming.unacknowledged >= kFileWindow / 2) {
+        chat::Request request;
+        request.set_operation(chat::Operation::FILE_WINDOW);
+        request.mutable_file_window()->set_transfer_id(transfer_id);
+        request.mutable_file_window()->set_bytes(incoming.unacknowledged);
+        incoming.unacknowledged = 0;
+        chat_client.send(request, nullptr);
+    }
+}
+
+void end_file_transfer(const chat::FileTransfer& transfer, const std::string& reason) {
+    std::lock_guard<std::mutex> lock(files_mutex);
+    std::cout << "Transfer of " << transfer.name() << " ended: " << reason << std::endl;
+    file_offers.erase(transfer.transfer_id());
+    auto outgoing = outgoing_files.find(transfer.transfer_id());
+    if (outgoing != outgoing_files.end()) {
+        fclose(outgoing->second.file);
+        outgoing_files.erase(outgoing);
+    }
+    auto incoming = incoming_files.find(transfer.transfer_id());
+    if (incoming != incoming_files.end()) {
+        fclose(incoming->second.file);
+        remove(incoming->second.path.c_str());
+        incoming_files.erase(incoming);
+    }
 }
 
 void handle_response(const chat::Response& response) {
     switch (response.operation()) {
-        case chat::Operation::INCOMING_MESSAGE: {
-            const chat::IncomingMessageResponse& msg = response.incoming_message();
-            std::string message_type = (msg.type() == chat::MessageType::BROADCAST) ? "Broadcast" : "Direct";
-            std::cout << "-----New Message Incoming-----\n";
-            std::cout << "From: " << msg.sender() << "\n";
-            std::cout << "Type: " << message_type << "\n";
-            std::cout << "Content: " << msg.content() << "\n";
+        case chat::Operation::FILE_OFFER: {
+            const chat::FileTransfer& offer = response.transfer();
+            {
+                std::lock_guard<std::mutex> lock(files_mutex);
+                file_offers[offer.transfer_id()] = offer;
+            }
+            std::cout << "-----File Offered-----\n";
+            std::cout << "From: " << offer.sender() << "\n";
+            std::cout << "File: " << offer.name() << " (" << offer.size() << " bytes)\n";
+            std::cout << "Choose 14 to accept or decline it.\n";
             std::cout << "----------------------\n";
             break;
         }
+        case chat::Operation::FILE_WINDOW:
+            send_file_data(response.transfer().transfer_id(), response.transfer().window());
+            break;
+        case chat::Operation::FILE_CANCEL:
+            end_file_transfer(response.transfer(), response.message());
+            break;
+        case chat::Operation::INCOMING_MESSAGE:
+            print_incoming_message(response.incoming_message());
+            break;
+        case chat::Operation::INCOMING_MESSAGE_BATCH:
+            for (const chat::IncomingMessageResponse& msg : response.incoming_messages()) {
+                print_incoming_message(msg);
+            }
+            break;
+        case chat::Operation::SEND_MESSAGE_BATCH: {
+            int failed = 0;
+            for (int result : response.message_batch().results()) {
+                failed += result != chat::StatusCode::OK;
+            }
+            std::cout << "Messages sent: " << response.message_batch().results_size() - failed
+                      << ", failed: " << failed << std::endl;
+            break;
+        }
         case chat::Operation::GET_USERS:
             if (!response.user_list().users().empty()) {
                 const auto& first_user = response.user_list().users(0);
@@ -70,6 +225,37 @@ void handle_response(const chat::Response& response) {
             std::cout << "Message sent successfully: " << response.message() << std::endl;
             break;
         }
+        case chat::Operation::JOIN_ROOM:
+        case chat::Operation::LEAVE_ROOM:
+            if (response.status_code() == chat::StatusCode::OK) {
+                std::cout << response.message() << " " << response.room().room() << " ("
+                          << response.room().members() << " members)" << std::endl;
+            } else {
+                std::cout << "Room request failed: " << response.message() << std::endl;
+            }
+            break;
+        case chat::Operation::GET_STATS:
+            std::cout << "-----Server Stats-----\n" << response.stats().DebugString()
+                      << "----------------------" << std::endl;
+            break;
+        case chat::Operation::PRESENCE_UPDATE:
+            if (response.presence().snapshot()) {
+                std::cout << "-----Users (" << response.presence().users_size() << ")-----\n";
+                for (const auto& user : response.presence().users()) {
+                    std::cout << user.username() << ": " << chat::UserStatus_Name(user.status()) << "\n";
+                }
+                std::cout << "----------------------" << std::endl;
+            }
+            for (const auto& event : response.presence().events()) {
+                if (event.change() == chat::PresenceChange::LEFT) {
+                    std::cout << "* " << event.username() << " left" << std::endl;
+                } else if (event.change() == chat::PresenceChange::JOINED) {
+                    std::cout << "* " << event.username() << " joined (" << chat::UserStatus_Name(event.status()) << ")" << std::endl;
+                } else {
+                    std::cout << "* " << event.username() << " is now " << chat::UserStatus_Name(event.status()) << std::endl;
+                }
+            }
+            break;
         default:
             std::cout << "Received response: " << response.message() << std::endl;
             break;
@@ -77,80 +263,52 @@ void handle_response(const chat::Response& response) {
 }
 
 
-void wait_for_response(int sock) {
-    fd_set read_fds;
-    FD_ZERO(&read_fds);
-    FD_SET(sock, &read_fds);
-
-    struct timeval tv;
-    tv.tv_sec = 5; 
-    tv.tv_usec = 0;
-
-    if (select(sock + 1, &read_fds, NULL, NULL, &tv) > 0) {
-        char buffer[1024];
-        int bytes_read = read(sock, buffer, sizeof(buffer));
-        if (bytes_read > 0) {
-            chat::Response response;
-            response.ParseFromArray(buffer, bytes_read);
-            handle_response(response);
-        } else {
-            std::cout << "Failed to receive response from server." << std::endl;
-        }
-    } else {
+// Sends a request and waits for its answer. Returns false (after saying
+// why) if none came.
+bool call_server(chat::Request& request, chat::Response& response) {
+    std::future<chat::Response> reply = chat_client.call(request);
+    if (reply.wait_for(std::chrono::milliseconds(kResponseTimeoutMs)) != std::future_status::ready) {
         std::cout << "Response timed out." << std::endl;
-    }
-
-    // display_help();
-}
-
-
-bool register_user(const std::string& username, const std::string& server_ip, int server_port, int& sock) {
-    sock = socket(AF_INET, SOCK_STREAM, 0);
-    if (sock < 0) {
-        std::cerr << "Error creating socket" << std::endl;
         return false;
     }
-
-    sockaddr_in server_address;
-    server_address.sin_family = AF_INET;
-    server_address.sin_port = htons(server_port);
-
-    if (inet_pton(AF_INET, server_ip.c_str(), &server_address.sin_addr) <= 0) {
-        std::cerr << "Invalid address/ Address not supported" << std::endl;
+    response = reply.get();
+    if (response.status_code() == chat::StatusCode::UNKNOWN_STATUS) {
+        std::cout << "Failed to receive response from server." << std::endl;
         return false;
     }
+    return true;
+}
 
-    if (connect(sock, (sockaddr*)&server_address, sizeof(server_address)) < 0) {
-        std::cerr << "Connection failed" << std::endl;
-        return false;
+void wait_for_response(chat::Request& request) {
+    chat::Response response;
+    if (call_server(request, response)) {
+        handle_response(response);
     }
+}
 
-    chat::NewUserRequest new_user_request;
-    new_user_request.set_username(username);
 
-    chat::Request request;
-    request.set_operation(chat::Operation::REGISTER_USER);
-    *request.mutable_register_user() = new_user_request;
+bool register_user(const std::string& username, const std::string& server_ip, int server_port) {
+    chat_client.set_message_handler(print_incoming_message);
+    chat_client.set_response_handler(handle_response);
+    chat_client.set_chunk_handler(receive_file_data);
+    chat_client.set_disconnect_handler([] { std::cout << "Server closed connection\n"; });
 
-    std::string request_str;
-    request.SerializeToString(&request_str);
-    send(sock, request_str.c_str(), request_str.size(), 0);
+    chat::Response response;
+    bool registered = chat_client.connect(server_ip, server_port, username, &response);
+    std::cout << "Response: " << response.message() << std::endl;
+    return registered;
+}
 
-    char buffer[1024];
-    int bytes_read = read(sock, buffer, sizeof(buffer));
-    if (bytes_read > 0) {
-        chat::Response response;
-        response.ParseFromArray(buffer, bytes_read);
-        if (response.status_code() == chat::StatusCode::OK) {
-            std::cout << "Response: " << response.message() << std::endl;
-            return true;
-        } else {
-            std::cout << "Response: " << response.message() << std::endl;
-            return false;
-        }
+// The server keeps the session for a while after the connection drops;
+// resuming it keeps the rooms and brings what was sent in between.
+bool ensure_connected() {
+    if (chat_client.connected()) {
+        return true;
     }
-
-    return false;
+    chat::Response response;
+    bool resumed = chat_client.resume(&response);
+    std::cout << (resumed ? "Reconnected: " : "Could not reconnect: ") << response.message() << std::endl;
+    return resumed;
 }
 
 void show_menu() {
@@ -162,66 +320,77 @@ void show_menu() {
     std::cout << "5. Display user information" << std::endl;
     std::cout << "6. Help" << std::endl;
     std::cout << "7. Exit" << std::endl;
+    std::cout << "8. Server statistics" << std::endl;
+    std::cout << "9. Join a room" << std::endl;
+    std::cout << "10. Leave a room" << std::endl;
+    std::cout << "11. Send to a room" << std::endl;
+    std::cout << "12. " << (following_presence ? "Stop following presence" : "Follow presence") << std::endl;
+    std::cout << "13. Send a file" << std::endl;
+    std::cout << "14. Answer a file offer" << std::endl;
     std::cout << "Enter your choice: ";
 }
 
-void handle_choice(int choice, int sock) {
+void handle_choice(int choice) {
     switch (choice) {
         case 1:
-            broadcast_message(sock);
+            broadcast_message();
             break;
         case 2:
-            send_private_message(sock);
+            send_private_message();
             break;
         case 3:
-            change_status(sock);
+            change_status();
             break;
         case 4:
-            list_users(sock);
+            list_users();
             break;
         case 5:
-            display_user_info(sock);
+            display_user_info();
             break;
         case 6:
             display_help();
             break;
         case 7:
-            exit_chat(sock);
+            exit_chat();
+            break;
+        case 8:
+            show_server_stats();
+            break;
+        case 9:
+            join_room();
+            break;
+        case 10:
+            leave_room();
+            break;
+        case 11:
+            send_room_message();
+            break;
+        case 12:
+            toggle_presence();
+            break;
+        case 13:
+            send_file();
+            break;
+        case 14:
+            answer_file_offer();
             break;
         default:
             std::cout << "Invalid choice. Please try again." << std::endl;
     }
 }
 
-void broadcast_message(int sock) {
+void broadcast_message() {
     std::cout << "-----Broadcast message-----" << std::endl;
     std::cout << "Enter message to broadcast: ";
     std::string message;
     std::cin.ignore();
     std::getline(std::cin, message);
 
-    chat::SendMessageRequest send_message_request;
-    send_message_request.set_content(message);
-
-    chat::Request request;
-    request.set_operation(chat::Operation::SEND_MESSAGE);
-    *request.mutable_send_message() = send_message_request;
-
-    std::string request_str;
-    request.SerializeToString(&request_str);
-    send(sock, request_str.c_str(), request_str.size(), 0);
-
-    char buffer[1024];
-    int bytes_read = read(sock, buffer, sizeof(buffer));
-    if (bytes_read > 0) {
-        chat::Response response;
-        response.ParseFromArray(buffer, bytes_read);
-        std::cout << "Server response: " << response.message() << std::endl;
-    }
+    chat_client.send_message("", message);
 }
 
 
-void send_private_message(int sock) {
+void send_private_message() {
     std::cout << "-----Private message functionality-----" << std::endl;
     std::cout << "Enter recipient username: ";
     std::string recipient;
@@ -231,32 +400,14 @@ void send_private_message(int sock) {
     std::cin.ignore();
     std::getline(std::cin, message);
 
-    chat::SendMessageRequest send_message_request;
-    send_message_request.set_recipient(recipient);
-    send_message_request.set_content(message);
-
-    chat::Request request;
-    request.set_operation(chat::Operation::SEND_MESSAGE);
-    *request.mutable_send_message() = send_message_request;
-
-    std::string request_str;
-    request.SerializeToString(&request_str);
-    send(sock, request_str.c_str(), request_str.size(), 0);
-
-    char buffer[1024];
-    int bytes_read = read(sock, buffer, sizeof(buffer));
-    if (bytes_read > 0) {
-        chat::Response response;
-        response.ParseFromArray(buffer, bytes_read);
-        std::cout << "Server response: " << response.message() << std::endl;
-    }
+    chat_client.send_message(recipient, message);
 }
 
 
 
 
 
-void change_status(int sock) {
+void change_status() {
     std::cout << "-----Change status functionality-----" << std::endl;
 
     std::cout << "Select your new status:" << std::endl;
@@ -292,15 +443,8 @@ void change_status(int sock) {
     request.set_operation(chat::Operation::UPDATE_STATUS);
     *request.mutable_update_status() = update_status_request;
 
-    std::string request_str;
-    request.SerializeToString(&request_str);
-    send(sock, request_str.c_str(), request_str.size(), 0);
-
-    char buffer[1024];
-    int bytes_read = read(sock, buffer, sizeof(buffer));
-    if (bytes_read > 0) {
-        chat::Response response;
-        response.ParseFromArray(buffer, bytes_read);
+    chat::Response response;
+    if (call_server(request, response)) {
         if (response.status_code() == chat::StatusCode::OK) {
             std::cout << "Status changed successfully to " << chat::UserStatus_Name(new_status) << std::endl;
         } else {
@@ -309,81 +453,208 @@ void change_status(int sock) {
     }
 }
 
-void list_users(int sock) {
+void list_users() {
     chat::Request request;
     request.set_operation(chat::Operation::GET_USERS);
 
-    std::string request_str;
-    request.SerializeToString(&request_str);
-    send(sock, request_str.c_str(), request_str.size(), 0);
+    wait_for_response(request);
+}
+
+void show_server_stats() {
+    chat::Request request;
+    request.set_operation(chat::Operation::GET_STATS);
 
-    wait_for_response(sock);
+    wait_for_response(request);
 }
 
 
-void display_user_info(int sock) {
-    std::cout << "-----User Info-----" << std::endl;
-    std::cout << "Enter the username of the user you want to get information about: ";
-    std::string user_to_search;
-    std::cin >> user_to_search;
+void send_room_request(chat::Operation operation) {
+    std::cout << "Enter room name: ";
+    std::string room;
+    std::cin >> room;
 
     chat::Request request;
-    request.set_operation(chat::Operation::GET_USERS);
-    request.mutable_get_users()->set_username(user_to_search);
+    request.set_operation(operation);
+    if (operation == chat::Operation::JOIN_ROOM) {
+        request.mutable_join_room()->set_room(room);
+    } else {
+        request.mutable_leave_room()->set_room(room);
+    }
 
-    std::string request_str;
-    request.SerializeToString(&request_str);
-    send(sock, request_str.c_str(), request_str.size(), 0);
+    wait_for_response(request);
+}
 
-    // Esperar la respuesta directa y procesarla.
-    wait_for_response(sock);
+void join_room() {
+    std::cout << "-----Join room-----" << std::endl;
+    send_room_request(chat::Operation::JOIN_ROOM);
 }
 
+void leave_room() {
+    std::cout << "-----Leave room-----" << std::endl;
+    send_room_request(chat::Operation::LEAVE_ROOM);
+}
 
-void exit_chat(int sock) {
-    std::cout << "Exiting chat..." << std::endl;
-    close(sock);
-    exit(0);
+void send_room_message() {
+    std::cout << "-----Room message-----" << std::endl;
+    std::cout << "Enter room name: ";
+    std::string room;
+    std::cin >> room;
+    std::cout << "Enter message to send: ";
+    std::string message;
+    std::cin.ignore();
+    std::getline(std::cin, message);
+
+    chat_client.send_message("", message, room);
 }
 
 
-void receive_messages(int sock) {
-    fd_set read_fds;
-    struct timeval tv;
-    char buffer[1024];
+// The snapshot and the changes that follow arrive on their own and are
+// printed as they come.
+void toggle_presence() {
+    chat::Request request;
+    request.set_operation(following_presence ? chat::Operation::UNSUBSCRIBE_PRESENCE : chat::Operation::SUBSCRIBE_PRESENCE);
 
-    while (true) {
-        FD_ZERO(&read_fds);
-        FD_SET(sock, &read_fds);
+    chat::Response response;
+    if (call_server(request, response)) {
+        if (response.status_code() == chat::StatusCode::OK) {
+            following_presence = !following_presence;
+        }
+        std::cout << "Response: " << response.message() << std::endl;
+    }
+}
 
-        tv.tv_sec = 0;  
-        tv.tv_usec = 500000; 
 
-        int retval = select(sock + 1, &read_fds, NULL, NULL, &tv);
-        if (retval == -1) {
-            perror("select()");
-            continue;
-        } else if (retval) {
-            int bytes_read = read(sock, buffer, sizeof(buffer));
-            if (bytes_read > 0) {
-                chat::Response response;
-                response.ParseFromArray(buffer, bytes_read);
-                handle_response(response);
-            } else if (bytes_read == 0) {
-                std::cout << "Server closed connection\n";
-                break;
-            }
+void send_file() {
+    std::cout << "-----Send a file-----" << std::endl;
+    std::cout << "Enter recipient username: ";
+    std::string recipient;
+    std::cin >> recipient;
+    std::cout << "Enter the path of the file: ";
+    std::string path;
+    std::cin >> path;
+
+    FILE* file = fopen(path.c_str(), "rb");
+    if (file == nullptr) {
+        std::cout << "Cannot open " << path << std::endl;
+        return;
+    }
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    std::string name = path.substr(path.find_last_of('/') + 1);
+
+    chat::Request request;
+    request.set_operation(chat::Operation::FILE_OFFER);
+    request.mutable_file_offer()->set_recipient(recipient);
+    request.mutable_file_offer()->set_name(name);
+    request.mutable_file_offer()->set_size(size > 0 ? uint64_t(size) : 0);
+    // Answered on the I/O thread, so the file is listed before the
+    // recipient's window can arrive.
+    chat_client.send(request, [file, name](const chat::Response& response) {
+        if (response.status_code() != chat::StatusCode::OK) {
+            std::cout << "Could not offer " << name << ": " << response.message() << std::endl;
+            fclose(file);
+            return;
+        }
+        std::lock_guard<std::mutex> lock(files_mutex);
+        outgoing_files[response.transfer().transfer_id()] = {file, name, response.transfer().size()};
+        std::cout << "Offered " << name << "; it is sent once accepted." << std::endl;
+    });
+}
+
+void answer_file_offer() {
+    std::cout << "-----File offers-----" << std::endl;
+    {
+        std::lock_guard<std::mutex> lock(files_mutex);
+        if (file_offers.empty()) {
+            std::cout << "No files offered." << std::endl;
+            return;
+        }
+        for (const auto& entry : file_offers) {
+            std::cout << entry.first << ": " << entry.second.name() << " (" << entry.second.size() << " bytes) from "
+                      << entry.second.sender() << std::endl;
+        }
+    }
+    std::cout << "Enter the transfer number: ";
+    uint64_t transfer_id;
+    std::cin >> transfer_id;
+    std::cout << "Accept it? (y/n): ";
+    std::string answer;
+    std::cin >> answer;
+
+    chat::FileTransfer offer;
+    {
+        std::lock_guard<std::mutex> lock(files_mutex);
+        auto it = file_offers.find(transfer_id);
+        if (it == file_offers.end()) {
+            std::cout << "No such offer." << std::endl;
+            return;
+        }
+        offer = it->second;
+        file_offers.erase(it);
+    }
+
+    chat::Request request;
+    request.mutable_file_window()->set_transfer_id(transfer_id);
+    if (answer != "y") {
+        request.set_operation(chat::Operation::FILE_CANCEL);
+        wait_for_response(request);
+        return;
+    }
+    std::string path = "received_" + offer.name().substr(offer.name().find_last_of('/') + 1);
+    FILE* file = fopen(path.c_str(), "wb");
+    if (file == nullptr) {
+        std::cout << "Cannot write " << path << std::endl;
+        request.set_operation(chat::Operation::FILE_CANCEL);
+        wait_for_response(request);
+        return;
+    }
+    {
+        // Listed before accepting: the data may follow the answer at once.
+        std::lock_guard<std::mutex> lock(files_mutex);
+        incoming_files[transfer_id] = {file, path, offer.size(), 0, 0};
+    }
+    request.set_operation(chat::Operation::FILE_ACCEPT);
+    request.mutable_file_window()->set_bytes(kFileWindow);
+    chat::Response response;
+    if (call_server(request, response)) {
+        if (response.status_code() == chat::StatusCode::OK) {
+            std::cout << "Receiving " << offer.name() << " as " << path << std::endl;
+            return;
         }
+        std::cout << "Could not accept: " << response.message() << std::endl;
     }
+    end_file_transfer(offer, "not accepted");
 }
 
 
-void* receive_messages_wrapper(void* arg) {
-    pthread_mutex_lock(&lock);
-    int sock = *(int*)arg;
-    receive_messages(sock);
-    pthread_mutex_unlock(&lock);
-    return nullptr;
+void display_user_info() {
+    std::cout << "-----User Info-----" << std::endl;
+    std::cout << "Enter the username of the user you want to get information about: ";
+    std::string user_to_search;
+    std::cin >> user_to_search;
+
+    chat::Request request;
+    request.set_operation(chat::Operation::GET_USERS);
+    request.mutable_get_users()->set_username(user_to_search);
+
+    // Esperar la respuesta directa y procesarla.
+    wait_for_response(request);
+}
+
+
+void exit_chat() {
+    std::cout << "Exiting chat..." << std::endl;
+    if (chat_client.connected()) {
+        // Otherwise the server would keep the session around for a resume.
+        chat::Request request;
+        request.set_operation(chat::Operation::UNREGISTER_USER);
+        request.mutable_unregister_user()->set_username(username);
+        chat::Response response;
+        call_server(request, response);
+    }
+    chat_client.close();
+    exit(0);
 }
 
 
@@ -397,28 +668,20 @@ int main(int argc, char const* argv[]) {
     std::string server_ip = argv[2];
     int server_port = std::stoi(argv[3]);
 
-    int sock;
-    if (!register_user(username, server_ip, server_port, sock)) {
+    if (!register_user(username, server_ip, server_port)) {
         std::cerr << "Failed to register user" << std::endl;
         return -1;
     }
 
-    int flags = fcntl(sock, F_GETFL, 0);
-    fcntl(sock, F_SETFL, flags | O_NONBLOCK);
-
-    pthread_mutex_init(&lock, NULL);
-
-    pthread_t receiver_thread;
-    pthread_create(&receiver_thread, nullptr, receive_messages_wrapper, &sock);
-
     int choice;
     while (true) {
         show_menu();
         std::cin >> choice;
-        handle_choice(choice, sock);
+        if (!ensure_connected() && choice != 7) {
+            continue;
+        }
+        handle_choice(choice);
     }
 
-    pthread_mutex_destroy(&lock);
-
     return 0;
 }
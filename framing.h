@@ -0,0 +1,462 @@
+#ifndef CHAT_FRAMING_H
+#define CHAT_FRAMING_H
+
+// Wire framing shared by the server and the client.
+//
+// Every protobuf message travels as a frame: a 4-byte big-endian payload
+// length followed by the serialized message. This lets a reader split a TCP
+// stream back into messages no matter how the kernel coalesced or split them.
+//
+// Peers that negotiated compression at REGISTER_USER may also send
+// compressed frames: the header has kFrameCompressed set, and the payload is
+// the 4-byte big-endian size of the serialized message followed by its zlib
+// stream. Only frames of at least the negotiated threshold are compressed,
+// and only when that makes them smaller. FrameBuffer inflates them
+// transparently, so readers only ever see serialized messages.
+//
+// File data travels in chunk frames instead (see FileOffer in chat.proto):
+// the header has kFrameChunk set, and the payload is the 8-byte big-endian
+// transfer ID followed by the data. They are never compressed and carry no
+// protobuf, so the server passes them on without parsing more than the ID.
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <errno.h>
+#include <poll.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <zlib.h>
+#include <google/protobuf/message_lite.h>
+
+const size_t kFrameHeaderSize = 4;
+const uint32_t kMaxFrameSize = 16 * 1024 * 1024;
+const size_t kFrameBlockSize = 4096;
+const uint32_t kFrameCompressed = 0x80000000u;
+const size_t kCompressedSizeHeader = 4;
+const uint32_t kFrameChunk = 0x40000000u;
+const uint32_t kFrameFlags = kFrameCompressed | kFrameChunk;
+const size_t kChunkHeaderSize = 8;  // The transfer ID, after the frame header.
+const size_t kMaxChunkData = 64 * 1024;
+
+inline void write_frame_header(char* out, uint32_t size) {
+    out[0] = static_cast<char>((size >> 24) & 0xff);
+    out[1] = static_cast<char>((size >> 16) & 0xff);
+    out[2] = static_cast<char>((size >> 8) & 0xff);
+    out[3] = static_cast<char>(size & 0xff);
+}
+
+inline uint32_t read_frame_header(const char* in) {
+    const unsigned char* p = reinterpret_cast<const unsigned char*>(in);
+    return (uint32_t(p[0]) << 24) | (uint32_t(p[1]) << 16) | (uint32_t(p[2]) << 8) | uint32_t(p[3]);
+}
+
+// Writes the headers of a chunk frame carrying `size` bytes of data.
+inline void write_chunk_header(char* out, uint64_t transfer_id, uint32_t size) {
+    write_frame_header(out, static_cast<uint32_t>(kChunkHeaderSize + size) | kFrameChunk);
+    write_frame_header(out + kFrameHeaderSize, static_cast<uint32_t>(transfer_id >> 32));
+    write_frame_header(out + kFrameHeaderSize + 4, static_cast<uint32_t>(transfer_id));
+}
+
+inline uint64_t read_chunk_transfer(const char* payload) {
+    return (uint64_t(read_frame_header(payload)) << 32) | read_frame_header(payload + 4);
+}
+
+// Serializes a message straight into a framed buffer (header + payload),
+// reusing whatever capacity `out` already has.
+inline void serialize_frame(const google::protobuf::MessageLite& message, std::string* out) {
+    size_t size = message.ByteSizeLong();
+    out->resize(kFrameHeaderSize + size);
+    write_frame_header(&(*out)[0], static_cast<uint32_t>(size));
+    message.SerializeWithCachedSizesToArray(reinterpret_cast<uint8_t*>(&(*out)[kFrameHeaderSize]));
+}
+
+// zlib streams kept per thread and reset between frames: setting one up
+// allocates and clears a few hundred kilobytes, which costs far more than
+// compressing a small frame.
+class FrameCodec {
+public:
+    FrameCodec() : deflate_level_(0), inflate_ready_(false) {}
+    ~FrameCodec() {
+        if (deflate_level_ != 0) {
+            deflateEnd(&deflater_);
+        }
+        if (inflate_ready_) {
+            inflateEnd(&inflater_);
+        }
+    }
+
+    FrameCodec(const FrameCodec&) = delete;
+    FrameCodec& operator=(const FrameCodec&) = delete;
+
+    // Compresses `size` bytes into `out`, which must have room for
+    // compressBound(size). Returns the compressed size, or 0 on failure.
+    size_t deflate(const char* data, size_t size, int level, char* out, size_t capacity) {
+        if (deflate_level_ != level) {
+            if (deflate_level_ != 0) {
+                deflateEnd(&deflater_);
+            }
+            memset(&deflater_, 0, sizeof(deflater_));
+            if (deflateInit(&deflater_, level) != Z_OK) {
+                deflate_level_ = 0;
+                return 0;
+            }
+            deflate_level_ = level;
+        } else {
+            deflateReset(&deflater_);
+        }
+        deflater_.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(data));
+        deflater_.avail_in = static_cast<uInt>(size);
+        deflater_.next_out = reinterpret_cast<Bytef*>(out);
+        deflater_.avail_out = static_cast<uInt>(capacity);
+        if (::deflate(&deflater_, Z_FINISH) != Z_STREAM_END) {
+            return 0;
+        }
+        return deflater_.total_out;
+    }
+
+    // Inflates exactly `capacity` bytes into `out`.
+    bool inflate(const char* data, size_t size, char* out, size_t capacity) {
+        if (!inflate_ready_) {
+            memset(&inflater_, 0, sizeof(inflater_));
+            if (inflateInit(&inflater_) != Z_OK) {
+                return false;
+            }
+            inflate_ready_ = true;
+        } else {
+            inflateReset(&inflater_);
+        }
+        inflater_.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(data));
+        inflater_.avail_in = static_cast<uInt>(size);
+        inflater_.next_out = reinterpret_cast<Bytef*>(out);
+        inflater_.avail_out = static_cast<uInt>(capacity);
+        return ::inflate(&inflater_, Z_FINISH) == Z_STREAM_END && inflater_.total_out == capacity;
+    }
+
+    static FrameCodec& local() {
+        static thread_local FrameCodec codec;
+        return codec;
+    }
+
+private:
+    z_stream deflater_;
+    int deflate_level_;  // 0 while no deflate stream is set up.
+    z_stream inflater_;
+    bool inflate_ready_;
+};
+
+// Compresses a serialized frame (header + payload) into `out` if the payload
+// is at least `threshold` bytes and deflates to something smaller. Returns
+// whether it did; `out` is unspecified otherwise.
+inline bool compress_frame(const std::string& frame, size_t threshold, int level, std::string* out) {
+    size_t size = frame.size() - kFrameHeaderSize;
+    if (threshold == 0 || size < threshold) {
+        return false;
+    }
+    size_t bound = compressBound(size);
+    out->resize(kFrameHeaderSize + kCompressedSizeHeader + bound);
+    size_t compressed = FrameCodec::local().deflate(frame.data() + kFrameHeaderSize, size, level,
+                                                    &(*out)[kFrameHeaderSize + kCompressedSizeHeader], bound);
+    if (compressed == 0 || kCompressedSizeHeader + compressed >= size) {
+        return false;
+    }
+    out->resize(kFrameHeaderSize + kCompressedSizeHeader + compressed);
+    write_frame_header(&(*out)[0], static_cast<uint32_t>(kCompressedSizeHeader + compressed) | kFrameCompressed);
+    write_frame_header(&(*out)[kFrameHeaderSize], static_cast<uint32_t>(size));
+    return true;
+}
+
+// A payload that only differs per copy in its last few bytes (a response
+// and its request_id) can be compressed once: the common prefix is deflated
+// up to a byte boundary (Z_SYNC_FLUSH) without a final block, and each copy
+// appends its tail as a stored final block, then the zlib trailer, whose
+// checksum is combined from the prefix's without reading it again.
+struct DeflatedPrefix {
+    std::string bytes;  // zlib header and blocks; no final block, no trailer.
+    uint32_t adler;  // Of the uncompressed prefix.
+    size_t size;  // Uncompressed.
+};
+
+inline bool deflate_prefix(const char* data, size_t size, int level, DeflatedPrefix* out) {
+    z_stream stream;
+    memset(&stream, 0, sizeof(stream));
+    if (deflateInit(&stream, level) != Z_OK) {
+        return false;
+    }
+    out->bytes.resize(compressBound(size) + 64);  // Room for the flush marker.
+    stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(data));
+    stream.avail_in = static_cast<uInt>(size);
+    stream.next_out = reinterpret_cast<Bytef*>(&out->bytes[0]);
+    stream.avail_out = static_cast<uInt>(out->bytes.size());
+    bool ok = ::deflate(&stream, Z_SYNC_FLUSH) == Z_OK && stream.avail_in == 0 && stream.avail_out > 0;
+    out->bytes.resize(stream.total_out);
+    out->adler = static_cast<uint32_t>(stream.adler);
+    out->size = size;
+    deflateEnd(&stream);
+    return ok;
+}
+
+// Bytes a compressed frame built by finish_deflated_frame() takes beyond the
+// prefix and the tail: headers, the stored block's header and the trailer.
+const size_t kDeflatedFrameOverhead = kFrameHeaderSize + kCompressedSizeHeader + 5 + 4;
+
+// Writes the compressed frame of `prefix` followed by `tail` into `out`.
+inline void finish_deflated_frame(const DeflatedPrefix& prefix, const char* tail, uint16_t tail_size, std::string* out) {
+    size_t compressed = prefix.bytes.size() + 5 + tail_size + 4;
+    out->resize(kFrameHeaderSize + kCompressedSizeHeader + compressed);
+    char* p = &(*out)[0];
+    write_frame_header(p, static_cast<uint32_t>(kCompressedSizeHeader + compressed) | kFrameCompressed);
+    write_frame_header(p + kFrameHeaderSize, static_cast<uint32_t>(prefix.size + tail_size));
+    p += kFrameHeaderSize + kCompressedSizeHeader;
+    memcpy(p, prefix.bytes.data(), prefix.bytes.size());
+    p += prefix.bytes.size();
+    p[0] = 1;  // BFINAL, stored.
+    p[1] = static_cast<char>(tail_size & 0xff);
+    p[2] = static_cast<char>(tail_size >> 8);
+    p[3] = static_cast<char>(~tail_size & 0xff);
+    p[4] = static_cast<char>((~tail_size >> 8) & 0xff);
+    memcpy(p + 5, tail, tail_size);
+    uLong tail_adler = adler32(1, reinterpret_cast<const Bytef*>(tail), tail_size);
+    // Big-endian, like a frame header.
+    write_frame_header(p + 5 + tail_size, static_cast<uint32_t>(adler32_combine(prefix.adler, tail_adler, tail_size)));
+}
+
+// Inflates the payload of a compressed frame into `out`.
+inline bool inflate_payload(const char* payload, uint32_t size, std::string* out) {
+    if (size < kCompressedSizeHeader) {
+        return false;
+    }
+    uint32_t inflated_size = read_frame_header(payload);
+    if (inflated_size > kMaxFrameSize) {
+        return false;
+    }
+    out->resize(inflated_size);
+    return FrameCodec::local().inflate(payload + kCompressedSizeHeader, size - kCompressedSizeHeader, &(*out)[0], inflated_size);
+}
+
+// Writes the whole buffer, waiting for writability if the socket is
+// non-blocking and its send buffer is full.
+inline bool write_all(int sock, const char* data, size_t size) {
+    while (size > 0) {
+        ssize_t sent = send(sock, data, size, MSG_NOSIGNAL);
+        if (sent > 0) {
+            data += sent;
+            size -= sent;
+            continue;
+        }
+        if (sent < 0 && errno == EINTR) {
+            continue;
+        }
+        if (sent < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+            pollfd pfd = {sock, POLLOUT, 0};
+            poll(&pfd, 1, -1);
+            continue;
+        }
+        return false;
+    }
+    return true;
+}
+
+// Sends a message, compressed if the peer agreed to a `compress_threshold`
+// and the message reaches it.
+inline bool send_frame(int sock, const google::protobuf::MessageLite& message, size_t compress_threshold = 0) {
+    std::string frame;
+    serialize_frame(message, &frame);
+    std::string compressed;
+    if (compress_frame(frame, compress_threshold, Z_BEST_SPEED, &compressed)) {
+        return write_all(sock, compressed.data(), compressed.size());
+    }
+    return write_all(sock, frame.data(), frame.size());
+}
+
+// Per-thread cache of default-sized receive blocks, so connections can hand
+// their buffer back while idle without paying a malloc on the next read.
+class FrameBlockCache {
+public:
+    ~FrameBlockCache() {
+        for (char* block : blocks_) {
+            delete[] block;
+        }
+    }
+
+    char* acquire() {
+        if (blocks_.empty()) {
+            return new char[kFrameBlockSize];
+        }
+        char* block = blocks_.back();
+        blocks_.pop_back();
+        return block;
+    }
+
+    void release(char* block) {
+        if (blocks_.size() < kMaxCachedBlocks) {
+            blocks_.push_back(block);
+        } else {
+            delete[] block;
+        }
+    }
+
+    static FrameBlockCache& local() {
+        static thread_local FrameBlockCache cache;
+        return cache;
+    }
+
+private:
+    static const size_t kMaxCachedBlocks = 256;
+    std::vector<char*> blocks_;
+};
+
+// Streaming reassembly buffer for one connection.
+//
+// Bytes are read straight into the free tail of the buffer and complete
+// frames are handed out in place, so several frames from one read() and a
+// frame split across reads both parse without an intermediate copy. Consumed
+// space is reclaimed by sliding the (partial-frame) residue to the front only
+// when the tail runs out, and the buffer only grows past kFrameBlockSize for
+// frames that need it.
+class FrameBuffer {
+public:
+    FrameBuffer() : data_(nullptr), capacity_(0), head_(0), tail_(0), wanted_(0), error_(false) {}
+    ~FrameBuffer() { delete[] data_; }
+
+    FrameBuffer(const FrameBuffer&) = delete;
+    FrameBuffer& operator=(const FrameBuffer&) = delete;
+
+    // Performs a single read() into the buffer; returns its result.
+    ssize_t read_from(int fd) {
+        reserve_tail();
+        ssize_t bytes_read = read(fd, data_ + tail_, capacity_ - tail_);
+        if (bytes_read > 0) {
+            tail_ += bytes_read;
+        }
+        return bytes_read;
+    }
+
+    // Appends bytes that were received by other means (e.g. a completion-based backend).
+    void append(const char* data, size_t size) {
+        while (size > 0) {
+            reserve_tail();
+            size_t chunk = std::min(size, capacity_ - tail_);
+            memcpy(data_ + tail_, data, chunk);
+            tail_ += chunk;
+            data += chunk;
+            size -= chunk;
+        }
+    }
+
+    // Points at the next complete frame payload, if one is buffered. The
+    // pointer stays valid until the next read_from()/append()/release(), or
+    // for a compressed frame (inflated into a per-thread buffer) until the
+    // next next_frame() on this thread. Chunk frames are only accepted by a
+    // caller that passes `chunk`, which tells them apart; their payload
+    // starts with the transfer ID.
+    bool next_frame(const char** payload, uint32_t* size, bool* chunk = nullptr) {
+        if (tail_ - head_ < kFrameHeaderSize) {
+            return false;
+        }
+        uint32_t header = read_frame_header(data_ + head_);
+        uint32_t frame_size = header & ~kFrameFlags;
+        bool is_chunk = (header & kFrameChunk) != 0;
+        if (frame_size > kMaxFrameSize || (is_chunk && (chunk == nullptr || (header & kFrameCompressed) ||
+                                                        frame_size < kChunkHeaderSize ||
+                                                        frame_size > kChunkHeaderSize + kMaxChunkData))) {
+            error_ = true;
+            return false;
+        }
+        if (chunk != nullptr) {
+            *chunk = is_chunk;
+        }
+        if (tail_ - head_ < kFrameHeaderSize + frame_size) {
+            wanted_ = kFrameHeaderSize + frame_size;
+            return false;
+        }
+        *payload = data_ + head_ + kFrameHeaderSize;
+        *size = frame_size;
+        if (header & kFrameCompressed) {
+            static thread_local std::string inflated;
+            if (!inflate_payload(*payload, frame_size, &inflated)) {
+                error_ = true;
+                return false;
+            }
+            *payload = inflated.data();
+            *size = static_cast<uint32_t>(inflated.size());
+        }
+        head_ += kFrameHeaderSize + frame_size;
+        if (head_ == tail_) {
+            head_ = tail_ = 0;
+        }
+        return true;
+    }
+
+    // Set when the peer announced a frame larger than kMaxFrameSize, sent
+    // a compressed frame that does not inflate or an unexpected chunk frame.
+    bool error() const { return error_; }
+    bool empty() const { return head_ == tail_; }
+    size_t buffered() const { return tail_ - head_; }
+    // The buffered bytes; valid until the next read_from()/append()/release().
+    const char* data() const { return data_ + head_; }
+
+    // Forgets what is buffered, for a new stream.
+    void reset() {
+        head_ = tail_ = wanted_ = 0;
+        error_ = false;
+    }
+
+    // Drops the storage while nothing is buffered, so idle connections cost
+    // nothing beyond the object itself.
+    void release() {
+        if (data_ == nullptr || head_ != tail_) {
+            return;
+        }
+        if (capacity_ == kFrameBlockSize) {
+            FrameBlockCache::local().release(data_);
+        } else {
+            delete[] data_;
+        }
+        data_ = nullptr;
+        capacity_ = head_ = tail_ = 0;
+    }
+
+private:
+    void reserve_tail() {
+        if (data_ == nullptr) {
+            data_ = FrameBlockCache::local().acquire();
+            capacity_ = kFrameBlockSize;
+        }
+        if (tail_ < capacity_) {
+            return;
+        }
+        size_t pending = tail_ - head_;
+        size_t needed = std::max(pending + 1, std::max(wanted_, kFrameBlockSize));
+        if (head_ > 0 && needed <= capacity_) {
+            memmove(data_, data_ + head_, pending);
+        } else {
+            size_t new_capacity = capacity_;
+            while (new_capacity < needed) {
+                new_capacity *= 2;
+            }
+            char* grown = new char[new_capacity];
+            memcpy(grown, data_ + head_, pending);
+            if (capacity_ == kFrameBlockSize) {
+                FrameBlockCache::local().release(data_);
+            } else {
+                delete[] data_;
+            }
+            data_ = grown;
+            capacity_ = new_capacity;
+        }
+        head_ = 0;
+        tail_ = pending;
+    }
+
+    char* data_;
+    size_t capacity_;
+    size_t head_;
+    size_t tail_;
+    size_t wanted_;
+    bool error_;
+};
+
+#endif
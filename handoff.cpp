@@ -0,0 +1,378 @@
+#include "handoff.h"
+
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <sys/un.h>
+#include <unistd.h>
+#include "log.h"
+
+struct HandoffHeader {
+    uint16_t version;
+    uint16_t type;
+    uint32_t fd_count;
+    uint64_t payload_size;
+};
+
+const uint64_t kMaxHandoffPayload = uint64_t(1) << 32;
+
+// Fixed-width fields and length-prefixed strings, appended to a buffer.
+class HandoffWriter {
+public:
+    explicit HandoffWriter(std::string* out) : out_(out) {}
+
+    template <typename T>
+    void put(T value) { out_->append(reinterpret_cast<const char*>(&value), sizeof(value)); }
+
+    void put_string(const std::string& value) {
+        put(uint32_t(value.size()));
+        out_->append(value);
+    }
+
+private:
+    std::string* out_;
+};
+
+// Reads what HandoffWriter wrote; every get fails once the data runs out.
+class HandoffReader {
+public:
+    explicit HandoffReader(const std::string& data) : data_(data), offset_(0) {}
+
+    template <typename T>
+    bool get(T* value) {
+        if (data_.size() - offset_ < sizeof(T)) {
+            return false;
+        }
+        memcpy(value, data_.data() + offset_, sizeof(T));
+        offset_ += sizeof(T);
+        return true;
+    }
+
+    bool get_string(std::string* value) {
+        uint32_t size;
+        if (!get(&size) || data_.size() - offset_ < size) {
+            return false;
+        }
+        value->assign(data_, offset_, size);
+        offset_ += size;
+        return true;
+    }
+
+    // A count of items that each take at least `min_bytes`, checked against
+    // what is left so a corrupt count cannot trigger a huge allocation.
+    bool get_count(size_t min_bytes, uint32_t* count) {
+        return get(count) && uint64_t(*count) * min_bytes <= data_.size() - offset_;
+    }
+
+    bool done() const { return offset_ == data_.size(); }
+
+private:
+    const std::string& data_;
+    size_t offset_;
+};
+
+void encode_handoff_state(const HandoffState& state, std::string* out) {
+    HandoffWriter writer(out);
+    writer.put_string(state.mode);
+    writer.put(state.presence_version);
+    writer.put(uint32_t(state.generations.size()));
+    out->append(reinterpret_cast<const char*>(state.generations.data()), state.generations.size() * sizeof(uint32_t));
+    writer.put(uint32_t(state.known_users.size()));
+    for (const std::string& name : state.known_users) {
+        writer.put_string(name);
+    }
+}
+
+bool decode_handoff_state(const std::string& data, HandoffState* state) {
+    HandoffReader reader(data);
+    uint32_t count;
+    if (!reader.get_string(&state->mode) || !reader.get(&state->presence_version) ||
+        !reader.get_count(sizeof(uint32_t), &count)) {
+        return false;
+    }
+    state->generations.resize(count);
+    for (uint32_t& generation : state->generations) {
+        reader.get(&generation);
+    }
+    if (!reader.get_count(sizeof(uint32_t), &count)) {
+        return false;
+    }
+    state->known_users.resize(count);
+    for (std::string& name : state->known_users) {
+        if (!reader.get_string(&name)) {
+            return false;
+        }
+    }
+    return reader.done();
+}
+
+void encode_handoff_connections(const std::vector<HandoffConnection>& connections, std::string* out) {
+    HandoffWriter writer(out);
+    writer.put(uint32_t(connections.size()));
+    for (const HandoffConnection& conn : connections) {
+        writer.put_string(conn.ip_address);
+        writer.put_string(conn.username);
+        writer.put(conn.slot);
+        writer.put(conn.status);
+        writer.put(conn.last_activity_ms);
+        writer.put(conn.resume_key[0]);
+        writer.put(conn.resume_key[1]);
+        writer.put(conn.detached_until_ms);
+        uint8_t flags = (conn.batched_delivery ? 1 : 0) | (conn.compress ? 2 : 0) | (conn.presence_subscribed ? 4 : 0) |
+                        (conn.slow ? 8 : 0);
+        writer.put(flags);
+        writer.put(uint32_t(conn.rooms.size()));
+        for (const std::string& room : conn.rooms) {
+            writer.put_string(room);
+        }
+        writer.put_string(conn.inbound);
+        writer.put(uint32_t(conn.outbound.size()));
+        for (const HandoffFrame& frame : conn.outbound) {
+            writer.put(frame.kind);
+            writer.put(uint8_t(frame.packable ? 1 : 0));
+            writer.put_string(frame.bytes);
+        }
+    }
+}
+
+bool decode_handoff_connections(const std::string& data, std::vector<HandoffConnection>* connections) {
+    HandoffReader reader(data);
+    uint32_t count;
+    if (!reader.get_count(1, &count)) {
+        return false;
+    }
+    connections->resize(count);
+    for (HandoffConnection& conn : *connections) {
+        uint8_t flags;
+        uint32_t rooms;
+        if (!reader.get_string(&conn.ip_address) || !reader.get_string(&conn.username) || !reader.get(&conn.slot) ||
+            !reader.get(&conn.status) || !reader.get(&conn.last_activity_ms) || !reader.get(&conn.resume_key[0]) ||
+            !reader.get(&conn.resume_key[1]) || !reader.get(&conn.detached_until_ms) || !reader.get(&flags) ||
+            !reader.get_count(sizeof(uint32_t), &rooms)) {
+            return false;
+        }
+        conn.batched_delivery = flags & 1;
+        conn.compress = flags & 2;
+        conn.presence_subscribed = flags & 4;
+        conn.slow = flags & 8;
+        conn.rooms.resize(rooms);
+        for (std::string& room : conn.rooms) {
+            if (!reader.get_string(&room)) {
+                return false;
+            }
+        }
+        uint32_t frames;
+        if (!reader.get_string(&conn.inbound) || !reader.get_count(2 + sizeof(uint32_t), &frames)) {
+            return false;
+        }
+        conn.outbound.resize(frames);
+        for (HandoffFrame& frame : conn.outbound) {
+            uint8_t packable;
+            if (!reader.get(&frame.kind) || !reader.get(&packable) || !reader.get_string(&frame.bytes)) {
+                return false;
+            }
+            frame.packable = packable != 0;
+        }
+    }
+    return reader.done();
+}
+
+static bool make_address(const std::string& path, sockaddr_un* address) {
+    memset(address, 0, sizeof(*address));
+    address->sun_family = AF_UNIX;
+    if (path.size() >= sizeof(address->sun_path)) {
+        log_error("Handoff socket path too long: {}", path);
+        return false;
+    }
+    memcpy(address->sun_path, path.c_str(), path.size());
+    return true;
+}
+
+static void set_timeouts(int fd) {
+    timeval timeout = {kHandoffTimeoutMs / 1000, (kHandoffTimeoutMs % 1000) * 1000};
+    setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+    setsockopt(fd, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+}
+
+static std::string unpublished_path(const std::string& path) {
+    return path + ".new";
+}
+
+int handoff_listen(const std::string& path) {
+    std::string temp_path = unpublished_path(path);
+    sockaddr_un address;
+    if (!make_address(temp_path, &address)) {
+        return -1;
+    }
+    int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (fd < 0) {
+        log_error("Handoff socket: {}", strerror(errno));
+        return -1;
+    }
+    unlink(temp_path.c_str());
+    // Bound with no permissions for anyone else; connecting needs write access.
+    mode_t mask = umask(0077);
+    bool bound = bind(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) == 0;
+    umask(mask);
+    if (!bound || listen(fd, 1) < 0) {
+        log_error("Cannot listen for handoffs on {}: {}", temp_path, strerror(errno));
+        close(fd);
+        unlink(temp_path.c_str());
+        return -1;
+    }
+    return fd;
+}
+
+bool handoff_publish(const std::string& path) {
+    std::string temp_path = unpublished_path(path);
+    if (rename(temp_path.c_str(), path.c_str()) != 0) {
+        log_error("Cannot move the handoff socket {} to {}: {}", temp_path, path, strerror(errno));
+        unlink(temp_path.c_str());
+        return false;
+    }
+    return true;
+}
+
+int handoff_connect(const std::string& path) {
+    sockaddr_un address;
+    if (!make_address(path, &address)) {
+        return -1;
+    }
+    int fd = socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (fd < 0 || connect(fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)) < 0) {
+        log_error("Cannot connect to the handoff socket {}: {}", path, strerror(errno));
+        if (fd >= 0) {
+            close(fd);
+        }
+        return -1;
+    }
+    set_timeouts(fd);
+    return fd;
+}
+
+int handoff_accept(int listen_fd) {
+    int fd = accept4(listen_fd, nullptr, nullptr, SOCK_CLOEXEC);
+    if (fd < 0) {
+        return -1;
+    }
+    ucred peer;
+    socklen_t size = sizeof(peer);
+    if (getsockopt(fd, SOL_SOCKET, SO_PEERCRED, &peer, &size) < 0 || peer.uid != getuid()) {
+        log_warn("Refusing a handoff request from uid {}", size == sizeof(peer) ? int(peer.uid) : -1);
+        close(fd);
+        return -1;
+    }
+    set_timeouts(fd);
+    return fd;
+}
+
+static bool send_all(int fd, const char* data, size_t size) {
+    while (size > 0) {
+        ssize_t sent = send(fd, data, size, MSG_NOSIGNAL);
+        if (sent < 0 && errno == EINTR) {
+            continue;
+        }
+        if (sent <= 0) {
+            return false;
+        }
+        data += sent;
+        size -= size_t(sent);
+    }
+    return true;
+}
+
+static bool receive_all(int fd, char* data, size_t size) {
+    while (size > 0) {
+        ssize_t received = recv(fd, data, size, 0);
+        if (received < 0 && errno == EINTR) {
+            continue;
+        }
+        if (received <= 0) {
+            return false;
+        }
+        data += received;
+        size -= size_t(received);
+    }
+    return true;
+}
+
+bool handoff_send(int fd, HandoffMessage type, const std::string& payload, const std::vector<int>& fds) {
+    if (fds.size() > kHandoffMaxFds) {
+        return false;
+    }
+    HandoffHeader header = {kHandoffVersion, uint16_t(type), uint32_t(fds.size()), payload.size()};
+    iovec iov = {&header, sizeof(header)};
+    msghdr msg = {};
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    std::vector<char> control;
+    if (!fds.empty()) {
+        control.resize(CMSG_SPACE(fds.size() * sizeof(int)));
+        msg.msg_control = control.data();
+        msg.msg_controllen = control.size();
+        cmsghdr* cmsg = CMSG_FIRSTHDR(&msg);
+        cmsg->cmsg_level = SOL_SOCKET;
+        cmsg->cmsg_type = SCM_RIGHTS;
+        cmsg->cmsg_len = CMSG_LEN(fds.size() * sizeof(int));
+        memcpy(CMSG_DATA(cmsg), fds.data(), fds.size() * sizeof(int));
+    }
+    ssize_t sent;
+    do {
+        sent = sendmsg(fd, &msg, MSG_NOSIGNAL);
+    } while (sent < 0 && errno == EINTR);
+    // The descriptors went with the first byte; the rest of the header, if
+    // it was cut short, goes without them.
+    if (sent <= 0 || !send_all(fd, reinterpret_cast<const char*>(&header) + sent, sizeof(header) - size_t(sent))) {
+        return false;
+    }
+    return send_all(fd, payload.data(), payload.size());
+}
+
+bool handoff_receive(int fd, HandoffMessage* type, std::string* payload, std::vector<int>* fds) {
+    HandoffHeader header;
+    iovec iov = {&header, sizeof(header)};
+    msghdr msg = {};
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    std::vector<char> control(CMSG_SPACE(kHandoffMaxFds * sizeof(int)));
+    msg.msg_control = control.data();
+    msg.msg_controllen = control.size();
+    ssize_t received;
+    do {
+        received = recvmsg(fd, &msg, MSG_CMSG_CLOEXEC);
+    } while (received < 0 && errno == EINTR);
+    if (received <= 0) {
+        return false;
+    }
+
+    fds->clear();
+    for (cmsghdr* cmsg = CMSG_FIRSTHDR(&msg); cmsg != nullptr; cmsg = CMSG_NXTHDR(&msg, cmsg)) {
+        if (cmsg->cmsg_level == SOL_SOCKET && cmsg->cmsg_type == SCM_RIGHTS) {
+            size_t count = (cmsg->cmsg_len - CMSG_LEN(0)) / sizeof(int);
+            const int* received_fds = reinterpret_cast<const int*>(CMSG_DATA(cmsg));
+            fds->insert(fds->end(), received_fds, received_fds + count);
+        }
+    }
+    bool valid = (msg.msg_flags & MSG_CTRUNC) == 0 &&
+                 receive_all(fd, reinterpret_cast<char*>(&header) + received, sizeof(header) - size_t(received)) &&
+                 header.version == kHandoffVersion && header.fd_count == fds->size() &&
+                 header.payload_size < kMaxHandoffPayload;
+    if (valid) {
+        payload->resize(header.payload_size);
+        valid = receive_all(fd, &(*payload)[0], payload->size());
+    }
+    if (!valid) {
+        if (msg.msg_flags & MSG_CTRUNC) {
+            log_error("Handoff: descriptors were lost (is the open file limit too low?)");
+        }
+        for (int received_fd : *fds) {
+            close(received_fd);
+        }
+        fds->clear();
+        return false;
+    }
+    *type = static_cast<HandoffMessage>(header.type);
+    return true;
+}
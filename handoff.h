@@ -0,0 +1,99 @@
+#ifndef CHAT_HANDOFF_H
+#define CHAT_HANDOFF_H
+
+// Hot restart: a running server hands its listening sockets, its client
+// connections and its sessions over to a new server process, which carries
+// on serving them. Clients keep their TCP connections, their registration
+// and their user IDs, and see at most a short pause.
+//
+// The old process listens on a Unix socket (--handoff). The new one connects
+// to it (--takeover) and asks for the handoff; the old one parks its I/O
+// threads and sends its state as a sequence of messages. Each message is a
+// fixed header followed by a payload in a compact binary encoding (native
+// byte order: both ends run on the same host); file descriptors travel with
+// the header as SCM_RIGHTS ancillary data:
+//
+//   HANDOFF_REQUEST       new -> old
+//   HANDOFF_STATE         the listeners, the I/O mode, the session slot layout
+//   HANDOFF_CONNECTIONS   up to kHandoffMaxFds client sockets and their state
+//   HANDOFF_DETACHED      sessions waiting for a resume, which have no socket
+//   HANDOFF_DONE
+//   HANDOFF_ACCEPTED      new -> old: the old process exits without touching
+//                         the sockets again
+//
+// Until HANDOFF_ACCEPTED arrives nothing has changed for the clients, so if
+// the new process goes away or stalls the old one just resumes serving. The
+// new process sends it only once everything on its side that can fail (the
+// offline queue, its own handoff socket) is set up.
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+const uint16_t kHandoffVersion = 2;
+const size_t kHandoffMaxFds = 200;  // Below the kernel's SCM_MAX_FD (253).
+const int kHandoffTimeoutMs = 10000;  // Either side gives up on a peer silent for this long.
+
+enum HandoffMessage {
+    HANDOFF_REQUEST = 1,
+    HANDOFF_STATE = 2,
+    HANDOFF_CONNECTIONS = 3,
+    HANDOFF_DONE = 4,
+    HANDOFF_ACCEPTED = 5,
+    HANDOFF_DETACHED = 6,
+};
+
+// A frame waiting in an outbound queue. The first one of a queue may be the
+// unsent rest of a frame that was partly written.
+struct HandoffFrame {
+    uint8_t kind;  // FrameKind.
+    bool packable;
+    std::string bytes;
+};
+
+struct HandoffConnection {
+    std::string ip_address;
+    std::string username;  // Empty if the connection never registered.
+    uint32_t slot;  // Session slot; only meaningful with a username.
+    uint8_t status;
+    int64_t last_activity_ms;  // steady_clock, which both processes share.
+    uint64_t resume_key[2];  // All zero if none was issued.
+    int64_t detached_until_ms;  // When a detached session expires (steady_clock); 0 while attached.
+    bool batched_delivery;
+    bool compress;
+    bool presence_subscribed;
+    bool slow;
+    std::vector<std::string> rooms;
+    std::string inbound;  // Start of a request that has not fully arrived.
+    std::vector<HandoffFrame> outbound;
+};
+
+struct HandoffState {
+    std::string mode;  // I/O model; the new process keeps the old one's.
+    uint64_t presence_version;
+    std::vector<uint32_t> generations;  // Of every session slot handed out.
+    std::vector<std::string> known_users;  // Recipients the offline queue accepts.
+};
+
+void encode_handoff_state(const HandoffState& state, std::string* out);
+bool decode_handoff_state(const std::string& data, HandoffState* state);
+void encode_handoff_connections(const std::vector<HandoffConnection>& connections, std::string* out);
+bool decode_handoff_connections(const std::string& data, std::vector<HandoffConnection>* connections);
+
+// Binds a Unix socket that only this user may connect to, at a temporary
+// path next to `path`. Returns the listening socket or -1. Nothing can reach
+// it until handoff_publish() renames it over `path`, which replaces a stale
+// socket or the one of the server being taken over in a single step.
+int handoff_listen(const std::string& path);
+bool handoff_publish(const std::string& path);
+int handoff_connect(const std::string& path);
+
+// Accepts a connection from a process of the same user; -1 on error.
+int handoff_accept(int listen_fd);
+
+// Both return false once the peer is gone, misbehaves or stays silent for
+// kHandoffTimeoutMs. Received descriptors are close-on-exec.
+bool handoff_send(int fd, HandoffMessage type, const std::string& payload, const std::vector<int>& fds);
+bool handoff_receive(int fd, HandoffMessage* type, std::string* payload, std::vector<int>* fds);
+
+#endif
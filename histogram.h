@@ -0,0 +1,126 @@
+#ifndef CHAT_HISTOGRAM_H
+#define CHAT_HISTOGRAM_H
+
+// Fixed-precision latency histogram in the style of HdrHistogram.
+//
+// Values (nanoseconds) are kept in power-of-two buckets, each split into
+// 1024 linear sub-buckets, so every recorded value is exact to within
+// 0.1% no matter its magnitude, recording is a couple of shifts and an
+// increment, and histograms from several threads merge by adding counts.
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+class LatencyHistogram {
+public:
+    LatencyHistogram() : counts_(kCountsLength, 0), total_(0), min_(UINT64_MAX), max_(0), sum_(0) {}
+
+    void record(uint64_t value) {
+        value = std::min(value, kMaxValue);
+        counts_[index_for(value)]++;
+        total_++;
+        sum_ += value;
+        min_ = std::min(min_, value);
+        max_ = std::max(max_, value);
+    }
+
+    void merge(const LatencyHistogram& other) {
+        for (size_t i = 0; i < kCountsLength; i++) {
+            counts_[i] += other.counts_[i];
+        }
+        total_ += other.total_;
+        sum_ += other.sum_;
+        min_ = std::min(min_, other.min_);
+        max_ = std::max(max_, other.max_);
+    }
+
+    uint64_t count() const { return total_; }
+    uint64_t min() const { return total_ == 0 ? 0 : min_; }
+    uint64_t max() const { return max_; }
+    double mean() const { return total_ == 0 ? 0.0 : double(sum_) / total_; }
+
+    // Smallest recorded value v such that `percentile` percent of the
+    // samples are <= v (reported as the top of its sub-bucket).
+    uint64_t percentile(double percentile) const {
+        if (total_ == 0) {
+            return 0;
+        }
+        uint64_t wanted = uint64_t(percentile / 100.0 * total_ + 0.5);
+        wanted = std::max<uint64_t>(1, std::min(wanted, total_));
+        uint64_t seen = 0;
+        for (size_t i = 0; i < kCountsLength; i++) {
+            seen += counts_[i];
+            if (seen >= wanted) {
+                return std::min(value_for(i), max_);
+            }
+        }
+        return max_;
+    }
+
+    // Writes the classic HdrHistogram percentile distribution, with values
+    // divided by `scale` (e.g. 1000 for microseconds).
+    void print_distribution(FILE* out, double scale) const {
+        fprintf(out, "%12s %14s %10s %14s\n\n", "Value", "Percentile", "TotalCount", "1/(1-Percentile)");
+        if (total_ == 0) {
+            return;
+        }
+        uint64_t seen = 0;
+        double next = 0.0;
+        for (size_t i = 0; i < kCountsLength; i++) {
+            if (counts_[i] == 0) {
+                continue;
+            }
+            seen += counts_[i];
+            double reached = double(seen) / total_;
+            if (reached < next && seen != total_) {
+                continue;
+            }
+            double value = std::min(value_for(i), max_) / scale;
+            if (seen == total_) {
+                fprintf(out, "%12.3f %14.12f %10llu\n", value, 1.0, (unsigned long long)seen);
+                break;
+            }
+            fprintf(out, "%12.3f %14.12f %10llu %14.2f\n", value, reached, (unsigned long long)seen, 1.0 / (1.0 - reached));
+            // Rows get denser towards 100%: each one covers a fifth of what is left.
+            next = reached + (1.0 - reached) / 5.0;
+        }
+        fprintf(out, "#[Mean = %.3f, Max = %.3f, Total count = %llu]\n",
+                mean() / scale, max_ / scale, (unsigned long long)total_);
+    }
+
+private:
+    static constexpr int kSubBucketBits = 11;
+    static constexpr uint64_t kSubBucketCount = uint64_t(1) << kSubBucketBits;
+    static constexpr uint64_t kSubBucketHalf = kSubBucketCount / 2;
+    static constexpr int kMaxBits = 44;  // About 4.9 hours in nanoseconds.
+    static constexpr uint64_t kMaxValue = (uint64_t(1) << kMaxBits) - 1;
+    static constexpr size_t kCountsLength = (kMaxBits - kSubBucketBits + 2) * kSubBucketHalf;
+
+    static size_t index_for(uint64_t value) {
+        if (value < kSubBucketCount) {
+            return value;
+        }
+        int shift = 63 - __builtin_clzll(value) - (kSubBucketBits - 1);
+        return (shift + 1) * kSubBucketHalf + ((value >> shift) - kSubBucketHalf);
+    }
+
+    // Highest value that maps to the given index.
+    static uint64_t value_for(size_t index) {
+        if (index < kSubBucketCount) {
+            return index;
+        }
+        int shift = int(index / kSubBucketHalf) - 1;
+        uint64_t sub_bucket = index % kSubBucketHalf + kSubBucketHalf;
+        return ((sub_bucket + 1) << shift) - 1;
+    }
+
+    std::vector<uint64_t> counts_;
+    uint64_t total_;
+    uint64_t min_;
+    uint64_t max_;
+    uint64_t sum_;
+};
+
+#endif
@@ -0,0 +1,906 @@
+// Headless load generator for the chat server.
+//
+// Opens one connection per simulated user, registers them all, then drives
+// an open-loop mix of direct and broadcast messages, GET_USERS and
+// UPDATE_STATUS requests at a fixed target rate, spread over a few worker
+// threads. Every operation is timed from the moment it was scheduled to be
+// sent (so a stalled server shows up as latency instead of silently lowering
+// the offered load) until its response arrives; messages are additionally
+// timed until the INCOMING_MESSAGE reaches each recipient, using a send
+// timestamp carried in the message content.
+//
+// Users register with accept_batched_delivery. With --batch, each user
+// coalesces its messages into SEND_MESSAGE_BATCH requests, the way a bot
+// using the client's MessageBatcher would.
+//
+// With --compress on they also accept compression, and send frames above the
+// threshold the server answers with compressed, like the client does. The
+// report then compares the bytes on the wire with the bytes of the frames,
+// and shows what compressing cost the server. Message content is filled with
+// words rather than a single repeated byte so ratios are realistic.
+//
+// With --address id, direct messages name their recipient by the user id
+// the server assigned at registration instead of by username.
+//
+// With --resume-storm on, once the traffic has drained every user drops its
+// connection and resumes its session on a new one, all at the same time,
+// like clients coming back after a network blip.
+//
+//     ./loadgen 127.0.0.1 8080 --users 1000 --rate 20000 --duration 10
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <deque>
+#include <random>
+#include <chrono>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <pthread.h>
+#include <fcntl.h>
+#include <signal.h>
+#include <unistd.h>
+#include <arpa/inet.h>
+#include <netinet/tcp.h>
+#include <sys/epoll.h>
+#include <sys/resource.h>
+#include <sys/time.h>
+#include "chat.pb.h"
+#include "framing.h"
+#include "histogram.h"
+
+enum OpKind {
+    OP_REGISTER,
+    OP_RESUME,
+    OP_DIRECT,
+    OP_BROADCAST,
+    OP_GET_USERS,
+    OP_STATUS,
+    OP_COUNT,
+};
+
+const char* kOpNames[OP_COUNT] = {"register", "resume", "direct", "broadcast", "get_users", "status"};
+
+struct Options {
+    std::string host = "127.0.0.1";
+    int port = 0;
+    int users = 1000;
+    int threads = 0;       // 0: one per CPU, at most 4.
+    int duration = 10;     // Measured seconds.
+    int warmup = 2;        // Seconds of traffic before measuring.
+    int rate = 10000;      // Operations per second, all threads together.
+    size_t payload = 64;   // Message content size in bytes.
+    int batch = 1;         // Messages per SEND_MESSAGE_BATCH; 1 sends them one by one.
+    int batch_window = 5;  // Milliseconds a message may wait for its batch to fill.
+    bool compress = false;
+    bool address_by_id = false;
+    bool resume_storm = false;
+    std::string prefix = "lg";
+    std::string histogram_file;
+    int mix[OP_COUNT] = {0, 0, 80, 2, 3, 15};
+};
+
+Options options;
+std::vector<std::string> usernames;
+std::vector<uint64_t> user_ids;  // From each REGISTER_USER answer; read once everyone has registered.
+pthread_barrier_t registered_barrier;
+std::atomic<int64_t> traffic_start_ns(0);
+std::string filler;  // Text message content is cut from.
+
+int64_t now_ns() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+struct Pending {
+    OpKind op;
+    int64_t scheduled_ns;
+    int batch_size;  // Messages answered by this response if it is a batch, else 0.
+};
+
+struct Session {
+    int socket;
+    int index;
+    FrameBuffer inbound;
+    std::deque<Pending> pending;  // The server answers each connection in order.
+    std::deque<Pending> batched;  // Messages of the batches in `pending`, in order.
+    chat::Request batch;          // Messages waiting to be sent as a batch.
+    int64_t batch_opened_ns;
+    size_t compress_threshold;    // From the REGISTER_USER answer; 0 while not compressing.
+    std::string resume_token;     // From the last REGISTER_USER or RESUME answer.
+};
+
+struct Worker {
+    int id;
+    std::vector<Session*> sessions;
+    std::vector<Session*> open_batches;
+    int epoll_fd;
+    std::mt19937_64 rng;
+    std::string frame;
+    std::string compressed;
+    chat::Request request;
+    chat::Response response;
+
+    // Samples are only recorded for operations scheduled inside the window.
+    int64_t window_start_ns;
+    int64_t window_end_ns;
+
+    LatencyHistogram responses[OP_COUNT];
+    LatencyHistogram deliveries[2];  // Indexed by chat::MessageType.
+    uint64_t sent[OP_COUNT];
+    uint64_t answered[OP_COUNT];
+    uint64_t delivered[2];
+    uint64_t errors;
+    bool failed;
+
+    // Traffic volume over the whole run: bytes on the wire, and the size of
+    // the same frames uncompressed.
+    uint64_t wire_in;
+    uint64_t frame_in;
+    uint64_t wire_out;
+    uint64_t frame_out;
+};
+
+bool in_window(const Worker& worker, int64_t scheduled_ns) {
+    return scheduled_ns >= worker.window_start_ns && scheduled_ns < worker.window_end_ns;
+}
+
+void raise_fd_limit() {
+    rlimit limit;
+    if (getrlimit(RLIMIT_NOFILE, &limit) == 0 && limit.rlim_cur < limit.rlim_max) {
+        limit.rlim_cur = limit.rlim_max;
+        setrlimit(RLIMIT_NOFILE, &limit);
+    }
+}
+
+int connect_to_server() {
+    sockaddr_in address;
+    memset(&address, 0, sizeof(address));
+    address.sin_family = AF_INET;
+    address.sin_port = htons(options.port);
+    if (inet_pton(AF_INET, options.host.c_str(), &address.sin_addr) <= 0) {
+        return -1;
+    }
+
+    // The server may still be starting when a benchmark script launches us.
+    for (int attempt = 0; attempt < 50; attempt++) {
+        int sock = socket(AF_INET, SOCK_STREAM, 0);
+        if (sock < 0) {
+            return -1;
+        }
+        if (connect(sock, (sockaddr*)&address, sizeof(address)) == 0) {
+            int enable = 1;
+            setsockopt(sock, IPPROTO_TCP, TCP_NODELAY, &enable, sizeof(enable));
+            fcntl(sock, F_SETFL, fcntl(sock, F_GETFL, 0) | O_NONBLOCK);
+            return sock;
+        }
+        close(sock);
+        if (errno != ECONNREFUSED) {
+            return -1;
+        }
+        usleep(100 * 1000);
+    }
+    return -1;
+}
+
+void fill_message(Worker& worker, Session* session, OpKind op, int64_t scheduled_ns, chat::SendMessageRequest* message) {
+    if (op == OP_DIRECT) {
+        int recipient = worker.rng() % usernames.size();
+        if (recipient == session->index && usernames.size() > 1) {
+            recipient = (recipient + 1) % usernames.size();
+        }
+        if (options.address_by_id && user_ids[recipient] != 0) {
+            message->set_recipient_id(user_ids[recipient]);
+        } else {
+            message->set_recipient(usernames[recipient]);
+        }
+    }
+    // The content starts with the scheduled send time so whoever
+    // receives it can compute the end-to-end latency.
+    std::string* content = message->mutable_content();
+    *content = std::to_string(scheduled_ns);
+    content->push_back(' ');
+    if (content->size() < options.payload) {
+        size_t length = options.payload - content->size();
+        content->append(filler, worker.rng() % (filler.size() - length), length);
+    }
+}
+
+// Words in random order, enough to cut any payload from at a random offset.
+void build_filler() {
+    static const char* const kWords[] = {
+        "the", "server", "message", "hello", "room", "status", "online", "send", "queue", "frame", "latency",
+        "user", "chat", "again", "tomorrow", "meeting", "thanks", "please", "review", "build", "deploy", "broken",
+        "fixed", "test", "coffee", "lunch", "where", "when", "why", "maybe", "sure", "okay", "done", "later",
+        "project", "deadline", "network", "socket", "thread", "compile", "error", "warning", "commit", "branch",
+    };
+    std::mt19937_64 rng(42);
+    while (filler.size() < options.payload + 64 * 1024) {
+        filler += kWords[rng() % (sizeof(kWords) / sizeof(kWords[0]))];
+        filler.push_back(' ');
+    }
+}
+
+void write_frame(Worker& worker, Session* session, const chat::Request& request) {
+    serialize_frame(request, &worker.frame);
+    const std::string& frame = compress_frame(worker.frame, session->compress_threshold, Z_BEST_SPEED, &worker.compressed)
+                                   ? worker.compressed : worker.frame;
+    worker.frame_out += worker.frame.size();
+    worker.wire_out += frame.size();
+    if (!write_all(session->socket, frame.data(), frame.size())) {
+        worker.failed = true;
+    }
+}
+
+void flush_batch(Worker& worker, Session* session) {
+    int size = session->batch.send_message_batch().messages_size();
+    if (size == 0) {
+        return;
+    }
+    session->pending.push_back({OP_DIRECT, session->batch_opened_ns, size});
+    write_frame(worker, session, session->batch);
+    session->batch.mutable_send_message_batch()->clear_messages();
+}
+
+// Sends the batches that are full or have waited long enough (all of them
+// when `all` is set).
+void flush_batches(Worker& worker, bool all) {
+    int64_t due = now_ns() - int64_t(options.batch_window) * 1000000;
+    size_t kept = 0;
+    for (Session* session : worker.open_batches) {
+        int size = session->batch.send_message_batch().messages_size();
+        if (all || size >= options.batch || session->batch_opened_ns <= due) {
+            flush_batch(worker, session);
+        } else if (size > 0) {
+            worker.open_batches[kept++] = session;
+        }
+    }
+    worker.open_batches.resize(kept);
+}
+
+void send_request(Worker& worker, Session* session, OpKind op, int64_t scheduled_ns) {
+    if (options.batch > 1 && (op == OP_DIRECT || op == OP_BROADCAST)) {
+        chat::SendMessageBatchRequest* batch = session->batch.mutable_send_message_batch();
+        if (batch->messages_size() == 0) {
+            session->batch.set_operation(chat::Operation::SEND_MESSAGE_BATCH);
+            session->batch_opened_ns = now_ns();
+            worker.open_batches.push_back(session);
+        }
+        fill_message(worker, session, op, scheduled_ns, batch->add_messages());
+        session->batched.push_back({op, scheduled_ns, 0});
+        worker.sent[op]++;
+        return;
+    }
+
+    chat::Request& request = worker.request;
+    request.Clear();
+    switch (op) {
+        case OP_REGISTER:
+            request.set_operation(chat::Operation::REGISTER_USER);
+            request.mutable_register_user()->set_username(usernames[session->index]);
+            request.mutable_register_user()->set_accept_batched_delivery(true);
+            request.mutable_register_user()->set_accept_compression(options.compress);
+            break;
+        case OP_RESUME:
+            request.set_operation(chat::Operation::RESUME);
+            request.mutable_resume()->set_token(session->resume_token);
+            break;
+        case OP_DIRECT:
+        case OP_BROADCAST:
+            request.set_operation(chat::Operation::SEND_MESSAGE);
+            fill_message(worker, session, op, scheduled_ns, request.mutable_send_message());
+            break;
+        case OP_GET_USERS:
+            request.set_operation(chat::Operation::GET_USERS);
+            request.mutable_get_users();
+            break;
+        case OP_STATUS:
+            // Stay ONLINE: a BUSY user would stop receiving messages and
+            // skew the delivery numbers.
+            request.set_operation(chat::Operation::UPDATE_STATUS);
+            request.mutable_update_status()->set_username(usernames[session->index]);
+            request.mutable_update_status()->set_new_status(chat::UserStatus::ONLINE);
+            break;
+        default:
+            return;
+    }
+
+    session->pending.push_back({op, scheduled_ns, 0});
+    worker.sent[op]++;
+    write_frame(worker, session, request);
+}
+
+void record_delivery(Worker& worker, const chat::IncomingMessageResponse& message, int64_t received_ns) {
+    int64_t scheduled_ns = strtoll(message.content().c_str(), nullptr, 10);
+    int type = message.type() == chat::MessageType::DIRECT ? 1 : 0;
+    if (in_window(worker, scheduled_ns)) {
+        worker.deliveries[type].record(received_ns - scheduled_ns);
+        worker.delivered[type]++;
+    }
+}
+
+void record_answer(Worker& worker, const Pending& pending, bool ok, int64_t received_ns) {
+    worker.answered[pending.op]++;
+    if (!ok) {
+        worker.errors++;
+    }
+    if (pending.op == OP_REGISTER || pending.op == OP_RESUME || in_window(worker, pending.scheduled_ns)) {
+        worker.responses[pending.op].record(received_ns - pending.scheduled_ns);
+    }
+}
+
+void handle_frame(Worker& worker, Session* session, const char* data, uint32_t size) {
+    int64_t received_ns = now_ns();
+    worker.frame_in += kFrameHeaderSize + size;
+    chat::Response& response = worker.response;
+    if (!response.ParseFromArray(data, size)) {
+        worker.errors++;
+        return;
+    }
+
+    if (response.operation() == chat::Operation::INCOMING_MESSAGE) {
+        record_delivery(worker, response.incoming_message(), received_ns);
+        return;
+    }
+    if (response.operation() == chat::Operation::INCOMING_MESSAGE_BATCH) {
+        for (const chat::IncomingMessageResponse& message : response.incoming_messages()) {
+            record_delivery(worker, message, received_ns);
+        }
+        return;
+    }
+
+    if (session->pending.empty()) {
+        worker.errors++;
+        return;
+    }
+    Pending pending = session->pending.front();
+    session->pending.pop_front();
+    if (pending.op == OP_RESUME && response.status_code() == chat::StatusCode::CONFLICT) {
+        // The server has not seen the old connection drop yet. Timed from
+        // the first attempt.
+        send_request(worker, session, OP_RESUME, pending.scheduled_ns);
+        return;
+    }
+    if (pending.op == OP_REGISTER || pending.op == OP_RESUME) {
+        session->compress_threshold = response.compression_threshold();
+        session->resume_token = response.resume_token();
+    }
+    if (pending.op == OP_REGISTER) {
+        user_ids[session->index] = response.user_id();
+    }
+    if (pending.batch_size == 0) {
+        record_answer(worker, pending, response.status_code() == chat::StatusCode::OK, received_ns);
+        return;
+    }
+    const chat::SendMessageBatchResponse& results = response.message_batch();
+    for (int i = 0; i < pending.batch_size && !session->batched.empty(); i++) {
+        bool ok = i < results.results_size() && results.results(i) == chat::StatusCode::OK;
+        record_answer(worker, session->batched.front(), ok, received_ns);
+        session->batched.pop_front();
+    }
+}
+
+bool handle_readable(Worker& worker, Session* session) {
+    while (true) {
+        ssize_t bytes_read = session->inbound.read_from(session->socket);
+        if (bytes_read == 0) {
+            return false;
+        }
+        if (bytes_read < 0) {
+            return errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR;
+        }
+        worker.wire_in += bytes_read;
+        const char* payload;
+        uint32_t size;
+        while (session->inbound.next_frame(&payload, &size)) {
+            handle_frame(worker, session, payload, size);
+        }
+        if (session->inbound.error()) {
+            return false;
+        }
+    }
+}
+
+// Waits for socket activity for up to timeout_ms. Returns false once a
+// connection was lost.
+bool poll_sessions(Worker& worker, int timeout_ms) {
+    epoll_event events[256];
+    int count = epoll_wait(worker.epoll_fd, events, 256, timeout_ms);
+    for (int i = 0; i < count; i++) {
+        Session* session = static_cast<Session*>(events[i].data.ptr);
+        if (!handle_readable(worker, session)) {
+            std::cerr << "Connection of " << usernames[session->index] << " closed by the server" << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
+
+size_t pending_total(const Worker& worker) {
+    size_t total = 0;
+    for (Session* session : worker.sessions) {
+        total += session->pending.size();
+    }
+    return total;
+}
+
+OpKind pick_op(Worker& worker, int mix_total) {
+    int roll = worker.rng() % mix_total;
+    for (int op = OP_DIRECT; op < OP_COUNT; op++) {
+        if (roll < options.mix[op]) {
+            return static_cast<OpKind>(op);
+        }
+        roll -= options.mix[op];
+    }
+    return OP_DIRECT;
+}
+
+bool register_sessions(Worker& worker) {
+    for (Session* session : worker.sessions) {
+        session->socket = connect_to_server();
+        if (session->socket < 0) {
+            std::cerr << "Could not connect to " << options.host << ":" << options.port << std::endl;
+            return false;
+        }
+        epoll_event event;
+        event.events = EPOLLIN;
+        event.data.ptr = session;
+        epoll_ctl(worker.epoll_fd, EPOLL_CTL_ADD, session->socket, &event);
+        send_request(worker, session, OP_REGISTER, now_ns());
+    }
+
+    int64_t deadline = now_ns() + int64_t(10) * 1000000000;
+    while (pending_total(worker) > 0) {
+        if (worker.failed || now_ns() > deadline || !poll_sessions(worker, 100)) {
+            std::cerr << "Registration did not complete" << std::endl;
+            return false;
+        }
+    }
+    return worker.errors == 0;
+}
+
+// Closes every connection, then resumes each session on a new one.
+bool resume_sessions(Worker& worker) {
+    for (Session* session : worker.sessions) {
+        epoll_ctl(worker.epoll_fd, EPOLL_CTL_DEL, session->socket, nullptr);
+        close(session->socket);
+        session->inbound.reset();
+        session->pending.clear();
+        session->batched.clear();
+    }
+    for (Session* session : worker.sessions) {
+        session->socket = connect_to_server();
+        if (session->socket < 0) {
+            std::cerr << "Could not reconnect to " << options.host << ":" << options.port << std::endl;
+            return false;
+        }
+        epoll_event event;
+        event.events = EPOLLIN;
+        event.data.ptr = session;
+        epoll_ctl(worker.epoll_fd, EPOLL_CTL_ADD, session->socket, &event);
+        send_request(worker, session, OP_RESUME, now_ns());
+    }
+
+    uint64_t errors = worker.errors;
+    int64_t deadline = now_ns() + int64_t(10) * 1000000000;
+    while (pending_total(worker) > 0) {
+        if (worker.failed || now_ns() > deadline || !poll_sessions(worker, 100)) {
+            std::cerr << "Resuming did not complete" << std::endl;
+            return false;
+        }
+    }
+    return worker.errors == errors;
+}
+
+void* run_worker(void* arg) {
+    Worker& worker = *static_cast<Worker*>(arg);
+    bool registered = register_sessions(worker);
+    if (!registered) {
+        worker.failed = true;
+    }
+    pthread_barrier_wait(&registered_barrier);
+    if (!registered) {
+        return nullptr;
+    }
+
+    // The main thread publishes the common start time (or -1 if another
+    // worker failed to register) right after the barrier.
+    int64_t start;
+    while ((start = traffic_start_ns.load()) == 0) {
+        usleep(1000);
+    }
+    if (start < 0) {
+        return nullptr;
+    }
+    worker.window_start_ns = start + int64_t(options.warmup) * 1000000000;
+    worker.window_end_ns = worker.window_start_ns + int64_t(options.duration) * 1000000000;
+
+    int mix_total = 0;
+    for (int op = OP_DIRECT; op < OP_COUNT; op++) {
+        mix_total += options.mix[op];
+    }
+
+    // Each thread offers an equal share of the rate, staggered so the
+    // threads do not all fire on the same instant.
+    double interval_ns = 1e9 * options.threads / options.rate;
+    double next_ns = start + interval_ns * worker.id / options.threads;
+    int64_t drain_deadline = worker.window_end_ns + int64_t(5) * 1000000000;
+
+    while (!worker.failed) {
+        int64_t now = now_ns();
+        while (next_ns <= now && next_ns < worker.window_end_ns) {
+            Session* session = worker.sessions[worker.rng() % worker.sessions.size()];
+            send_request(worker, session, pick_op(worker, mix_total), int64_t(next_ns));
+            next_ns += interval_ns;
+        }
+        flush_batches(worker, next_ns >= worker.window_end_ns);
+
+        int timeout_ms;
+        if (next_ns < worker.window_end_ns) {
+            timeout_ms = int((int64_t(next_ns) - now_ns()) / 1000000);
+            if (!worker.open_batches.empty()) {
+                timeout_ms = std::min(timeout_ms, options.batch_window);
+            }
+            timeout_ms = std::max(timeout_ms, 0);
+        } else {
+            // Done sending; keep reading until every request was answered
+            // and late deliveries had a chance to arrive.
+            if (now >= drain_deadline || (pending_total(worker) == 0 && now >= worker.window_end_ns + 500000000)) {
+                break;
+            }
+            timeout_ms = 50;
+        }
+        if (!poll_sessions(worker, timeout_ms)) {
+            worker.failed = true;
+        }
+    }
+    if (options.resume_storm && !worker.failed && !resume_sessions(worker)) {
+        worker.failed = true;
+    }
+    return nullptr;
+}
+
+// Asks the server for its counters over a connection of our own.
+bool fetch_server_stats(chat::ServerStats* stats) {
+    int sock = connect_to_server();
+    if (sock < 0) {
+        return false;
+    }
+    chat::Request request;
+    request.set_operation(chat::Operation::GET_STATS);
+    bool ok = send_frame(sock, request);
+    FrameBuffer inbound;
+    const char* payload = nullptr;
+    uint32_t size = 0;
+    while (ok && !inbound.next_frame(&payload, &size)) {
+        pollfd pfd = {sock, POLLIN, 0};
+        ok = poll(&pfd, 1, 5000) > 0 && inbound.read_from(sock) > 0;
+    }
+    chat::Response response;
+    ok = ok && response.ParseFromArray(payload, size) && response.operation() == chat::Operation::GET_STATS;
+    if (ok) {
+        *stats = response.stats();
+    }
+    close(sock);
+    return ok;
+}
+
+double cpu_seconds() {
+    rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_utime.tv_sec + usage.ru_stime.tv_sec + (usage.ru_utime.tv_usec + usage.ru_stime.tv_usec) / 1e6;
+}
+
+double ratio(uint64_t before, uint64_t after) {
+    return after == 0 ? 1.0 : double(before) / double(after);
+}
+
+void print_row(const char* name, const LatencyHistogram& histogram, double seconds) {
+    if (histogram.count() == 0) {
+        return;
+    }
+    // Registrations and resumes happen outside the window, so they get no rate.
+    std::string rate = seconds > 0 ? std::to_string(uint64_t(histogram.count() / seconds)) : "-";
+    printf("%-18s %10llu %10s %10.1f %10.1f %10.1f %10.1f\n", name,
+           (unsigned long long)histogram.count(), rate.c_str(),
+           histogram.percentile(50.0) / 1000.0, histogram.percentile(99.0) / 1000.0,
+           histogram.percentile(99.9) / 1000.0, histogram.max() / 1000.0);
+}
+
+bool parse_mix(const std::string& value) {
+    int mix[OP_COUNT] = {};
+    size_t start = 0;
+    while (start < value.size()) {
+        size_t end = value.find(',', start);
+        if (end == std::string::npos) {
+            end = value.size();
+        }
+        std::string item = value.substr(start, end - start);
+        size_t equals = item.find('=');
+        if (equals == std::string::npos) {
+            return false;
+        }
+        std::string name = item.substr(0, equals);
+        int op = OP_DIRECT;
+        while (op < OP_COUNT && name != kOpNames[op]) {
+            op++;
+        }
+        if (op == OP_COUNT) {
+            return false;
+        }
+        mix[op] = std::stoi(item.substr(equals + 1));
+        start = end + 1;
+    }
+    int total = 0;
+    for (int op = OP_DIRECT; op < OP_COUNT; op++) {
+        options.mix[op] = mix[op];
+        total += mix[op];
+    }
+    return total > 0;
+}
+
+void print_usage(const char* program) {
+    std::cerr << "Usage: " << program << " <server_ip> <server_port> [options]\n"
+              << "  --users <n>            Simulated users, one connection each (default: 1000)\n"
+              << "  --threads <n>          Worker threads (default: one per CPU, at most 4)\n"
+              << "  --rate <ops/s>         Target operations per second (default: 10000)\n"
+              << "  --duration <s>         Measured seconds (default: 10)\n"
+              << "  --warmup <s>           Unmeasured seconds before that (default: 2)\n"
+              << "  --payload <bytes>      Message content size (default: 64)\n"
+              << "  --batch <n>            Send each user's messages in batches of up to <n> (default: 1)\n"
+              << "  --batch-window <ms>    Longest a message waits for its batch (default: 5)\n"
+              << "  --compress on|off      Negotiate frame compression (default: off)\n"
+              << "  --address name|id      Address direct messages by username or by user id (default: name)\n"
+              << "  --resume-storm on|off  Afterwards, drop every connection and resume all sessions at once (default: off)\n"
+              << "  --mix <op=w,...>       Weights for direct, broadcast, get_users, status\n"
+              << "                         (default: direct=80,broadcast=2,get_users=3,status=15)\n"
+              << "  --prefix <name>        Username prefix (default: lg)\n"
+              << "  --histogram <file>     Write full percentile distributions to <file>" << std::endl;
+}
+
+int main(int argc, char const* argv[]) {
+    if (argc < 3 || argc % 2 != 1) {
+        print_usage(argv[0]);
+        return -1;
+    }
+    options.host = argv[1];
+    options.port = std::stoi(argv[2]);
+    for (int i = 3; i + 1 < argc; i += 2) {
+        std::string option = argv[i];
+        std::string value = argv[i + 1];
+        if (option == "--users") {
+            options.users = std::stoi(value);
+        } else if (option == "--threads") {
+            options.threads = std::stoi(value);
+        } else if (option == "--rate") {
+            options.rate = std::stoi(value);
+        } else if (option == "--duration") {
+            options.duration = std::stoi(value);
+        } else if (option == "--warmup") {
+            options.warmup = std::stoi(value);
+        } else if (option == "--payload") {
+            options.payload = std::stoul(value);
+        } else if (option == "--batch") {
+            options.batch = std::stoi(value);
+        } else if (option == "--batch-window") {
+            options.batch_window = std::stoi(value);
+        } else if (option == "--compress") {
+            if (value != "on" && value != "off") {
+                std::cerr << "--compress takes on or off" << std::endl;
+                return -1;
+            }
+            options.compress = value == "on";
+        } else if (option == "--address") {
+            if (value != "name" && value != "id") {
+                std::cerr << "--address takes name or id" << std::endl;
+                return -1;
+            }
+            options.address_by_id = value == "id";
+        } else if (option == "--resume-storm") {
+            if (value != "on" && value != "off") {
+                std::cerr << "--resume-storm takes on or off" << std::endl;
+                return -1;
+            }
+            options.resume_storm = value == "on";
+        } else if (option == "--mix") {
+            if (!parse_mix(value)) {
+                std::cerr << "Invalid mix: " << value << std::endl;
+                return -1;
+            }
+        } else if (option == "--prefix") {
+            options.prefix = value;
+        } else if (option == "--histogram") {
+            options.histogram_file = value;
+        } else {
+            std::cerr << "Unknown option: " << option << std::endl;
+            print_usage(argv[0]);
+            return -1;
+        }
+    }
+    if (options.users <= 0 || options.threads < 0 || options.rate <= 0 || options.duration <= 0 || options.warmup < 0 ||
+        options.batch <= 0 || options.batch_window < 0) {
+        std::cerr << "Users, threads, rate, duration and batch must be positive" << std::endl;
+        return -1;
+    }
+    if (options.threads == 0) {
+        options.threads = std::max(1, std::min(4, int(sysconf(_SC_NPROCESSORS_ONLN))));
+    }
+    options.threads = std::min(options.threads, options.users);
+
+    signal(SIGPIPE, SIG_IGN);
+    raise_fd_limit();
+
+    for (int i = 0; i < options.users; i++) {
+        usernames.push_back(options.prefix + std::to_string(i));
+    }
+    user_ids.assign(options.users, 0);
+    build_filler();
+
+    std::vector<Worker*> workers;
+    for (int i = 0; i < options.threads; i++) {
+        Worker* worker = new Worker();
+        worker->id = i;
+        worker->epoll_fd = epoll_create1(0);
+        worker->rng.seed(1000 + i);
+        workers.push_back(worker);
+    }
+    for (int i = 0; i < options.users; i++) {
+        Session* session = new Session();
+        session->socket = -1;
+        session->index = i;
+        session->compress_threshold = 0;
+        workers[i % options.threads]->sessions.push_back(session);
+    }
+
+    printf("Load: %d users on %d worker threads, %d ops/s for %d s (+%d s warm-up), %zu byte messages\n",
+           options.users, options.threads, options.rate, options.duration, options.warmup, options.payload);
+    printf("Mix: direct=%d broadcast=%d get_users=%d status=%d, compression %s\n", options.mix[OP_DIRECT],
+           options.mix[OP_BROADCAST], options.mix[OP_GET_USERS], options.mix[OP_STATUS], options.compress ? "on" : "off");
+    fflush(stdout);
+
+    pthread_barrier_init(&registered_barrier, NULL, options.threads + 1);
+    std::vector<pthread_t> threads(options.threads);
+    for (int i = 0; i < options.threads; i++) {
+        pthread_create(&threads[i], NULL, run_worker, workers[i]);
+    }
+    pthread_barrier_wait(&registered_barrier);
+    bool registered = true;
+    for (Worker* worker : workers) {
+        registered = registered && !worker->failed;
+    }
+    // Server counters and our own CPU time are sampled around the traffic.
+    chat::ServerStats stats_before;
+    bool have_stats = registered && fetch_server_stats(&stats_before);
+    double cpu_before = cpu_seconds();
+    if (registered) {
+        traffic_start_ns.store(now_ns());
+    } else {
+        traffic_start_ns.store(-1);
+    }
+    for (pthread_t thread : threads) {
+        pthread_join(thread, NULL);
+    }
+    double cpu_used = cpu_seconds() - cpu_before;
+    chat::ServerStats stats_after;
+    have_stats = have_stats && fetch_server_stats(&stats_after);
+    if (!registered) {
+        std::cerr << "Failed to register all users" << std::endl;
+        return 1;
+    }
+
+    LatencyHistogram responses[OP_COUNT];
+    LatencyHistogram deliveries[2];
+    uint64_t sent = 0;
+    uint64_t answered = 0;
+    uint64_t errors = 0;
+    uint64_t wire_in = 0, frame_in = 0, wire_out = 0, frame_out = 0;
+    bool failed = false;
+    for (Worker* worker : workers) {
+        wire_in += worker->wire_in;
+        frame_in += worker->frame_in;
+        wire_out += worker->wire_out;
+        frame_out += worker->frame_out;
+        for (int op = 0; op < OP_COUNT; op++) {
+            responses[op].merge(worker->responses[op]);
+            if (op != OP_REGISTER && op != OP_RESUME) {
+                sent += worker->sent[op];
+                answered += worker->answered[op];
+            }
+        }
+        deliveries[0].merge(worker->deliveries[0]);
+        deliveries[1].merge(worker->deliveries[1]);
+        errors += worker->errors;
+        failed = failed || worker->failed;
+    }
+
+    double seconds = options.duration;
+    uint64_t measured = 0;
+    for (int op = OP_DIRECT; op < OP_COUNT; op++) {
+        measured += responses[op].count();
+    }
+    printf("\nThroughput: %.0f ops/s answered, %.0f messages/s delivered\n", measured / seconds,
+           (deliveries[0].count() + deliveries[1].count()) / seconds);
+    printf("Requests: %llu sent, %llu answered, %llu errors\n\n", (unsigned long long)sent,
+           (unsigned long long)answered, (unsigned long long)errors);
+    printf("%-18s %10s %10s %10s %10s %10s %10s\n", "latency (us)", "count", "per sec", "p50", "p99", "p99.9", "max");
+    print_row("register", responses[OP_REGISTER], 0);
+    print_row("resume", responses[OP_RESUME], 0);
+    print_row("direct", responses[OP_DIRECT], seconds);
+    print_row("direct delivery", deliveries[chat::MessageType::DIRECT], seconds);
+    print_row("broadcast", responses[OP_BROADCAST], seconds);
+    print_row("broadcast delivery", deliveries[chat::MessageType::BROADCAST], seconds);
+    print_row("get_users", responses[OP_GET_USERS], seconds);
+    print_row("status", responses[OP_STATUS], seconds);
+
+    printf("\nTraffic: received %.1f MB for %.1f MB of frames (ratio %.2f), sent %.1f MB for %.1f MB (ratio %.2f)\n",
+           wire_in / 1e6, frame_in / 1e6, ratio(frame_in, wire_in), wire_out / 1e6, frame_out / 1e6, ratio(frame_out, wire_out));
+    printf("Load generator CPU: %.2f s\n", cpu_used);
+    if (have_stats) {
+        uint64_t frames = stats_after.compressed_frames() - stats_before.compressed_frames();
+        uint64_t in = stats_after.compression_in_bytes() - stats_before.compression_in_bytes();
+        uint64_t out = stats_after.compression_out_bytes() - stats_before.compression_out_bytes();
+        uint64_t cpu_ns = stats_after.compression_cpu_ns() - stats_before.compression_cpu_ns();
+        printf("Server compression: %llu frames, %.1f MB -> %.1f MB (ratio %.2f), %.1f ms CPU (%.1f us per frame)\n",
+               (unsigned long long)frames, in / 1e6, out / 1e6, ratio(in, out), cpu_ns / 1e6,
+               frames == 0 ? 0.0 : cpu_ns / 1e3 / frames);
+
+        // Both samples include one GET_STATS; the difference counts the load.
+        uint64_t requests = 0;
+        for (int i = 0; i < stats_after.operations_size(); i++) {
+            requests += stats_after.operations(i).requests();
+        }
+        for (int i = 0; i < stats_before.operations_size(); i++) {
+            requests -= stats_before.operations(i).requests();
+        }
+        uint64_t reads = stats_after.read_calls() - stats_before.read_calls();
+        uint64_t writes = stats_after.write_calls() - stats_before.write_calls();
+        printf("Server I/O: %.2f reads and %.2f writes per request, up to %llu requests served per wakeup\n",
+               requests == 0 ? 0.0 : double(reads) / requests, requests == 0 ? 0.0 : double(writes) / requests,
+               (unsigned long long)stats_after.pipeline_depth().max());
+        printf("Server sessions: %llu registered, %.0f bytes of registry each\n", (unsigned long long)stats_after.sessions(),
+               stats_after.sessions() == 0 ? 0.0 : double(stats_after.session_bytes()) / stats_after.sessions());
+        uint64_t rosters = stats_after.roster_served() - stats_before.roster_served();
+        if (rosters > 0) {
+            printf("Server user lists: %llu answered from %llu cached builds\n", (unsigned long long)rosters,
+                   (unsigned long long)(stats_after.roster_builds() - stats_before.roster_builds()));
+        }
+        uint64_t resumed = stats_after.resumed_sessions() - stats_before.resumed_sessions();
+        if (resumed > 0) {
+            printf("Server resumes: %llu sessions, %llu frames kept for them, %llu sessions expired\n",
+                   (unsigned long long)resumed,
+                   (unsigned long long)(stats_after.resumed_frames() - stats_before.resumed_frames()),
+                   (unsigned long long)(stats_after.expired_sessions() - stats_before.expired_sessions()));
+        }
+        uint64_t jobs = stats_after.worker_jobs() - stats_before.worker_jobs();
+        if (jobs > 0) {
+            uint64_t stolen = stats_after.stolen_jobs() - stats_before.stolen_jobs();
+            printf("Server workers: %llu jobs, %.2f requests each, %.1f%% stolen\n", (unsigned long long)jobs,
+                   double(requests) / jobs, 100.0 * stolen / jobs);
+        }
+    }
+
+    if (!options.histogram_file.empty()) {
+        FILE* out = fopen(options.histogram_file.c_str(), "w");
+        if (out == nullptr) {
+            perror("fopen");
+            return 1;
+        }
+        const char* names[] = {"direct delivery", "broadcast delivery"};
+        int types[] = {chat::MessageType::DIRECT, chat::MessageType::BROADCAST};
+        for (int i = 0; i < 2; i++) {
+            fprintf(out, "# %s latency (us)\n", names[i]);
+            deliveries[types[i]].print_distribution(out, 1000.0);
+            fprintf(out, "\n");
+        }
+        for (int op = OP_DIRECT; op < OP_COUNT; op++) {
+            fprintf(out, "# %s response latency (us)\n", kOpNames[op]);
+            responses[op].print_distribution(out, 1000.0);
+            fprintf(out, "\n");
+        }
+        fclose(out);
+    }
+
+    return failed || sent != answered ? 1 : 0;
+}
@@ -0,0 +1,284 @@
+#include "log.h"
+
+#include <cstdio>
+#include <ctime>
+#include <vector>
+#include <pthread.h>
+#include <unistd.h>
+
+std::atomic<int> log_min_level(LOG_INFO);
+
+// Single-producer/single-consumer byte ring. Positions only ever grow; the
+// owning thread advances tail, the writer thread advances head.
+struct LogRing {
+    char* data;
+    size_t size;  // Power of two.
+    std::atomic<uint64_t> head;
+    std::atomic<uint64_t> tail;
+    std::atomic<uint64_t> dropped;
+    std::atomic<bool> abandoned;  // Owning thread exited; free once drained.
+};
+
+// Keeps the calling thread's ring and the size of the record it reserved.
+struct LogThreadRing {
+    LogRing* ring = nullptr;
+    size_t pending = 0;
+
+    ~LogThreadRing() {
+        if (ring != nullptr) {
+            ring->abandoned.store(true, std::memory_order_release);
+        }
+    }
+};
+
+static thread_local LogThreadRing thread_ring;
+
+static pthread_mutex_t rings_mutex = PTHREAD_MUTEX_INITIALIZER;
+static std::vector<LogRing*> rings;
+static size_t ring_bytes = 64 * 1024;
+static uint64_t retired_dropped = 0;  // Drops from rings already freed.
+
+static pthread_t writer_thread;
+static bool writer_started = false;
+static std::atomic<bool> writer_stopping(false);
+
+static const char* const kLevelNames[] = {"DEBUG", "INFO ", "WARN ", "ERROR"};
+
+bool log_parse_level(const std::string& name, LogLevel* level) {
+    if (name == "debug") {
+        *level = LOG_DEBUG;
+    } else if (name == "info") {
+        *level = LOG_INFO;
+    } else if (name == "warn") {
+        *level = LOG_WARN;
+    } else if (name == "error") {
+        *level = LOG_ERROR;
+    } else if (name == "off") {
+        *level = LOG_OFF;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+static LogRing* local_ring() {
+    LogRing* ring = thread_ring.ring;
+    if (ring != nullptr) {
+        return ring;
+    }
+
+    ring = new LogRing();
+    pthread_mutex_lock(&rings_mutex);
+    ring->size = ring_bytes;
+    pthread_mutex_unlock(&rings_mutex);
+    ring->data = new char[ring->size];
+    ring->head.store(0, std::memory_order_relaxed);
+    ring->tail.store(0, std::memory_order_relaxed);
+    ring->dropped.store(0, std::memory_order_relaxed);
+    ring->abandoned.store(false, std::memory_order_relaxed);
+
+    pthread_mutex_lock(&rings_mutex);
+    rings.push_back(ring);
+    pthread_mutex_unlock(&rings_mutex);
+    thread_ring.ring = ring;
+    return ring;
+}
+
+char* log_reserve(size_t size) {
+    LogRing* ring = local_ring();
+    uint64_t tail = ring->tail.load(std::memory_order_relaxed);
+    uint64_t head = ring->head.load(std::memory_order_acquire);
+    size_t offset = tail & (ring->size - 1);
+    size_t contiguous = ring->size - offset;
+
+    // Records never wrap: if this one does not fit before the end of the
+    // buffer, the rest of the buffer becomes padding.
+    size_t needed = size <= contiguous ? size : contiguous + size;
+    if (size > ring->size / 2 || ring->size - (tail - head) < needed) {
+        ring->dropped.fetch_add(1, std::memory_order_relaxed);
+        return nullptr;
+    }
+
+    if (size > contiguous) {
+        if (contiguous >= sizeof(LogRecordHeader)) {
+            LogRecordHeader padding = {};
+            padding.size = static_cast<uint32_t>(contiguous);
+            padding.format = nullptr;
+            memcpy(ring->data + offset, &padding, sizeof(padding));
+        }
+        offset = 0;
+    }
+    thread_ring.pending = needed;
+    return ring->data + offset;
+}
+
+void log_commit() {
+    LogRing* ring = thread_ring.ring;
+    uint64_t tail = ring->tail.load(std::memory_order_relaxed);
+    ring->tail.store(tail + thread_ring.pending, std::memory_order_release);
+}
+
+uint64_t log_dropped() {
+    pthread_mutex_lock(&rings_mutex);
+    uint64_t total = retired_dropped;
+    for (LogRing* ring : rings) {
+        total += ring->dropped.load(std::memory_order_relaxed);
+    }
+    pthread_mutex_unlock(&rings_mutex);
+    return total;
+}
+
+static void render_record(const LogRecordHeader& header, const char* args, std::string& out) {
+    static thread_local time_t cached_second = 0;
+    static thread_local char cached_prefix[32];
+
+    time_t second = header.timestamp_ns / 1000000000;
+    if (second != cached_second) {
+        tm local;
+        localtime_r(&second, &local);
+        strftime(cached_prefix, sizeof(cached_prefix), "%Y-%m-%d %H:%M:%S", &local);
+        cached_second = second;
+    }
+    char millis[8];
+    snprintf(millis, sizeof(millis), ".%03d ", int((header.timestamp_ns / 1000000) % 1000));
+    out += cached_prefix;
+    out += millis;
+    out += kLevelNames[header.level < LOG_OFF ? header.level : uint8_t(LOG_ERROR)];
+    out += ' ';
+
+    int remaining = header.arg_count;
+    for (const char* p = header.format; *p != '\0'; p++) {
+        if (p[0] != '{' || p[1] != '}' || remaining == 0) {
+            out += *p;
+            continue;
+        }
+        p++;
+        remaining--;
+
+        uint8_t type = static_cast<uint8_t>(*args++);
+        char number[32];
+        if (type == LOG_ARG_STRING) {
+            uint16_t length;
+            memcpy(&length, args, 2);
+            out.append(args + 2, length);
+            args += 2 + length;
+            continue;
+        }
+        if (type == LOG_ARG_INT) {
+            int64_t value;
+            memcpy(&value, args, 8);
+            snprintf(number, sizeof(number), "%lld", static_cast<long long>(value));
+        } else if (type == LOG_ARG_UINT) {
+            uint64_t value;
+            memcpy(&value, args, 8);
+            snprintf(number, sizeof(number), "%llu", static_cast<unsigned long long>(value));
+        } else {
+            double value;
+            memcpy(&value, args, 8);
+            snprintf(number, sizeof(number), "%g", value);
+        }
+        args += 8;
+        out += number;
+    }
+    out += '\n';
+}
+
+// Renders every committed record of one ring; returns whether it had any.
+static bool drain_ring(LogRing* ring, std::string& out) {
+    uint64_t head = ring->head.load(std::memory_order_relaxed);
+    uint64_t tail = ring->tail.load(std::memory_order_acquire);
+    if (head == tail) {
+        return false;
+    }
+
+    while (head < tail) {
+        size_t offset = head & (ring->size - 1);
+        size_t contiguous = ring->size - offset;
+        if (contiguous < sizeof(LogRecordHeader)) {
+            head += contiguous;
+            continue;
+        }
+        LogRecordHeader header;
+        memcpy(&header, ring->data + offset, sizeof(header));
+        if (header.format != nullptr) {
+            render_record(header, ring->data + offset + sizeof(header), out);
+        }
+        head += header.size;
+    }
+    ring->head.store(head, std::memory_order_release);
+    return true;
+}
+
+static void* writer_main(void*) {
+    std::string out;
+    std::vector<LogRing*> snapshot;
+    uint64_t reported_dropped = 0;
+
+    while (true) {
+        bool stopping = writer_stopping.load(std::memory_order_acquire);
+
+        pthread_mutex_lock(&rings_mutex);
+        snapshot = rings;
+        pthread_mutex_unlock(&rings_mutex);
+
+        bool drained = false;
+        for (LogRing* ring : snapshot) {
+            // Check abandonment first so the final drain sees every record.
+            bool abandoned = ring->abandoned.load(std::memory_order_acquire);
+            drained |= drain_ring(ring, out);
+            if (abandoned) {
+                pthread_mutex_lock(&rings_mutex);
+                rings.erase(std::find(rings.begin(), rings.end(), ring));
+                retired_dropped += ring->dropped.load(std::memory_order_relaxed);
+                pthread_mutex_unlock(&rings_mutex);
+                delete[] ring->data;
+                delete ring;
+            }
+        }
+
+        uint64_t dropped = log_dropped();
+        if (dropped != reported_dropped) {
+            char line[96];
+            snprintf(line, sizeof(line), "WARN  log: %llu records dropped (rings full)\n",
+                     static_cast<unsigned long long>(dropped - reported_dropped));
+            out += line;
+            reported_dropped = dropped;
+        }
+
+        if (!out.empty()) {
+            fwrite(out.data(), 1, out.size(), stdout);
+            fflush(stdout);
+            out.clear();
+        }
+
+        if (stopping) {
+            break;
+        }
+        if (!drained) {
+            usleep(2000);
+        }
+    }
+    return NULL;
+}
+
+void log_start(LogLevel level, size_t ring_size) {
+    size_t size = 4096;
+    while (size < ring_size) {
+        size *= 2;
+    }
+    pthread_mutex_lock(&rings_mutex);
+    ring_bytes = size;
+    pthread_mutex_unlock(&rings_mutex);
+
+    log_min_level.store(level, std::memory_order_relaxed);
+    writer_started = pthread_create(&writer_thread, NULL, writer_main, NULL) == 0;
+}
+
+void log_shutdown() {
+    if (!writer_started) {
+        return;
+    }
+    writer_stopping.store(true, std::memory_order_release);
+    pthread_join(writer_thread, NULL);
+    writer_started = false;
+}
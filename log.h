@@ -0,0 +1,197 @@
+#ifndef CHAT_LOG_H
+#define CHAT_LOG_H
+
+// Asynchronous logging that stays off the request path.
+//
+// Each thread appends compact binary records (timestamp, level, a pointer to
+// the format string and the raw arguments) to its own single-producer ring
+// buffer; a background thread drains every ring, renders the text and writes
+// it out in batches. Logging never takes a lock and never blocks: when a
+// ring is full the record is dropped and counted, and the writer reports the
+// drop count.
+//
+// Formats use "{}" placeholders and must be string literals, since only the
+// pointer is stored:
+//
+//     log_info("User registered: {} with IP: {}", username, ip_address);
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+
+enum LogLevel {
+    LOG_DEBUG = 0,
+    LOG_INFO = 1,
+    LOG_WARN = 2,
+    LOG_ERROR = 3,
+    LOG_OFF = 4,
+};
+
+enum LogArgType : uint8_t {
+    LOG_ARG_INT = 0,
+    LOG_ARG_UINT = 1,
+    LOG_ARG_DOUBLE = 2,
+    LOG_ARG_STRING = 3,
+};
+
+// Record layout in the ring: this header, then per argument one type byte
+// followed by 8 bytes (numbers) or a 2-byte length and the bytes (strings).
+// Records are padded to 8 bytes.
+struct LogRecordHeader {
+    uint32_t size;  // Whole record including padding; a zero format marks ring padding.
+    uint8_t level;
+    uint8_t arg_count;
+    uint16_t reserved;
+    int64_t timestamp_ns;
+    const char* format;
+};
+
+const size_t kLogMaxStringArg = 1024;
+
+extern std::atomic<int> log_min_level;
+
+// Parses "debug", "info", "warn", "error" or "off".
+bool log_parse_level(const std::string& name, LogLevel* level);
+
+// Starts the writer thread. Records logged before this are kept in the
+// rings and written once it runs.
+void log_start(LogLevel level, size_t ring_bytes);
+
+// Drains everything still buffered and stops the writer.
+void log_shutdown();
+
+// Records dropped so far because a thread's ring was full.
+uint64_t log_dropped();
+
+inline bool log_enabled(LogLevel level) {
+    return level >= log_min_level.load(std::memory_order_relaxed);
+}
+
+// Reserves space for one record in the calling thread's ring, or returns
+// nullptr (and counts a drop) if it does not fit. log_commit() publishes the
+// reserved record to the writer.
+char* log_reserve(size_t size);
+void log_commit();
+
+inline size_t log_arg_size(const std::string& value) {
+    return 1 + 2 + std::min(value.size(), kLogMaxStringArg);
+}
+
+inline size_t log_arg_size(const char* value) {
+    return 1 + 2 + std::min(strlen(value), kLogMaxStringArg);
+}
+
+template <typename T>
+inline typename std::enable_if<std::is_arithmetic<T>::value || std::is_enum<T>::value, size_t>::type
+log_arg_size(T) {
+    return 1 + 8;
+}
+
+inline void log_encode_string(char*& out, const char* data, size_t size) {
+    uint16_t length = static_cast<uint16_t>(std::min(size, kLogMaxStringArg));
+    *out++ = LOG_ARG_STRING;
+    memcpy(out, &length, 2);
+    memcpy(out + 2, data, length);
+    out += 2 + length;
+}
+
+inline void log_encode(char*& out, const std::string& value) {
+    log_encode_string(out, value.data(), value.size());
+}
+
+inline void log_encode(char*& out, const char* value) {
+    log_encode_string(out, value, strlen(value));
+}
+
+template <typename T>
+inline typename std::enable_if<std::is_floating_point<T>::value>::type
+log_encode(char*& out, T value) {
+    double number = value;
+    *out++ = LOG_ARG_DOUBLE;
+    memcpy(out, &number, 8);
+    out += 8;
+}
+
+template <typename T>
+inline typename std::enable_if<std::is_integral<T>::value || std::is_enum<T>::value>::type
+log_encode(char*& out, T value) {
+    if (std::is_signed<T>::value || std::is_enum<T>::value) {
+        int64_t number = static_cast<int64_t>(value);
+        *out++ = LOG_ARG_INT;
+        memcpy(out, &number, 8);
+    } else {
+        uint64_t number = static_cast<uint64_t>(value);
+        *out++ = LOG_ARG_UINT;
+        memcpy(out, &number, 8);
+    }
+    out += 8;
+}
+
+inline size_t log_args_size() {
+    return 0;
+}
+
+template <typename T, typename... Rest>
+inline size_t log_args_size(const T& first, const Rest&... rest) {
+    return log_arg_size(first) + log_args_size(rest...);
+}
+
+inline void log_encode_args(char*&) {}
+
+template <typename T, typename... Rest>
+inline void log_encode_args(char*& out, const T& first, const Rest&... rest) {
+    log_encode(out, first);
+    log_encode_args(out, rest...);
+}
+
+template <typename... Args>
+void log_write(LogLevel level, const char* format, const Args&... args) {
+    if (!log_enabled(level)) {
+        return;
+    }
+    size_t size = (sizeof(LogRecordHeader) + log_args_size(args...) + 7) & ~size_t(7);
+    char* record = log_reserve(size);
+    if (record == nullptr) {
+        return;
+    }
+
+    LogRecordHeader header;
+    header.size = static_cast<uint32_t>(size);
+    header.level = static_cast<uint8_t>(level);
+    header.arg_count = static_cast<uint8_t>(sizeof...(args));
+    header.reserved = 0;
+    header.timestamp_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+    header.format = format;
+    memcpy(record, &header, sizeof(header));
+
+    char* out = record + sizeof(header);
+    log_encode_args(out, args...);
+    log_commit();
+}
+
+template <typename... Args>
+void log_debug(const char* format, const Args&... args) {
+    log_write(LOG_DEBUG, format, args...);
+}
+
+template <typename... Args>
+void log_info(const char* format, const Args&... args) {
+    log_write(LOG_INFO, format, args...);
+}
+
+template <typename... Args>
+void log_warn(const char* format, const Args&... args) {
+    log_write(LOG_WARN, format, args...);
+}
+
+template <typename... Args>
+void log_error(const char* format, const Args&... args) {
+    log_write(LOG_ERROR, format, args...);
+}
+
+#endif
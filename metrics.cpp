@@ -0,0 +1,250 @@
+#include "metrics.h"
+
+#include <algorithm>
+#include <chrono>
+#include <vector>
+#include <pthread.h>
+
+static const chat::StatusCode kStatusCodes[kMetricStatusCodes] = {
+    chat::StatusCode::UNKNOWN_STATUS,
+    chat::StatusCode::OK,
+    chat::StatusCode::BAD_REQUEST,
+    chat::StatusCode::UNAUTHORIZED,
+    chat::StatusCode::FORBIDDEN,
+    chat::StatusCode::NOT_FOUND,
+    chat::StatusCode::CONFLICT,
+    chat::StatusCode::INTERNAL_SERVER_ERROR,
+    chat::StatusCode::NOT_IMPLEMENTED,
+};
+
+static pthread_mutex_t registry_mutex = PTHREAD_MUTEX_INITIALIZER;
+static std::vector<ThreadMetrics*> live_metrics;
+static ThreadMetrics retired_metrics;  // Counts of threads that already exited.
+static const std::chrono::steady_clock::time_point start_time = std::chrono::steady_clock::now();
+
+static void fold_counter(MetricCounter& into, const MetricCounter& from) {
+    into.add(from.get());
+}
+
+static void fold_histogram(MetricHistogram& into, const MetricHistogram& from) {
+    for (size_t i = 0; i < MetricHistogram::kBuckets; i++) {
+        fold_counter(into.counts[i], from.counts[i]);
+    }
+    fold_counter(into.total, from.total);
+    if (from.max.get() > into.max.get()) {
+        into.max.value.store(from.max.get(), std::memory_order_relaxed);
+    }
+}
+
+static void fold(ThreadMetrics& into, const ThreadMetrics& from) {
+    for (int i = 0; i < kMetricOperations; i++) {
+        fold_counter(into.requests[i], from.requests[i]);
+        fold_histogram(into.latency[i], from.latency[i]);
+    }
+    for (int i = 0; i < kMetricStatusCodes; i++) {
+        fold_counter(into.responses[i], from.responses[i]);
+    }
+    fold_counter(into.bytes_in, from.bytes_in);
+    fold_counter(into.bytes_out, from.bytes_out);
+    fold_counter(into.read_calls, from.read_calls);
+    fold_counter(into.write_calls, from.write_calls);
+    fold_counter(into.connections_opened, from.connections_opened);
+    fold_counter(into.connections_closed, from.connections_closed);
+    fold_counter(into.frames_queued, from.frames_queued);
+    fold_counter(into.frames_sent, from.frames_sent);
+    fold_counter(into.bytes_queued, from.bytes_queued);
+    fold_counter(into.bytes_dequeued, from.bytes_dequeued);
+    fold_counter(into.frames_packed, from.frames_packed);
+    fold_counter(into.frames_routed, from.frames_routed);
+    fold_counter(into.frames_dropped, from.frames_dropped);
+    fold_counter(into.slow_consumers, from.slow_consumers);
+    fold_counter(into.overflow_disconnects, from.overflow_disconnects);
+    fold_counter(into.frames_compressed, from.frames_compressed);
+    fold_counter(into.compression_in, from.compression_in);
+    fold_counter(into.compression_out, from.compression_out);
+    fold_counter(into.compression_cpu_ns, from.compression_cpu_ns);
+    fold_histogram(into.queue_depth, from.queue_depth);
+    fold_histogram(into.broadcast_fanout, from.broadcast_fanout);
+    fold_counter(into.rooms_created, from.rooms_created);
+    fold_counter(into.rooms_deleted, from.rooms_deleted);
+    fold_histogram(into.room_fanout, from.room_fanout);
+    fold_histogram(into.pipeline_depth, from.pipeline_depth);
+    fold_counter(into.worker_jobs, from.worker_jobs);
+    fold_counter(into.jobs_stolen, from.jobs_stolen);
+    fold_counter(into.sessions_detached, from.sessions_detached);
+    fold_counter(into.sessions_resumed, from.sessions_resumed);
+    fold_counter(into.sessions_expired, from.sessions_expired);
+    fold_counter(into.resumed_frames, from.resumed_frames);
+    fold_counter(into.roster_builds, from.roster_builds);
+    fold_counter(into.roster_served, from.roster_served);
+    fold_counter(into.transfers_offered, from.transfers_offered);
+    fold_counter(into.transfers_accepted, from.transfers_accepted);
+    fold_counter(into.transfers_ended, from.transfers_ended);
+    fold_counter(into.file_bytes, from.file_bytes);
+    fold_counter(into.file_bytes_spooled, from.file_bytes_spooled);
+    fold_counter(into.presence_subscribed, from.presence_subscribed);
+    fold_counter(into.presence_unsubscribed, from.presence_unsubscribed);
+    fold_counter(into.presence_changes, from.presence_changes);
+    fold_counter(into.presence_events, from.presence_events);
+    fold_counter(into.presence_updates, from.presence_updates);
+    fold_counter(into.heap_allocations, from.heap_allocations);
+    fold_counter(into.offline_queued, from.offline_queued);
+    fold_counter(into.offline_delivered, from.offline_delivered);
+    fold_counter(into.offline_syncs, from.offline_syncs);
+}
+
+// Owns the calling thread's block; hands the counts over on thread exit.
+struct ThreadMetricsHolder {
+    ThreadMetrics* metrics = nullptr;
+
+    ~ThreadMetricsHolder() {
+        if (metrics == nullptr) {
+            return;
+        }
+        pthread_mutex_lock(&registry_mutex);
+        fold(retired_metrics, *metrics);
+        for (size_t i = 0; i < live_metrics.size(); i++) {
+            if (live_metrics[i] == metrics) {
+                live_metrics[i] = live_metrics.back();
+                live_metrics.pop_back();
+                break;
+            }
+        }
+        pthread_mutex_unlock(&registry_mutex);
+        delete metrics;
+    }
+};
+
+static thread_local ThreadMetricsHolder thread_holder;
+
+ThreadMetrics& thread_metrics() {
+    ThreadMetrics* metrics = thread_holder.metrics;
+    if (metrics == nullptr) {
+        metrics = new ThreadMetrics();
+        pthread_mutex_lock(&registry_mutex);
+        live_metrics.push_back(metrics);
+        pthread_mutex_unlock(&registry_mutex);
+        thread_holder.metrics = metrics;
+    }
+    return *metrics;
+}
+
+int metrics_status_index(chat::StatusCode code) {
+    for (int i = 1; i < kMetricStatusCodes; i++) {
+        if (kStatusCodes[i] == code) {
+            return i;
+        }
+    }
+    return 0;
+}
+
+static uint64_t percentile(const MetricHistogram& histogram, uint64_t count, double percentile) {
+    uint64_t wanted = uint64_t(percentile / 100.0 * count + 0.5);
+    if (wanted == 0) {
+        wanted = 1;
+    }
+    uint64_t seen = 0;
+    for (size_t i = 0; i < MetricHistogram::kBuckets; i++) {
+        seen += histogram.counts[i].get();
+        if (seen >= wanted) {
+            return std::min(MetricHistogram::value_for(i), histogram.max.get());
+        }
+    }
+    return histogram.max.get();
+}
+
+static void summarize(const MetricHistogram& histogram, chat::Distribution* distribution) {
+    uint64_t count = 0;
+    for (size_t i = 0; i < MetricHistogram::kBuckets; i++) {
+        count += histogram.counts[i].get();
+    }
+    distribution->set_count(count);
+    if (count == 0) {
+        return;
+    }
+    distribution->set_mean(double(histogram.total.get()) / count);
+    distribution->set_p50(percentile(histogram, count, 50.0));
+    distribution->set_p90(percentile(histogram, count, 90.0));
+    distribution->set_p99(percentile(histogram, count, 99.0));
+    distribution->set_p999(percentile(histogram, count, 99.9));
+    distribution->set_max(histogram.max.get());
+}
+
+void metrics_snapshot(chat::ServerStats* stats) {
+    // The sum is built off to the side so readers never block the threads
+    // that are counting; only thread start/exit takes the registry lock.
+    ThreadMetrics* sum = new ThreadMetrics();
+    pthread_mutex_lock(&registry_mutex);
+    fold(*sum, retired_metrics);
+    for (ThreadMetrics* metrics : live_metrics) {
+        fold(*sum, *metrics);
+    }
+    pthread_mutex_unlock(&registry_mutex);
+
+    stats->Clear();
+    stats->set_uptime_ms(std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - start_time).count());
+    for (int i = 0; i < kMetricOperations; i++) {
+        if (sum->requests[i].get() == 0) {
+            continue;
+        }
+        chat::OperationStats* operation = stats->add_operations();
+        operation->set_operation(static_cast<chat::Operation>(i));
+        operation->set_requests(sum->requests[i].get());
+        summarize(sum->latency[i], operation->mutable_latency());
+    }
+    for (int i = 0; i < kMetricStatusCodes; i++) {
+        if (sum->responses[i].get() == 0) {
+            continue;
+        }
+        chat::StatusCodeCount* responses = stats->add_responses();
+        responses->set_status_code(kStatusCodes[i]);
+        responses->set_count(sum->responses[i].get());
+    }
+    stats->set_bytes_in(sum->bytes_in.get());
+    stats->set_bytes_out(sum->bytes_out.get());
+    stats->set_read_calls(sum->read_calls.get());
+    stats->set_write_calls(sum->write_calls.get());
+    stats->set_active_connections(sum->connections_opened.get() - std::min(sum->connections_opened.get(), sum->connections_closed.get()));
+    stats->set_total_connections(sum->connections_opened.get());
+    // Threads are read one after another, so a frame may be seen leaving a
+    // queue before it is seen entering it.
+    stats->set_queued_frames(sum->frames_queued.get() - std::min(sum->frames_queued.get(), sum->frames_sent.get()));
+    stats->set_queued_bytes(sum->bytes_queued.get() - std::min(sum->bytes_queued.get(), sum->bytes_dequeued.get()));
+    stats->set_packed_frames(sum->frames_packed.get());
+    stats->set_routed_frames(sum->frames_routed.get());
+    stats->set_slow_consumers(sum->slow_consumers.get());
+    stats->set_dropped_frames(sum->frames_dropped.get());
+    stats->set_overflow_disconnects(sum->overflow_disconnects.get());
+    stats->set_compressed_frames(sum->frames_compressed.get());
+    stats->set_compression_in_bytes(sum->compression_in.get());
+    stats->set_compression_out_bytes(sum->compression_out.get());
+    stats->set_compression_cpu_ns(sum->compression_cpu_ns.get());
+    summarize(sum->queue_depth, stats->mutable_queue_depth());
+    summarize(sum->broadcast_fanout, stats->mutable_broadcast_fanout());
+    stats->set_active_rooms(sum->rooms_created.get() - std::min(sum->rooms_created.get(), sum->rooms_deleted.get()));
+    summarize(sum->room_fanout, stats->mutable_room_fanout());
+    summarize(sum->pipeline_depth, stats->mutable_pipeline_depth());
+    stats->set_worker_jobs(sum->worker_jobs.get());
+    stats->set_stolen_jobs(sum->jobs_stolen.get());
+    uint64_t left = sum->sessions_resumed.get() + sum->sessions_expired.get();
+    stats->set_detached_sessions(sum->sessions_detached.get() - std::min(sum->sessions_detached.get(), left));
+    stats->set_resumed_sessions(sum->sessions_resumed.get());
+    stats->set_expired_sessions(sum->sessions_expired.get());
+    stats->set_resumed_frames(sum->resumed_frames.get());
+    stats->set_roster_builds(sum->roster_builds.get());
+    stats->set_roster_served(sum->roster_served.get());
+    stats->set_file_transfers(sum->transfers_accepted.get());
+    stats->set_active_transfers(sum->transfers_offered.get() - std::min(sum->transfers_offered.get(), sum->transfers_ended.get()));
+    stats->set_file_bytes(sum->file_bytes.get());
+    stats->set_file_bytes_spooled(sum->file_bytes_spooled.get());
+    stats->set_presence_subscribers(sum->presence_subscribed.get() - std::min(sum->presence_subscribed.get(), sum->presence_unsubscribed.get()));
+    stats->set_presence_changes(sum->presence_changes.get());
+    stats->set_presence_events(sum->presence_events.get());
+    stats->set_presence_updates(sum->presence_updates.get());
+    stats->set_heap_allocations(sum->heap_allocations.get());
+    stats->set_offline_queued(sum->offline_queued.get());
+    stats->set_offline_delivered(sum->offline_delivered.get());
+    stats->set_offline_syncs(sum->offline_syncs.get());
+    delete sum;
+}
@@ -0,0 +1,146 @@
+#ifndef CHAT_METRICS_H
+#define CHAT_METRICS_H
+
+// Server instrumentation.
+//
+// Every thread counts into its own ThreadMetrics block. Only the owning
+// thread writes a block, so updates are plain relaxed loads and stores with
+// no atomic read-modify-write and no shared cache lines. Readers
+// (GET_STATS, the periodic dump) sum all live blocks on demand. When a
+// thread exits, its counts are folded into a retired total.
+//
+// Gauges such as open connections are kept as pairs of per-thread deltas
+// (a frame may be queued by one thread and written by another), and only
+// the sums are meaningful.
+
+#include <atomic>
+#include <cstdint>
+#include "chat.pb.h"
+
+// Single-writer counter: cheap to bump, safe to read from any thread.
+struct MetricCounter {
+    std::atomic<uint64_t> value{0};
+
+    void add(uint64_t amount) {
+        value.store(value.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+    }
+    uint64_t get() const { return value.load(std::memory_order_relaxed); }
+};
+
+// Compact log-linear histogram (8 linear sub-buckets per power of two, so
+// values are exact to within about 6%), small enough to keep one per
+// operation in every thread.
+struct MetricHistogram {
+    static constexpr int kSubBucketBits = 4;
+    static constexpr uint64_t kSubBucketHalf = uint64_t(1) << (kSubBucketBits - 1);
+    static constexpr int kMaxBits = 40;
+    static constexpr size_t kBuckets = (kMaxBits - kSubBucketBits + 2) * kSubBucketHalf;
+
+    MetricCounter counts[kBuckets];
+    MetricCounter total;
+    MetricCounter max;
+
+    void record(uint64_t value) {
+        counts[index_for(value)].add(1);
+        total.add(value);
+        if (value > max.get()) {
+            max.value.store(value, std::memory_order_relaxed);
+        }
+    }
+
+    static size_t index_for(uint64_t value) {
+        if (value >= (uint64_t(1) << kMaxBits)) {
+            return kBuckets - 1;
+        }
+        if (value < 2 * kSubBucketHalf) {
+            return value;
+        }
+        int shift = 63 - __builtin_clzll(value) - (kSubBucketBits - 1);
+        return (shift + 1) * kSubBucketHalf + ((value >> shift) - kSubBucketHalf);
+    }
+
+    static uint64_t value_for(size_t index) {
+        if (index < 2 * kSubBucketHalf) {
+            return index;
+        }
+        int shift = int(index / kSubBucketHalf) - 1;
+        uint64_t sub_bucket = index % kSubBucketHalf + kSubBucketHalf;
+        return ((sub_bucket + 1) << shift) - 1;
+    }
+};
+
+const int kMetricOperations = chat::Operation_ARRAYSIZE;
+const int kMetricStatusCodes = 9;  // chat::StatusCode values.
+
+struct ThreadMetrics {
+    MetricCounter requests[kMetricOperations];
+    MetricHistogram latency[kMetricOperations];
+    MetricCounter responses[kMetricStatusCodes];
+    MetricCounter bytes_in;
+    MetricCounter bytes_out;
+    MetricCounter read_calls;
+    MetricCounter write_calls;
+    MetricCounter connections_opened;
+    MetricCounter connections_closed;
+    MetricCounter frames_queued;
+    MetricCounter frames_sent;  // Written or dropped with a closed connection.
+    MetricCounter bytes_queued;
+    MetricCounter bytes_dequeued;
+    MetricCounter frames_packed;  // Deliveries merged into a frame already queued.
+    MetricCounter frames_routed;  // Deliveries handed to another reactor.
+    MetricCounter frames_dropped;  // Deliveries shed from (or never queued on) an overflowing queue.
+    MetricCounter slow_consumers;
+    MetricCounter overflow_disconnects;
+    MetricCounter frames_compressed;
+    MetricCounter compression_in;
+    MetricCounter compression_out;
+    MetricCounter compression_cpu_ns;
+    MetricHistogram queue_depth;
+    MetricHistogram broadcast_fanout;
+    MetricCounter rooms_created;
+    MetricCounter rooms_deleted;
+    MetricHistogram room_fanout;
+    MetricHistogram pipeline_depth;
+    MetricCounter worker_jobs;  // Worker pool jobs, each running a connection's queued requests.
+    MetricCounter jobs_stolen;  // Of those, jobs a worker took from another worker's queue.
+    MetricCounter sessions_detached;  // Sessions kept for a resume after their connection dropped.
+    MetricCounter sessions_resumed;
+    MetricCounter sessions_expired;
+    MetricCounter resumed_frames;
+    MetricCounter roster_builds;  // GET_USERS (all) answers serialized for the cache.
+    MetricCounter roster_served;  // GET_USERS (all) answered from it.
+    MetricCounter transfers_offered;
+    MetricCounter transfers_accepted;
+    MetricCounter transfers_ended;  // Completed or cancelled.
+    MetricCounter file_bytes;  // File data relayed in chunk frames.
+    MetricCounter file_bytes_spooled;  // Of it, written to a spool file.
+    MetricCounter presence_subscribed;
+    MetricCounter presence_unsubscribed;
+    MetricCounter presence_changes;
+    MetricCounter presence_events;
+    MetricCounter presence_updates;
+    MetricCounter heap_allocations;
+    MetricCounter offline_queued;
+    MetricCounter offline_delivered;
+    MetricCounter offline_syncs;
+};
+
+// The calling thread's block, created on first use.
+ThreadMetrics& thread_metrics();
+
+// Index of a status code in ThreadMetrics::responses.
+int metrics_status_index(chat::StatusCode code);
+
+inline void metrics_count_request(chat::Operation operation, chat::StatusCode status, uint64_t latency_ns) {
+    ThreadMetrics& metrics = thread_metrics();
+    if (operation >= 0 && operation < kMetricOperations) {
+        metrics.requests[operation].add(1);
+        metrics.latency[operation].record(latency_ns);
+    }
+    metrics.responses[metrics_status_index(status)].add(1);
+}
+
+// Sums every thread's counters into `stats`.
+void metrics_snapshot(chat::ServerStats* stats);
+
+#endif
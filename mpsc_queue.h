@@ -0,0 +1,79 @@
+#ifndef CHAT_MPSC_QUEUE_H
+#define CHAT_MPSC_QUEUE_H
+
+// Bounded lock-free multi-producer/single-consumer queue (Dmitry Vyukov's
+// array queue with per-cell sequence numbers).
+//
+// Producers claim a cell with one compare-and-swap on the tail and publish
+// it by bumping the cell's sequence; the consumer needs no atomic
+// read-modify-write at all. push() fails instead of blocking when the queue
+// is full. pop() may report the queue empty while a producer that already
+// claimed the next cell has not published it yet, so producers must signal
+// the consumer after publishing, not before.
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+template <typename T>
+class MpscQueue {
+public:
+    // `capacity` must be a power of two.
+    explicit MpscQueue(size_t capacity) : cells_(new Cell[capacity]), mask_(capacity - 1), head_(0), tail_(0) {
+        for (size_t i = 0; i < capacity; i++) {
+            cells_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    MpscQueue(const MpscQueue&) = delete;
+    MpscQueue& operator=(const MpscQueue&) = delete;
+
+    bool push(const T& value) {
+        size_t position = tail_.load(std::memory_order_relaxed);
+        Cell* cell;
+        while (true) {
+            cell = &cells_[position & mask_];
+            size_t sequence = cell->sequence.load(std::memory_order_acquire);
+            intptr_t difference = intptr_t(sequence) - intptr_t(position);
+            if (difference == 0) {
+                if (tail_.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (difference < 0) {
+                return false;  // Full.
+            } else {
+                position = tail_.load(std::memory_order_relaxed);
+            }
+        }
+        cell->value = value;
+        cell->sequence.store(position + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer thread only.
+    bool pop(T* value) {
+        Cell* cell = &cells_[head_ & mask_];
+        size_t sequence = cell->sequence.load(std::memory_order_acquire);
+        if (sequence != head_ + 1) {
+            return false;
+        }
+        *value = cell->value;
+        cell->sequence.store(head_ + mask_ + 1, std::memory_order_release);
+        head_++;
+        return true;
+    }
+
+private:
+    struct Cell {
+        std::atomic<size_t> sequence;
+        T value;
+    };
+
+    std::unique_ptr<Cell[]> cells_;
+    size_t mask_;
+    alignas(64) size_t head_;  // Consumer side, on its own cache line.
+    alignas(64) std::atomic<size_t> tail_;
+};
+
+#endif
@@ -0,0 +1,564 @@
+#include "offline_store.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "chat.pb.h"
+#include "log.h"
+#include "metrics.h"
+
+// Record layout: this header, the recipient, the body, then zero padding to
+// 8 bytes. The checksum covers everything after itself. The size is written
+// last, and a zero size marks the end of a segment's records.
+struct RecordHeader {
+    uint32_t size;
+    uint32_t checksum;
+    uint8_t type;
+    uint8_t reserved;
+    uint16_t recipient_size;
+    uint32_t body_size;
+    uint64_t sequence;
+};
+
+const uint8_t kRecordMessage = 1;  // Body: serialized IncomingMessageResponse.
+const uint8_t kRecordAck = 2;      // No body; the recipient's messages up to `sequence` were delivered.
+
+static size_t record_size(size_t recipient_size, size_t body_size) {
+    return (sizeof(RecordHeader) + recipient_size + body_size + 7) & ~size_t(7);
+}
+
+static uint32_t record_checksum(const char* record, size_t size) {
+    // FNV-1a.
+    uint32_t hash = 2166136261u;
+    for (size_t i = offsetof(RecordHeader, type); i < size; i++) {
+        hash = (hash ^ uint8_t(record[i])) * 16777619u;
+    }
+    return hash;
+}
+
+static const RecordHeader* record_at(const char* data) {
+    return reinterpret_cast<const RecordHeader*>(data);
+}
+
+static void sync_directory(const std::string& directory) {
+    int fd = ::open(directory.c_str(), O_RDONLY | O_DIRECTORY);
+    if (fd >= 0) {
+        fsync(fd);
+        close(fd);
+    }
+}
+
+static void sync_range(char* data, size_t from, size_t to) {
+    size_t page = size_t(sysconf(_SC_PAGESIZE));
+    size_t aligned = from & ~(page - 1);
+    if (msync(data + aligned, to - aligned, MS_SYNC) != 0) {
+        log_error("Offline queue msync failed: {}", strerror(errno));
+    }
+}
+
+OfflineStore::OfflineStore(const std::string& directory, size_t segment_size)
+    : directory_(directory), segment_size_(segment_size), active_(nullptr), next_sequence_(1),
+      durable_(0), syncing_(false), compacting_(false), pending_(0) {
+    pthread_mutex_init(&mutex_, NULL);
+    pthread_cond_init(&synced_, NULL);
+}
+
+OfflineStore::~OfflineStore() {
+    pthread_mutex_lock(&mutex_);
+    sync_all();
+    while (!segments_.empty()) {
+        close_segment(segments_.begin()->second, false);
+    }
+    pthread_mutex_unlock(&mutex_);
+    pthread_cond_destroy(&synced_);
+    pthread_mutex_destroy(&mutex_);
+}
+
+OfflineStore::Segment* OfflineStore::open_segment(uint64_t start, bool create) {
+    char name[32];
+    snprintf(name, sizeof(name), "%020llu.log", (unsigned long long)start);
+    std::string path = directory_ + "/" + name;
+
+    int fd = ::open(path.c_str(), create ? O_RDWR | O_CREAT | O_EXCL : O_RDWR, 0644);
+    if (fd < 0) {
+        log_error("Cannot open offline queue segment {}: {}", path, strerror(errno));
+        return nullptr;
+    }
+    size_t size = segment_size_;
+    if (create) {
+        // Reserve the blocks now: running out of space while writing through
+        // the mapping would be a SIGBUS instead of an error.
+        int error = posix_fallocate(fd, 0, size);
+        if (error != 0) {
+            log_error("Cannot allocate offline queue segment {}: {}", path, strerror(error));
+            close(fd);
+            unlink(path.c_str());
+            return nullptr;
+        }
+        sync_directory(directory_);
+    } else {
+        struct stat info;
+        if (fstat(fd, &info) != 0 || info.st_size < off_t(sizeof(RecordHeader))) {
+            log_error("Ignoring offline queue segment {}: bad size", path);
+            close(fd);
+            return nullptr;
+        }
+        size = size_t(info.st_size);
+    }
+
+    void* data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (data == MAP_FAILED) {
+        log_error("Cannot map offline queue segment {}: {}", path, strerror(errno));
+        close(fd);
+        return nullptr;
+    }
+
+    Segment* segment = new Segment();
+    segment->start = start;
+    segment->path = path;
+    segment->fd = fd;
+    segment->data = static_cast<char*>(data);
+    segment->size = size;
+    segment->used = 0;
+    segment->synced = 0;
+    segment->live = 0;
+    segment->live_bytes = 0;
+    segments_[start] = segment;
+    return segment;
+}
+
+// Called with mutex_ held.
+void OfflineStore::close_segment(Segment* segment, bool remove) {
+    munmap(segment->data, segment->size);
+    close(segment->fd);
+    if (remove) {
+        unlink(segment->path.c_str());
+        sync_directory(directory_);
+    }
+    segments_.erase(segment->start);
+    if (segment == active_) {
+        active_ = nullptr;
+    }
+    delete segment;
+}
+
+// Indexes the segment's records; stops at the first one that is incomplete
+// or fails its checksum. Returns false if such a torn record was found.
+bool OfflineStore::recover(Segment* segment, std::unordered_map<std::string, uint64_t>& acked,
+                           std::unordered_map<std::string, std::map<uint64_t, uint64_t>>& queued) {
+    size_t offset = 0;
+    bool clean = true;
+    while (offset + sizeof(RecordHeader) <= segment->size) {
+        const RecordHeader* header = record_at(segment->data + offset);
+        if (header->size == 0) {
+            break;
+        }
+        if (header->size % 8 != 0 || header->size > segment->size - offset ||
+            record_size(header->recipient_size, header->body_size) != header->size ||
+            record_checksum(segment->data + offset, header->size) != header->checksum) {
+            clean = false;
+            break;
+        }
+
+        std::string recipient(segment->data + offset + sizeof(RecordHeader), header->recipient_size);
+        if (header->type == kRecordMessage) {
+            // A relocated message appears twice until its old segment is
+            // deleted; the map keeps one copy.
+            queued[recipient][header->sequence] = segment->start + offset;
+        } else if (header->type == kRecordAck) {
+            uint64_t& through = acked[recipient];
+            through = std::max(through, header->sequence);
+        }
+        next_sequence_ = std::max(next_sequence_, header->sequence + 1);
+        offset += header->size;
+    }
+    segment->used = offset;
+    segment->synced = offset;
+    return clean;
+}
+
+bool OfflineStore::open() {
+    if (mkdir(directory_.c_str(), 0755) != 0 && errno != EEXIST) {
+        log_error("Cannot create offline queue directory {}: {}", directory_, strerror(errno));
+        return false;
+    }
+    DIR* dir = opendir(directory_.c_str());
+    if (dir == nullptr) {
+        log_error("Cannot read offline queue directory {}: {}", directory_, strerror(errno));
+        return false;
+    }
+    std::vector<uint64_t> starts;
+    while (dirent* entry = readdir(dir)) {
+        unsigned long long start;
+        char suffix[8];
+        if (strlen(entry->d_name) == 24 && sscanf(entry->d_name, "%20llu%7s", &start, suffix) == 2 &&
+            strcmp(suffix, ".log") == 0) {
+            starts.push_back(start);
+        }
+    }
+    closedir(dir);
+    std::sort(starts.begin(), starts.end());
+
+    pthread_mutex_lock(&mutex_);
+    std::unordered_map<std::string, uint64_t> acked;
+    std::unordered_map<std::string, std::map<uint64_t, uint64_t>> queued;
+    for (uint64_t start : starts) {
+        Segment* segment = open_segment(start, false);
+        if (segment == nullptr) {
+            continue;
+        }
+        if (!recover(segment, acked, queued) && start == starts.back()) {
+            // Appends resume here, so clear the torn bytes.
+            memset(segment->data + segment->used, 0, segment->size - segment->used);
+            sync_range(segment->data, segment->used, segment->size);
+        }
+        active_ = segment;
+    }
+    if (active_ == nullptr) {
+        active_ = open_segment(0, true);
+        if (active_ == nullptr) {
+            pthread_mutex_unlock(&mutex_);
+            return false;
+        }
+    }
+    durable_ = active_->start + active_->used;
+
+    size_t recovered = 0;
+    for (auto& recipient : queued) {
+        uint64_t through = acked[recipient.first];
+        Mailbox* mailbox = nullptr;
+        for (auto& message : recipient.second) {
+            if (message.first <= through) {
+                continue;
+            }
+            if (mailbox == nullptr) {
+                mailbox = &mailboxes_[recipient.first];
+                known_.insert(recipient.first);
+            }
+            mailbox->messages.push_back({message.first, message.second});
+            add_live(message.second, 1);
+            recovered++;
+        }
+    }
+    pending_.store(recovered, std::memory_order_relaxed);
+    compact(false);
+    log_info("Offline queue: {} messages for {} users in {} segments", recovered, mailboxes_.size(), segments_.size());
+    pthread_mutex_unlock(&mutex_);
+    return true;
+}
+
+void OfflineStore::remember(const std::string& username) {
+    pthread_mutex_lock(&mutex_);
+    known_.insert(username);
+    pthread_mutex_unlock(&mutex_);
+}
+
+bool OfflineStore::known(const std::string& username) {
+    pthread_mutex_lock(&mutex_);
+    bool found = known_.count(username) != 0;
+    pthread_mutex_unlock(&mutex_);
+    return found;
+}
+
+std::vector<std::string> OfflineStore::known_users() {
+    pthread_mutex_lock(&mutex_);
+    std::vector<std::string> names(known_.begin(), known_.end());
+    pthread_mutex_unlock(&mutex_);
+    return names;
+}
+
+bool OfflineStore::has_pending(const std::string& username) {
+    if (pending() == 0) {
+        return false;
+    }
+    pthread_mutex_lock(&mutex_);
+    auto it = mailboxes_.find(username);
+    bool found = it != mailboxes_.end() && !it->second.messages.empty();
+    pthread_mutex_unlock(&mutex_);
+    return found;
+}
+
+// Called with mutex_ held.
+OfflineStore::Segment* OfflineStore::segment_for(uint64_t position) {
+    auto it = segments_.upper_bound(position);
+    --it;
+    return it->second;
+}
+
+// Called with mutex_ held.
+void OfflineStore::add_live(uint64_t position, int delta) {
+    Segment* segment = segment_for(position);
+    size_t size = record_at(segment->data + (position - segment->start))->size;
+    segment->live += delta;
+    segment->live_bytes += delta * ssize_t(size);
+}
+
+// Called with mutex_ held. Stores the record's log position in `position`.
+bool OfflineStore::append_record(uint8_t type, const std::string& recipient, uint64_t sequence,
+                                 const char* body, size_t body_size, uint64_t* position) {
+    size_t size = record_size(recipient.size(), body_size);
+    if (recipient.size() > UINT16_MAX || size > segment_size_ || active_ == nullptr) {
+        return false;
+    }
+    if (active_->used + size > active_->size) {
+        Segment* next = open_segment(active_->start + active_->size, true);
+        if (next == nullptr) {
+            return false;
+        }
+        active_ = next;
+        compact(true);
+    }
+
+    char* record = active_->data + active_->used;
+    RecordHeader* header = reinterpret_cast<RecordHeader*>(record);
+    header->type = type;
+    header->reserved = 0;
+    header->recipient_size = uint16_t(recipient.size());
+    header->body_size = uint32_t(body_size);
+    header->sequence = sequence;
+    memcpy(record + sizeof(RecordHeader), recipient.data(), recipient.size());
+    memcpy(record + sizeof(RecordHeader) + recipient.size(), body, body_size);
+    size_t written = sizeof(RecordHeader) + recipient.size() + body_size;
+    memset(record + written, 0, size - written);
+    header->checksum = record_checksum(record, size);
+    __atomic_store_n(&header->size, uint32_t(size), __ATOMIC_RELEASE);
+
+    *position = active_->start + active_->used;
+    active_->used += size;
+    return true;
+}
+
+uint64_t OfflineStore::append(const std::string& recipient, const std::string& sender, const std::string& content) {
+    chat::IncomingMessageResponse message;
+    message.set_sender(sender);
+    message.set_content(content);
+    message.set_type(chat::MessageType::DIRECT);
+
+    pthread_mutex_lock(&mutex_);
+    message.SerializeToString(&scratch_);
+    uint64_t sequence = next_sequence_++;
+    uint64_t position;
+    if (!append_record(kRecordMessage, recipient, sequence, scratch_.data(), scratch_.size(), &position)) {
+        pthread_mutex_unlock(&mutex_);
+        return 0;
+    }
+    mailboxes_[recipient].messages.push_back({sequence, position});
+    known_.insert(recipient);
+    add_live(position, 1);
+    pending_.fetch_add(1, std::memory_order_relaxed);
+    uint64_t end = position + record_size(recipient.size(), scratch_.size());
+    pthread_mutex_unlock(&mutex_);
+    return end;
+}
+
+void OfflineStore::commit(uint64_t position) {
+    struct Range {
+        Segment* segment;
+        size_t from;
+        size_t to;
+    };
+    static thread_local std::vector<Range> ranges;
+
+    pthread_mutex_lock(&mutex_);
+    while (durable_ < position) {
+        if (syncing_) {
+            pthread_cond_wait(&synced_, &mutex_);
+            continue;
+        }
+        // Become the leader: sync everything appended so far, which covers
+        // every caller that is waiting now.
+        syncing_ = true;
+        uint64_t target = active_->start + active_->used;
+        ranges.clear();
+        for (auto& entry : segments_) {
+            Segment* segment = entry.second;
+            if (segment->synced < segment->used) {
+                ranges.push_back({segment, segment->synced, segment->used});
+            }
+        }
+        // Segments being synced are not deleted: compaction skips while
+        // syncing_ is set.
+        pthread_mutex_unlock(&mutex_);
+        for (const Range& range : ranges) {
+            sync_range(range.segment->data, range.from, range.to);
+        }
+        thread_metrics().offline_syncs.add(1);
+        pthread_mutex_lock(&mutex_);
+        for (const Range& range : ranges) {
+            range.segment->synced = std::max(range.segment->synced, range.to);
+        }
+        durable_ = std::max(durable_, target);
+        syncing_ = false;
+        pthread_cond_broadcast(&synced_);
+    }
+    pthread_mutex_unlock(&mutex_);
+}
+
+void OfflineStore::sync() {
+    pthread_mutex_lock(&mutex_);
+    sync_all();
+    pthread_mutex_unlock(&mutex_);
+}
+
+// Called with mutex_ held; syncs inline instead of through a leader.
+void OfflineStore::sync_all() {
+    while (syncing_) {
+        pthread_cond_wait(&synced_, &mutex_);
+    }
+    for (auto& entry : segments_) {
+        Segment* segment = entry.second;
+        if (segment->synced < segment->used) {
+            sync_range(segment->data, segment->synced, segment->used);
+            segment->synced = segment->used;
+        }
+    }
+    if (active_ != nullptr) {
+        durable_ = std::max(durable_, active_->start + active_->used);
+    }
+    thread_metrics().offline_syncs.add(1);
+}
+
+bool OfflineStore::begin_delivery(const std::string& username) {
+    if (pending() == 0) {
+        return false;
+    }
+    pthread_mutex_lock(&mutex_);
+    auto it = mailboxes_.find(username);
+    bool started = it != mailboxes_.end() && !it->second.messages.empty() && !it->second.delivering;
+    if (started) {
+        it->second.delivering = true;
+    }
+    pthread_mutex_unlock(&mutex_);
+    return started;
+}
+
+size_t OfflineStore::peek(const std::string& username, size_t max_messages, std::vector<StoredMessage>* messages) {
+    messages->clear();
+    pthread_mutex_lock(&mutex_);
+    auto it = mailboxes_.find(username);
+    if (it != mailboxes_.end()) {
+        const std::deque<QueuedMessage>& queue = it->second.messages;
+        size_t count = std::min(max_messages, queue.size());
+        for (size_t i = 0; i < count; i++) {
+            Segment* segment = segment_for(queue[i].position);
+            const char* record = segment->data + (queue[i].position - segment->start);
+            const RecordHeader* header = record_at(record);
+            messages->push_back({record + sizeof(RecordHeader) + header->recipient_size, header->body_size});
+        }
+    }
+    pthread_mutex_unlock(&mutex_);
+    return messages->size();
+}
+
+void OfflineStore::acknowledge(const std::string& username, size_t count) {
+    pthread_mutex_lock(&mutex_);
+    auto it = mailboxes_.find(username);
+    if (it != mailboxes_.end() && count > 0) {
+        std::deque<QueuedMessage>& queue = it->second.messages;
+        count = std::min(count, queue.size());
+        uint64_t through = queue[count - 1].sequence;
+        for (size_t i = 0; i < count; i++) {
+            add_live(queue.front().position, -1);
+            queue.pop_front();
+        }
+        pending_.fetch_sub(count, std::memory_order_relaxed);
+        // Not committed: if the ACK is lost in a crash the messages are
+        // delivered again, never dropped.
+        uint64_t position;
+        append_record(kRecordAck, username, through, nullptr, 0, &position);
+        compact(false);
+    }
+    pthread_mutex_unlock(&mutex_);
+}
+
+bool OfflineStore::end_delivery(const std::string& username) {
+    pthread_mutex_lock(&mutex_);
+    auto it = mailboxes_.find(username);
+    bool done = true;
+    if (it != mailboxes_.end()) {
+        if (it->second.messages.empty()) {
+            mailboxes_.erase(it);
+        } else {
+            done = false;  // More arrived; the caller keeps delivering.
+        }
+    }
+    pthread_mutex_unlock(&mutex_);
+    return done;
+}
+
+void OfflineStore::abort_delivery(const std::string& username) {
+    pthread_mutex_lock(&mutex_);
+    auto it = mailboxes_.find(username);
+    if (it != mailboxes_.end()) {
+        it->second.delivering = false;
+        if (it->second.messages.empty()) {
+            mailboxes_.erase(it);
+        }
+    }
+    pthread_mutex_unlock(&mutex_);
+}
+
+// Called with mutex_ held. Deletes the oldest segments while nothing in them
+// is still queued. With `relocate_pinned` (after a segment fills up), a
+// mostly delivered oldest segment has its last messages copied forward.
+void OfflineStore::compact(bool relocate_pinned) {
+    if (compacting_) {
+        return;
+    }
+    compacting_ = true;
+    while (segments_.size() > 1 && !syncing_) {
+        Segment* oldest = segments_.begin()->second;
+        if (oldest == active_) {
+            break;
+        }
+        if (oldest->live > 0) {
+            if (!relocate_pinned || oldest->live_bytes * 4 > oldest->used || !relocate(oldest)) {
+                break;
+            }
+        }
+        close_segment(oldest, true);
+    }
+    compacting_ = false;
+}
+
+// Called with mutex_ held. Copies the segment's queued messages to the head
+// of the log and makes the copies durable; false if some could not be moved.
+bool OfflineStore::relocate(Segment* segment) {
+    for (auto& entry : mailboxes_) {
+        if (entry.second.delivering) {
+            // peek() handed out pointers into the old copies.
+            for (const QueuedMessage& message : entry.second.messages) {
+                if (segment_for(message.position) == segment) {
+                    return false;
+                }
+            }
+            continue;
+        }
+        for (QueuedMessage& message : entry.second.messages) {
+            if (segment_for(message.position) != segment) {
+                continue;
+            }
+            const char* record = segment->data + (message.position - segment->start);
+            const RecordHeader* header = record_at(record);
+            uint64_t position;
+            if (!append_record(kRecordMessage, entry.first, message.sequence,
+                               record + sizeof(RecordHeader) + header->recipient_size, header->body_size, &position)) {
+                return false;
+            }
+            add_live(message.position, -1);
+            message.position = position;
+            add_live(position, 1);
+        }
+    }
+    // The originals go with the segment, so the copies must be on disk first.
+    sync_all();
+    log_info("Offline queue: moved the last messages out of segment {}", segment->path);
+    return segment->live == 0;
+}
@@ -0,0 +1,144 @@
+#ifndef CHAT_OFFLINE_STORE_H
+#define CHAT_OFFLINE_STORE_H
+
+// Store-and-forward queue for direct messages whose recipient is away.
+//
+// Messages are appended to a log of fixed-size segment files that are
+// memory-mapped, so an append is a memcpy under the store lock. A message
+// record carries a sequence number, the recipient and the serialized
+// IncomingMessageResponse; once a recipient's messages have been handed to
+// their connection an ACK record ("delivered through sequence n") is
+// appended. On startup the segments are scanned and every recipient's
+// unacknowledged messages are indexed again (an in-memory deque of log
+// positions per recipient).
+//
+// Durability uses group commit: commit() waits until the log is synced up
+// to a position, and whichever caller finds no sync running msyncs
+// everything appended so far on behalf of all the others waiting.
+//
+// Segments are deleted oldest first once none of their messages is still
+// queued. If a long-absent recipient pins the oldest segment, its few
+// remaining messages are copied to the head of the log (keeping their
+// sequence numbers) so the segment can go.
+
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+#include <pthread.h>
+
+// A queued message: the serialized IncomingMessageResponse, pointing into
+// the log. Valid until the message is acknowledged.
+struct StoredMessage {
+    const char* data;
+    size_t size;
+};
+
+class OfflineStore {
+public:
+    OfflineStore(const std::string& directory, size_t segment_size);
+    ~OfflineStore();
+
+    OfflineStore(const OfflineStore&) = delete;
+    OfflineStore& operator=(const OfflineStore&) = delete;
+
+    // Creates the directory if needed and recovers the queued messages.
+    bool open();
+
+    // Recipients that have registered since startup or still have messages
+    // queued; only these get messages queued for them.
+    void remember(const std::string& username);
+    bool known(const std::string& username);
+    bool has_pending(const std::string& username);
+
+    // Appends a direct message for `recipient`. Returns the log position to
+    // commit() before the message may be reported as accepted, or 0 if it
+    // could not be stored.
+    uint64_t append(const std::string& recipient, const std::string& sender, const std::string& content);
+
+    // Waits until the log is durable up to `position`.
+    void commit(uint64_t position);
+
+    // Makes everything appended so far durable.
+    void sync();
+
+    // Names remember() was called with, so another process can take over.
+    std::vector<std::string> known_users();
+
+    // Delivery of one recipient's queue runs on one thread at a time:
+    //
+    //     if (store.begin_delivery(user)) {
+    //         do {
+    //             while ((count = store.peek(user, max, &messages)) > 0) {
+    //                 ... send, or abort_delivery() and stop ...
+    //                 store.acknowledge(user, count);
+    //             }
+    //         } while (!store.end_delivery(user));
+    //     }
+    //
+    // begin_delivery() returns false if nothing is queued or another thread
+    // is already delivering (it will also send anything queued meanwhile).
+    bool begin_delivery(const std::string& username);
+    size_t peek(const std::string& username, size_t max_messages, std::vector<StoredMessage>* messages);
+    void acknowledge(const std::string& username, size_t count);
+    bool end_delivery(const std::string& username);
+    void abort_delivery(const std::string& username);
+
+    size_t pending() const { return pending_.load(std::memory_order_relaxed); }
+
+private:
+    struct Segment {
+        uint64_t start;  // Log position of the first byte.
+        std::string path;
+        int fd;
+        char* data;
+        size_t size;    // File size; segments keep the size they were created with.
+        size_t used;    // Bytes holding records.
+        size_t synced;  // Bytes known to be on disk.
+        size_t live;    // Queued messages stored here.
+        size_t live_bytes;
+    };
+
+    struct QueuedMessage {
+        uint64_t sequence;
+        uint64_t position;
+    };
+
+    struct Mailbox {
+        std::deque<QueuedMessage> messages;
+        bool delivering = false;
+    };
+
+    Segment* open_segment(uint64_t start, bool create);
+    void close_segment(Segment* segment, bool remove);
+    bool recover(Segment* segment, std::unordered_map<std::string, uint64_t>& acked,
+                 std::unordered_map<std::string, std::map<uint64_t, uint64_t>>& queued);
+    Segment* segment_for(uint64_t position);
+    bool append_record(uint8_t type, const std::string& recipient, uint64_t sequence,
+                       const char* body, size_t body_size, uint64_t* position);
+    void add_live(uint64_t position, int delta);
+    void compact(bool relocate_pinned);
+    bool relocate(Segment* segment);
+    void sync_all();
+
+    std::string directory_;
+    size_t segment_size_;
+    pthread_mutex_t mutex_;
+    pthread_cond_t synced_;
+    std::map<uint64_t, Segment*> segments_;  // By start position.
+    Segment* active_;
+    uint64_t next_sequence_;
+    uint64_t durable_;  // Log position synced to disk.
+    bool syncing_;
+    bool compacting_;
+    std::atomic<size_t> pending_;  // Read without the lock to skip idle lookups.
+    std::unordered_map<std::string, Mailbox> mailboxes_;
+    std::unordered_set<std::string> known_;
+    std::string scratch_;
+};
+
+#endif
@@ -0,0 +1,475 @@
+#ifndef CHAT_OUTBOUND_H
+#define CHAT_OUTBOUND_H
+
+// Outbound side of a connection: immutable, refcounted frames and a per
+// connection queue of them that is drained with writev().
+//
+// A broadcast serializes its frame once and pushes the same Frame* onto every
+// recipient's queue; queues only store pointers, so fanning out costs a
+// refcount increment per recipient and no allocation.
+//
+// Frames flagged packable hold an INCOMING_MESSAGE_BATCH. Two serialized
+// batches concatenate into one valid batch, so when such frames pile up
+// behind each other (the peer is not keeping up) the queue merges them into
+// a single frame instead of keeping one per delivery.
+//
+// Every frame records what it carries, so a queue that has grown too large
+// can shed the deliveries it can afford to lose (see drop_oldest()).
+//
+// Frames of file data (bulk frames) never hold up the rest: a frame queued
+// behind bulk frames that have not started going out is queued ahead of
+// them. A bulk frame may also keep its data in a spool file rather than in
+// memory; the queue then sends that part with sendfile(), so a recipient
+// that is behind on a large transfer costs page cache, not heap. Such bytes
+// are counted apart (spooled()), and shedding only looks at the others.
+
+#include <algorithm>
+#include <atomic>
+#include <string>
+#include <vector>
+#include <errno.h>
+#include <limits.h>
+#include <unistd.h>
+#include <sys/sendfile.h>
+#include <sys/uio.h>
+#include <sys/socket.h>
+#include "framing.h"
+
+// Ordered from least to most expendable.
+enum FrameKind {
+    FRAME_RESPONSE,   // Reply to the peer's own request; never dropped.
+    FRAME_DIRECT,     // Direct messages.
+    FRAME_BROADCAST,  // Broadcast or room messages.
+};
+
+// An unlinked file that spooled frames read from; closed with the last
+// reference.
+struct FileSpool {
+    int fd;
+    std::atomic<int> refs;
+};
+
+inline void spool_unref(FileSpool* spool) {
+    if (spool->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        close(spool->fd);
+        delete spool;
+    }
+}
+
+struct Frame {
+    Frame() : refs(0), packable(false), kind(FRAME_RESPONSE), bulk(false), spool(nullptr), spool_offset(0), spool_size(0) {}
+
+    std::atomic<int> refs;
+    bool packable;
+    FrameKind kind;
+    std::string bytes;  // Header + payload. Only a queue that holds the sole
+                        // reference may still append to it (see push()).
+    bool bulk;  // File data; other frames go ahead of it.
+    FileSpool* spool;  // If set, the frame goes on with spool_size bytes of this file from spool_offset. Holds a reference.
+    uint64_t spool_offset;
+    uint32_t spool_size;
+};
+
+inline size_t frame_size(const Frame* frame) {
+    return frame->bytes.size() + frame->spool_size;
+}
+
+// Appends the spooled part of a frame to `out`.
+inline bool read_spooled(const Frame* frame, std::string* out) {
+    size_t start = out->size();
+    out->resize(start + frame->spool_size);
+    size_t done = 0;
+    while (done < frame->spool_size) {
+        ssize_t got = pread(frame->spool->fd, &(*out)[start + done], frame->spool_size - done, off_t(frame->spool_offset + done));
+        if (got < 0 && errno == EINTR) {
+            continue;
+        }
+        if (got <= 0) {
+            return false;
+        }
+        done += got;
+    }
+    return true;
+}
+
+// Per-thread cache of released frames. A recycled frame keeps the capacity
+// of its byte buffer, so serializing the next response into it does not
+// allocate. Frames return to the pool of whichever thread drops the last
+// reference.
+class FramePool {
+public:
+    ~FramePool() {
+        for (Frame* frame : frames_) {
+            delete frame;
+        }
+    }
+
+    Frame* acquire() {
+        if (frames_.empty()) {
+            return new Frame();
+        }
+        Frame* frame = frames_.back();
+        frames_.pop_back();
+        return frame;
+    }
+
+    void release(Frame* frame) {
+        if (frame->spool != nullptr) {
+            spool_unref(frame->spool);
+            frame->spool = nullptr;
+            frame->spool_size = 0;
+        }
+        frame->bulk = false;
+        if (frames_.size() < kMaxPooledFrames && frame->bytes.capacity() <= kMaxPooledBytes) {
+            frames_.push_back(frame);
+        } else {
+            delete frame;
+        }
+    }
+
+    static FramePool& local() {
+        static thread_local FramePool pool;
+        return pool;
+    }
+
+private:
+    static const size_t kMaxPooledFrames = 256;
+    static const size_t kMaxPooledBytes = 16 * 1024;
+    std::vector<Frame*> frames_;
+};
+
+inline Frame* make_frame(const google::protobuf::MessageLite& message) {
+    Frame* frame = FramePool::local().acquire();
+    frame->refs.store(1, std::memory_order_relaxed);
+    frame->packable = false;
+    frame->kind = FRAME_RESPONSE;
+    serialize_frame(message, &frame->bytes);
+    return frame;
+}
+
+inline Frame* frame_ref(Frame* frame) {
+    frame->refs.fetch_add(1, std::memory_order_relaxed);
+    return frame;
+}
+
+inline void frame_unref(Frame* frame) {
+    if (frame->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        FramePool::local().release(frame);
+    }
+}
+
+enum FlushResult {
+    FLUSH_DONE,     // Queue fully written.
+    FLUSH_BLOCKED,  // Socket buffer full, wait for writability.
+    FLUSH_ERROR,    // Peer gone; the read side will notice and clean up.
+};
+
+// FIFO of frame references. Backed by a power-of-two ring that only grows,
+// so steady-state pushes never allocate. Not thread-safe: callers hold the
+// owning connection's lock.
+class OutboundQueue {
+public:
+    OutboundQueue()
+        : slots_(nullptr), capacity_(0), head_(0), count_(0), offset_(0), pinned_(0), bytes_(0), spooled_(0), writes_(0) {}
+    ~OutboundQueue() {
+        clear();
+        delete[] slots_;
+    }
+
+    OutboundQueue(const OutboundQueue&) = delete;
+    OutboundQueue& operator=(const OutboundQueue&) = delete;
+
+    bool empty() const { return count_ == 0; }
+    size_t size() const { return count_; }
+    // Bytes still to be written, including the unsent part of the head frame.
+    size_t bytes() const { return bytes_; }
+    // The part of bytes() still in spool files rather than in memory.
+    size_t spooled() const { return spooled_; }
+    size_t memory_bytes() const { return bytes_ - spooled_; }
+    // sendmsg() calls made so far.
+    uint64_t writes() const { return writes_; }
+
+    // Takes ownership of one reference. A frame other than a bulk one goes
+    // ahead of the bulk frames at the end of the queue that have not started
+    // going out. A packable frame queued right behind another packable frame
+    // that has not started going out is merged into it rather than queued on
+    // its own.
+    void push(Frame* frame) {
+        size_t at = count_;
+        if (!frame->bulk) {
+            size_t first_movable = std::max(pinned_, size_t(offset_ > 0 ? 1 : 0));
+            while (at > first_movable && slots_[(head_ + at - 1) & (capacity_ - 1)]->bulk) {
+                at--;
+            }
+        }
+        if (frame->packable && pack(frame, at)) {
+            return;
+        }
+        if (count_ == capacity_) {
+            grow();
+        }
+        for (size_t i = count_; i > at; i--) {
+            slots_[(head_ + i) & (capacity_ - 1)] = slots_[(head_ + i - 1) & (capacity_ - 1)];
+        }
+        slots_[(head_ + at) & (capacity_ - 1)] = frame;
+        count_++;
+        bytes_ += frame_size(frame);
+        spooled_ += frame->spool_size;
+    }
+
+    void clear() {
+        while (count_ > 0) {
+            pop();
+        }
+        offset_ = 0;
+        pinned_ = 0;
+        bytes_ = 0;
+        spooled_ = 0;
+    }
+
+    // Drops whole frames of `min_kind` or more expendable, oldest first,
+    // until at most `target_bytes` are left in memory. The frame being
+    // written is kept. Returns the number of frames dropped and adds their size to
+    // `dropped_bytes`.
+    size_t drop_oldest(FrameKind min_kind, size_t target_bytes, size_t* dropped_bytes) {
+        size_t kept = 0;
+        size_t dropped = 0;
+        for (size_t i = 0; i < count_; i++) {
+            Frame* frame = slots_[(head_ + i) & (capacity_ - 1)];
+            bool started = i < pinned_ || (i == 0 && offset_ > 0);
+            if (bytes_ - spooled_ > target_bytes && !started && frame->kind >= min_kind) {
+                bytes_ -= frame_size(frame);
+                spooled_ -= frame->spool_size;
+                *dropped_bytes += frame_size(frame);
+                frame_unref(frame);
+                dropped++;
+                continue;
+            }
+            slots_[(head_ + kept) & (capacity_ - 1)] = frame;
+            kept++;
+        }
+        count_ = kept;
+        return dropped;
+    }
+
+    // Drops the bulk frames that have not started going out for which
+    // drop(frame) is true (a cancelled transfer's). Returns how many.
+    template <typename Drop>
+    size_t drop_bulk(Drop drop) {
+        size_t kept = 0;
+        size_t dropped = 0;
+        for (size_t i = 0; i < count_; i++) {
+            Frame* frame = slots_[(head_ + i) & (capacity_ - 1)];
+            bool started = i < pinned_ || (i == 0 && offset_ > 0);
+            if (frame->bulk && !started && drop(frame)) {
+                bytes_ -= frame_size(frame);
+                spooled_ -= frame->spool_size;
+                frame_unref(frame);
+                dropped++;
+                continue;
+            }
+            slots_[(head_ + kept) & (capacity_ - 1)] = frame;
+            kept++;
+        }
+        count_ = kept;
+        return dropped;
+    }
+
+    // For completion-based writers (io_uring), which hand the frames to the
+    // kernel and learn later how much went out: describes up to `max`
+    // frames from the head in `iov` and `frames`, and pins them until
+    // finish_write(), so meanwhile they are neither dropped nor packed into.
+    // Spooled data is read back into its frame first, one frame at a time.
+    int start_write(iovec* iov, Frame** frames, int max) {
+        int described = 0;
+        for (size_t i = 0; i < count_ && described < max; i++) {
+            Frame* frame = slots_[(head_ + i) & (capacity_ - 1)];
+            if (frame->spool != nullptr) {
+                if (described > 0) {
+                    break;
+                }
+                load_spooled(frame);
+            }
+            size_t skip = (i == 0) ? offset_ : 0;
+            iov[described].iov_base = const_cast<char*>(frame->bytes.data()) + skip;
+            iov[described].iov_len = frame->bytes.size() - skip;
+            frames[described] = frame;
+            described++;
+        }
+        pinned_ = described;
+        return described;
+    }
+
+    void finish_write(size_t sent) {
+        writes_++;
+        if (pinned_ == 0) {
+            return;  // The frames were taken meanwhile (see take()).
+        }
+        pinned_ = 0;
+        consume(sent);
+    }
+
+    // Moves every frame out, whole, for another queue to send from the
+    // start: the part of the first one already written went to a peer that
+    // is gone. Hands over the queue's references.
+    void take(std::vector<Frame*>* frames) {
+        for (size_t i = 0; i < count_; i++) {
+            frames->push_back(slots_[(head_ + i) & (capacity_ - 1)]);
+        }
+        head_ = 0;
+        count_ = 0;
+        offset_ = 0;
+        pinned_ = 0;
+        bytes_ = 0;
+        spooled_ = 0;
+    }
+
+    // Calls visit(frame, offset) for every queued frame, oldest first;
+    // offset is how much of it was already written (only ever non-zero for
+    // the first).
+    template <typename Visit>
+    void for_each(Visit visit) const {
+        for (size_t i = 0; i < count_; i++) {
+            visit(slots_[(head_ + i) & (capacity_ - 1)], i == 0 ? offset_ : 0);
+        }
+    }
+
+    // Writes as much as the socket accepts, up to IOV_MAX frames per call.
+    // The in-memory frames up to the next spooled part go out with one
+    // sendmsg(), the spooled part with sendfile().
+    FlushResult flush(int fd) {
+        while (count_ > 0) {
+            Frame* head = slots_[head_];
+            ssize_t sent;
+            if (head->spool != nullptr && offset_ >= head->bytes.size()) {
+                off_t position = off_t(head->spool_offset + (offset_ - head->bytes.size()));
+                sent = sendfile(fd, head->spool->fd, &position, frame_size(head) - offset_);
+                if (sent == 0) {
+                    return FLUSH_ERROR;  // The spool file came up short.
+                }
+            } else {
+                iovec iov[kMaxIov];
+                int iov_count = 0;
+                for (size_t i = 0; i < count_ && iov_count < kMaxIov; i++) {
+                    Frame* frame = slots_[(head_ + i) & (capacity_ - 1)];
+                    size_t skip = (i == 0) ? offset_ : 0;
+                    iov[iov_count].iov_base = const_cast<char*>(frame->bytes.data()) + skip;
+                    iov[iov_count].iov_len = frame->bytes.size() - skip;
+                    iov_count++;
+                    if (frame->spool != nullptr) {
+                        break;
+                    }
+                }
+
+                msghdr msg = {};
+                msg.msg_iov = iov;
+                msg.msg_iovlen = iov_count;
+                sent = sendmsg(fd, &msg, MSG_NOSIGNAL);
+            }
+            writes_++;
+            if (sent < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                if (errno == EAGAIN || errno == EWOULDBLOCK) {
+                    return FLUSH_BLOCKED;
+                }
+                return FLUSH_ERROR;
+            }
+            consume(sent);
+        }
+        return FLUSH_DONE;
+    }
+
+private:
+    static const int kMaxIov = IOV_MAX < 64 ? IOV_MAX : 64;
+    static const size_t kMaxPackedBytes = 64 * 1024;
+
+    // Packs into the frame before position `at`.
+    bool pack(Frame* frame, size_t at) {
+        if (at == 0 || (at == 1 && offset_ > 0) || at <= pinned_) {
+            return false;
+        }
+        size_t tail_index = (head_ + at - 1) & (capacity_ - 1);
+        Frame* tail = slots_[tail_index];
+        size_t payload = frame->bytes.size() - kFrameHeaderSize;
+        if (!tail->packable || tail->kind != frame->kind || tail->bytes.size() + payload > kMaxPackedBytes) {
+            return false;
+        }
+        if (tail->refs.load(std::memory_order_acquire) != 1) {
+            // Still shared with other queues (a broadcast): merge into a
+            // private copy instead.
+            Frame* copy = FramePool::local().acquire();
+            copy->refs.store(1, std::memory_order_relaxed);
+            copy->packable = true;
+            copy->kind = tail->kind;
+            copy->bytes.assign(tail->bytes);
+            frame_unref(tail);
+            slots_[tail_index] = tail = copy;
+        }
+        tail->bytes.append(frame->bytes, kFrameHeaderSize, std::string::npos);
+        write_frame_header(&tail->bytes[0], static_cast<uint32_t>(tail->bytes.size() - kFrameHeaderSize));
+        bytes_ += payload;
+        frame_unref(frame);
+        return true;
+    }
+
+    void consume(size_t sent) {
+        bytes_ -= sent;
+        while (sent > 0) {
+            Frame* frame = slots_[head_];
+            size_t left = frame_size(frame) - offset_;
+            size_t memory = frame->bytes.size();
+            size_t step = std::min(sent, left);
+            // The spooled part is the one past the frame's in-memory bytes.
+            spooled_ -= std::max(offset_ + step, memory) - std::max(offset_, memory);
+            if (sent < left) {
+                offset_ += sent;
+                return;
+            }
+            sent -= left;
+            offset_ = 0;
+            pop();
+        }
+    }
+
+    // Brings a frame's spooled part into its bytes. Should the spool file
+    // fail, the frame keeps its length, so the stream stays in step.
+    void load_spooled(Frame* frame) {
+        read_spooled(frame, &frame->bytes);
+        spooled_ -= frame->spool_size;
+        spool_unref(frame->spool);
+        frame->spool = nullptr;
+        frame->spool_size = 0;
+    }
+
+    void pop() {
+        frame_unref(slots_[head_]);
+        head_ = (head_ + 1) & (capacity_ - 1);
+        count_--;
+    }
+
+    void grow() {
+        size_t new_capacity = capacity_ == 0 ? 8 : capacity_ * 2;
+        Frame** grown = new Frame*[new_capacity];
+        for (size_t i = 0; i < count_; i++) {
+            grown[i] = slots_[(head_ + i) & (capacity_ - 1)];
+        }
+        delete[] slots_;
+        slots_ = grown;
+        capacity_ = new_capacity;
+        head_ = 0;
+    }
+
+    Frame** slots_;
+    size_t capacity_;
+    size_t head_;
+    size_t count_;
+    size_t offset_;
+    size_t pinned_;  // Frames at the head handed to start_write().
+    size_t bytes_;
+    size_t spooled_;
+    uint64_t writes_;
+};
+
+#endif
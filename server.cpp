@@ -1,236 +1,3677 @@
 #include <iostream>
 #include <string>
+#include <stdexcept>
 #include <unordered_map>
+#include <unordered_set>
 #include <pthread.h>
 #include <netinet/in.h>
+#include <netinet/tcp.h>
 #include <unistd.h>
 #include <chrono>
 #include <thread>
 #include <arpa/inet.h>
+#include <fcntl.h>
+#include <errno.h>
+#include <string.h>
+#include <signal.h>
+#include <vector>
+#include <algorithm>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/random.h>
+#include <sys/resource.h>
+#include <poll.h>
+#include <time.h>
 #include "chat.pb.h"
+#include "framing.h"
+#include "outbound.h"
+#include "timer_wheel.h"
+#include "log.h"
+#include "alloc_stats.h"
+#include "metrics.h"
+#include "offline_store.h"
+#include "mpsc_queue.h"
+#include "session_store.h"
+#include "handoff.h"
+#include "uring.h"
+#include "worker_pool.h"
+#include "snapshot_cell.h"
+#include <google/protobuf/arena.h>
+#include <google/protobuf/text_format.h>
 
-struct UserSession {
-    std::string username;
-    std::string ip_address;
-    chat::UserStatus status;
+struct Reactor;
+
+// io_uring mode: the SENDMSG in flight for a connection; it has at most one.
+const int kUringSendIov = 64;
+struct UringSend {
+    msghdr msg;
+    iovec iov[kUringSendIov];
+    Frame* frames[kUringSendIov];  // Hold references until the send completes.
+    int count;
+};
+
+// Per-connection state shared by all I/O models. Kept deliberately small
+// (the receive buffer is only held while a frame is partially read) so tens
+// of thousands of idle clients stay cheap.
+//
+// The inbound side belongs to the connection's I/O thread, and so do its
+// requests unless a worker pool runs them (see queue_request()). The outbound
+// queue can be fed from any thread under out_mutex; whoever enqueues tries a
+// non-blocking flush right away and, if the socket is full, leaves the rest
+// for the I/O thread to drain once the socket becomes writable.
+struct Connection {
     int socket;
-    std::chrono::system_clock::time_point last_activity;
+    std::string ip_address;
+    FrameBuffer inbound;
+    pthread_mutex_t out_mutex;
+    OutboundQueue outbound;
+    bool want_write;
+    bool closed;
+    bool slow;  // Output went past the high watermark and has not drained to the low one yet.
+    bool overflowed;  // Being disconnected for not reading; nothing more is queued.
+    bool corked;  // A batch of its requests is running; output waits for uncork_connection().
+    bool parked;  // Closed, but its session is detached and output is kept for a resume (see detach_session()).
+    bool held_lost;  // What was kept for the resume overflowed; the session is ending (see hold_frame()).
+    Connection* successor;  // Set once its session was resumed elsewhere: output goes there. Holds a reference.
+    int wakeup_fd;  // Thread mode only: eventfd that interrupts the owner's poll().
+    Reactor* reactor;  // Event loop that owns the socket; null in thread mode.
+    bool uring;  // Owned by an io_uring loop, which alone writes the socket (see uring_request_send()).
+    UringSend* uring_send;  // io_uring mode: the write in flight; owner only.
+    bool flush_pending;  // Owner reactor only: already listed for a flush after an inbox drain.
+    bool finishing;  // I/O thread only: handed to finish_connection(), nothing more is read.
+    pthread_mutex_t work_mutex;  // Guards the three fields below.
+    std::string work_queue;  // Worker pool: requests read but not run yet, each a 4-byte size and the payload.
+    bool work_scheduled;  // A worker job for the connection is queued or running.
+    bool work_finish;  // Once its requests have run, the job disconnects it.
+    std::string username;  // Session registered on this connection; set by the thread running its requests.
+    uint32_t user_slot;  // Its SessionStore slot (kNoSlot while unregistered); set along with username.
+    UserId user_id;  // 0 while unregistered; set along with username.
+    bool batched_delivery;  // Registered with accept_batched_delivery; set along with username.
+    bool compress;  // Registered with accept_compression; set along with username.
+    TimerNode idle_timer;  // Session inactivity; holds a connection reference while pending.
+    TimerNode resume_timer;  // Grace period of its detached session; holds a connection reference while pending.
+    int64_t resume_deadline_ms;  // SessionStore::now_ms() at which that runs out.
+    std::vector<std::string> rooms;  // Joined rooms, sorted; only touched by the thread running its requests.
+    bool presence_subscribed;  // Guarded by the presence hub's mutex.
+    std::atomic<int> transfers;  // File transfers it sends or receives (see cancel_transfers()).
+    std::atomic<int> refs;
+};
+
+// Sessions live in a SessionStore: a dense user-ID space whose slots hold
+// each session's status, socket, last activity and connection (which holds
+// a reference). Whole-registry walks (broadcasts, GET_USERS) scan its packed
+// state array, and a connection or a message addressed by id reaches its
+// session without hashing a name.
+//
+// Names map to slots through an index split into independently locked
+// shards keyed by a hash of the username, so lookups for different users
+// never contend. The index keys are the interned names: slots point at
+// them instead of keeping copies. A session is added and removed with its
+// name shard locked, then its slot's lock.
+SessionStore sessions;
+
+const size_t kUserShards = 64;
+
+struct UserShard {
+    UserShard() : name_bytes(0) { pthread_rwlock_init(&lock, NULL); }
+
+    pthread_rwlock_t lock;
+    std::unordered_map<std::string, uint32_t> slots;
+    size_t name_bytes;  // Heap held by names too long for std::string's inline buffer.
+};
+
+// What a name index entry costs beyond its name: a node (next pointer, key,
+// slot, cached hash) and a bucket pointer.
+const size_t kNameIndexEntryBytes = sizeof(void*) + sizeof(std::pair<const std::string, uint32_t>) + sizeof(size_t) +
+                                    sizeof(void*);
+
+size_t name_heap_bytes(const std::string& name) {
+    return name.capacity() > std::string().capacity() ? name.capacity() + 1 : 0;
+}
+
+UserShard user_shards[kUserShards];
+
+UserShard& shard_for(const std::string& username) {
+    return user_shards[std::hash<std::string>()(username) % kUserShards];
+}
+
+// Rooms have their own sharded index. A room is nothing but its member
+// array (connection pointers, each holding a reference), so a room message
+// costs one pass over a contiguous array the size of the room, no matter
+// how many users or rooms exist. Each connection keeps the sorted names of
+// the rooms it joined, to check membership and to leave them all when it
+// goes away.
+const size_t kRoomShards = 64;
+const size_t kMaxRoomName = 64;
+const size_t kMaxRoomsPerConnection = 1024;
+
+struct Room {
+    std::vector<Connection*> members;
 };
 
-std::unordered_map<std::string, UserSession> users;
-pthread_mutex_t users_mutex = PTHREAD_MUTEX_INITIALIZER;
+struct RoomShard {
+    RoomShard() { pthread_rwlock_init(&lock, NULL); }
+
+    pthread_rwlock_t lock;
+    std::unordered_map<std::string, Room*> rooms;
+};
+
+RoomShard room_shards[kRoomShards];
+
+RoomShard& room_shard_for(const std::string& room) {
+    return room_shards[std::hash<std::string>()(room) % kRoomShards];
+}
+
 int inactivity_timeout = 30;
+int resume_grace = 30;  // Seconds a session outlives its connection; 0 ends it right away.
+int timer_tick_ms = 100;
+TimerWheel* timer_wheel = nullptr;
+OfflineStore* offline_store = nullptr;  // Null when --offline-dir is empty.
+std::string offline_dir = "offline_queue";
+size_t offline_segment_mb = 16;
 
-void handle_register_user(const chat::NewUserRequest& request, chat::Response& response, int socket, const std::string& client_ip) {
-    pthread_mutex_lock(&users_mutex);
-    if (users.find(request.username()) != users.end()) {
-        response.set_operation(chat::Operation::REGISTER_USER);  
+// Every open connection, so a hot restart can find them all. Connections
+// join in connection_create() and leave in connection_close().
+pthread_mutex_t open_connections_mutex = PTHREAD_MUTEX_INITIALIZER;
+std::unordered_set<Connection*> open_connections;
+
+// A hot restart (see handoff.h) first parks every thread that serves
+// connections or runs timers. Each stops at a point where it holds no locks
+// and is not in the middle of a request, so the handoff thread can read the
+// whole state undisturbed, then either hand it over or let everyone resume.
+struct ParkingLot {
+    ParkingLot() : requested(false), threads(0), parked(0) {
+        pthread_mutex_init(&mutex, NULL);
+        pthread_cond_init(&changed, NULL);
+    }
+
+    pthread_mutex_t mutex;
+    pthread_cond_t changed;
+    std::atomic<bool> requested;
+    int threads;  // Threads that have to park.
+    int parked;
+};
+
+ParkingLot parking;
+
+// Counts a thread that has to park; called before the thread is started,
+// so a handoff can never miss it.
+void parking_enter() {
+    pthread_mutex_lock(&parking.mutex);
+    parking.threads++;
+    pthread_mutex_unlock(&parking.mutex);
+}
+
+void parking_leave() {
+    pthread_mutex_lock(&parking.mutex);
+    parking.threads--;
+    pthread_cond_broadcast(&parking.changed);
+    pthread_mutex_unlock(&parking.mutex);
+}
+
+// Called by those threads between units of work; blocks while a handoff is
+// in progress.
+void parking_point() {
+    if (!parking.requested.load(std::memory_order_acquire)) {
+        return;
+    }
+    pthread_mutex_lock(&parking.mutex);
+    parking.parked++;
+    pthread_cond_broadcast(&parking.changed);
+    while (parking.requested.load(std::memory_order_relaxed)) {
+        pthread_cond_wait(&parking.changed, &parking.mutex);
+    }
+    parking.parked--;
+    pthread_mutex_unlock(&parking.mutex);
+}
+
+void on_idle_timer(TimerNode* node);
+void on_resume_timer(TimerNode* node);
+
+Connection* connection_create(int socket, const std::string& ip_address, bool with_wakeup) {
+    Connection* conn = new Connection();
+    conn->socket = socket;
+    conn->ip_address = ip_address;
+    pthread_mutex_init(&conn->out_mutex, NULL);
+    conn->want_write = false;
+    conn->closed = false;
+    conn->slow = false;
+    conn->overflowed = false;
+    conn->corked = false;
+    conn->parked = false;
+    conn->held_lost = false;
+    conn->successor = nullptr;
+    conn->batched_delivery = false;
+    conn->compress = false;
+    conn->wakeup_fd = with_wakeup ? eventfd(0, EFD_NONBLOCK) : -1;
+    conn->reactor = nullptr;
+    conn->uring = false;
+    conn->uring_send = nullptr;
+    conn->flush_pending = false;
+    conn->finishing = false;
+    pthread_mutex_init(&conn->work_mutex, NULL);
+    conn->work_scheduled = false;
+    conn->work_finish = false;
+    conn->presence_subscribed = false;
+    conn->user_slot = kNoSlot;
+    conn->user_id = 0;
+    TimerWheel::init_node(&conn->idle_timer, on_idle_timer, conn);
+    TimerWheel::init_node(&conn->resume_timer, on_resume_timer, conn);
+    conn->resume_deadline_ms = 0;
+    conn->transfers.store(0, std::memory_order_relaxed);
+    conn->refs.store(1, std::memory_order_relaxed);
+    thread_metrics().connections_opened.add(1);
+    pthread_mutex_lock(&open_connections_mutex);
+    open_connections.insert(conn);
+    pthread_mutex_unlock(&open_connections_mutex);
+    return conn;
+}
+
+Connection* connection_ref(Connection* conn) {
+    conn->refs.fetch_add(1, std::memory_order_relaxed);
+    return conn;
+}
+
+void connection_unref(Connection* conn) {
+    if (conn->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        if (conn->wakeup_fd >= 0) {
+            close(conn->wakeup_fd);
+        }
+        if (conn->uring) {
+            close(conn->socket);  // See connection_close().
+        }
+        delete conn->uring_send;
+        if (conn->successor != nullptr) {
+            connection_unref(conn->successor);
+        }
+        pthread_mutex_destroy(&conn->work_mutex);
+        pthread_mutex_destroy(&conn->out_mutex);
+        delete conn;
+    }
+}
+
+bool in_room(const Connection* conn, const std::string& room) {
+    return std::binary_search(conn->rooms.begin(), conn->rooms.end(), room);
+}
+
+// Adds the connection to the room, creating it if needed. Returns the
+// member count.
+size_t room_add_member(const std::string& name, Connection* conn) {
+    RoomShard& shard = room_shard_for(name);
+    pthread_rwlock_wrlock(&shard.lock);
+    Room*& room = shard.rooms[name];
+    if (room == nullptr) {
+        room = new Room();
+        thread_metrics().rooms_created.add(1);
+    }
+    room->members.push_back(connection_ref(conn));
+    size_t members = room->members.size();
+    pthread_rwlock_unlock(&shard.lock);
+
+    conn->rooms.insert(std::lower_bound(conn->rooms.begin(), conn->rooms.end(), name), name);
+    return members;
+}
+
+// Removes the connection from the room, deleting the room once it is
+// empty. Returns the member count left.
+size_t room_remove_member(const std::string& name, Connection* conn) {
+    auto joined = std::lower_bound(conn->rooms.begin(), conn->rooms.end(), name);
+    if (joined == conn->rooms.end() || *joined != name) {
+        return 0;
+    }
+    conn->rooms.erase(joined);
+
+    RoomShard& shard = room_shard_for(name);
+    pthread_rwlock_wrlock(&shard.lock);
+    auto it = shard.rooms.find(name);
+    size_t members = 0;
+    if (it != shard.rooms.end()) {
+        std::vector<Connection*>& list = it->second->members;
+        auto member = std::find(list.begin(), list.end(), conn);
+        if (member != list.end()) {
+            *member = list.back();  // Order does not matter; keep the array dense.
+            list.pop_back();
+            connection_unref(conn);
+        }
+        members = list.size();
+        if (list.empty()) {
+            delete it->second;
+            shard.rooms.erase(it);
+            thread_metrics().rooms_deleted.add(1);
+        }
+    }
+    pthread_rwlock_unlock(&shard.lock);
+    return members;
+}
+
+// Outbound queues are bounded. Once a connection has more than
+// outbound_high bytes waiting in memory (file data in spool files does not
+// count) and its socket is full, it is a slow consumer
+// and slow_policy decides what gives:
+//
+//   drop-oldest      its oldest queued messages are dropped down to
+//                    outbound_low bytes;
+//   drop-broadcasts  its queued broadcast and room messages are dropped down
+//                    to outbound_low bytes, and new ones are not queued until
+//                    it has drained below outbound_low again;
+//   disconnect       it is disconnected.
+//
+// Responses to the client's own requests are never dropped; if shedding
+// messages cannot bring the queue back under outbound_high, the connection
+// is disconnected. Either way the sender is never held up by the receiver.
+enum SlowPolicy {
+    SLOW_DROP_OLDEST,
+    SLOW_DROP_BROADCASTS,
+    SLOW_DISCONNECT,
+};
+
+size_t outbound_high = 4 * 1024 * 1024;
+size_t outbound_low = 1024 * 1024;
+SlowPolicy slow_policy = SLOW_DROP_BROADCASTS;
+
+bool parse_slow_policy(const std::string& name, SlowPolicy* policy) {
+    if (name == "drop-oldest") {
+        *policy = SLOW_DROP_OLDEST;
+    } else if (name == "drop-broadcasts") {
+        *policy = SLOW_DROP_BROADCASTS;
+    } else if (name == "disconnect") {
+        *policy = SLOW_DISCONNECT;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+// Called with out_mutex held once the socket is known to be full.
+void check_overflow(Connection* conn) {
+    if (conn->outbound.memory_bytes() <= outbound_high) {
+        return;
+    }
+    ThreadMetrics& metrics = thread_metrics();
+    if (!conn->slow) {
+        conn->slow = true;
+        metrics.slow_consumers.add(1);
+        log_warn("Client {} (socket {}) is not reading; {} bytes queued", conn->ip_address, conn->socket, conn->outbound.bytes());
+    }
+    if (slow_policy != SLOW_DISCONNECT) {
+        size_t dropped_bytes = 0;
+        FrameKind kind = slow_policy == SLOW_DROP_OLDEST ? FRAME_DIRECT : FRAME_BROADCAST;
+        size_t dropped = conn->outbound.drop_oldest(kind, outbound_low, &dropped_bytes);
+        metrics.frames_dropped.add(dropped);
+        metrics.frames_sent.add(dropped);
+        metrics.bytes_dequeued.add(dropped_bytes);
+        if (conn->outbound.memory_bytes() <= outbound_high) {
+            return;
+        }
+    }
+
+    // The I/O thread sees the shutdown as a hangup and cleans up as usual.
+    conn->overflowed = true;
+    metrics.overflow_disconnects.add(1);
+    metrics.frames_sent.add(conn->outbound.size());
+    metrics.bytes_dequeued.add(conn->outbound.bytes());
+    log_warn("Disconnecting client {} (socket {}): {} bytes of output it is not reading", conn->ip_address, conn->socket, conn->outbound.bytes());
+    conn->outbound.clear();
+    shutdown(conn->socket, SHUT_RDWR);
+}
+
+void uring_request_send(Connection* conn);
+
+// Called with out_mutex held. In io_uring mode want_write means a send is
+// submitted or about to be, and the loop writes instead.
+void flush_locked(Connection* conn) {
+    if (conn->closed) {
+        return;
+    }
+    if (conn->uring) {
+        if (!conn->want_write) {
+            conn->want_write = true;
+            uring_request_send(conn);
+        }
+        return;
+    }
+    size_t frames_before = conn->outbound.size();
+    size_t bytes_before = conn->outbound.bytes();
+    uint64_t writes_before = conn->outbound.writes();
+    FlushResult result = conn->outbound.flush(conn->socket);
+    ThreadMetrics& metrics = thread_metrics();
+    metrics.write_calls.add(conn->outbound.writes() - writes_before);
+    metrics.frames_sent.add(frames_before - conn->outbound.size());
+    metrics.bytes_dequeued.add(bytes_before - conn->outbound.bytes());
+    metrics.bytes_out.add(bytes_before - conn->outbound.bytes());
+    if (conn->slow && conn->outbound.memory_bytes() <= outbound_low) {
+        conn->slow = false;
+    }
+    if (result != FLUSH_BLOCKED) {
+        return;
+    }
+    if (!conn->want_write) {
+        conn->want_write = true;
+        if (conn->wakeup_fd >= 0) {
+            uint64_t one = 1;
+            write(conn->wakeup_fd, &one, sizeof(one));
+        }
+    }
+    check_overflow(conn);
+}
+
+// While a connection is corked, output for it is only queued, unless this
+// much piles up; the batch is then written out early so corking never holds
+// more than this in memory.
+const size_t kCorkedBytesLimit = 64 * 1024;
+
+// A parked connection keeps what is sent to it for the resume of its
+// session, within outbound_high: past that its oldest broadcasts go first.
+// If that is not enough, a resume could no longer replay everything the
+// session missed, so nothing more is kept and the session ends at once, as
+// if its grace period had run out; a RESUME meanwhile is turned down. Called
+// with out_mutex held.
+void hold_frame(Connection* conn, Frame* frame) {
+    ThreadMetrics& metrics = thread_metrics();
+    size_t frames_before = conn->outbound.size();
+    size_t bytes_before = conn->outbound.bytes();
+    conn->outbound.push(frame_ref(frame));
+    if (conn->outbound.size() == frames_before) {
+        metrics.frames_packed.add(1);
+    }
+    metrics.frames_queued.add(conn->outbound.size() - frames_before);
+    metrics.bytes_queued.add(conn->outbound.bytes() - bytes_before);
+    if (conn->outbound.memory_bytes() <= outbound_high) {
+        return;
+    }
+    size_t dropped_bytes = 0;
+    size_t dropped = conn->outbound.drop_oldest(FRAME_BROADCAST, outbound_low, &dropped_bytes);
+    metrics.frames_dropped.add(dropped);
+    metrics.frames_sent.add(dropped);
+    metrics.bytes_dequeued.add(dropped_bytes);
+    if (conn->outbound.memory_bytes() <= outbound_high) {
+        return;
+    }
+
+    log_warn("Session of {} has {} bytes kept for its resume; ending it", conn->username, conn->outbound.bytes());
+    conn->parked = false;
+    conn->held_lost = true;
+    metrics.frames_sent.add(conn->outbound.size());
+    metrics.bytes_dequeued.add(conn->outbound.bytes());
+    conn->outbound.clear();
+    // Unless a resume or the timer got there first, the pending timer's
+    // reference carries over.
+    if (timer_wheel->cancel(&conn->resume_timer)) {
+        timer_wheel->schedule(&conn->resume_timer, 0);
+    }
+}
+
+void route_frame(Connection* conn, Frame* frame);
+
+// Queues a frame (taking a new reference) and, unless the caller will flush
+// later or the connection is corked, writes it out if the socket has room.
+// Never blocks on the peer.
+void enqueue_frame(Connection* conn, Frame* frame, bool flush = true) {
+    pthread_mutex_lock(&conn->out_mutex);
+    if (conn->successor != nullptr) {
+        // Sent before the session moved; it follows the session.
+        Connection* successor = connection_ref(conn->successor);
+        pthread_mutex_unlock(&conn->out_mutex);
+        route_frame(successor, frame);
+        connection_unref(successor);
+        return;
+    }
+    if (conn->parked) {
+        hold_frame(conn, frame);
+    } else if (!conn->closed && !conn->overflowed) {
+        ThreadMetrics& metrics = thread_metrics();
+        if (conn->slow && slow_policy == SLOW_DROP_BROADCASTS && frame->kind == FRAME_BROADCAST) {
+            metrics.frames_dropped.add(1);
+            pthread_mutex_unlock(&conn->out_mutex);
+            return;
+        }
+        size_t frames_before = conn->outbound.size();
+        size_t bytes_before = conn->outbound.bytes();
+        metrics.queue_depth.record(frames_before);
+        conn->outbound.push(frame_ref(frame));
+        if (conn->outbound.size() == frames_before) {
+            metrics.frames_packed.add(1);
+        }
+        metrics.frames_queued.add(conn->outbound.size() - frames_before);
+        metrics.bytes_queued.add(conn->outbound.bytes() - bytes_before);
+        if (conn->want_write) {
+            check_overflow(conn);
+        } else if (flush && (!conn->corked || conn->outbound.bytes() >= kCorkedBytesLimit)) {
+            flush_locked(conn);
+        }
+    }
+    pthread_mutex_unlock(&conn->out_mutex);
+}
+
+void flush_connection(Connection* conn) {
+    pthread_mutex_lock(&conn->out_mutex);
+    if (!conn->want_write) {
+        flush_locked(conn);
+    }
+    pthread_mutex_unlock(&conn->out_mutex);
+}
+
+// The I/O thread corks a connection while it runs a batch of its requests:
+// their responses, deliveries to the connection itself (its own broadcasts,
+// its queued offline messages) and anything other threads route to it in the
+// meantime are only queued, and uncorking writes them all with one writev.
+// This is an explicit flush point rather than TCP_CORK, so it costs no extra
+// setsockopt() calls and the socket keeps TCP_NODELAY.
+void cork_connection(Connection* conn) {
+    pthread_mutex_lock(&conn->out_mutex);
+    conn->corked = true;
+    pthread_mutex_unlock(&conn->out_mutex);
+}
+
+void uncork_connection(Connection* conn) {
+    pthread_mutex_lock(&conn->out_mutex);
+    conn->corked = false;
+    if (!conn->want_write) {
+        flush_locked(conn);
+    }
+    pthread_mutex_unlock(&conn->out_mutex);
+}
+
+// Event loop state. In reactor mode each reactor runs on its own core with
+// its own SO_REUSEPORT listener and only ever touches the sockets it
+// accepted: a delivery for a connection owned by another reactor is handed
+// over through the owner's lock-free inbox, and the owner queues and writes
+// it. (The user registry stays shared, but routing only takes its read
+// side.)
+struct RoutedFrame {
+    Connection* conn;  // Holds a reference.
+    Frame* frame;  // Holds a reference.
+};
+
+const size_t kReactorInboxSize = 64 * 1024;
+const size_t kReactorInboxBatch = 4096;  // Deliveries handled per wakeup before serving sockets again.
+
+struct Reactor {
+    Reactor() : inbox(kReactorInboxSize), wake_pending(false), ring(nullptr), ops(0), quiescing(false) {
+        pthread_mutex_init(&flush_mutex, NULL);
+    }
+
+    int listen_fd;
+    int epoll_fd;  // -1 for an io_uring loop.
+    int wakeup_fd;
+    int cpu;  // -1 if not pinned.
+    MpscQueue<RoutedFrame> inbox;
+    std::atomic<bool> wake_pending;  // The wakeup eventfd has been written since the last drain.
+
+    // io_uring mode only (see run_uring_loop()).
+    Uring* ring;  // Created by the loop's own thread.
+    size_t ops;  // Submitted operations that will still complete.
+    bool quiescing;  // Operations are being cancelled for a handoff.
+    std::vector<Connection*> send_list;  // Output to submit after this round; hold references.
+    pthread_mutex_t flush_mutex;
+    std::vector<Connection*> flush_requests;  // Output queued by other threads; hold references.
+};
+
+thread_local Reactor* current_reactor = nullptr;
+std::vector<Reactor*> all_reactors;  // Guarded by parking.mutex.
+
+void wake_reactor(Reactor* reactor) {
+    if (!reactor->wake_pending.exchange(true)) {
+        uint64_t one = 1;
+        write(reactor->wakeup_fd, &one, sizeof(one));
+    }
+}
+
+// Queues a delivery for `conn` on whichever thread owns its socket. If the
+// owner's inbox is full the frame is queued directly, which is always safe.
+void route_frame(Connection* conn, Frame* frame) {
+    Reactor* owner = conn->reactor;
+    if (owner != nullptr && owner != current_reactor) {
+        if (owner->inbox.push({connection_ref(conn), frame_ref(frame)})) {
+            thread_metrics().frames_routed.add(1);
+            wake_reactor(owner);
+            return;
+        }
+        connection_unref(conn);
+        frame_unref(frame);
+    }
+    enqueue_frame(conn, frame);
+}
+
+// Queues what other reactors handed over, then writes each connection once.
+void drain_inbox(Reactor* reactor) {
+    static thread_local std::vector<Connection*> touched;
+    reactor->wake_pending.store(false);
+    RoutedFrame routed;
+    size_t drained = 0;
+    while (drained < kReactorInboxBatch && reactor->inbox.pop(&routed)) {
+        enqueue_frame(routed.conn, routed.frame, false);
+        frame_unref(routed.frame);
+        if (routed.conn->flush_pending) {
+            connection_unref(routed.conn);
+        } else {
+            routed.conn->flush_pending = true;
+            touched.push_back(routed.conn);
+        }
+        drained++;
+    }
+    for (Connection* conn : touched) {
+        conn->flush_pending = false;
+        flush_connection(conn);
+        connection_unref(conn);
+    }
+    touched.clear();
+    if (drained == kReactorInboxBatch) {
+        wake_reactor(reactor);  // Come back for the rest after a round of socket events.
+    }
+}
+
+// Clients that register with accept_compression get frames of at least
+// compress_threshold bytes compressed (0 turns compression off). A frame
+// shared by many recipients is compressed once, and the compressed copy is
+// shared by all of them that negotiated it.
+size_t compress_threshold = 1024;
+int compress_level = Z_BEST_SPEED;
+
+uint64_t thread_cpu_ns() {
+    timespec now;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &now);
+    return uint64_t(now.tv_sec) * 1000000000 + now.tv_nsec;
+}
+
+// Returns a new reference to what a connection that negotiated compression
+// gets instead of `frame`: a compressed copy if the frame is big enough and
+// shrinks, otherwise the frame itself.
+Frame* compressed_variant(Frame* frame) {
+    size_t size = frame->bytes.size();
+    if (compress_threshold == 0 || size - kFrameHeaderSize < compress_threshold) {
+        return frame_ref(frame);
+    }
+    ThreadMetrics& metrics = thread_metrics();
+    uint64_t start_ns = thread_cpu_ns();
+    Frame* copy = FramePool::local().acquire();
+    bool compressed = compress_frame(frame->bytes, compress_threshold, compress_level, &copy->bytes);
+    metrics.compression_cpu_ns.add(thread_cpu_ns() - start_ns);
+    if (!compressed) {
+        FramePool::local().release(copy);
+        return frame_ref(frame);
+    }
+    copy->refs.store(1, std::memory_order_relaxed);
+    copy->packable = false;  // Compressed batches do not concatenate.
+    copy->kind = frame->kind;
+    metrics.frames_compressed.add(1);
+    metrics.compression_in.add(size);
+    metrics.compression_out.add(copy->bytes.size());
+    return copy;
+}
+
+// Routed like any delivery, so a response built by a worker goes back to
+// the connection's reactor to be written.
+void send_response(Connection* conn, const google::protobuf::MessageLite& message) {
+    Frame* frame = make_frame(message);
+    if (conn->compress) {
+        Frame* compressed = compressed_variant(frame);
+        frame_unref(frame);
+        frame = compressed;
+    }
+    route_frame(conn, frame);
+    frame_unref(frame);
+}
+
+// Invoked by the I/O thread once the socket reports writability.
+void handle_writable(Connection* conn) {
+    pthread_mutex_lock(&conn->out_mutex);
+    conn->want_write = false;
+    flush_locked(conn);
+    pthread_mutex_unlock(&conn->out_mutex);
+}
+
+bool connection_wants_write(Connection* conn) {
+    pthread_mutex_lock(&conn->out_mutex);
+    bool want_write = conn->want_write;
+    pthread_mutex_unlock(&conn->out_mutex);
+    return want_write;
+}
+
+// Closing under out_mutex guarantees no other thread writes to the fd after
+// it has been released and possibly reused by a new connection. An io_uring
+// connection is only shut down here: operations already submitted name the
+// descriptor by number, so it is closed with the last reference, once they
+// have all completed. With `park` the output is kept for a resume.
+void connection_close(Connection* conn, bool park = false) {
+    pthread_mutex_lock(&conn->out_mutex);
+    bool closing = !conn->closed;
+    if (closing) {
+        conn->closed = true;
+        conn->parked = park;
+        ThreadMetrics& metrics = thread_metrics();
+        metrics.connections_closed.add(1);
+        if (!park) {
+            metrics.frames_sent.add(conn->outbound.size());
+            metrics.bytes_dequeued.add(conn->outbound.bytes());
+            conn->outbound.clear();
+        }
+        if (conn->uring) {
+            shutdown(conn->socket, SHUT_RDWR);
+        } else {
+            close(conn->socket);
+        }
+    }
+    pthread_mutex_unlock(&conn->out_mutex);
+    if (closing) {
+        pthread_mutex_lock(&open_connections_mutex);
+        open_connections.erase(conn);
+        pthread_mutex_unlock(&open_connections_mutex);
+    }
+}
+
+// Presence subscriptions. A subscriber gets one snapshot of every session
+// and its status, then PRESENCE_UPDATE frames with only what changed,
+// coalesced over presence_interval_ms: a user who changes several times in
+// one interval shows up once, with the last state, and one that ends up
+// where it started not at all. So presence traffic follows churn, not the
+// size of the roster.
+//
+// The hub keeps its own copy of the roster. Whoever changes a session
+// records it here while still holding the session's shard lock, so the hub
+// sees each user's changes in the same order as the registry, and snapshots
+// never have to walk the shards. Snapshots are queued under the hub's mutex
+// and updates are built under it too, so a new subscriber always gets its
+// snapshot before any update.
+struct PendingPresence {
+    bool present_before;
+    chat::UserStatus status_before;
+    bool joined;  // Registered during the interval.
+    UserId id;  // Of the latest session under the name.
+};
+
+struct PresenceEntry {
+    chat::UserStatus status;
+    UserId id;
+};
+
+struct PresenceHub {
+    PresenceHub() : version(0), flushed_version(0), subscribed_since_flush(false) {
+        pthread_mutex_init(&mutex, NULL);
+    }
+
+    pthread_mutex_t mutex;
+    std::unordered_map<std::string, PresenceEntry> roster;
+    std::unordered_map<std::string, PendingPresence> pending;  // Changed since the last update.
+    std::vector<Connection*> subscribers;  // Hold references.
+    uint64_t version;  // Bumped by every change.
+    uint64_t flushed_version;  // Version of the last update sent.
+    bool subscribed_since_flush;
+};
+
+PresenceHub presence_hub;
+int presence_interval_ms = 250;
+// Bumped whenever a user joins or leaves the online list, once the change
+// is visible in the sessions; versions the cached GET_USERS answer (see
+// send_user_list()).
+std::atomic<uint64_t> roster_changes(0);
+TimerNode presence_timer;
+
+// `status` is ignored when the user is no longer present.
+void presence_record(const std::string& username, UserId id, bool present, chat::UserStatus status, bool joined) {
+    pthread_mutex_lock(&presence_hub.mutex);
+    auto current = presence_hub.roster.find(username);
+    bool was_present = current != presence_hub.roster.end();
+    auto pending = presence_hub.pending.find(username);
+    if (pending == presence_hub.pending.end()) {
+        PendingPresence before = {was_present, was_present ? current->second.status : chat::UserStatus::OFFLINE, false, id};
+        pending = presence_hub.pending.emplace(username, before).first;
+    }
+    pending->second.joined = pending->second.joined || joined;
+    pending->second.id = id;
+    bool was_listed = was_present && current->second.status == chat::UserStatus::ONLINE;
+    bool listed = present && status == chat::UserStatus::ONLINE;
+    if (listed != was_listed || (listed && current->second.id != id)) {
+        roster_changes.fetch_add(1, std::memory_order_release);
+    }
+    if (present) {
+        presence_hub.roster[username] = {status, id};
+    } else if (was_present) {
+        presence_hub.roster.erase(current);
+    }
+    presence_hub.version++;
+    pthread_mutex_unlock(&presence_hub.mutex);
+    thread_metrics().presence_changes.add(1);
+}
+
+void presence_joined(const std::string& username, UserId id) {
+    presence_record(username, id, true, chat::UserStatus::ONLINE, true);
+}
+
+void presence_status(const std::string& username, UserId id, chat::UserStatus status) {
+    presence_record(username, id, true, status, false);
+}
+
+void presence_left(const std::string& username, UserId id) {
+    presence_record(username, id, false, chat::UserStatus::OFFLINE, false);
+}
+
+// Queues the snapshot and adds the connection to the subscribers; false if
+// it was subscribed already. Snapshots and updates are queued as responses,
+// which are never shed: a subscriber that missed one would stay wrong.
+bool presence_subscribe(Connection* conn, google::protobuf::Arena* arena, uint64_t* version) {
+    chat::Response& snapshot = *google::protobuf::Arena::CreateMessage<chat::Response>(arena);
+    snapshot.set_operation(chat::Operation::PRESENCE_UPDATE);
+    chat::PresenceUpdate* update = snapshot.mutable_presence();
+    update->set_snapshot(true);
+
+    pthread_mutex_lock(&presence_hub.mutex);
+    if (conn->presence_subscribed) {
+        pthread_mutex_unlock(&presence_hub.mutex);
+        return false;
+    }
+    update->mutable_users()->Reserve(int(presence_hub.roster.size()));
+    for (const auto& user : presence_hub.roster) {
+        chat::User* user_proto = update->add_users();
+        user_proto->set_username(user.first);
+        user_proto->set_status(user.second.status);
+        user_proto->set_id(user.second.id);
+    }
+    *version = presence_hub.version;
+    update->set_version(*version);
+    send_response(conn, snapshot);
+    presence_hub.subscribers.push_back(connection_ref(conn));
+    presence_hub.subscribed_since_flush = true;
+    conn->presence_subscribed = true;
+    pthread_mutex_unlock(&presence_hub.mutex);
+
+    ThreadMetrics& metrics = thread_metrics();
+    metrics.presence_subscribed.add(1);
+    metrics.presence_updates.add(1);
+    return true;
+}
+
+bool presence_unsubscribe(Connection* conn) {
+    pthread_mutex_lock(&presence_hub.mutex);
+    bool subscribed = conn->presence_subscribed;
+    if (subscribed) {
+        std::vector<Connection*>& list = presence_hub.subscribers;
+        auto it = std::find(list.begin(), list.end(), conn);
+        *it = list.back();
+        list.pop_back();
+        conn->presence_subscribed = false;
+    }
+    pthread_mutex_unlock(&presence_hub.mutex);
+    if (subscribed) {
+        thread_metrics().presence_unsubscribed.add(1);
+        connection_unref(conn);
+    }
+    return subscribed;
+}
+
+// Turns the interval's changes into one update frame, shared by every
+// subscriber (and its compressed copy by those that negotiated it).
+void flush_presence() {
+    static std::vector<Connection*> recipients;  // Timer thread only (or a handoff while it is parked).
+    chat::Response message;
+    message.set_operation(chat::Operation::PRESENCE_UPDATE);
+    chat::PresenceUpdate* update = message.mutable_presence();
+
+    pthread_mutex_lock(&presence_hub.mutex);
+    for (const auto& change : presence_hub.pending) {
+        auto current = presence_hub.roster.find(change.first);
+        bool present = current != presence_hub.roster.end();
+        // Someone who subscribed meanwhile may have seen an intermediate state.
+        bool unchanged = present == change.second.present_before &&
+                         (!present || current->second.status == change.second.status_before);
+        if (unchanged && !presence_hub.subscribed_since_flush) {
+            continue;
+        }
+        chat::PresenceEvent* event = update->add_events();
+        event->set_username(change.first);
+        event->set_user_id(change.second.id);
+        if (!present) {
+            event->set_change(chat::PresenceChange::LEFT);
+        } else {
+            bool joined = !change.second.present_before || change.second.joined;
+            event->set_change(joined ? chat::PresenceChange::JOINED : chat::PresenceChange::STATUS_CHANGED);
+            event->set_status(current->second.status);
+        }
+    }
+    presence_hub.pending.clear();
+    presence_hub.subscribed_since_flush = false;
+    recipients.clear();
+    if (update->events_size() > 0) {
+        for (Connection* subscriber : presence_hub.subscribers) {
+            recipients.push_back(connection_ref(subscriber));
+        }
+    }
+    if (!recipients.empty() || presence_hub.subscribers.empty()) {
+        update->set_since_version(presence_hub.flushed_version);
+        update->set_version(presence_hub.version);
+        presence_hub.flushed_version = presence_hub.version;
+    }
+    pthread_mutex_unlock(&presence_hub.mutex);
+
+    if (recipients.empty()) {
+        return;
+    }
+    ThreadMetrics& metrics = thread_metrics();
+    metrics.presence_events.add(update->events_size());
+    metrics.presence_updates.add(recipients.size());
+    Frame* frame = make_frame(message);
+    Frame* compressed = nullptr;
+    for (Connection* recipient : recipients) {
+        if (recipient->compress) {
+            if (compressed == nullptr) {
+                compressed = compressed_variant(frame);
+            }
+            route_frame(recipient, compressed);
+        } else {
+            route_frame(recipient, frame);
+        }
+        connection_unref(recipient);
+    }
+    frame_unref(frame);
+    if (compressed != nullptr) {
+        frame_unref(compressed);
+    }
+}
+
+void on_presence_timer(TimerNode* node) {
+    flush_presence();
+    timer_wheel->schedule(node, presence_interval_ms);
+}
+
+// Inactivity is tracked lazily: activity only updates last_activity, and the
+// timer is armed once per timeout window. When it fires, the session is
+// either really idle or the timer is re-armed for the time that is left.
+void arm_idle_timer(Connection* conn, uint64_t delay_ms) {
+    connection_ref(conn);
+    if (!timer_wheel->schedule(&conn->idle_timer, delay_ms)) {
+        connection_unref(conn);  // Was already pending and holding a reference.
+    }
+}
+
+void on_idle_timer(TimerNode* node) {
+    Connection* conn = static_cast<Connection*>(node->data);
+    uint64_t timeout_ms = uint64_t(inactivity_timeout) * 1000;
+
+    uint32_t slot = conn->user_slot;
+    if (slot == kNoSlot) {  // Unregistered since.
+        connection_unref(conn);
+        return;
+    }
+    pthread_rwlock_t& lock = sessions.lock_for(slot);
+    pthread_rwlock_wrlock(&lock);
+    SessionState& state = sessions.state(slot);
+    if (state.live && sessions.connection(slot) == conn && state.status != chat::UserStatus::OFFLINE) {
+        uint64_t idle_ms = SessionStore::now_ms() - state.last_activity_ms;
+        if (idle_ms >= timeout_ms) {
+            state.status = chat::UserStatus::OFFLINE;
+            presence_status(conn->username, sessions.id(slot), chat::UserStatus::OFFLINE);
+            log_info("User {} set to OFFLINE due to inactivity", conn->username);
+        } else {
+            arm_idle_timer(conn, timeout_ms - idle_ms);
+        }
+    }
+    pthread_rwlock_unlock(&lock);
+    connection_unref(conn);
+}
+
+// Status texts are assigned into the response's arena string directly;
+// set_message(const char*) would build a temporary std::string first.
+void set_status(chat::Response& response, chat::StatusCode code, const char* message) {
+    response.set_status_code(code);
+    response.mutable_message()->assign(message);
+}
+
+// A resume token is the session's user ID followed by its resume key.
+const size_t kResumeTokenSize = sizeof(UserId) + sizeof(ResumeKey);
+
+ResumeKey new_resume_key() {
+    ResumeKey key;
+    while (getrandom(&key, sizeof(key), 0) != ssize_t(sizeof(key))) {
+    }
+    if ((key.words[0] | key.words[1]) == 0) {
+        key.words[0] = 1;  // All zero means no key.
+    }
+    return key;
+}
+
+void set_resume_token(chat::Response& response, UserId id, const ResumeKey& key) {
+    std::string* token = response.mutable_resume_token();
+    token->resize(kResumeTokenSize);
+    memcpy(&(*token)[0], &id, sizeof(id));
+    memcpy(&(*token)[sizeof(id)], &key, sizeof(key));
+}
+
+bool parse_resume_token(const std::string& token, UserId* id, ResumeKey* key) {
+    if (token.size() != kResumeTokenSize) {
+        return false;
+    }
+    memcpy(id, token.data(), sizeof(*id));
+    memcpy(key, token.data() + sizeof(*id), sizeof(*key));
+    return (key->words[0] | key->words[1]) != 0;
+}
+
+void handle_register_user(const chat::NewUserRequest& request, chat::Response& response, Connection* conn) {
+    if (conn->user_slot != kNoSlot) {
+        response.set_operation(chat::Operation::REGISTER_USER);
         response.set_status_code(chat::StatusCode::BAD_REQUEST);
-        response.set_message("Username already taken");
+        response.set_message("Connection already registered as " + conn->username);
+        return;
+    }
+    // An empty name is how sessions, handoff records and the room and
+    // presence checks spell "not registered", so it cannot be a username.
+    if (request.username().empty()) {
+        response.set_operation(chat::Operation::REGISTER_USER);
+        set_status(response, chat::StatusCode::BAD_REQUEST, "Username must not be empty");
+        return;
+    }
+
+    ResumeKey key = {};
+    if (resume_grace > 0) {
+        key = new_resume_key();
+    }
+    UserShard& shard = shard_for(request.username());
+    pthread_rwlock_wrlock(&shard.lock);
+    uint32_t slot = kNoSlot;
+    if (shard.slots.find(request.username()) != shard.slots.end()) {
+        response.set_operation(chat::Operation::REGISTER_USER);  
+        set_status(response, chat::StatusCode::BAD_REQUEST, "Username already taken");
+    } else if ((slot = sessions.acquire()) == kNoSlot) {
+        response.set_operation(chat::Operation::REGISTER_USER);
+        set_status(response, chat::StatusCode::INTERNAL_SERVER_ERROR, "Too many users");
     } else {
-        UserSession session;
-        session.username = request.username();
-        session.ip_address = client_ip;
-        session.status = chat::UserStatus::ONLINE;
-        session.socket = socket;
-        session.last_activity = std::chrono::system_clock::now();
-
-        users[session.username] = session;
+        const std::string& name = shard.slots.emplace(request.username(), slot).first->first;
+        shard.name_bytes += name_heap_bytes(name);
+        in_addr address = {};
+        inet_pton(AF_INET, conn->ip_address.c_str(), &address);
+
+        pthread_rwlock_t& lock = sessions.lock_for(slot);
+        pthread_rwlock_wrlock(&lock);
+        sessions.fill(slot, &name, conn->socket, address.s_addr, connection_ref(conn), chat::UserStatus::ONLINE);
+        sessions.resume_key(slot) = key;
+        UserId id = sessions.id(slot);
+        pthread_rwlock_unlock(&lock);
+
+        presence_joined(name, id);
+        conn->username = name;
+        conn->user_slot = slot;
+        conn->user_id = id;
+        response.set_user_id(id);
+        if (resume_grace > 0) {
+            set_resume_token(response, id, key);
+        }
+        conn->batched_delivery = request.accept_batched_delivery();
+        conn->compress = request.accept_compression() && compress_threshold > 0;
+        if (conn->compress) {
+            response.set_compression_threshold(compress_threshold);
+        }
+        if (offline_store != nullptr) {
+            offline_store->remember(name);
+        }
+        arm_idle_timer(conn, uint64_t(inactivity_timeout) * 1000);
         response.set_operation(chat::Operation::REGISTER_USER);  
-        response.set_status_code(chat::StatusCode::OK);
-        response.set_message("User registered successfully");
+        set_status(response, chat::StatusCode::OK, "User registered successfully");
+
+        log_info("User registered: {} with IP: {}", name, conn->ip_address);
+    }
+    pthread_rwlock_unlock(&shard.lock);
+}
+
+
+void handle_update_status(const chat::UpdateStatusRequest& request, chat::Response& response) {
+    UserShard& shard = shard_for(request.username());
+    pthread_rwlock_rdlock(&shard.lock);
+    auto it = shard.slots.find(request.username());
+    bool found = it != shard.slots.end();
+    if (found) {
+        uint32_t slot = it->second;
+        pthread_rwlock_t& lock = sessions.lock_for(slot);
+        pthread_rwlock_wrlock(&lock);
+        SessionState& state = sessions.state(slot);
+        if (state.status != request.new_status()) {
+            presence_status(request.username(), sessions.id(slot), request.new_status());
+        }
+        state.status = request.new_status();
+        state.last_activity_ms = SessionStore::now_ms();
+        if (request.new_status() != chat::UserStatus::OFFLINE) {
+            arm_idle_timer(sessions.connection(slot), uint64_t(inactivity_timeout) * 1000);
+        }
+        pthread_rwlock_unlock(&lock);
+        set_status(response, chat::StatusCode::OK, "Status updated successfully");
+        log_info("User {} changed status to {}", request.username(), chat::UserStatus_Name(request.new_status()));
+    }
+    pthread_rwlock_unlock(&shard.lock);
+
+    if (!found) {
+        set_status(response, chat::StatusCode::BAD_REQUEST, "User not found");
+        
+        log_warn("Failed to update status for unknown user: {}", request.username());
+        // Dumping every session is only worth its cost when debugging.
+        if (log_enabled(LOG_DEBUG)) {
+            sessions.scan([](uint32_t slot, const SessionState&) {
+                char ip_address[INET_ADDRSTRLEN];
+                in_addr address = {sessions.ipv4(slot)};
+                inet_ntop(AF_INET, &address, ip_address, INET_ADDRSTRLEN);
+                log_debug("Registered user: {}, IP: {}", sessions.name(slot), ip_address);
+            });
+        }
+    }
+}
+
+// The rooms and the presence hub hold references to the connection.
+void leave_rooms_and_presence(Connection* conn) {
+    while (!conn->rooms.empty()) {
+        room_remove_member(conn->rooms.back(), conn);
+    }
+    presence_unsubscribe(conn);
+}
+
+// Removes the connection's session unless it was resumed on another
+// connection or, with `detached_only`, is no longer detached. Returns the
+// reference the session held, or null if it was not removed.
+Connection* remove_session(Connection* conn, bool detached_only) {
+    if (conn->user_slot == kNoSlot) {
+        return nullptr;
+    }
+    uint32_t slot = conn->user_slot;
+    Connection* session_conn = nullptr;
+    UserShard& shard = shard_for(conn->username);
+    pthread_rwlock_wrlock(&shard.lock);
+    auto it = shard.slots.find(conn->username);
+    if (it != shard.slots.end() && it->second == slot) {
+        pthread_rwlock_t& lock = sessions.lock_for(slot);
+        pthread_rwlock_wrlock(&lock);
+        if (sessions.connection(slot) == conn && (!detached_only || sessions.state(slot).detached)) {
+            presence_left(conn->username, sessions.id(slot));
+            session_conn = sessions.clear(slot);
+        }
+        pthread_rwlock_unlock(&lock);
+        if (session_conn != nullptr) {
+            shard.name_bytes -= name_heap_bytes(it->first);
+            shard.slots.erase(it);
+            sessions.release(slot);
+        }
+    }
+    pthread_rwlock_unlock(&shard.lock);
+    return session_conn;
+}
+
+void end_session(Connection* conn) {
+    leave_rooms_and_presence(conn);
+    Connection* session_conn = remove_session(conn, false);
+    if (conn->user_slot != kNoSlot && timer_wheel->cancel(&conn->idle_timer)) {
+        connection_unref(conn);
+    }
+    if (session_conn != nullptr) {
+        connection_unref(session_conn);
+    }
+}
+
+// Keeps the session of a connection that dropped for resume_grace seconds.
+// Its slot, and with it the name and the id, stays taken; the connection
+// stays in its rooms and its presence subscription and, parked, keeps what
+// is sent to it, but its socket is closed. A RESUME moves all of that to the
+// new connection (see handle_resume()); otherwise on_resume_timer() ends the
+// session. Returns false if the connection does not hold a session.
+bool detach_session(Connection* conn) {
+    // Armed first: as soon as the session shows as detached it may be
+    // resumed, which cancels the timer.
+    conn->resume_deadline_ms = SessionStore::now_ms() + int64_t(resume_grace) * 1000;
+    connection_ref(conn);
+    timer_wheel->schedule(&conn->resume_timer, uint64_t(resume_grace) * 1000);
+
+    uint32_t slot = conn->user_slot;
+    pthread_rwlock_t& lock = sessions.lock_for(slot);
+    pthread_rwlock_wrlock(&lock);
+    bool detached = sessions.matches(slot, conn->user_id) && sessions.connection(slot) == conn;
+    if (detached) {
+        SessionState& state = sessions.state(slot);
+        state.detached = 1;
+        state.socket = -1;
+    }
+    pthread_rwlock_unlock(&lock);
+    if (!detached) {
+        if (timer_wheel->cancel(&conn->resume_timer)) {
+            connection_unref(conn);
+        }
+        return false;
+    }
+
+    connection_close(conn, true);
+    thread_metrics().sessions_detached.add(1);
+    log_info("User {} disconnected; session kept {} s for a resume", conn->username, resume_grace);
+    return true;
+}
+
+void drop_parked_output(Connection* conn) {
+    pthread_mutex_lock(&conn->out_mutex);
+    if (conn->parked) {
+        conn->parked = false;
+        ThreadMetrics& metrics = thread_metrics();
+        metrics.frames_sent.add(conn->outbound.size());
+        metrics.bytes_dequeued.add(conn->outbound.bytes());
+        conn->outbound.clear();
+    }
+    pthread_mutex_unlock(&conn->out_mutex);
+}
+
+// The grace period of a detached session ran out without a resume.
+void on_resume_timer(TimerNode* node) {
+    Connection* conn = static_cast<Connection*>(node->data);
+    // Removing the session first settles any race with a resume: one that
+    // got there first leaves nothing to remove, one that comes later finds
+    // no session.
+    Connection* session_conn = remove_session(conn, true);
+    if (session_conn != nullptr) {
+        leave_rooms_and_presence(conn);
+        if (timer_wheel->cancel(&conn->idle_timer)) {
+            connection_unref(conn);
+        }
+        pthread_mutex_lock(&conn->out_mutex);
+        bool held_lost = conn->held_lost;
+        pthread_mutex_unlock(&conn->out_mutex);
+        drop_parked_output(conn);
+        thread_metrics().sessions_expired.add(1);
+        if (held_lost) {
+            log_info("Session of {} ended: too much output kept for its resume", conn->username);
+        } else {
+            log_info("Session of {} ended: not resumed within {} s", conn->username, resume_grace);
+        }
+        connection_unref(session_conn);
+    }
+    connection_unref(conn);
+}
+
+void cancel_transfers(Connection* conn);
+
+void handle_client_disconnection(Connection* conn) {
+    if (resume_grace > 0 && conn->user_slot != kNoSlot && detach_session(conn)) {
+        cancel_transfers(conn);
+        return;
+    }
+    end_session(conn);
+    connection_close(conn);
+    cancel_transfers(conn);
+}
+
+// Queues frames taken from another connection (taking over their
+// references) and writes them out together.
+void adopt_frames(Connection* conn, std::vector<Frame*>& frames) {
+    pthread_mutex_lock(&conn->out_mutex);
+    if (!conn->closed && !conn->overflowed) {
+        ThreadMetrics& metrics = thread_metrics();
+        size_t frames_before = conn->outbound.size();
+        size_t bytes_before = conn->outbound.bytes();
+        for (Frame* frame : frames) {
+            conn->outbound.push(frame);
+        }
+        metrics.frames_queued.add(conn->outbound.size() - frames_before);
+        metrics.bytes_queued.add(conn->outbound.bytes() - bytes_before);
+        if (conn->want_write) {
+            check_overflow(conn);
+        } else if (!conn->corked || conn->outbound.bytes() >= kCorkedBytesLimit) {
+            flush_locked(conn);
+        }
+    } else {
+        for (Frame* frame : frames) {
+            frame_unref(frame);
+        }
+    }
+    pthread_mutex_unlock(&conn->out_mutex);
+    frames.clear();
+}
+
+void room_replace_member(const std::string& name, Connection* from, Connection* to) {
+    RoomShard& shard = room_shard_for(name);
+    pthread_rwlock_wrlock(&shard.lock);
+    auto it = shard.rooms.find(name);
+    if (it != shard.rooms.end()) {
+        std::vector<Connection*>& list = it->second->members;
+        auto member = std::find(list.begin(), list.end(), from);
+        if (member != list.end()) {
+            *member = connection_ref(to);
+            connection_unref(from);
+        }
+    }
+    pthread_rwlock_unlock(&shard.lock);
+}
+
+void presence_replace_subscriber(Connection* from, Connection* to) {
+    pthread_mutex_lock(&presence_hub.mutex);
+    bool subscribed = from->presence_subscribed;
+    if (subscribed) {
+        std::vector<Connection*>& list = presence_hub.subscribers;
+        *std::find(list.begin(), list.end(), from) = connection_ref(to);
+        from->presence_subscribed = false;
+        to->presence_subscribed = true;
+    }
+    pthread_mutex_unlock(&presence_hub.mutex);
+    if (subscribed) {
+        connection_unref(from);
+    }
+}
+
+// Reattaches a detached session to this connection: one check of the token
+// against the session's slot, then the session, its rooms, its presence
+// subscription and whatever was kept for it move over. The kept output is
+// queued in one go, under the session's lock, so nothing sent to the
+// session afterwards can overtake it.
+void handle_resume(const chat::ResumeRequest& request, chat::Response& response, Connection* conn) {
+    if (conn->user_slot != kNoSlot) {
+        response.set_status_code(chat::StatusCode::BAD_REQUEST);
+        response.set_message("Connection already registered as " + conn->username);
+        return;
+    }
+    UserId id;
+    ResumeKey key;
+    if (resume_grace == 0 || !parse_resume_token(request.token(), &id, &key)) {
+        set_status(response, chat::StatusCode::BAD_REQUEST, "Invalid resume token");
+        return;
+    }
+    ResumeKey next_key = new_resume_key();
+    static thread_local std::vector<Frame*> kept;
+    Connection* previous = nullptr;  // The detached connection.
+    Connection* attached = nullptr;  // Still holds the session.
+    uint32_t slot = sessions.slot_of(id);
+    if (slot != kNoSlot) {
+        pthread_rwlock_t& lock = sessions.lock_for(slot);
+        pthread_rwlock_wrlock(&lock);
+        SessionState& state = sessions.state(slot);
+        if (!sessions.matches(slot, id) || !resume_key_matches(sessions.resume_key(slot), key)) {
+            // Not this session's token.
+        } else if (!state.detached) {
+            attached = connection_ref(sessions.connection(slot));
+        } else {
+            previous = sessions.connection(slot);
+            pthread_mutex_lock(&previous->out_mutex);
+            if (previous->held_lost || previous->resume_deadline_ms <= SessionStore::now_ms()) {
+                // Ending, only its timer has not run yet; after hold_frame()
+                // gave up, what the session missed cannot be replayed in full.
+                pthread_mutex_unlock(&previous->out_mutex);
+                previous = nullptr;
+            } else {
+                ThreadMetrics& metrics = thread_metrics();
+                metrics.frames_sent.add(previous->outbound.size());
+                metrics.bytes_dequeued.add(previous->outbound.bytes());
+                previous->outbound.take(&kept);
+                previous->parked = false;
+                previous->successor = connection_ref(conn);
+                pthread_mutex_unlock(&previous->out_mutex);
+
+                conn->username = sessions.name(slot);
+                conn->user_slot = slot;
+                conn->user_id = id;
+                conn->batched_delivery = previous->batched_delivery;
+                conn->compress = previous->compress;
+                in_addr address = {};
+                inet_pton(AF_INET, conn->ip_address.c_str(), &address);
+                sessions.rebind(slot, conn->socket, address.s_addr, connection_ref(conn));
+                sessions.resume_key(slot) = next_key;
+                if (state.status != chat::UserStatus::ONLINE) {
+                    state.status = chat::UserStatus::ONLINE;
+                    presence_status(conn->username, id, chat::UserStatus::ONLINE);
+                }
+                metrics.sessions_resumed.add(1);
+                metrics.resumed_frames.add(kept.size());
+                adopt_frames(conn, kept);
+            }
+        }
+        pthread_rwlock_unlock(&lock);
+    }
+
+    if (attached != nullptr) {
+        // Most likely a connection the client gave up on before the server
+        // noticed. Closing it detaches the session, so the retry succeeds.
+        pthread_mutex_lock(&attached->out_mutex);
+        if (!attached->closed) {
+            shutdown(attached->socket, SHUT_RDWR);
+        }
+        pthread_mutex_unlock(&attached->out_mutex);
+        connection_unref(attached);
+        set_status(response, chat::StatusCode::CONFLICT, "Session still attached to another connection; retry");
+        return;
+    }
+    if (previous == nullptr) {
+        set_status(response, chat::StatusCode::NOT_FOUND, "No session to resume; register again");
+        return;
+    }
+
+    if (timer_wheel->cancel(&previous->resume_timer)) {
+        connection_unref(previous);
+    }
+    if (timer_wheel->cancel(&previous->idle_timer)) {
+        connection_unref(previous);
+    }
+    arm_idle_timer(conn, uint64_t(inactivity_timeout) * 1000);
+    for (const std::string& room : previous->rooms) {
+        room_replace_member(room, previous, conn);
+    }
+    conn->rooms.swap(previous->rooms);
+    presence_replace_subscriber(previous, conn);
+    connection_unref(previous);  // The session's.
+
+    response.set_user_id(id);
+    set_resume_token(response, id, next_key);
+    if (conn->compress) {
+        response.set_compression_threshold(compress_threshold);
+    }
+    set_status(response, chat::StatusCode::OK, "Session resumed");
+    log_info("User {} resumed their session from IP: {}", conn->username, conn->ip_address);
+}
+
+// Ends the session now instead of keeping it for a resume once the
+// connection closes; the connection stays open, unregistered.
+void handle_unregister_user(const chat::User& request, chat::Response& response, Connection* conn) {
+    if (conn->user_slot == kNoSlot || (!request.username().empty() && request.username() != conn->username)) {
+        set_status(response, chat::StatusCode::BAD_REQUEST, "Not registered as that user");
+        return;
+    }
+    log_info("User unregistered: {}", conn->username);
+    end_session(conn);
+    conn->username.clear();
+    conn->user_slot = kNoSlot;
+    conn->user_id = 0;
+    set_status(response, chat::StatusCode::OK, "User unregistered");
+}
+
+// GET_USERS for one user; the list of everyone comes from send_user_list().
+void handle_get_users(const chat::UserListRequest& user_list_request, chat::UserListResponse* user_list_response, chat::Response& response) {
+    user_list_response->Clear();
+    bool found = false;
+    UserShard& shard = shard_for(user_list_request.username());
+    pthread_rwlock_rdlock(&shard.lock);
+    auto it = shard.slots.find(user_list_request.username());
+    if (it != shard.slots.end()) {
+        uint32_t slot = it->second;
+        pthread_rwlock_t& lock = sessions.lock_for(slot);
+        pthread_rwlock_rdlock(&lock);
+        char ip_address[INET_ADDRSTRLEN];
+        in_addr address = {sessions.ipv4(slot)};
+        inet_ntop(AF_INET, &address, ip_address, INET_ADDRSTRLEN);
+        chat::User* user_proto = user_list_response->add_users();
+        user_proto->set_username(it->first);
+        user_proto->set_ip_address(ip_address);
+        user_proto->set_status(static_cast<chat::UserStatus>(sessions.state(slot).status));
+        user_proto->set_id(sessions.id(slot));
+        pthread_rwlock_unlock(&lock);
+        found = true;
+    }
+    pthread_rwlock_unlock(&shard.lock);
+
+    if (found) {
+        set_status(response, chat::StatusCode::OK, "User info fetched successfully.");
+    } else {
+        set_status(response, chat::StatusCode::NOT_FOUND, "No users found or specific user not found.");
+    }
+}
+
+// GET_USERS for everyone is answered from a cache: the serialized Response
+// (all but its request_id) for the online users as of a roster_changes
+// value, rebuilt by the first request that finds the list changed since.
+// Everyone else copies the bytes and appends their request_id as one more
+// field, which a parser merges like any other. Readers take the cached
+// answer without locking (see snapshot_cell.h), so a crowd polling the
+// roster costs a copy each rather than a scan and a serialization each.
+// Clients that negotiated compression get a copy of the answer deflated
+// once, with their request_id spliced in (see deflate_prefix()).
+struct CachedUserList {
+    chat::StatusCode status;
+    std::string body;
+    bool deflated;  // `compressed` holds the body; only if it is worth it.
+    DeflatedPrefix compressed;
+};
+
+SnapshotCell<CachedUserList> user_list_cache;
+
+void rebuild_user_list(uint64_t version) {
+    pthread_mutex_lock(&user_list_cache.write_mutex());
+    SnapshotCell<CachedUserList>::Hold cached = user_list_cache.acquire();
+    bool stale = cached->version == UINT64_MAX || cached->version < version;
+    cached.release();
+    if (stale) {
+        chat::Response response;
+        response.set_operation(chat::Operation::GET_USERS);
+        chat::UserListResponse* list = response.mutable_user_list();
+        // Changes the scan sees past this version only make the answer a
+        // little fresher than its label.
+        uint64_t built = roster_changes.load(std::memory_order_acquire);
+        sessions.scan([list](uint32_t slot, const SessionState& state) {
+            if (state.status == chat::UserStatus::ONLINE) {
+                chat::User* user_proto = list->add_users();
+                user_proto->set_username(sessions.name(slot));
+                user_proto->set_id(sessions.id(slot));
+            }
+        });
+        if (list->users_size() > 0) {
+            set_status(response, chat::StatusCode::OK, "User info fetched successfully.");
+        } else {
+            set_status(response, chat::StatusCode::NOT_FOUND, "No users found or specific user not found.");
+        }
+
+        CachedUserList answer;
+        answer.status = response.status_code();
+        response.SerializeToString(&answer.body);
+        answer.deflated = false;
+        if (compress_threshold > 0 && answer.body.size() >= compress_threshold) {
+            uint64_t start_ns = thread_cpu_ns();
+            answer.deflated = deflate_prefix(answer.body.data(), answer.body.size(), compress_level, &answer.compressed) &&
+                              answer.compressed.bytes.size() + kDeflatedFrameOverhead < answer.body.size();
+            thread_metrics().compression_cpu_ns.add(thread_cpu_ns() - start_ns);
+        }
+        user_list_cache.publish(built, &answer);
+        thread_metrics().roster_builds.add(1);
+    }
+    pthread_mutex_unlock(&user_list_cache.write_mutex());
+}
+
+// Sends the cached GET_USERS answer; `response` only gets its status, for
+// the metrics.
+void send_user_list(Connection* conn, uint64_t request_id, chat::Response& response) {
+    uint64_t version = roster_changes.load(std::memory_order_acquire);
+    SnapshotCell<CachedUserList>::Hold cached = user_list_cache.acquire();
+    if (cached->version != version) {
+        cached.release();
+        rebuild_user_list(version);
+        cached = user_list_cache.acquire();
+    }
+    const CachedUserList& answer = cached->value;
+
+    char tail[1 + 10];  // The request_id field: its tag and up to ten varint bytes.
+    size_t tail_size = 0;
+    if (request_id != 0) {
+        tail[0] = char(chat::Response::kRequestIdFieldNumber << 3);  // Wire type 0, varint.
+        uint8_t* end = google::protobuf::io::CodedOutputStream::WriteVarint64ToArray(
+            request_id, reinterpret_cast<uint8_t*>(tail + 1));
+        tail_size = end - reinterpret_cast<uint8_t*>(tail);
+    }
+    Frame* frame = FramePool::local().acquire();
+    frame->refs.store(1, std::memory_order_relaxed);
+    frame->packable = false;
+    frame->kind = FRAME_RESPONSE;
+    if (conn->compress && answer.deflated) {
+        finish_deflated_frame(answer.compressed, tail, uint16_t(tail_size), &frame->bytes);
+        ThreadMetrics& metrics = thread_metrics();
+        metrics.frames_compressed.add(1);
+        metrics.compression_in.add(kFrameHeaderSize + answer.body.size() + tail_size);
+        metrics.compression_out.add(frame->bytes.size());
+    } else {
+        frame->bytes.resize(kFrameHeaderSize + answer.body.size() + tail_size);
+        char* out = &frame->bytes[0];
+        write_frame_header(out, static_cast<uint32_t>(answer.body.size() + tail_size));
+        memcpy(out + kFrameHeaderSize, answer.body.data(), answer.body.size());
+        memcpy(out + kFrameHeaderSize + answer.body.size(), tail, tail_size);
+    }
+    response.set_status_code(answer.status);
+    cached.release();
+    thread_metrics().roster_served.add(1);
+    route_frame(conn, frame);
+    frame_unref(frame);
+}
+
+// Messages on their way to the same recipients. They are kept in an
+// INCOMING_MESSAGE_BATCH response on the request arena (content is moved out
+// of the request, not copied) and serialized on first use, in the form each
+// recipient understands: one packable batch frame for connections that
+// registered with accept_batched_delivery, one INCOMING_MESSAGE frame per
+// message for the others. Every frame is built once and shared by all the
+// recipients that need it, and so is its compressed copy.
+class Delivery {
+public:
+    Delivery() : arena_(nullptr), batch_(nullptr), packed_(nullptr), packed_compressed_(nullptr), kind_(FRAME_DIRECT) {}
+    ~Delivery() { clear(); }
+
+    Delivery(const Delivery&) = delete;
+    Delivery& operator=(const Delivery&) = delete;
+
+    bool empty() const { return batch_ == nullptr; }
+
+    void add(google::protobuf::Arena* arena, chat::SendMessageRequest& request, const std::string& sender, UserId sender_id,
+             chat::MessageType type) {
+        chat::IncomingMessageResponse* message = next_message(arena);
+        message->set_sender(sender);
+        message->set_sender_id(sender_id);
+        message->mutable_content()->swap(*request.mutable_content());
+        message->set_type(type);
+        kind_ = type == chat::MessageType::DIRECT ? FRAME_DIRECT : FRAME_BROADCAST;
+        if (type == chat::MessageType::ROOM) {
+            message->set_room(request.room());
+        }
+    }
+
+    // Adds a message taken from the offline queue.
+    void add_stored(google::protobuf::Arena* arena, const StoredMessage& stored) {
+        next_message(arena)->ParseFromArray(stored.data, int(stored.size));
+        kind_ = FRAME_DIRECT;
+    }
+
+    void send_to(Connection* conn) {
+        if (conn->batched_delivery) {
+            if (packed_ == nullptr) {
+                packed_ = make_frame(*batch_);
+                packed_->packable = true;
+                packed_->kind = kind_;
+            }
+            if (!conn->compress) {
+                route_frame(conn, packed_);
+                return;
+            }
+            if (packed_compressed_ == nullptr) {
+                packed_compressed_ = compressed_variant(packed_);
+            }
+            route_frame(conn, packed_compressed_);
+            return;
+        }
+        if (singles_.empty()) {
+            for (chat::IncomingMessageResponse& message : *batch_->mutable_incoming_messages()) {
+                // Borrows the message; both live on the same arena.
+                chat::Response* single = google::protobuf::Arena::CreateMessage<chat::Response>(arena_);
+                single->set_operation(chat::Operation::INCOMING_MESSAGE);
+                single->unsafe_arena_set_allocated_incoming_message(&message);
+                Frame* frame = make_frame(*single);
+                frame->kind = kind_;
+                singles_.push_back(frame);
+                single->unsafe_arena_release_incoming_message();
+            }
+        }
+        if (conn->compress && singles_compressed_.empty()) {
+            for (Frame* frame : singles_) {
+                singles_compressed_.push_back(compressed_variant(frame));
+            }
+        }
+        for (Frame* frame : conn->compress ? singles_compressed_ : singles_) {
+            route_frame(conn, frame);
+        }
+    }
+
+    // Drops the frames; the messages go away with the request arena.
+    void clear() {
+        if (packed_ != nullptr) {
+            frame_unref(packed_);
+            packed_ = nullptr;
+        }
+        if (packed_compressed_ != nullptr) {
+            frame_unref(packed_compressed_);
+            packed_compressed_ = nullptr;
+        }
+        for (Frame* frame : singles_) {
+            frame_unref(frame);
+        }
+        singles_.clear();
+        for (Frame* frame : singles_compressed_) {
+            frame_unref(frame);
+        }
+        singles_compressed_.clear();
+        batch_ = nullptr;
+    }
+
+private:
+    chat::IncomingMessageResponse* next_message(google::protobuf::Arena* arena) {
+        if (batch_ == nullptr) {
+            arena_ = arena;
+            batch_ = google::protobuf::Arena::CreateMessage<chat::Response>(arena);
+            batch_->set_operation(chat::Operation::INCOMING_MESSAGE_BATCH);
+        }
+        return batch_->add_incoming_messages();
+    }
+
+    google::protobuf::Arena* arena_;
+    chat::Response* batch_;
+    Frame* packed_;
+    Frame* packed_compressed_;
+    FrameKind kind_;  // What the messages are, for shedding them from slow connections.
+    std::vector<Frame*> singles_;
+    std::vector<Frame*> singles_compressed_;
+};
+
+// Returns a reference to the recipient's connection if they are ONLINE.
+// `registered` tells whether they have a session at all.
+Connection* find_online_connection(const std::string& username, bool* registered = nullptr) {
+    Connection* conn = nullptr;
+    UserShard& shard = shard_for(username);
+    pthread_rwlock_rdlock(&shard.lock);
+    auto it = shard.slots.find(username);
+    if (it != shard.slots.end()) {
+        pthread_rwlock_t& lock = sessions.lock_for(it->second);
+        pthread_rwlock_rdlock(&lock);
+        if (sessions.state(it->second).status == chat::UserStatus::ONLINE) {
+            conn = connection_ref(sessions.connection(it->second));
+        }
+        pthread_rwlock_unlock(&lock);
+    }
+    if (registered != nullptr) {
+        *registered = it != shard.slots.end();
+    }
+    pthread_rwlock_unlock(&shard.lock);
+    return conn;
+}
+
+bool is_direct(const chat::SendMessageRequest& message) {
+    return message.recipient_id() != 0 || !message.recipient().empty();
+}
+
+// Like find_online_connection() for a direct message's recipient, but a
+// message addressed by recipient_id goes straight to the session's slot
+// without hashing a name. The offline queue is keyed by name, so the name
+// is only filled in for such a message if it may end up there.
+Connection* find_recipient(chat::SendMessageRequest& message, bool* registered) {
+    if (message.recipient_id() == 0) {
+        return find_online_connection(message.recipient(), registered);
+    }
+    Connection* conn = nullptr;
+    *registered = false;
+    uint32_t slot = sessions.slot_of(message.recipient_id());
+    if (slot == kNoSlot) {
+        return nullptr;
+    }
+    pthread_rwlock_t& lock = sessions.lock_for(slot);
+    pthread_rwlock_rdlock(&lock);
+    if (sessions.matches(slot, message.recipient_id())) {
+        *registered = true;
+        if (sessions.state(slot).status == chat::UserStatus::ONLINE) {
+            conn = connection_ref(sessions.connection(slot));
+        }
+        if (conn == nullptr || (offline_store != nullptr && offline_store->pending() > 0)) {
+            message.set_recipient(sessions.name(slot));
+        }
+    }
+    pthread_rwlock_unlock(&lock);
+    return conn;
+}
+
+// Direct messages for users who are BUSY, OFFLINE or disconnected are kept
+// in the offline store and delivered once they are ONLINE again. While a
+// user still has messages queued, new ones are queued behind them so they
+// arrive in order.
+const size_t kOfflineDeliveryBatch = 256;
+
+bool offline_queue_ahead(const std::string& recipient) {
+    return offline_store != nullptr && offline_store->has_pending(recipient);
+}
+
+// Only users the server has seen (registered now or since startup, or
+// with messages already queued) get messages queued for them.
+bool offline_accepts(const std::string& recipient, bool registered) {
+    return offline_store != nullptr && (registered || offline_store->known(recipient));
+}
+
+uint64_t queue_offline_message(const chat::SendMessageRequest& request, const std::string& sender) {
+    uint64_t position = offline_store->append(request.recipient(), sender, request.content());
+    if (position != 0) {
+        thread_metrics().offline_queued.add(1);
+    }
+    return position;
+}
+
+// Hands the user's queued messages to their connection, oldest first, in
+// batches of kOfflineDeliveryBatch. Stops if they go away meanwhile.
+void deliver_offline_messages(const std::string& username) {
+    if (offline_store == nullptr || !offline_store->begin_delivery(username)) {
+        return;
+    }
+    static thread_local std::vector<StoredMessage> stored;
+    google::protobuf::Arena arena;
+    size_t delivered = 0;
+    do {
+        size_t count;
+        while ((count = offline_store->peek(username, kOfflineDeliveryBatch, &stored)) > 0) {
+            Connection* conn = find_online_connection(username);
+            if (conn == nullptr) {
+                offline_store->abort_delivery(username);
+                return;
+            }
+            Delivery delivery;
+            for (const StoredMessage& message : stored) {
+                delivery.add_stored(&arena, message);
+            }
+            delivery.send_to(conn);
+            delivery.clear();
+            connection_unref(conn);
+            arena.Reset();
+
+            offline_store->acknowledge(username, count);
+            thread_metrics().offline_delivered.add(count);
+            delivered += count;
+        }
+    } while (!offline_store->end_delivery(username));
+    log_info("Delivered {} queued messages to {}", delivered, username);
+}
+
+void broadcast_delivery(Delivery& delivery) {
+    // Only snapshot the recipients under the lock; queueing (and any
+    // socket writes) happen after it is released. The vector is reused
+    // across calls so the fan-out itself does not allocate.
+    static thread_local std::vector<Connection*> recipients;
+    recipients.clear();
+    sessions.scan([](uint32_t slot, const SessionState& state) {
+        if (state.status == chat::UserStatus::ONLINE) {
+            recipients.push_back(connection_ref(sessions.connection(slot)));
+        }
+    });
+
+    thread_metrics().broadcast_fanout.record(recipients.size());
+    for (Connection* recipient : recipients) {
+        delivery.send_to(recipient);
+        connection_unref(recipient);
+    }
+    delivery.clear();
+}
+
+void room_delivery(const std::string& name, Delivery& delivery) {
+    static thread_local std::vector<Connection*> recipients;
+    recipients.clear();
+    RoomShard& shard = room_shard_for(name);
+    pthread_rwlock_rdlock(&shard.lock);
+    auto it = shard.rooms.find(name);
+    if (it != shard.rooms.end()) {
+        for (Connection* member : it->second->members) {
+            recipients.push_back(connection_ref(member));
+        }
+    }
+    pthread_rwlock_unlock(&shard.lock);
+
+    thread_metrics().room_fanout.record(recipients.size());
+    for (Connection* recipient : recipients) {
+        delivery.send_to(recipient);
+        connection_unref(recipient);
+    }
+    delivery.clear();
+}
+
+// Room messages need a member sender and no recipient.
+bool check_room_message(const chat::SendMessageRequest& request, Connection* conn, chat::StatusCode* code) {
+    if (is_direct(request)) {
+        *code = chat::StatusCode::BAD_REQUEST;
+        return false;
+    }
+    if (!in_room(conn, request.room())) {
+        *code = chat::StatusCode::FORBIDDEN;
+        return false;
+    }
+    return true;
+}
+
+void handle_join_room(const chat::RoomRequest& request, chat::Response& response, Connection* conn) {
+    if (conn->username.empty()) {
+        set_status(response, chat::StatusCode::UNAUTHORIZED, "Register before joining rooms");
+    } else if (request.room().empty() || request.room().size() > kMaxRoomName) {
+        set_status(response, chat::StatusCode::BAD_REQUEST, "Invalid room name");
+    } else if (in_room(conn, request.room())) {
+        set_status(response, chat::StatusCode::BAD_REQUEST, "Already in room");
+    } else if (conn->rooms.size() >= kMaxRoomsPerConnection) {
+        set_status(response, chat::StatusCode::FORBIDDEN, "Too many rooms joined");
+    } else {
+        size_t members = room_add_member(request.room(), conn);
+        chat::RoomResponse* room = response.mutable_room();
+        room->set_room(request.room());
+        room->set_members(members);
+        set_status(response, chat::StatusCode::OK, "Joined room");
+        log_debug("User {} joined room {} ({} members)", conn->username, request.room(), members);
+    }
+}
+
+void handle_leave_room(const chat::RoomRequest& request, chat::Response& response, Connection* conn) {
+    if (!in_room(conn, request.room())) {
+        set_status(response, chat::StatusCode::NOT_FOUND, "Not in room");
+        return;
+    }
+    size_t members = room_remove_member(request.room(), conn);
+    chat::RoomResponse* room = response.mutable_room();
+    room->set_room(request.room());
+    room->set_members(members);
+    set_status(response, chat::StatusCode::OK, "Left room");
+    log_debug("User {} left room {} ({} members)", conn->username, request.room(), members);
+}
+
+void handle_send_message(chat::SendMessageRequest& request, chat::Response& response, Connection* conn) {
+    const std::string& sender = conn->username;
+    UserId sender_id = conn->user_id;
+    Delivery delivery;
+    chat::StatusCode code;
+    if (!request.room().empty()) {
+        if (!check_room_message(request, conn, &code)) {
+            set_status(response, code, code == chat::StatusCode::FORBIDDEN ? "Join the room before sending to it"
+                                                                          : "A message goes to a recipient or a room, not both");
+            return;
+        }
+        delivery.add(response.GetArena(), request, sender, sender_id, chat::MessageType::ROOM);
+        room_delivery(request.room(), delivery);
+        set_status(response, chat::StatusCode::OK, "Message sent to room");
+    } else if (!is_direct(request)) {
+        // Broadcast message to all online users
+        delivery.add(response.GetArena(), request, sender, sender_id, chat::MessageType::BROADCAST);
+        broadcast_delivery(delivery);
+        set_status(response, chat::StatusCode::OK, "Message broadcasted successfully");
+    } else {
+        // Send direct message to a specific user
+        bool registered = false;
+        Connection* recipient = find_recipient(request, &registered);
+        if (recipient != nullptr && !offline_queue_ahead(request.recipient())) {
+            delivery.add(response.GetArena(), request, sender, sender_id, chat::MessageType::DIRECT);
+            delivery.send_to(recipient);
+
+            set_status(response, chat::StatusCode::OK, "Message sent successfully");
+        } else if (offline_accepts(request.recipient(), registered)) {
+            uint64_t position = queue_offline_message(request, sender);
+            if (position == 0) {
+                set_status(response, chat::StatusCode::INTERNAL_SERVER_ERROR, "Could not queue message");
+            } else {
+                offline_store->commit(position);
+                if (recipient != nullptr) {
+                    deliver_offline_messages(request.recipient());
+                    set_status(response, chat::StatusCode::OK, "Message sent successfully");
+                } else {
+                    set_status(response, chat::StatusCode::OK, "Recipient is away; message queued for delivery");
+                }
+            }
+        } else {
+            set_status(response, chat::StatusCode::NOT_FOUND, "Recipient not found or offline");
+        }
+        if (recipient != nullptr) {
+            connection_unref(recipient);
+        }
+    }
+}
+
+const int kMaxBatchMessages = 1024;
+
+struct DirectDelivery {
+    Connection* recipient;  // Holds a reference.
+    Delivery delivery;
+};
+
+// Sends the direct messages collected so far, one delivery per recipient.
+void flush_direct_deliveries(std::vector<std::unique_ptr<DirectDelivery>>& directs, size_t& count) {
+    for (size_t i = 0; i < count; i++) {
+        directs[i]->delivery.send_to(directs[i]->recipient);
+        directs[i]->delivery.clear();
+        connection_unref(directs[i]->recipient);
+    }
+    count = 0;
+}
+
+// Handles each message like SEND_MESSAGE, but delivers them in as few frames
+// as possible: consecutive broadcasts share one delivery, and direct
+// messages are grouped per recipient until the next broadcast, so every
+// recipient still receives the sender's messages in order. Consecutive
+// messages to the same room share one delivery too. Messages queued for
+// absent recipients are committed together at the end.
+void handle_send_message_batch(chat::SendMessageBatchRequest& request, chat::Response& response, Connection* conn) {
+    const std::string& sender = conn->username;
+    UserId sender_id = conn->user_id;
+    if (request.messages_size() > kMaxBatchMessages) {
+        set_status(response, chat::StatusCode::BAD_REQUEST, "Too many messages in batch");
+        return;
+    }
+
+    google::protobuf::Arena* arena = response.GetArena();
+    chat::SendMessageBatchResponse* results = response.mutable_message_batch();
+    Delivery broadcast;
+    Delivery room;
+    const std::string* room_name = nullptr;  // Room the pending room delivery goes to.
+    // Reused across calls; entries past `direct_count` are idle.
+    static thread_local std::vector<std::unique_ptr<DirectDelivery>> directs;
+    size_t direct_count = 0;
+    uint64_t commit_position = 0;
+
+    for (chat::SendMessageRequest& message : *request.mutable_messages()) {
+        if (room_name != nullptr && *room_name != message.room()) {
+            room_delivery(*room_name, room);
+            room_name = nullptr;
+        }
+        if (!message.room().empty()) {
+            chat::StatusCode code;
+            if (!check_room_message(message, conn, &code)) {
+                results->add_results(code);
+                continue;
+            }
+            flush_direct_deliveries(directs, direct_count);
+            if (!broadcast.empty()) {
+                broadcast_delivery(broadcast);
+            }
+            room.add(arena, message, sender, sender_id, chat::MessageType::ROOM);
+            room_name = &message.room();
+            results->add_results(chat::StatusCode::OK);
+            continue;
+        }
+        if (!is_direct(message)) {
+            flush_direct_deliveries(directs, direct_count);
+            broadcast.add(arena, message, sender, sender_id, chat::MessageType::BROADCAST);
+            results->add_results(chat::StatusCode::OK);
+            continue;
+        }
+
+        if (!broadcast.empty()) {
+            broadcast_delivery(broadcast);
+        }
+        bool registered = false;
+        Connection* recipient = find_recipient(message, &registered);
+        if (recipient == nullptr || offline_queue_ahead(message.recipient())) {
+            if (!offline_accepts(message.recipient(), registered)) {
+                results->add_results(chat::StatusCode::NOT_FOUND);
+            } else {
+                uint64_t position = queue_offline_message(message, sender);
+                commit_position = std::max(commit_position, position);
+                results->add_results(position != 0 ? chat::StatusCode::OK : chat::StatusCode::INTERNAL_SERVER_ERROR);
+                if (recipient != nullptr) {
+                    // Whatever is grouped for them goes out first.
+                    flush_direct_deliveries(directs, direct_count);
+                    deliver_offline_messages(message.recipient());
+                }
+            }
+            if (recipient != nullptr) {
+                connection_unref(recipient);
+            }
+            continue;
+        }
+        size_t index = 0;
+        while (index < direct_count && directs[index]->recipient != recipient) {
+            index++;
+        }
+        if (index < direct_count) {
+            connection_unref(recipient);
+        } else {
+            if (direct_count == directs.size()) {
+                directs.emplace_back(new DirectDelivery());
+            }
+            directs[direct_count++]->recipient = recipient;
+        }
+        directs[index]->delivery.add(arena, message, sender, sender_id, chat::MessageType::DIRECT);
+        results->add_results(chat::StatusCode::OK);
+    }
+
+    flush_direct_deliveries(directs, direct_count);
+    if (!broadcast.empty()) {
+        broadcast_delivery(broadcast);
+    }
+    if (room_name != nullptr) {
+        room_delivery(*room_name, room);
+    }
+    if (commit_position != 0) {
+        offline_store->commit(commit_position);
+    }
+    set_status(response, chat::StatusCode::OK, "Batch processed");
+}
+
+void handle_subscribe_presence(chat::Response& response, Connection* conn) {
+    if (conn->username.empty()) {
+        set_status(response, chat::StatusCode::UNAUTHORIZED, "Register before subscribing to presence");
+        return;
+    }
+    uint64_t version;
+    if (!presence_subscribe(conn, response.GetArena(), &version)) {
+        set_status(response, chat::StatusCode::BAD_REQUEST, "Already subscribed to presence");
+        return;
+    }
+    response.mutable_presence()->set_version(version);
+    set_status(response, chat::StatusCode::OK, "Subscribed to presence");
+}
+
+void handle_unsubscribe_presence(chat::Response& response, Connection* conn) {
+    if (presence_unsubscribe(conn)) {
+        set_status(response, chat::StatusCode::OK, "Unsubscribed from presence");
+    } else {
+        set_status(response, chat::StatusCode::NOT_FOUND, "Not subscribed to presence");
+    }
+}
+
+// File transfers (see FileOffer in chat.proto). The server keeps each
+// transfer's two connections, how far it got and what the recipient
+// granted; the data comes in chunk frames, which relay_chunk() passes from
+// the sender's input to the recipient's outbound queue without parsing
+// them. A chunk for a recipient that already has spool_after bytes queued
+// in memory goes to the transfer's spool file instead, and its frame keeps
+// only the headers: the queue sends the data from the file with sendfile()
+// (see outbound.h), behind any chat traffic queued meanwhile. So however
+// large the file and however slow the recipient, a transfer holds at most a
+// chunk of heap on either side. The spool file is emptied whenever the
+// recipient has caught up.
+//
+// Transfers belong to connections, not sessions: they are cancelled when
+// either connection closes, even if its session is kept for a resume, and
+// when the server hands over to a new process. IDs start at a random value,
+// so those of a previous process are not reused.
+const size_t kTransferShards = 64;
+const size_t kMaxFileName = 255;
+const uint64_t kMaxFileWindow = 16 * 1024 * 1024;  // How far ahead of what it sent a sender may be granted.
+size_t spool_after = 256 * 1024;
+std::string spool_dir = "/tmp";
+
+struct Transfer {
+    uint64_t id;
+    Connection* sender;  // Holds a reference.
+    Connection* recipient;  // Holds a reference.
+    std::string sender_name;
+    UserId sender_id;
+    std::string name;
+    uint64_t size;
+    uint64_t sent;  // Data bytes relayed.
+    uint64_t granted;  // Data bytes the recipient allowed so far.
+    bool accepted;
+    FileSpool* spool;  // Created the first time the recipient is behind; holds a reference.
+    uint64_t spool_end;  // Where the next spooled chunk goes.
+};
+
+struct TransferShard {
+    TransferShard() { pthread_mutex_init(&mutex, NULL); }
+
+    pthread_mutex_t mutex;
+    std::unordered_map<uint64_t, Transfer*> transfers;
+};
+
+TransferShard transfer_shards[kTransferShards];
+std::atomic<uint64_t> next_transfer_id((new_resume_key().words[0] >> 1) + 1);  // Never 0.
+
+TransferShard& transfer_shard_for(uint64_t id) {
+    return transfer_shards[id % kTransferShards];
+}
+
+void describe_transfer(const Transfer& transfer, chat::FileTransfer* info) {
+    info->set_transfer_id(transfer.id);
+    info->set_sender(transfer.sender_name);
+    info->set_sender_id(transfer.sender_id);
+    info->set_name(transfer.name);
+    info->set_size(transfer.size);
+}
+
+// Tells one side of a transfer what happened to it.
+void notify_transfer(Connection* conn, chat::Operation operation, const Transfer& transfer, uint64_t window,
+                     const char* message) {
+    chat::Response notice;
+    notice.set_operation(operation);
+    set_status(notice, chat::StatusCode::OK, message);
+    describe_transfer(transfer, notice.mutable_transfer());
+    notice.mutable_transfer()->set_window(window);
+    send_response(conn, notice);
+}
+
+// Frees a transfer that is no longer listed in its shard.
+void release_transfer(Transfer* transfer) {
+    transfer->sender->transfers.fetch_sub(1, std::memory_order_relaxed);
+    transfer->recipient->transfers.fetch_sub(1, std::memory_order_relaxed);
+    connection_unref(transfer->sender);
+    connection_unref(transfer->recipient);
+    if (transfer->spool != nullptr) {
+        spool_unref(transfer->spool);
+    }
+    thread_metrics().transfers_ended.add(1);
+    delete transfer;
+}
+
+// Takes a transfer out of its shard if it is still listed there.
+bool unlist_transfer(Transfer* transfer) {
+    TransferShard& shard = transfer_shard_for(transfer->id);
+    pthread_mutex_lock(&shard.mutex);
+    auto it = shard.transfers.find(transfer->id);
+    bool listed = it != shard.transfers.end() && it->second == transfer;
+    if (listed) {
+        shard.transfers.erase(it);
+    }
+    pthread_mutex_unlock(&shard.mutex);
+    return listed;
+}
+
+// Takes the chunks of a cancelled transfer that have not started going out
+// off the recipient's queue, with their part of the spool file: the
+// recipient would only throw them away.
+void drop_queued_chunks(const Transfer& transfer) {
+    uint64_t id = transfer.id;
+    Connection* recipient = transfer.recipient;
+    pthread_mutex_lock(&recipient->out_mutex);
+    recipient->outbound.drop_bulk(
+        [id](const Frame* frame) { return read_chunk_transfer(frame->bytes.data() + kFrameHeaderSize) == id; });
+    pthread_mutex_unlock(&recipient->out_mutex);
+}
+
+// The connection of the ONLINE session an offer is for, if it is attached.
+Connection* find_file_recipient(const chat::FileOffer& offer) {
+    Connection* conn = nullptr;
+    UserShard* shard = nullptr;
+    uint32_t slot = kNoSlot;
+    if (offer.recipient_id() != 0) {
+        slot = sessions.slot_of(offer.recipient_id());
+    } else {
+        shard = &shard_for(offer.recipient());
+        pthread_rwlock_rdlock(&shard->lock);
+        auto it = shard->slots.find(offer.recipient());
+        if (it != shard->slots.end()) {
+            slot = it->second;
+        }
+    }
+    if (slot != kNoSlot) {
+        pthread_rwlock_t& lock = sessions.lock_for(slot);
+        pthread_rwlock_rdlock(&lock);
+        const SessionState& state = sessions.state(slot);
+        bool addressed = offer.recipient_id() == 0 ? state.live : sessions.matches(slot, offer.recipient_id());
+        if (addressed && !state.detached && state.status == chat::UserStatus::ONLINE) {
+            conn = connection_ref(sessions.connection(slot));
+        }
+        pthread_rwlock_unlock(&lock);
+    }
+    if (shard != nullptr) {
+        pthread_rwlock_unlock(&shard->lock);
+    }
+    return conn;
+}
+
+void handle_file_offer(const chat::FileOffer& offer, chat::Response& response, Connection* conn) {
+    if (conn->username.empty()) {
+        set_status(response, chat::StatusCode::UNAUTHORIZED, "Register before sending files");
+        return;
+    }
+    if (offer.size() == 0 || offer.name().empty() || offer.name().size() > kMaxFileName) {
+        set_status(response, chat::StatusCode::BAD_REQUEST, "Invalid file name or size");
+        return;
+    }
+    Connection* recipient = find_file_recipient(offer);
+    if (recipient == nullptr) {
+        set_status(response, chat::StatusCode::NOT_FOUND, "Recipient not found or not online");
+        return;
+    }
+    if (recipient == conn) {
+        connection_unref(recipient);
+        set_status(response, chat::StatusCode::BAD_REQUEST, "Cannot send a file to yourself");
+        return;
+    }
+
+    Transfer* transfer = new Transfer();
+    transfer->id = next_transfer_id.fetch_add(1, std::memory_order_relaxed);
+    transfer->sender = connection_ref(conn);
+    transfer->recipient = recipient;
+    transfer->sender_name = conn->username;
+    transfer->sender_id = conn->user_id;
+    transfer->name = offer.name();
+    transfer->size = offer.size();
+    transfer->sent = 0;
+    transfer->granted = 0;
+    transfer->accepted = false;
+    transfer->spool = nullptr;
+    transfer->spool_end = 0;
+    conn->transfers.fetch_add(1, std::memory_order_relaxed);
+    recipient->transfers.fetch_add(1, std::memory_order_relaxed);
+    thread_metrics().transfers_offered.add(1);
+    TransferShard& shard = transfer_shard_for(transfer->id);
+    pthread_mutex_lock(&shard.mutex);
+    shard.transfers[transfer->id] = transfer;
+    pthread_mutex_unlock(&shard.mutex);
+
+    // A recipient closing meanwhile may have looked for its transfers
+    // before this one was listed (see cancel_transfers()).
+    pthread_mutex_lock(&recipient->out_mutex);
+    bool gone = recipient->closed;
+    pthread_mutex_unlock(&recipient->out_mutex);
+    if (gone) {
+        if (unlist_transfer(transfer)) {
+            release_transfer(transfer);
+        }
+        set_status(response, chat::StatusCode::NOT_FOUND, "Recipient not found or not online");
+        return;
+    }
+
+    notify_transfer(recipient, chat::Operation::FILE_OFFER, *transfer, 0, "Incoming file");
+    describe_transfer(*transfer, response.mutable_transfer());
+    set_status(response, chat::StatusCode::OK, "File offered");
+    log_debug("User {} offered {} ({} bytes) as transfer {}", conn->username, offer.name(), offer.size(), transfer->id);
+}
+
+// FILE_ACCEPT and FILE_WINDOW: the recipient grants the sender more bytes.
+void handle_file_window(const chat::FileWindow& request, chat::Operation operation, chat::Response& response,
+                        Connection* conn) {
+    TransferShard& shard = transfer_shard_for(request.transfer_id());
+    pthread_mutex_lock(&shard.mutex);
+    auto it = shard.transfers.find(request.transfer_id());
+    if (it == shard.transfers.end() || it->second->recipient != conn) {
+        pthread_mutex_unlock(&shard.mutex);
+        set_status(response, chat::StatusCode::NOT_FOUND, "No such transfer");
+        return;
+    }
+    Transfer* transfer = it->second;
+    bool accepting = operation == chat::Operation::FILE_ACCEPT;
+    if (transfer->accepted == accepting) {
+        pthread_mutex_unlock(&shard.mutex);
+        set_status(response, chat::StatusCode::BAD_REQUEST, accepting ? "Transfer already accepted" : "Transfer not accepted yet");
+        return;
+    }
+    transfer->accepted = true;
+    uint64_t limit = std::min(transfer->size, transfer->sent + kMaxFileWindow);
+    uint64_t window = std::min(request.bytes(), limit - std::min(limit, transfer->granted));
+    transfer->granted += window;
+    chat::Response notice;
+    notice.set_operation(chat::Operation::FILE_WINDOW);
+    set_status(notice, chat::StatusCode::OK, accepting ? "File accepted" : "More room for the file");
+    describe_transfer(*transfer, notice.mutable_transfer());
+    notice.mutable_transfer()->set_window(window);
+    Connection* sender = connection_ref(transfer->sender);
+    pthread_mutex_unlock(&shard.mutex);
+
+    if (accepting) {
+        thread_metrics().transfers_accepted.add(1);
+    }
+    if (accepting || window > 0) {
+        send_response(sender, notice);
+    }
+    connection_unref(sender);
+    response.mutable_transfer()->Swap(notice.mutable_transfer());
+    set_status(response, chat::StatusCode::OK, accepting ? "File accepted" : "Window granted");
+}
+
+void handle_file_cancel(const chat::FileWindow& request, chat::Response& response, Connection* conn) {
+    TransferShard& shard = transfer_shard_for(request.transfer_id());
+    pthread_mutex_lock(&shard.mutex);
+    auto it = shard.transfers.find(request.transfer_id());
+    if (it == shard.transfers.end() || (it->second->sender != conn && it->second->recipient != conn)) {
+        pthread_mutex_unlock(&shard.mutex);
+        set_status(response, chat::StatusCode::NOT_FOUND, "No such transfer");
+        return;
+    }
+    Transfer* transfer = it->second;
+    shard.transfers.erase(it);
+    pthread_mutex_unlock(&shard.mutex);
+
+    drop_queued_chunks(*transfer);
+    if (transfer->sender == conn) {
+        notify_transfer(transfer->recipient, chat::Operation::FILE_CANCEL, *transfer, 0, "Cancelled by the sender");
+    } else {
+        notify_transfer(transfer->sender, chat::Operation::FILE_CANCEL, *transfer, 0,
+                        transfer->accepted ? "Cancelled by the recipient" : "Declined by the recipient");
+    }
+    describe_transfer(*transfer, response.mutable_transfer());
+    release_transfer(transfer);
+    set_status(response, chat::StatusCode::OK, "Transfer cancelled");
+}
+
+// Cancels the transfers of a connection that closed, telling the other
+// sides.
+void cancel_transfers(Connection* conn) {
+    if (conn->transfers.load(std::memory_order_relaxed) == 0) {
+        return;
+    }
+    std::vector<Transfer*> cancelled;
+    for (size_t i = 0; i < kTransferShards; i++) {
+        TransferShard& shard = transfer_shards[i];
+        pthread_mutex_lock(&shard.mutex);
+        for (auto it = shard.transfers.begin(); it != shard.transfers.end();) {
+            if (it->second->sender == conn || it->second->recipient == conn) {
+                cancelled.push_back(it->second);
+                it = shard.transfers.erase(it);
+            } else {
+                ++it;
+            }
+        }
+        pthread_mutex_unlock(&shard.mutex);
+    }
+    for (Transfer* transfer : cancelled) {
+        drop_queued_chunks(*transfer);
+        if (transfer->sender == conn) {
+            notify_transfer(transfer->recipient, chat::Operation::FILE_CANCEL, *transfer, 0, "The sender disconnected");
+        } else {
+            notify_transfer(transfer->sender, chat::Operation::FILE_CANCEL, *transfer, 0, "The recipient disconnected");
+        }
+        release_transfer(transfer);
+    }
+}
+
+// Before a handoff: the new process does not take transfers over.
+void cancel_all_transfers() {
+    for (size_t i = 0; i < kTransferShards; i++) {
+        TransferShard& shard = transfer_shards[i];
+        pthread_mutex_lock(&shard.mutex);
+        std::unordered_map<uint64_t, Transfer*> cancelled;
+        cancelled.swap(shard.transfers);
+        pthread_mutex_unlock(&shard.mutex);
+        for (auto& entry : cancelled) {
+            Transfer* transfer = entry.second;
+            drop_queued_chunks(*transfer);
+            notify_transfer(transfer->sender, chat::Operation::FILE_CANCEL, *transfer, 0, "The server is restarting");
+            notify_transfer(transfer->recipient, chat::Operation::FILE_CANCEL, *transfer, 0, "The server is restarting");
+            release_transfer(transfer);
+        }
+    }
+}
+
+// Also before a handoff, after cancel_all_transfers(): file data still
+// queued for transfers that were relayed in full would reach the new process
+// as plain memory, so it is dropped too and its recipients told which
+// transfers did not make it.
+void cancel_queued_files() {
+    pthread_mutex_lock(&open_connections_mutex);
+    std::vector<Connection*> conns(open_connections.begin(), open_connections.end());
+    pthread_mutex_unlock(&open_connections_mutex);
+    sessions.scan([&conns](uint32_t slot, const SessionState& state) {
+        if (state.detached) {
+            conns.push_back(sessions.connection(slot));
+        }
+    });
+    std::vector<uint64_t> ids;
+    for (Connection* conn : conns) {
+        ids.clear();
+        pthread_mutex_lock(&conn->out_mutex);
+        conn->outbound.drop_bulk([&ids](const Frame* frame) {
+            uint64_t id = read_chunk_transfer(frame->bytes.data() + kFrameHeaderSize);
+            if (std::find(ids.begin(), ids.end(), id) == ids.end()) {
+                ids.push_back(id);
+            }
+            return true;
+        });
+        pthread_mutex_unlock(&conn->out_mutex);
+        for (uint64_t id : ids) {
+            chat::Response notice;
+            notice.set_operation(chat::Operation::FILE_CANCEL);
+            set_status(notice, chat::StatusCode::OK, "The server is restarting");
+            notice.mutable_transfer()->set_transfer_id(id);
+            send_response(conn, notice);
+        }
+    }
+}
+
+int open_spool_file() {
+    int fd = open(spool_dir.c_str(), O_TMPFILE | O_RDWR | O_CLOEXEC, 0600);
+    if (fd < 0) {
+        // Not every file system supports O_TMPFILE.
+        std::string path = spool_dir + "/chat-spool-XXXXXX";
+        fd = mkostemp(&path[0], O_CLOEXEC);
+        if (fd >= 0) {
+            unlink(path.c_str());
+        }
+    }
+    if (fd < 0) {
+        log_warn("Cannot create a spool file in {}: {}", spool_dir, strerror(errno));
+    }
+    return fd;
+}
+
+// Writes a chunk's data to the transfer's spool file and points `frame` at
+// it. Called with the transfer's shard locked. Returns false, leaving the
+// frame alone, if the file cannot take it.
+bool spool_chunk(Transfer* transfer, const char* data, uint32_t size, Frame* frame) {
+    if (transfer->spool == nullptr) {
+        int fd = open_spool_file();
+        if (fd < 0) {
+            return false;
+        }
+        transfer->spool = new FileSpool();
+        transfer->spool->fd = fd;
+        transfer->spool->refs.store(1, std::memory_order_relaxed);
+        transfer->spool_end = 0;
+    } else if (transfer->spool_end > 0 && transfer->spool->refs.load(std::memory_order_acquire) == 1) {
+        // No queued frame reads from the file any more.
+        if (ftruncate(transfer->spool->fd, 0) == 0) {
+            transfer->spool_end = 0;
+        }
+    }
+    size_t written = 0;
+    while (written < size) {
+        ssize_t result = pwrite(transfer->spool->fd, data + written, size - written, off_t(transfer->spool_end + written));
+        if (result < 0 && errno == EINTR) {
+            continue;
+        }
+        if (result <= 0) {
+            log_warn("Cannot spool transfer {}: {}", transfer->id, strerror(errno));
+            return false;
+        }
+        written += result;
+    }
+    frame->spool = transfer->spool;
+    frame->spool->refs.fetch_add(1, std::memory_order_relaxed);
+    frame->spool_offset = transfer->spool_end;
+    frame->spool_size = size;
+    transfer->spool_end += size;
+    return true;
+}
+
+// Passes a chunk frame from a transfer's sender on to its recipient. Runs on
+// the sender's I/O thread, even with a worker pool: relaying is a copy or a
+// write to the spool file, cheaper than queuing the chunk for a worker.
+void relay_chunk(Connection* conn, const char* payload, uint32_t size) {
+    uint64_t id = read_chunk_transfer(payload);
+    const char* data = payload + kChunkHeaderSize;
+    uint32_t data_size = size - uint32_t(kChunkHeaderSize);
+    TransferShard& shard = transfer_shard_for(id);
+    pthread_mutex_lock(&shard.mutex);
+    auto it = shard.transfers.find(id);
+    if (it == shard.transfers.end() || it->second->sender != conn) {
+        // Most likely cancelled while the chunk was on its way.
+        pthread_mutex_unlock(&shard.mutex);
+        return;
+    }
+    Transfer* transfer = it->second;
+    if (!transfer->accepted || data_size > transfer->granted - transfer->sent) {
+        shard.transfers.erase(it);
+        pthread_mutex_unlock(&shard.mutex);
+        drop_queued_chunks(*transfer);
+        notify_transfer(transfer->sender, chat::Operation::FILE_CANCEL, *transfer, 0, "Sent more than the window");
+        notify_transfer(transfer->recipient, chat::Operation::FILE_CANCEL, *transfer, 0, "The sender broke the protocol");
+        release_transfer(transfer);
+        return;
+    }
+    Connection* recipient = connection_ref(transfer->recipient);
+    pthread_mutex_lock(&recipient->out_mutex);
+    bool behind = recipient->outbound.memory_bytes() >= spool_after;
+    pthread_mutex_unlock(&recipient->out_mutex);
+
+    Frame* frame = FramePool::local().acquire();
+    frame->refs.store(1, std::memory_order_relaxed);
+    frame->packable = false;
+    frame->kind = FRAME_RESPONSE;  // Never shed: the file would come out with a hole.
+    frame->bulk = true;
+    frame->bytes.resize(kFrameHeaderSize + kChunkHeaderSize);
+    write_chunk_header(&frame->bytes[0], id, data_size);
+    bool spooled = behind && spool_chunk(transfer, data, data_size, frame);
+    if (!spooled) {
+        frame->bytes.append(data, data_size);
+    }
+    transfer->sent += data_size;
+    bool done = transfer->sent == transfer->size;
+    if (done) {
+        shard.transfers.erase(it);
+    }
+    pthread_mutex_unlock(&shard.mutex);
+
+    ThreadMetrics& metrics = thread_metrics();
+    metrics.file_bytes.add(data_size);
+    if (spooled) {
+        metrics.file_bytes_spooled.add(data_size);
+    }
+    route_frame(recipient, frame);
+    frame_unref(frame);
+    connection_unref(recipient);
+    if (done) {
+        log_debug("Transfer {} of {} bytes relayed", id, transfer->size);
+        release_transfer(transfer);
+    }
+}
+
+// Memory held by the session registry: the store's chunks plus the name
+// index (entries, buckets and long names).
+size_t session_memory_bytes() {
+    size_t bytes = sessions.memory_bytes();
+    for (UserShard& shard : user_shards) {
+        pthread_rwlock_rdlock(&shard.lock);
+        bytes += shard.slots.size() * kNameIndexEntryBytes + shard.slots.bucket_count() * sizeof(void*) + shard.name_bytes;
+        pthread_rwlock_unlock(&shard.lock);
+    }
+    return bytes;
+}
+
+void collect_stats(chat::ServerStats* stats) {
+    metrics_snapshot(stats);
+    stats->set_sessions(sessions.live());
+    stats->set_session_bytes(session_memory_bytes());
+    if (offline_store != nullptr) {
+        stats->set_offline_pending(offline_store->pending());
+    }
+}
+
+void handle_get_stats(chat::Response& response) {
+    collect_stats(response.mutable_stats());
+    set_status(response, chat::StatusCode::OK, "Server stats");
+}
+
+
+// Every request, its response and any deliveries it produces are built on a
+// per-thread arena that is reset once the request is done. The first block
+// is kept for the life of the thread, so message objects stop costing heap
+// allocations after warm-up.
+const size_t kRequestArenaBlock = 8 * 1024;
+
+struct RequestArena {
+    static google::protobuf::ArenaOptions options(char* block) {
+        google::protobuf::ArenaOptions options;
+        options.initial_block = block;
+        options.initial_block_size = kRequestArenaBlock;
+        return options;
+    }
+
+    RequestArena() : block(new char[kRequestArenaBlock]), arena(options(block.get())) {}
+
+    std::unique_ptr<char[]> block;  // Declared first so it outlives the arena.
+    google::protobuf::Arena arena;
+};
+
+google::protobuf::Arena& request_arena() {
+    static thread_local RequestArena local;
+    return local.arena;
+}
+
+int alloc_report_interval = 0;
+TimerNode alloc_report_timer;
+
+void on_alloc_report(TimerNode* node) {
+    static uint64_t last_requests = 0;
+    static uint64_t last_allocations = 0;
+    chat::ServerStats stats;
+    metrics_snapshot(&stats);
+    uint64_t requests = 0;
+    for (const chat::OperationStats& operation : stats.operations()) {
+        requests += operation.requests();
+    }
+    uint64_t allocations = stats.heap_allocations();
+    uint64_t delta_requests = requests - last_requests;
+    uint64_t delta_allocations = allocations - last_allocations;
+    if (delta_requests > 0) {
+        log_info("Request path: {} requests, {} heap allocations ({} per request)",
+                 delta_requests, delta_allocations, double(delta_allocations) / delta_requests);
+    }
+    last_requests = requests;
+    last_allocations = allocations;
+    timer_wheel->schedule(node, uint64_t(alloc_report_interval) * 1000);
+}
+
+// --stats-file: the metrics are rewritten every stats_interval seconds, via
+// a temporary file and rename() so a scraper never reads a partial dump.
+std::string stats_file;
+int stats_interval = 10;
+TimerNode stats_timer;
+
+void on_stats_timer(TimerNode* node) {
+    chat::ServerStats stats;
+    collect_stats(&stats);
+    std::string text;
+    google::protobuf::TextFormat::PrintToString(stats, &text);
+
+    std::string temp_file = stats_file + ".tmp";
+    FILE* out = fopen(temp_file.c_str(), "w");
+    if (out == nullptr) {
+        log_warn("Cannot write stats file {}: {}", temp_file, strerror(errno));
+    } else {
+        bool written = fwrite(text.data(), 1, text.size(), out) == text.size();
+        written = fclose(out) == 0 && written;
+        if (!written || rename(temp_file.c_str(), stats_file.c_str()) != 0) {
+            log_warn("Cannot write stats file {}: {}", stats_file, strerror(errno));
+        }
+    }
+    timer_wheel->schedule(node, uint64_t(stats_interval) * 1000);
+}
+
+void process_request(Connection* conn, const char* data, int size) {
+    auto started = std::chrono::steady_clock::now();
+    uint64_t allocations_before = thread_allocations();
+    google::protobuf::Arena& arena = request_arena();
+    chat::Request& request = *google::protobuf::Arena::CreateMessage<chat::Request>(&arena);
+    if (!request.ParseFromArray(data, size)) {
+        // Nothing in the frame can be trusted, not even its operation, so it
+        // is answered as is and neither dispatched nor counted as activity.
+        log_debug("Malformed request from {}", conn->ip_address);
+        chat::Response& response = *google::protobuf::Arena::CreateMessage<chat::Response>(&arena);
+        set_status(response, chat::StatusCode::BAD_REQUEST, "Malformed request");
+        send_response(conn, response);
+        arena.Reset();
+        thread_metrics().responses[metrics_status_index(chat::StatusCode::BAD_REQUEST)].add(1);
+        return;
+    }
+
+    // The connection remembers which session slot it registered, so finding
+    // the sender hashes nothing.
+    const std::string& username = conn->username;
+    std::string came_online;  // User whose queued messages are due.
+    bool answered = false;  // The handler sent the response itself.
+
+    if (conn->user_slot != kNoSlot && chat::Operation::UPDATE_STATUS != request.operation()) {
+        pthread_rwlock_t& lock = sessions.lock_for(conn->user_slot);
+        pthread_rwlock_wrlock(&lock);
+        SessionState& state = sessions.state(conn->user_slot);
+        if (sessions.matches(conn->user_slot, conn->user_id)) {
+            log_debug("The user: {} will be updated to ONLINE", username);
+            if (state.status == chat::UserStatus::OFFLINE) {
+                arm_idle_timer(conn, uint64_t(inactivity_timeout) * 1000);
+            }
+            if (state.status != chat::UserStatus::ONLINE) {
+                came_online = username;
+                presence_status(username, conn->user_id, chat::UserStatus::ONLINE);
+            }
+            state.last_activity_ms = SessionStore::now_ms();
+            state.status = chat::UserStatus::ONLINE;
+        }
+        pthread_rwlock_unlock(&lock);
+    }
+
+    chat::Response& response = *google::protobuf::Arena::CreateMessage<chat::Response>(&arena);
+    response.set_operation(request.operation());  
+    response.set_status_code(chat::StatusCode::BAD_REQUEST);
+    response.set_request_id(request.request_id());
+
+    switch (request.operation()) {
+        case chat::Operation::REGISTER_USER:
+            log_debug("Handling register user {}", username);
+            handle_register_user(request.register_user(), response, conn);
+            break;
+        case chat::Operation::RESUME:
+            log_debug("Handling resume");
+            handle_resume(request.resume(), response, conn);
+            break;
+        case chat::Operation::UNREGISTER_USER:
+            log_debug("Handling unregister user {}", username);
+            handle_unregister_user(request.unregister_user(), response, conn);
+            break;
+        case chat::Operation::UPDATE_STATUS:
+            log_debug("Handling update status from: {}", username);
+            handle_update_status(request.update_status(), response);
+            break;
+        case chat::Operation::GET_USERS:
+            log_debug("Handling list user(s) from: {}", username);
+            if (request.get_users().username().empty()) {
+                send_user_list(conn, request.request_id(), response);
+                answered = true;
+            } else {
+                handle_get_users(request.get_users(), response.mutable_user_list(), response);
+            }
+            break;
+        case chat::Operation::SEND_MESSAGE:
+            log_debug("Handling send message from: {}", username);
+            handle_send_message(*request.mutable_send_message(), response, conn);
+            break;
+        case chat::Operation::SEND_MESSAGE_BATCH:
+            log_debug("Handling message batch from: {}", username);
+            handle_send_message_batch(*request.mutable_send_message_batch(), response, conn);
+            break;
+        case chat::Operation::JOIN_ROOM:
+            log_debug("Handling join room from: {}", username);
+            handle_join_room(request.join_room(), response, conn);
+            break;
+        case chat::Operation::LEAVE_ROOM:
+            log_debug("Handling leave room from: {}", username);
+            handle_leave_room(request.leave_room(), response, conn);
+            break;
+        case chat::Operation::GET_STATS:
+            log_debug("Handling get stats from: {}", username);
+            handle_get_stats(response);
+            break;
+        case chat::Operation::SUBSCRIBE_PRESENCE:
+            log_debug("Handling presence subscription from: {}", username);
+            handle_subscribe_presence(response, conn);
+            break;
+        case chat::Operation::UNSUBSCRIBE_PRESENCE:
+            log_debug("Handling presence unsubscription from: {}", username);
+            handle_unsubscribe_presence(response, conn);
+            break;
+        case chat::Operation::FILE_OFFER:
+            log_debug("Handling file offer from: {}", username);
+            handle_file_offer(request.file_offer(), response, conn);
+            break;
+        case chat::Operation::FILE_ACCEPT:
+        case chat::Operation::FILE_WINDOW:
+            log_debug("Handling file window from: {}", username);
+            handle_file_window(request.file_window(), request.operation(), response, conn);
+            break;
+        case chat::Operation::FILE_CANCEL:
+            log_debug("Handling file cancel from: {}", username);
+            handle_file_cancel(request.file_window(), response, conn);
+            break;
+        default:
+            set_status(response, chat::StatusCode::BAD_REQUEST, "Unknown operation");
+    }
+
+    if (!answered) {
+        send_response(conn, response);
+    }
+    chat::Operation operation = request.operation();
+    chat::StatusCode status = response.status_code();
+    if (status == chat::StatusCode::OK) {
+        if (operation == chat::Operation::REGISTER_USER || operation == chat::Operation::RESUME) {
+            came_online = username;
+        } else if (operation == chat::Operation::UPDATE_STATUS &&
+                   request.update_status().new_status() == chat::UserStatus::ONLINE) {
+            came_online = request.update_status().username();
+        }
+    }
+    arena.Reset();
+
+    uint64_t latency_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - started).count();
+    metrics_count_request(operation, status, latency_ns);
+    thread_metrics().heap_allocations.add(thread_allocations() - allocations_before);
+
+    // After the response, so a client that just registered gets that first.
+    if (!came_online.empty()) {
+        deliver_offline_messages(came_online);
+    }
+}
+
+// Worker pool (--workers). Without one, each I/O thread runs the requests it
+// reads. With one, I/O threads only split their input into frames and queue
+// them on the connection, and a worker runs them, so an expensive request
+// (a GET_USERS over a big roster, a broadcast to thousands) no longer holds
+// up the reads of every connection sharing its I/O thread. A connection has
+// at most one worker job queued or running, which runs everything queued
+// for it in arrival order, so its requests and their responses keep their
+// order. Responses go back to the connection's I/O thread like any other
+// delivery (see send_response()).
+WorkerPool* worker_pool = nullptr;
+
+void run_connection_work(void* conn);
+
+// Called with work_mutex held.
+void schedule_work_locked(Connection* conn) {
+    if (!conn->work_scheduled) {
+        conn->work_scheduled = true;
+        worker_pool->submit({run_connection_work, connection_ref(conn)});
+    }
+}
+
+void queue_request(Connection* conn, const char* data, uint32_t size) {
+    pthread_mutex_lock(&conn->work_mutex);
+    conn->work_queue.append(reinterpret_cast<const char*>(&size), sizeof(size));
+    conn->work_queue.append(data, size);
+    schedule_work_locked(conn);
+    pthread_mutex_unlock(&conn->work_mutex);
+}
+
+// A worker job: runs a connection's queued requests until there are none
+// left, corked like a batch on an I/O thread, then disconnects it if its I/O
+// thread is done with it.
+void run_connection_work(void* arg) {
+    Connection* conn = static_cast<Connection*>(arg);
+    static thread_local std::string batch;
+    thread_metrics().worker_jobs.add(1);
+    while (true) {
+        pthread_mutex_lock(&conn->work_mutex);
+        if (conn->work_queue.empty()) {
+            bool finish = conn->work_finish;
+            conn->work_scheduled = false;
+            pthread_mutex_unlock(&conn->work_mutex);
+            if (finish) {
+                handle_client_disconnection(conn);
+                connection_unref(conn);  // The I/O thread's.
+            }
+            break;
+        }
+        batch.swap(conn->work_queue);
+        pthread_mutex_unlock(&conn->work_mutex);
+
+        cork_connection(conn);
+        for (size_t offset = 0; offset < batch.size();) {
+            uint32_t size;
+            memcpy(&size, batch.data() + offset, sizeof(size));
+            process_request(conn, batch.data() + offset + sizeof(size), size);
+            offset += sizeof(size) + size;
+        }
+        uncork_connection(conn);
+        batch.clear();
+    }
+    connection_unref(conn);
+}
+
+// Called by the I/O thread once it is done with a connection: disconnects
+// it and drops the I/O thread's reference, after any requests it still has
+// queued for a worker.
+void finish_connection(Connection* conn) {
+    if (worker_pool == nullptr) {
+        handle_client_disconnection(conn);
+        connection_unref(conn);
+        return;
+    }
+    pthread_mutex_lock(&conn->work_mutex);
+    conn->work_finish = true;
+    schedule_work_locked(conn);
+    pthread_mutex_unlock(&conn->work_mutex);
+}
+
+void* worker_thread(void* index) {
+    WorkerJob job;
+    bool stolen;
+    while (true) {
+        if (worker_pool->take(size_t(index), &job, &stolen)) {
+            if (stolen) {
+                thread_metrics().jobs_stolen.add(1);
+            }
+            job.run(job.arg);
+            continue;
+        }
+        parking_point();  // Interrupted for a handoff with nothing left to run.
+    }
+    return NULL;
+}
+
+// Reads until the socket has nothing more and runs every complete request
+// in what arrived, in order, with the connection corked: a client that
+// pipelines requests gets all the answers to one wakeup's worth in a single
+// write. With a worker pool the requests are queued for it instead. Returns
+// false once the connection is done (EOF, a socket error or a protocol
+// error); whatever was answered is still written out first.
+bool serve_requests(Connection* conn) {
+    ThreadMetrics& metrics = thread_metrics();
+    size_t requests = 0;
+    bool open = true;
+    bool inline_requests = worker_pool == nullptr;
+    if (inline_requests) {
+        cork_connection(conn);
+    }
+    while (true) {
+        int bytes_read = conn->inbound.read_from(conn->socket);
+        metrics.read_calls.add(1);
+        if (bytes_read > 0) {
+            metrics.bytes_in.add(bytes_read);
+            const char* payload;
+            uint32_t size;
+            bool chunk;
+            while (conn->inbound.next_frame(&payload, &size, &chunk)) {
+                if (chunk) {
+                    relay_chunk(conn, payload, size);
+                    continue;
+                }
+                if (inline_requests) {
+                    process_request(conn, payload, size);
+                } else {
+                    queue_request(conn, payload, size);
+                }
+                requests++;
+            }
+            if (conn->inbound.error()) {
+                open = false;
+                break;
+            }
+            continue;
+        }
+        if (bytes_read < 0 && errno == EINTR) {
+            continue;
+        }
+        if (bytes_read < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+            break;
+        }
+        open = false;
+        break;
+    }
+    if (requests > 0) {
+        metrics.pipeline_depth.record(requests);
+    }
+    if (inline_requests) {
+        uncork_connection(conn);
+    }
+    return open;
+}
+
+void set_nonblocking(int fd) {
+    int flags = fcntl(fd, F_GETFL, 0);
+    fcntl(fd, F_SETFL, flags | O_NONBLOCK);
+}
+
+// Output is always written as whole frames, so Nagle only adds latency
+// (a small response can sit behind a delayed ACK for ~40ms).
+void set_nodelay(int fd) {
+    int one = 1;
+    setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+}
+
+// Thread-per-connection model. The socket is non-blocking so other threads
+// can flush into it without stalling; this thread waits on readability, on
+// writability while output is pending, and on its wakeup eventfd.
+void serve_client(Connection* conn) {
+    while (true) {
+        parking_point();
+        pollfd fds[2];
+        fds[0].fd = conn->socket;
+        fds[0].events = POLLIN | (connection_wants_write(conn) ? POLLOUT : 0);
+        fds[1].fd = conn->wakeup_fd;
+        fds[1].events = POLLIN;
+        if (poll(fds, 2, -1) < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            break;
+        }
+
+        if (fds[1].revents & POLLIN) {
+            uint64_t count;
+            read(conn->wakeup_fd, &count, sizeof(count));
+        }
+        if (fds[0].revents & POLLOUT) {
+            handle_writable(conn);
+        }
+        if ((fds[0].revents & (POLLIN | POLLHUP | POLLERR)) && !serve_requests(conn)) {
+            break;
+        }
+    }
+
+    finish_connection(conn);
+}
+
+void handle_client(int socket, const std::string& client_ip) {
+    set_nonblocking(socket);
+    set_nodelay(socket);
+    serve_client(connection_create(socket, client_ip, true));
+}
+
+void raise_fd_limit() {
+    rlimit limit;
+    if (getrlimit(RLIMIT_NOFILE, &limit) == 0 && limit.rlim_cur < limit.rlim_max) {
+        limit.rlim_cur = limit.rlim_max;
+        setrlimit(RLIMIT_NOFILE, &limit);
+    }
+}
+
+// Hands the connection to the reactor's event loop.
+void watch_connection(Reactor* reactor, Connection* conn) {
+    conn->reactor = reactor;
+
+    // EPOLLOUT is edge-triggered too, so it only fires when a full send
+    // buffer drains, which is exactly when queued output needs flushing.
+    // Registering reports the current state, so output or input that was
+    // already waiting (a connection taken over from another process) is
+    // noticed right away.
+    epoll_event event;
+    event.events = EPOLLIN | EPOLLOUT | EPOLLRDHUP | EPOLLET;
+    event.data.ptr = conn;
+    if (epoll_ctl(reactor->epoll_fd, EPOLL_CTL_ADD, conn->socket, &event) < 0) {
+        log_error("epoll_ctl: {}", strerror(errno));
+        finish_connection(conn);
+    }
+}
+
+void accept_connections(Reactor* reactor) {
+    while (true) {
+        sockaddr_in client_address;
+        socklen_t client_addrlen = sizeof(client_address);
+        int client_socket = accept4(reactor->listen_fd, (sockaddr*)&client_address, &client_addrlen, SOCK_NONBLOCK);
+        if (client_socket < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            if (errno != EAGAIN && errno != EWOULDBLOCK) {
+                log_error("accept4: {}", strerror(errno));
+            }
+            return;
+        }
+
+        char ip_address[INET_ADDRSTRLEN];
+        inet_ntop(AF_INET, &(client_address.sin_addr), ip_address, INET_ADDRSTRLEN);
+
+        set_nodelay(client_socket);
+        watch_connection(reactor, connection_create(client_socket, ip_address, false));
+    }
+}
+
+void close_connection(Connection* conn) {
+    if (conn->finishing) {
+        return;
+    }
+    conn->finishing = true;
+    // Closing the socket also removes it from the epoll interest list, but
+    // with a worker pool a worker closes it later, and the loop must not see
+    // events for a connection that may be gone by then.
+    if (worker_pool != nullptr && conn->reactor != nullptr && conn->reactor->epoll_fd >= 0) {
+        epoll_ctl(conn->reactor->epoll_fd, EPOLL_CTL_DEL, conn->socket, nullptr);
+    }
+    finish_connection(conn);
+}
+
+// Edge-triggered: serve_requests() drains the socket until EAGAIN,
+// otherwise we never get another notification for the data that is left.
+void handle_readable(Connection* conn) {
+    if (serve_requests(conn)) {
+        conn->inbound.release();
+        return;
+    }
+    close_connection(conn);
+}
+
+// An io_uring loop sets up its ring itself (see run_uring_loop()) and keeps
+// the listener blocking: the kernel waits on it for the loop.
+Reactor* create_reactor(int listen_fd, int cpu, bool uring = false) {
+    Reactor* reactor = new Reactor();
+    reactor->listen_fd = listen_fd;
+    reactor->cpu = cpu;
+    reactor->epoll_fd = uring ? -1 : epoll_create1(0);
+    reactor->wakeup_fd = eventfd(0, EFD_NONBLOCK);
+    if ((!uring && reactor->epoll_fd < 0) || reactor->wakeup_fd < 0) {
+        perror("epoll_create1/eventfd");
+        return nullptr;
+    }
+
+    if (!uring) {
+        // The listener is the only entry with a null pointer; the wakeup
+        // eventfd is the one pointing at the reactor itself.
+        set_nonblocking(listen_fd);
+        epoll_event event;
+        event.events = EPOLLIN;
+        event.data.ptr = nullptr;
+        epoll_ctl(reactor->epoll_fd, EPOLL_CTL_ADD, listen_fd, &event);
+        event.data.ptr = reactor;
+        epoll_ctl(reactor->epoll_fd, EPOLL_CTL_ADD, reactor->wakeup_fd, &event);
+    }
+
+    pthread_mutex_lock(&parking.mutex);
+    all_reactors.push_back(reactor);
+    pthread_mutex_unlock(&parking.mutex);
+    return reactor;
+}
+
+void pin_to_cpu(int cpu) {
+    if (cpu >= 0) {
+        cpu_set_t cpus;
+        CPU_ZERO(&cpus);
+        CPU_SET(cpu, &cpus);
+        pthread_setaffinity_np(pthread_self(), sizeof(cpus), &cpus);
+    }
+}
+
+void run_reactor(Reactor* reactor) {
+    current_reactor = reactor;
+    pin_to_cpu(reactor->cpu);
+
+    std::vector<epoll_event> events(1024);
+    while (true) {
+        parking_point();
+        int ready = epoll_wait(reactor->epoll_fd, events.data(), events.size(), -1);
+        if (ready < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            log_error("epoll_wait: {}", strerror(errno));
+            break;
+        }
+
+        for (int i = 0; i < ready; i++) {
+            void* target = events[i].data.ptr;
+            if (target == nullptr) {
+                accept_connections(reactor);
+                continue;
+            }
+            if (target == reactor) {
+                uint64_t count;
+                read(reactor->wakeup_fd, &count, sizeof(count));
+                drain_inbox(reactor);
+                continue;
+            }
+            Connection* conn = static_cast<Connection*>(target);
+            if (events[i].events & EPOLLOUT) {
+                handle_writable(conn);
+            }
+            if (events[i].events & (EPOLLIN | EPOLLRDHUP | EPOLLHUP | EPOLLERR)) {
+                // read() reports EOF/errors, so hangups go through the same path.
+                handle_readable(conn);
+            }
+        }
+    }
+
+    close(reactor->epoll_fd);
+}
+
+void* reactor_thread(void* reactor) {
+    run_reactor(static_cast<Reactor*>(reactor));
+    return NULL;
+}
+
+int open_listener(int port, bool reuse_port) {
+    int server_fd = socket(AF_INET, SOCK_STREAM, 0);
+
+    int reuse = 1;
+    setsockopt(server_fd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+    if (reuse_port) {
+        // Every reactor binds its own listener to the port and the kernel
+        // spreads incoming connections across them.
+        setsockopt(server_fd, SOL_SOCKET, SO_REUSEPORT, &reuse, sizeof(reuse));
+    }
+
+    sockaddr_in address;
+    address.sin_family = AF_INET;
+    address.sin_addr.s_addr = INADDR_ANY;
+    address.sin_port = htons(port);
+
+    if (bind(server_fd, (sockaddr*)&address, sizeof(address)) < 0) {
+        perror("bind");
+        close(server_fd);
+        return -1;
+    }
+    listen(server_fd, SOMAXCONN);
+    return server_fd;
+}
+
+// io_uring mode: reactors again (one per core, each with its own
+// SO_REUSEPORT listener and inbox), but instead of waiting for readiness and
+// then calling accept()/read()/send(), each loop keeps operations queued on
+// its own ring and handles their completions. Accept and receive are
+// multishot: one submission goes on producing a completion per new
+// connection or per chunk of data, and received data lands in buffers the
+// loop lends the kernel through a provided-buffer ring, so idle connections
+// hold no receive buffer. Output is written with one SENDMSG per connection
+// covering everything queued for it, and the sends of a whole round (a
+// broadcast fans out to many connections) reach the kernel together with the
+// next io_uring_enter(), the one system call a round makes.
+const unsigned kUringEntries = 4096;
+const unsigned kUringCompletions = 32768;
+const uint16_t kUringBufferGroup = 0;
+const unsigned kUringBuffers = 1024;
+const unsigned kUringBufferSize = 4096;
+
+// user_data of a completion: one of the tags below, or a connection
+// (holding a reference for the operation) with the operation in the low
+// bits.
+const uint64_t kUringAccept = 1;
+const uint64_t kUringWakeup = 2;
+const uint64_t kUringCancel = 3;
+const uint64_t kUringRecv = 4;
+const uint64_t kUringSendOp = 5;
+const uint64_t kUringOpMask = 7;
+
+// Called by flush_locked(), with out_mutex held, once it has set
+// want_write: the owning loop submits the send.
+void uring_request_send(Connection* conn) {
+    Reactor* owner = conn->reactor;
+    if (owner == current_reactor) {
+        owner->send_list.push_back(connection_ref(conn));
+        return;
+    }
+    pthread_mutex_lock(&owner->flush_mutex);
+    owner->flush_requests.push_back(connection_ref(conn));
+    pthread_mutex_unlock(&owner->flush_mutex);
+    wake_reactor(owner);
+}
+
+// get_sqe() only comes back empty while the kernel takes no submissions at
+// all, which it does not do to a ring created with FEAT_NODROP unless it is
+// out of memory.
+io_uring_sqe* uring_sqe(Reactor* reactor) {
+    io_uring_sqe* sqe;
+    while ((sqe = reactor->ring->get_sqe()) == nullptr) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    reactor->ops++;
+    return sqe;
+}
+
+void uring_arm_accept(Reactor* reactor) {
+    io_uring_sqe* sqe = uring_sqe(reactor);
+    sqe->opcode = IORING_OP_ACCEPT;
+    sqe->fd = reactor->listen_fd;
+    sqe->ioprio = IORING_ACCEPT_MULTISHOT;
+    sqe->user_data = kUringAccept;
+}
+
+void uring_arm_wakeup(Reactor* reactor) {
+    io_uring_sqe* sqe = uring_sqe(reactor);
+    sqe->opcode = IORING_OP_POLL_ADD;
+    sqe->fd = reactor->wakeup_fd;
+    sqe->len = IORING_POLL_ADD_MULTI;
+    sqe->poll32_events = POLLIN;
+    sqe->user_data = kUringWakeup;
+}
+
+void uring_arm_recv(Reactor* reactor, Connection* conn) {
+    io_uring_sqe* sqe = uring_sqe(reactor);
+    sqe->opcode = IORING_OP_RECV;
+    sqe->fd = conn->socket;
+    sqe->ioprio = IORING_RECV_MULTISHOT;
+    sqe->flags = IOSQE_BUFFER_SELECT;
+    sqe->buf_group = kUringBufferGroup;
+    sqe->user_data = reinterpret_cast<uint64_t>(connection_ref(conn)) | kUringRecv;
+}
+
+// Takes over the caller's reference to the connection.
+void uring_send(Reactor* reactor, Connection* conn) {
+    if (conn->uring_send == nullptr) {
+        conn->uring_send = new UringSend();
+    }
+    UringSend* send = conn->uring_send;
+    int count = 0;
+    pthread_mutex_lock(&conn->out_mutex);
+    if (!conn->closed && !conn->overflowed) {
+        // Referenced under the lock: an overflow may clear the queue as soon
+        // as it is released.
+        count = conn->outbound.start_write(send->iov, send->frames, kUringSendIov);
+        for (int i = 0; i < count; i++) {
+            frame_ref(send->frames[i]);
+        }
+    }
+    if (count == 0) {
+        conn->want_write = false;
+    }
+    pthread_mutex_unlock(&conn->out_mutex);
+    if (count == 0) {
+        connection_unref(conn);
+        return;
+    }
+
+    send->count = count;
+    memset(&send->msg, 0, sizeof(send->msg));
+    send->msg.msg_iov = send->iov;
+    send->msg.msg_iovlen = count;
+    io_uring_sqe* sqe = uring_sqe(reactor);
+    sqe->opcode = IORING_OP_SENDMSG;
+    sqe->fd = conn->socket;
+    sqe->addr = reinterpret_cast<uint64_t>(&send->msg);
+    sqe->len = 1;
+    sqe->msg_flags = MSG_NOSIGNAL;
+    sqe->user_data = reinterpret_cast<uint64_t>(conn) | kUringSendOp;
+}
+
+void uring_submit_sends(Reactor* reactor) {
+    for (size_t i = 0; i < reactor->send_list.size(); i++) {
+        uring_send(reactor, reactor->send_list[i]);
+    }
+    reactor->send_list.clear();
+}
 
-        std::cout << "User registered: " << session.username << " with IP: " << session.ip_address << std::endl;
+// Serves every request the buffered input completes, like
+// serve_requests(). Returns false on a protocol error.
+bool uring_serve(Connection* conn) {
+    size_t requests = 0;
+    bool inline_requests = worker_pool == nullptr;
+    if (inline_requests) {
+        cork_connection(conn);
+    }
+    const char* payload;
+    uint32_t size;
+    bool chunk;
+    while (conn->inbound.next_frame(&payload, &size, &chunk)) {
+        if (chunk) {
+            relay_chunk(conn, payload, size);
+            continue;
+        }
+        if (inline_requests) {
+            process_request(conn, payload, size);
+        } else {
+            queue_request(conn, payload, size);
+        }
+        requests++;
+    }
+    if (requests > 0) {
+        thread_metrics().pipeline_depth.record(requests);
+    }
+    if (inline_requests) {
+        uncork_connection(conn);
     }
-    pthread_mutex_unlock(&users_mutex);
+    conn->inbound.release();
+    return !conn->inbound.error();
 }
 
+// The shutdown ends the receive still armed, which then drops its reference.
+void uring_close(Connection* conn) {
+    shutdown(conn->socket, SHUT_RDWR);
+    close_connection(conn);
+}
 
-void handle_update_status(const chat::UpdateStatusRequest& request, chat::Response& response) {
-    pthread_mutex_lock(&users_mutex);
-    auto it = users.find(request.username());
-    if (it != users.end()) {
-        it->second.status = request.new_status();
-        it->second.last_activity = std::chrono::system_clock::now(); 
-        response.set_status_code(chat::StatusCode::OK);
-        response.set_message("Status updated successfully");
-        std::cout << "User " << request.username() << " changed status to " << chat::UserStatus_Name(request.new_status()) << std::endl;
-    } else {
-        response.set_status_code(chat::StatusCode::BAD_REQUEST);
-        response.set_message("User not found");
-        
-        std::cout << "Failed to update status. Registered users:" << std::endl;
-        for (const auto& user : users) {
-            std::cout << "User: " << user.second.username << ", IP: " << user.second.ip_address << std::endl;
-        }
-        std::cout << "Attempted to change status for user: " << request.username() << std::endl;
+// Adopts a connection: the loop receives from it and writes whatever is
+// queued for it. Also picks up connections again after a handoff was
+// called off, with their input buffered meanwhile.
+void uring_attach(Reactor* reactor, Connection* conn) {
+    pthread_mutex_lock(&conn->out_mutex);
+    if (!conn->uring) {
+        conn->reactor = reactor;
+        conn->uring = true;
+        conn->want_write = false;
+    }
+    if (!conn->want_write && !conn->outbound.empty()) {
+        conn->want_write = true;
+        reactor->send_list.push_back(connection_ref(conn));
+    }
+    pthread_mutex_unlock(&conn->out_mutex);
+    uring_arm_recv(reactor, conn);
+    if (!conn->inbound.empty() && !uring_serve(conn)) {
+        uring_close(conn);
     }
-    pthread_mutex_unlock(&users_mutex);
 }
 
-void handle_client_disconnection(int client_sock) {
-    pthread_mutex_lock(&users_mutex);
-    for (auto it = users.begin(); it != users.end(); ++it) {
-        if (it->second.socket == client_sock) {
-            users.erase(it);
-            break;
+// Arms the listener and the wakeup eventfd and adopts every connection
+// assigned to this loop.
+void uring_start(Reactor* reactor) {
+    reactor->quiescing = false;
+    uring_arm_accept(reactor);
+    uring_arm_wakeup(reactor);
+    std::vector<Connection*> owned;
+    pthread_mutex_lock(&open_connections_mutex);
+    for (Connection* conn : open_connections) {
+        if (conn->reactor == reactor && !conn->finishing) {
+            owned.push_back(connection_ref(conn));
         }
     }
-    pthread_mutex_unlock(&users_mutex);
-    close(client_sock);
+    pthread_mutex_unlock(&open_connections_mutex);
+    for (Connection* conn : owned) {
+        uring_attach(reactor, conn);
+        connection_unref(conn);
+    }
 }
 
-void handle_get_users(const chat::UserListRequest& user_list_request, chat::UserListResponse* user_list_response, chat::Response& response) {
-    // std::cout << "handle get users: " << user_list_request.username() << std::endl;
-    user_list_response->Clear();
-    bool found = false;
-    if (user_list_request.username().empty()) {
-        for (const auto& user : users) {
-            if (user.second.status == chat::UserStatus::ONLINE) {
-                chat::User* user_proto = user_list_response->add_users();
-                user_proto->set_username(user.first);
-                found = true;
-            }
+void uring_accepted(Reactor* reactor, io_uring_cqe* cqe) {
+    if (cqe->res >= 0) {
+        int client_socket = cqe->res;
+        sockaddr_in client_address;
+        socklen_t client_addrlen = sizeof(client_address);
+        char ip_address[INET_ADDRSTRLEN] = "";
+        if (getpeername(client_socket, (sockaddr*)&client_address, &client_addrlen) == 0) {
+            inet_ntop(AF_INET, &(client_address.sin_addr), ip_address, INET_ADDRSTRLEN);
         }
-    } else {
-        auto it = users.find(user_list_request.username());
-        if (it != users.end()) {
-            user_list_response->clear_users();
-            chat::User* user_proto = user_list_response->add_users();
-            user_proto->set_username(it->first);
-            user_proto->set_ip_address(it->second.ip_address);
-            user_proto->set_status(it->second.status);
-            found = true;
+        set_nodelay(client_socket);
+        Connection* conn = connection_create(client_socket, ip_address, false);
+        uring_attach(reactor, conn);
+    } else if (cqe->res != -ECANCELED) {
+        log_error("accept: {}", strerror(-cqe->res));
+    }
+    if (!(cqe->flags & IORING_CQE_F_MORE)) {
+        reactor->ops--;
+        if (!reactor->quiescing) {
+            uring_arm_accept(reactor);
         }
     }
+}
 
-    if (found) {
-        response.set_status_code(chat::StatusCode::OK);
-        response.set_message("User info fetched successfully.");
-    } else {
-        response.set_status_code(chat::StatusCode::NOT_FOUND);
-        response.set_message("No users found or specific user not found.");
+// Left unread while quiescing, so the wakeup fires again once re-armed.
+void uring_woken(Reactor* reactor, io_uring_cqe* cqe) {
+    if (!reactor->quiescing) {
+        uint64_t count;
+        read(reactor->wakeup_fd, &count, sizeof(count));
+        drain_inbox(reactor);
+        pthread_mutex_lock(&reactor->flush_mutex);
+        reactor->send_list.insert(reactor->send_list.end(), reactor->flush_requests.begin(),
+                                  reactor->flush_requests.end());
+        reactor->flush_requests.clear();
+        pthread_mutex_unlock(&reactor->flush_mutex);
+    }
+    if (!(cqe->flags & IORING_CQE_F_MORE)) {
+        reactor->ops--;
+        if (!reactor->quiescing) {
+            uring_arm_wakeup(reactor);
+        }
     }
 }
 
-void handle_send_message(const chat::SendMessageRequest& request, chat::Response& response, const std::string& sender) {
-    if (request.recipient().empty()) {
-        // Broadcast message to all online users
-        chat::IncomingMessageResponse message;
-        message.set_sender(sender);
-        message.set_content(request.content());
-        message.set_type(chat::MessageType::BROADCAST);
-        
-        chat::Response broadcast_response;
-        broadcast_response.set_operation(chat::Operation::INCOMING_MESSAGE);
-        *broadcast_response.mutable_incoming_message() = message;
-
-        std::string response_str;
-        broadcast_response.SerializeToString(&response_str);
-
-        pthread_mutex_lock(&users_mutex);
-        for (const auto& user : users) {
-            if (user.second.status == chat::UserStatus::ONLINE) {
-                send(user.second.socket, response_str.c_str(), response_str.size(), 0);
+void uring_received(Reactor* reactor, Connection* conn, io_uring_cqe* cqe) {
+    if (cqe->flags & IORING_CQE_F_BUFFER) {
+        uint16_t id = uint16_t(cqe->flags >> IORING_CQE_BUFFER_SHIFT);
+        if (cqe->res > 0 && !conn->finishing) {
+            ThreadMetrics& metrics = thread_metrics();
+            metrics.read_calls.add(1);
+            metrics.bytes_in.add(cqe->res);
+            conn->inbound.append(reactor->ring->buffer(id), cqe->res);
+        }
+        reactor->ring->recycle(id);
+    }
+    if (!conn->finishing) {
+        if (cqe->res > 0) {
+            // While quiescing the input is only buffered, to be handed over.
+            if (!reactor->quiescing && !uring_serve(conn)) {
+                uring_close(conn);
             }
+        } else if (cqe->res != -ENOBUFS && cqe->res != -ECANCELED) {
+            uring_close(conn);  // EOF or a socket error.
         }
-        pthread_mutex_unlock(&users_mutex);
+    }
+    if (cqe->flags & IORING_CQE_F_MORE) {
+        return;
+    }
+    // Multishot receives also end when the buffers run out.
+    reactor->ops--;
+    if (!conn->finishing && !reactor->quiescing) {
+        uring_arm_recv(reactor, conn);
+    }
+    connection_unref(conn);
+}
 
-        response.set_status_code(chat::StatusCode::OK);
-        response.set_message("Message broadcasted successfully");
+void uring_sent(Reactor* reactor, Connection* conn, io_uring_cqe* cqe) {
+    reactor->ops--;
+    UringSend* send = conn->uring_send;
+    int sent = cqe->res;
+    bool again = false;
+    pthread_mutex_lock(&conn->out_mutex);
+    // A parked queue is still unpinned: what was not written goes out on
+    // the connection that resumes the session.
+    if ((!conn->closed || conn->parked) && !conn->overflowed) {
+        size_t frames_before = conn->outbound.size();
+        size_t bytes_before = conn->outbound.bytes();
+        conn->outbound.finish_write(sent > 0 ? sent : 0);
+        ThreadMetrics& metrics = thread_metrics();
+        metrics.write_calls.add(1);
+        metrics.frames_sent.add(frames_before - conn->outbound.size());
+        metrics.bytes_dequeued.add(bytes_before - conn->outbound.bytes());
+        metrics.bytes_out.add(bytes_before - conn->outbound.bytes());
+        if (conn->slow && conn->outbound.memory_bytes() <= outbound_low) {
+            conn->slow = false;
+        }
+        again = sent > 0 && !conn->outbound.empty() && !reactor->quiescing && !conn->closed;
+    }
+    // After a failed send want_write stays set: nothing more is written and
+    // the receive side closes the connection.
+    if (!again && (sent >= 0 || sent == -ECANCELED)) {
+        conn->want_write = false;
+    }
+    pthread_mutex_unlock(&conn->out_mutex);
+    for (int i = 0; i < send->count; i++) {
+        frame_unref(send->frames[i]);
+    }
+    send->count = 0;
+    if (sent < 0 && sent != -ECANCELED) {
+        shutdown(conn->socket, SHUT_RDWR);
+    }
+    if (again) {
+        reactor->send_list.push_back(conn);  // Keeps the reference.
     } else {
-        // Send direct message to a specific user
-        pthread_mutex_lock(&users_mutex);
-        auto it = users.find(request.recipient());
-        if (it != users.end() && it->second.status == chat::UserStatus::ONLINE) {
-            chat::IncomingMessageResponse message;
-            message.set_sender(sender);
-            message.set_content(request.content());
-            message.set_type(chat::MessageType::DIRECT);
-
-            chat::Response direct_response;
-            direct_response.set_operation(chat::Operation::INCOMING_MESSAGE);
-            *direct_response.mutable_incoming_message() = message;
-
-            std::string response_str;
-            direct_response.SerializeToString(&response_str);
+        connection_unref(conn);
+    }
+}
 
-            send(it->second.socket, response_str.c_str(), response_str.size(), 0);
+void uring_dispatch(Reactor* reactor, io_uring_cqe* cqe) {
+    uint64_t data = cqe->user_data;
+    switch (data & kUringOpMask) {
+    case kUringAccept:
+        uring_accepted(reactor, cqe);
+        break;
+    case kUringWakeup:
+        uring_woken(reactor, cqe);
+        break;
+    case kUringCancel:
+        break;
+    case kUringRecv:
+        uring_received(reactor, reinterpret_cast<Connection*>(data & ~kUringOpMask), cqe);
+        break;
+    case kUringSendOp:
+        uring_sent(reactor, reinterpret_cast<Connection*>(data & ~kUringOpMask), cqe);
+        break;
+    }
+}
 
-            response.set_status_code(chat::StatusCode::OK);
-            response.set_message("Message sent successfully");
-        } else {
-            response.set_status_code(chat::StatusCode::NOT_FOUND);
-            response.set_message("Recipient not found or offline");
+// Before parking for a handoff every operation is cancelled and waited
+// for, so no buffer is left with the kernel and every queue is at rest.
+// Sends queued meanwhile stay listed for after the resume.
+void uring_quiesce(Reactor* reactor) {
+    reactor->quiescing = true;
+    bool cancelling = false;
+    while (reactor->ops > 0 || cancelling) {
+        if (!cancelling && reactor->ops > 0) {
+            io_uring_sqe* sqe = uring_sqe(reactor);
+            reactor->ops--;  // The cancellation itself is not waited for as an operation.
+            sqe->opcode = IORING_OP_ASYNC_CANCEL;
+            sqe->fd = -1;
+            sqe->cancel_flags = IORING_ASYNC_CANCEL_ANY;
+            sqe->user_data = kUringCancel;
+            cancelling = true;
+        }
+        if (!reactor->ring->submit(true)) {
+            log_error("io_uring_enter: {}", strerror(errno));
+            return;
         }
-        pthread_mutex_unlock(&users_mutex);
+        reactor->ring->reap([reactor, &cancelling](io_uring_cqe* cqe) {
+            if (cqe->user_data == kUringCancel) {
+                cancelling = false;  // Whatever raced with it is cancelled by the next one.
+            } else {
+                uring_dispatch(reactor, cqe);
+            }
+        });
     }
 }
 
-
-void handle_client(int socket, const std::string& client_ip) {
-    char buffer[1024];
-
+void run_uring_loop(Reactor* reactor) {
+    current_reactor = reactor;
+    pin_to_cpu(reactor->cpu);
+    Uring ring;
+    if (!ring.init(kUringEntries, kUringCompletions) || !ring.setup_buffers(kUringBufferGroup, kUringBuffers, kUringBufferSize)) {
+        log_error("io_uring setup: {}", strerror(errno));
+        return;
+    }
+    reactor->ring = &ring;
+    uring_start(reactor);
     while (true) {
-        int bytes_read = read(socket, buffer, sizeof(buffer));
-        if (bytes_read <= 0) {
-            handle_client_disconnection(socket);
-            return;
+        if (parking.requested.load(std::memory_order_acquire)) {
+            uring_quiesce(reactor);
+            parking_point();
+            uring_start(reactor);
+        }
+        uring_submit_sends(reactor);
+        if (!ring.submit(true)) {
+            log_error("io_uring_enter: {}", strerror(errno));
+            break;
         }
+        ring.reap([reactor](io_uring_cqe* cqe) { uring_dispatch(reactor, cqe); });
+    }
+    reactor->ring = nullptr;
+}
 
-        chat::Request request;
-        request.ParseFromArray(buffer, bytes_read);
+void* uring_thread(void* reactor) {
+    run_uring_loop(static_cast<Reactor*>(reactor));
+    return NULL;
+}
 
-        std::string username = "";
+// Every listening socket; handed over on a hot restart. The first one is
+// opened by main() (or taken over), reactors mode opens the rest.
+std::vector<int> listeners;
 
-        pthread_mutex_lock(&users_mutex);
-        for (auto& user : users) {
-            if (user.second.socket == socket && chat::Operation::UPDATE_STATUS != request.operation()) {
-                username = user.second.username;
-                std::cout << "The user: " << user.second.username << " will be updated to ONLINE" << std::endl;
-                user.second.last_activity = std::chrono::system_clock::now();
-                user.second.status = chat::UserStatus::ONLINE;
-                break;
-            }
-        }
-        pthread_mutex_unlock(&users_mutex);
+// Connections taken over from the previous process (see take_over()); the
+// run_*_server() functions start serving them.
+std::vector<Connection*> restored_connections;
 
-        chat::Response response;
-        response.Clear();
-        response.set_operation(request.operation());  
-        response.set_status_code(chat::StatusCode::BAD_REQUEST);
+void run_epoll_server() {
+    raise_fd_limit();
+    Reactor* reactor = create_reactor(listeners[0], -1);
+    if (reactor == nullptr) {
+        return;
+    }
+    for (Connection* conn : restored_connections) {
+        watch_connection(reactor, conn);
+    }
+    run_reactor(reactor);
+}
 
-        switch (request.operation()) {
-            case chat::Operation::REGISTER_USER:
-                std::cout << "Handling register user " << username << std::endl;
-                handle_register_user(request.register_user(), response, socket, client_ip);
-                break;
-            case chat::Operation::UPDATE_STATUS:
-                std::cout << "Handling update status from: " << username << std::endl;
-                handle_update_status(request.update_status(), response);
-                break;
-            case chat::Operation::GET_USERS:
-                std::cout << "Handling list user(s) from: " << username << std::endl;
-                handle_get_users(request.get_users(), response.mutable_user_list(), response);
-                break;
-            case chat::Operation::SEND_MESSAGE:
-                std::cout << "Handling send message from: " << username << std::endl;
-                handle_send_message(request.send_message(), response, username);
-                break;
-            default:
-                response.set_status_code(chat::StatusCode::BAD_REQUEST);
-                response.set_message("Unknown operation");
+// One reactor per core, epoll or io_uring ones; the first one runs on the
+// main thread.
+void run_reactor_server(int port, int count, bool uring) {
+    raise_fd_limit();
+    int cpus = std::max(1, int(sysconf(_SC_NPROCESSORS_ONLN)));
+    std::vector<Reactor*> reactors;
+    for (int i = 0; i < count; i++) {
+        if (i == int(listeners.size())) {
+            int listen_fd = open_listener(port, true);
+            if (listen_fd < 0) {
+                return;
+            }
+            listeners.push_back(listen_fd);
         }
-
-        std::string response_str;
-        response.SerializeToString(&response_str);
-        send(socket, response_str.c_str(), response_str.size(), 0);
+        Reactor* reactor = create_reactor(listeners[i], i % cpus, uring);
+        if (reactor == nullptr) {
+            return;
+        }
+        reactors.push_back(reactor);
+    }
+    for (size_t i = 0; i < restored_connections.size(); i++) {
+        if (uring) {
+            restored_connections[i]->reactor = reactors[i % count];  // Adopted by uring_start().
+        } else {
+            watch_connection(reactors[i % count], restored_connections[i]);
+        }
+    }
+    for (int i = 1; i < count; i++) {
+        parking_enter();
+        pthread_t thread_id;
+        pthread_create(&thread_id, NULL, uring ? uring_thread : reactor_thread, reactors[i]);
+        pthread_detach(thread_id);
+    }
+    if (uring) {
+        run_uring_loop(reactors[0]);
+    } else {
+        run_reactor(reactors[0]);
     }
-
-    close(socket);
 }
 
-
 // void* handle_client_wrapper(void* client_socket) {
 //     int socket = *(int*)client_socket;
 //     free(client_socket);
@@ -245,62 +3686,773 @@ void* handle_client_wrapper(void* client_socket_info) {
     char ip_address[INET_ADDRSTRLEN];
     inet_ntop(AF_INET, &(address.sin_addr), ip_address, INET_ADDRSTRLEN);
 
-    free(client_socket_info);
+    delete client_info;
     handle_client(socket, std::string(ip_address));
+    parking_leave();
+    return NULL;
+}
+
+void* restored_client_thread(void* conn) {
+    serve_client(static_cast<Connection*>(conn));
+    parking_leave();
+    return NULL;
+}
+
+// Drives the timer wheel; only timers that come due are visited.
+void* timer_monitor(void*) {
+    while (true) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(timer_tick_ms));
+        parking_point();
+        timer_wheel->advance();
+    }
     return NULL;
 }
 
-void* inactivity_monitor(void*) {
+// Interrupts the accept loop of thread mode so it parks.
+std::atomic<int> accept_wakeup_fd(-1);
+
+void run_thread_server() {
+    int server_fd = listeners[0];
+    accept_wakeup_fd = eventfd(0, EFD_NONBLOCK);
+    for (Connection* conn : restored_connections) {
+        parking_enter();
+        pthread_t thread_id;
+        pthread_create(&thread_id, NULL, restored_client_thread, conn);
+        pthread_detach(thread_id);
+    }
+
     while (true) {
-        std::this_thread::sleep_for(std::chrono::seconds(1));
-        auto now = std::chrono::system_clock::now();
+        parking_point();
+        pollfd fds[2];
+        fds[0].fd = server_fd;
+        fds[0].events = POLLIN;
+        fds[1].fd = accept_wakeup_fd;
+        fds[1].events = POLLIN;
+        if (poll(fds, 2, -1) < 0) {
+            continue;
+        }
+        if (fds[1].revents & POLLIN) {
+            uint64_t count;
+            read(accept_wakeup_fd, &count, sizeof(count));
+        }
+        if (!(fds[0].revents & POLLIN)) {
+            continue;
+        }
+
+        auto client_info = new std::pair<int, sockaddr_in>();
+        socklen_t client_addrlen = sizeof(client_info->second);
+        client_info->first = accept(server_fd, (sockaddr*)&client_info->second, &client_addrlen);
+        if (client_info->first < 0) {
+            delete client_info;
+            continue;
+        }
+
+        parking_enter();
+        pthread_t thread_id;
+        pthread_create(&thread_id, NULL, handle_client_wrapper, (void*)client_info);
+        pthread_detach(thread_id);
+    }
+}
+
+// Hot restart, old side. The handoff thread waits for a takeover request
+// on the --handoff socket, parks everyone, and sends the listeners, every
+// open connection and the session registry to the new process. Once that
+// process has confirmed, this one exits without closing anything the
+// clients could notice; until then, any failure just resumes serving.
+std::string server_mode;
+std::string handoff_path;
+const int kParkTimeoutMs = 5000;
+
+bool park_all() {
+    pthread_mutex_lock(&parking.mutex);
+    parking.requested.store(true, std::memory_order_release);
+    for (Reactor* reactor : all_reactors) {
+        wake_reactor(reactor);
+    }
+    pthread_mutex_unlock(&parking.mutex);
+    uint64_t one = 1;
+    pthread_mutex_lock(&open_connections_mutex);
+    for (Connection* conn : open_connections) {
+        if (conn->wakeup_fd >= 0) {
+            write(conn->wakeup_fd, &one, sizeof(one));
+        }
+    }
+    pthread_mutex_unlock(&open_connections_mutex);
+    if (accept_wakeup_fd >= 0) {
+        write(accept_wakeup_fd, &one, sizeof(one));
+    }
+    if (worker_pool != nullptr) {
+        worker_pool->interrupt();
+    }
+
+    timespec deadline;
+    clock_gettime(CLOCK_REALTIME, &deadline);
+    deadline.tv_sec += kParkTimeoutMs / 1000;
+    pthread_mutex_lock(&parking.mutex);
+    int result = 0;
+    while (parking.parked < parking.threads && result != ETIMEDOUT) {
+        result = pthread_cond_timedwait(&parking.changed, &parking.mutex, &deadline);
+    }
+    bool parked = parking.parked == parking.threads;
+    pthread_mutex_unlock(&parking.mutex);
+    return parked;
+}
+
+void unpark_all() {
+    if (worker_pool != nullptr) {
+        worker_pool->resume();
+    }
+    pthread_mutex_lock(&parking.mutex);
+    parking.requested.store(false, std::memory_order_release);
+    pthread_cond_broadcast(&parking.changed);
+    pthread_mutex_unlock(&parking.mutex);
+}
 
-        pthread_mutex_lock(&users_mutex);
-        for (auto& user : users) {
-            auto duration = std::chrono::duration_cast<std::chrono::seconds>(now - user.second.last_activity).count();
-            if (duration >= inactivity_timeout && user.second.status != chat::UserStatus::OFFLINE) {
-                user.second.status = chat::UserStatus::OFFLINE;
-                std::cout << "User " << user.second.username << " set to OFFLINE due to inactivity" << std::endl;
+// Everything but the socket itself. Every other thread is parked.
+void snapshot_connection(Connection* conn, HandoffConnection* record) {
+    record->ip_address = conn->ip_address;
+    record->username.clear();
+    record->slot = kNoSlot;
+    record->status = chat::UserStatus::OFFLINE;
+    record->last_activity_ms = 0;
+    record->resume_key[0] = record->resume_key[1] = 0;
+    record->detached_until_ms = 0;
+    if (conn->user_slot != kNoSlot) {
+        const SessionState& state = sessions.state(conn->user_slot);
+        const ResumeKey& key = sessions.resume_key(conn->user_slot);
+        record->username = conn->username;
+        record->slot = conn->user_slot;
+        record->status = state.status;
+        record->last_activity_ms = state.last_activity_ms;
+        record->resume_key[0] = key.words[0];
+        record->resume_key[1] = key.words[1];
+        // One hold_frame() gave up on goes over already expired.
+        int64_t deadline_ms = conn->held_lost ? SessionStore::now_ms() : conn->resume_deadline_ms;
+        record->detached_until_ms = state.detached ? deadline_ms : 0;
+    }
+    record->batched_delivery = conn->batched_delivery;
+    record->compress = conn->compress;
+    record->presence_subscribed = conn->presence_subscribed;
+    record->slow = conn->slow;
+    record->rooms = conn->rooms;
+    record->inbound.assign(conn->inbound.data(), conn->inbound.buffered());
+    record->outbound.clear();
+    bool parked = conn->parked;
+    conn->outbound.for_each([record, parked](const Frame* frame, size_t offset) {
+        // The rest of a partly written frame has no header of its own: it can
+        // neither be dropped nor have frames packed into it. A parked queue
+        // goes out whole, on whichever connection resumes the session.
+        bool started = offset > 0 && !parked;
+        std::string bytes = frame->bytes;
+        if (frame->spool != nullptr) {
+            read_spooled(frame, &bytes);  // File data goes over in the record like the rest.
+        }
+        record->outbound.push_back({uint8_t(started ? FRAME_RESPONSE : frame->kind), !started && frame->packable,
+                                    bytes.substr(offset)});
+    });
+}
+
+// Runs on the handoff thread; returns only if the handoff did not happen.
+void hand_off(int peer) {
+    HandoffMessage type;
+    std::string payload;
+    std::vector<int> fds;
+    if (!handoff_receive(peer, &type, &payload, &fds) || type != HANDOFF_REQUEST) {
+        log_warn("Ignoring a malformed handoff request");
+        for (int fd : fds) {
+            close(fd);
+        }
+        return;
+    }
+    log_info("Handing off to a new server process");
+    auto started = std::chrono::steady_clock::now();
+    if (!park_all()) {
+        log_warn("Handoff aborted: the I/O threads did not stop in time");
+        unpark_all();
+        return;
+    }
+
+    // Whatever is still in flight goes into the queues that are handed
+    // over: requests an I/O thread queued after the workers had parked (run
+    // here, so their responses join the queues), the presence changes of the
+    // current interval (the timer thread is parked, so flushing them here is
+    // safe) and the deliveries waiting in reactor inboxes.
+    if (worker_pool != nullptr) {
+        WorkerJob job;
+        while (worker_pool->take_any(&job)) {
+            job.run(job.arg);
+        }
+    }
+    flush_presence();
+    cancel_all_transfers();
+    cancel_queued_files();
+    for (Reactor* reactor : all_reactors) {
+        RoutedFrame routed;
+        while (reactor->inbox.pop(&routed)) {
+            enqueue_frame(routed.conn, routed.frame, false);
+            frame_unref(routed.frame);
+            connection_unref(routed.conn);
+        }
+        reactor->wake_pending.store(false);
+    }
+
+    HandoffState state;
+    state.mode = server_mode;
+    state.presence_version = presence_hub.flushed_version;
+    state.generations = sessions.generations();
+    if (offline_store != nullptr) {
+        offline_store->sync();
+        state.known_users = offline_store->known_users();
+    }
+    payload.clear();
+    encode_handoff_state(state, &payload);
+    bool sent = handoff_send(peer, HANDOFF_STATE, payload, listeners);
+
+    pthread_mutex_lock(&open_connections_mutex);
+    std::vector<Connection*> conns(open_connections.begin(), open_connections.end());
+    pthread_mutex_unlock(&open_connections_mutex);
+    std::vector<HandoffConnection> records;
+    for (size_t first = 0; sent && first < conns.size(); first += kHandoffMaxFds) {
+        size_t count = std::min(kHandoffMaxFds, conns.size() - first);
+        records.resize(count);
+        fds.clear();
+        for (size_t i = 0; i < count; i++) {
+            snapshot_connection(conns[first + i], &records[i]);
+            fds.push_back(conns[first + i]->socket);
+        }
+        payload.clear();
+        encode_handoff_connections(records, &payload);
+        sent = handoff_send(peer, HANDOFF_CONNECTIONS, payload, fds);
+    }
+    // Detached sessions are not open connections; their slots lead to them.
+    std::vector<Connection*> detached;
+    sessions.scan([&detached](uint32_t slot, const SessionState& state) {
+        if (state.detached) {
+            detached.push_back(sessions.connection(slot));
+        }
+    });
+    for (size_t first = 0; sent && first < detached.size(); first += kHandoffMaxFds) {
+        size_t count = std::min(kHandoffMaxFds, detached.size() - first);
+        records.resize(count);
+        for (size_t i = 0; i < count; i++) {
+            snapshot_connection(detached[first + i], &records[i]);
+        }
+        payload.clear();
+        encode_handoff_connections(records, &payload);
+        sent = handoff_send(peer, HANDOFF_DETACHED, payload, std::vector<int>());
+    }
+    sent = sent && handoff_send(peer, HANDOFF_DONE, std::string(), std::vector<int>());
+    if (!sent || !handoff_receive(peer, &type, &payload, &fds) || type != HANDOFF_ACCEPTED) {
+        log_warn("Handoff failed; carrying on serving");
+        // Queued output was held back for the handoff.
+        for (Connection* conn : conns) {
+            flush_connection(conn);
+        }
+        unpark_all();
+        return;
+    }
+
+    uint64_t elapsed_ms = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - started).count();
+    log_info("Handed off {} connections and {} sessions ({} detached) in {} ms; exiting", conns.size(), sessions.live(),
+             detached.size(), elapsed_ms);
+    log_shutdown();
+    _exit(0);
+}
+
+void* handoff_thread(void* listen_fd) {
+    int fd = *static_cast<int*>(listen_fd);
+    delete static_cast<int*>(listen_fd);
+    while (true) {
+        int peer = handoff_accept(fd);
+        if (peer < 0) {
+            if (errno != EINTR && errno != ECONNABORTED) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(100));
             }
+            continue;
         }
-        pthread_mutex_unlock(&users_mutex);
+        hand_off(peer);
+        close(peer);
     }
     return NULL;
 }
 
+// Hot restart, new side. Nothing but the main thread runs yet, so nothing
+// here needs locks.
+void restore_session(Connection* conn, const HandoffConnection& record) {
+    UserShard& shard = shard_for(record.username);
+    auto inserted = shard.slots.emplace(record.username, record.slot);
+    if (!inserted.second) {
+        log_warn("Handoff: user {} appears twice; the second connection stays unregistered", record.username);
+        sessions.release(record.slot);
+        return;
+    }
+    const std::string& name = inserted.first->first;
+    shard.name_bytes += name_heap_bytes(name);
+    in_addr address = {};
+    inet_pton(AF_INET, conn->ip_address.c_str(), &address);
+    chat::UserStatus status = chat::UserStatus_IsValid(record.status) ? static_cast<chat::UserStatus>(record.status)
+                                                                       : chat::UserStatus::ONLINE;
+    sessions.fill(record.slot, &name, conn->socket, address.s_addr, connection_ref(conn), status);
+    sessions.state(record.slot).last_activity_ms = record.last_activity_ms;
+    sessions.resume_key(record.slot) = {{record.resume_key[0], record.resume_key[1]}};
+    UserId id = sessions.id(record.slot);
+    presence_hub.roster[name] = {status, id};
+    conn->username = name;
+    conn->user_slot = record.slot;
+    conn->user_id = id;
+    if (status != chat::UserStatus::OFFLINE) {
+        int64_t left_ms = int64_t(inactivity_timeout) * 1000 - (SessionStore::now_ms() - record.last_activity_ms);
+        arm_idle_timer(conn, uint64_t(std::max<int64_t>(left_ms, 1)));
+    }
+}
+
+Connection* restore_connection(int socket, const HandoffConnection& record, bool with_wakeup) {
+    Connection* conn = connection_create(socket, record.ip_address, with_wakeup);
+    conn->batched_delivery = record.batched_delivery;
+    conn->compress = record.compress && compress_threshold > 0;
+    conn->slow = record.slow;
+    if (!record.inbound.empty()) {
+        conn->inbound.append(record.inbound.data(), record.inbound.size());
+    }
+    for (const HandoffFrame& queued : record.outbound) {
+        Frame* frame = FramePool::local().acquire();
+        frame->refs.store(1, std::memory_order_relaxed);
+        frame->packable = queued.packable;
+        frame->kind = queued.kind <= FRAME_BROADCAST ? static_cast<FrameKind>(queued.kind) : FRAME_RESPONSE;
+        frame->bytes = queued.bytes;
+        conn->outbound.push(frame);
+    }
+    ThreadMetrics& metrics = thread_metrics();
+    metrics.frames_queued.add(conn->outbound.size());
+    metrics.bytes_queued.add(conn->outbound.bytes());
+    conn->want_write = !conn->outbound.empty();  // Written once the I/O thread sees the socket writable.
+
+    if (!record.username.empty()) {
+        restore_session(conn, record);
+    }
+    for (const std::string& room : record.rooms) {
+        room_add_member(room, conn);
+    }
+    if (record.presence_subscribed) {
+        presence_hub.subscribers.push_back(connection_ref(conn));
+        conn->presence_subscribed = true;
+        metrics.presence_subscribed.add(1);
+    }
+    return conn;
+}
+
+// A detached session comes back parked, as detach_session() left it, for
+// what is left of its grace period.
+void restore_detached(const HandoffConnection& record) {
+    Connection* conn = restore_connection(-1, record, false);
+    conn->closed = true;
+    conn->parked = true;
+    conn->want_write = false;
+    open_connections.erase(conn);
+    thread_metrics().connections_closed.add(1);
+    if (conn->user_slot == kNoSlot) {  // restore_session() turned it down.
+        leave_rooms_and_presence(conn);
+        drop_parked_output(conn);
+    } else {
+        sessions.state(conn->user_slot).detached = 1;
+        conn->resume_deadline_ms = record.detached_until_ms;
+        int64_t left_ms = record.detached_until_ms - SessionStore::now_ms();
+        connection_ref(conn);
+        timer_wheel->schedule(&conn->resume_timer, uint64_t(std::max<int64_t>(left_ms, 1)));
+        thread_metrics().sessions_detached.add(1);
+    }
+    connection_unref(conn);  // The session, the rooms and the timers hold theirs.
+}
+
+// Takes over from the server serving handoffs at `path`: its listeners end
+// up in `listeners`, its connections in `restored_connections`. The old
+// server stays in charge until confirm_takeover(); returns the connection to
+// it, or -1 if the takeover already failed.
+int take_over(const std::string& path, std::string* mode, std::vector<std::string>* known_users) {
+    raise_fd_limit();  // Every client socket arrives here at once.
+    int peer = handoff_connect(path);
+    if (peer < 0) {
+        return -1;
+    }
+    HandoffMessage type;
+    std::string payload;
+    std::vector<int> fds;
+    HandoffState state;
+    bool ok = handoff_send(peer, HANDOFF_REQUEST, std::string(), std::vector<int>()) &&
+              handoff_receive(peer, &type, &payload, &fds);
+    if (ok) {
+        listeners = fds;
+        ok = type == HANDOFF_STATE && decode_handoff_state(payload, &state) && !listeners.empty() &&
+             (state.mode == "threads" || state.mode == "epoll" || state.mode == "reactors" || state.mode == "uring");
+    }
+
+    std::vector<HandoffConnection> records;
+    std::vector<HandoffConnection> detached;
+    std::vector<int> sockets;
+    std::vector<HandoffConnection> batch;
+    while (ok) {
+        ok = handoff_receive(peer, &type, &payload, &fds);
+        if (ok && type == HANDOFF_DONE) {
+            break;
+        }
+        sockets.insert(sockets.end(), fds.begin(), fds.end());
+        if (ok && type == HANDOFF_DETACHED) {
+            ok = fds.empty() && decode_handoff_connections(payload, &batch);
+            for (HandoffConnection& record : batch) {
+                if (!record.username.empty()) {
+                    detached.push_back(std::move(record));
+                }
+            }
+            continue;
+        }
+        ok = ok && type == HANDOFF_CONNECTIONS && decode_handoff_connections(payload, &batch) && batch.size() == fds.size();
+        for (HandoffConnection& record : batch) {
+            records.push_back(std::move(record));
+        }
+    }
+    if (!ok) {
+        log_error("Takeover from {} failed", path);
+        for (int fd : listeners) {
+            close(fd);
+        }
+        for (int fd : sockets) {
+            close(fd);
+        }
+        listeners.clear();
+        close(peer);
+        return -1;
+    }
+
+    std::vector<bool> used(state.generations.size(), false);
+    for (std::vector<HandoffConnection>* list : {&records, &detached}) {
+        for (HandoffConnection& record : *list) {
+            if (record.username.empty()) {
+                continue;
+            }
+            if (record.slot >= used.size() || used[record.slot] || state.generations[record.slot] == 0) {
+                log_warn("Handoff: user {} has no valid session slot; the session is dropped", record.username);
+                record.username.clear();
+                continue;
+            }
+            used[record.slot] = true;
+        }
+    }
+    sessions.restore(state.generations, used);
+    presence_hub.version = state.presence_version;
+    presence_hub.flushed_version = state.presence_version;
+    for (size_t i = 0; i < records.size(); i++) {
+        Connection* conn = restore_connection(sockets[i], records[i], state.mode == "threads");
+        if (state.mode == "uring") {
+            conn->want_write = true;  // Nobody writes until an io_uring loop adopts it.
+        }
+        restored_connections.push_back(conn);
+    }
+    for (const HandoffConnection& record : detached) {
+        if (!record.username.empty()) {
+            restore_detached(record);
+        }
+    }
+    *mode = state.mode;
+    *known_users = std::move(state.known_users);
+    log_info("Received {} connections and {} sessions ({} detached)", restored_connections.size(), sessions.live(),
+             detached.size());
+    return peer;
+}
+
+// Lets the old server exit. Whatever can still fail has to be set up before
+// this: afterwards a failure would drop every client it handed over.
+bool confirm_takeover(int peer, const std::string& path) {
+    // Until this arrives the old server may still give up and resume, so
+    // nothing may have been written to the clients yet.
+    bool ok = handoff_send(peer, HANDOFF_ACCEPTED, std::string(), std::vector<int>());
+    close(peer);
+    if (!ok) {
+        log_error("Takeover from {} failed: the old server did not take the confirmation", path);
+        return false;
+    }
+    log_info("Took over from {}", path);
+    return true;
+}
+
+void print_usage(const char* program) {
+    std::cerr << "Usage: " << program << " <port> [options]\n"
+              << "  --mode <model>              I/O model: threads, epoll, reactors or uring (default: threads)\n"
+              << "  --reactors <n>              Event loops in reactors and uring modes, one per core (default: one per CPU)\n"
+              << "  --workers <n|auto>          Run requests on a pool of <n> worker threads (auto: one per CPU) instead of\n"
+              << "                              the I/O threads; 0 disables (default: 0)\n"
+              << "  --inactivity-timeout <s>    Seconds before an idle user is set OFFLINE (default: 30)\n"
+              << "  --resume-grace <s>          Seconds a session outlives its dropped connection, waiting for a RESUME;\n"
+              << "                              0 ends it right away (default: 30)\n"
+              << "  --timer-tick <ms>           Timer wheel resolution (default: 100)\n"
+              << "  --log-level <level>         debug|info|warn|error|off (default: info)\n"
+              << "  --log-buffer <kb>           Per-thread log ring size (default: 64)\n"
+              << "  --alloc-report <s>          Log request-path heap allocations every <s> seconds (default: off)\n"
+              << "  --stats-file <path>         Periodically write the server metrics to <path> (default: off)\n"
+              << "  --stats-interval <s>        Seconds between --stats-file dumps (default: 10)\n"
+              << "  --offline-dir <path>        Queue messages for absent users under <path>; \"\" disables (default: offline_queue)\n"
+              << "  --offline-segment <mb>      Size of each offline queue log segment (default: 16)\n"
+              << "  --outbound-high <kb>        Output queued for a client before it counts as slow (default: 4096)\n"
+              << "  --outbound-low <kb>         Output a slow client must drain down to (default: 1024)\n"
+              << "  --slow-policy <policy>      drop-oldest|drop-broadcasts|disconnect (default: drop-broadcasts)\n"
+              << "  --compress-threshold <b>    Compress frames of at least <b> bytes for clients that accept it; 0 disables (default: 1024)\n"
+              << "  --compress-level <1-9>      zlib compression level (default: 1)\n"
+              << "  --spool-dir <path>          Where file data waits for recipients that are behind (default: /tmp)\n"
+              << "  --spool-after <kb>          Output queued for a recipient before its file data is spooled (default: 256)\n"
+              << "  --presence-interval <ms>    Presence changes are coalesced and pushed to subscribers this often (default: 250)\n"
+              << "  --handoff <path>            Hand the server over to a new process that asks on this Unix socket (default: off)\n"
+              << "  --takeover <path>           Take over the connections of the server listening for handoffs at <path>,\n"
+              << "                              then accept handoffs there too (unless --handoff says otherwise)" << std::endl;
+}
+
 int main(int argc, char const* argv[]) {
-    if (argc != 2) {
-        std::cerr << "Usage: " << argv[0] << " <port>" << std::endl;
+    if (argc < 2 || argc % 2 != 0) {
+        print_usage(argv[0]);
         return -1;
     }
 
-    int port = std::stoi(argv[1]);
-    int server_fd = socket(AF_INET, SOCK_STREAM, 0);
+    int port = 0;
+    try {
+        port = std::stoi(argv[1]);
+    } catch (const std::exception&) {
+        std::cerr << "Invalid port: " << argv[1] << std::endl;
+        print_usage(argv[0]);
+        return -1;
+    }
+    std::string mode = "threads";
+    int reactor_count = 0;
+    int worker_count = 0;
+    std::string takeover_path;
+    LogLevel log_level = LOG_INFO;
+    size_t log_buffer_kb = 64;
+    for (int i = 2; i + 1 < argc; i += 2) {
+        std::string option = argv[i];
+        std::string value = argv[i + 1];
+        try {
+            if (option == "--mode") {
+                mode = value;
+            } else if (option == "--reactors") {
+                reactor_count = std::stoi(value);
+            } else if (option == "--workers") {
+                worker_count = value == "auto" ? std::max(1, int(sysconf(_SC_NPROCESSORS_ONLN))) : std::stoi(value);
+            } else if (option == "--inactivity-timeout") {
+                inactivity_timeout = std::stoi(value);
+            } else if (option == "--resume-grace") {
+                resume_grace = std::stoi(value);
+            } else if (option == "--timer-tick") {
+                timer_tick_ms = std::stoi(value);
+            } else if (option == "--log-level") {
+                if (!log_parse_level(value, &log_level)) {
+                    std::cerr << "Unknown log level: " << value << std::endl;
+                    return -1;
+                }
+            } else if (option == "--log-buffer") {
+                log_buffer_kb = std::stoul(value);
+            } else if (option == "--alloc-report") {
+                alloc_report_interval = std::stoi(value);
+            } else if (option == "--stats-file") {
+                stats_file = value;
+            } else if (option == "--stats-interval") {
+                stats_interval = std::stoi(value);
+            } else if (option == "--offline-dir") {
+                offline_dir = value;
+            } else if (option == "--offline-segment") {
+                offline_segment_mb = std::stoul(value);
+            } else if (option == "--outbound-high") {
+                outbound_high = std::stoul(value) * 1024;
+            } else if (option == "--outbound-low") {
+                outbound_low = std::stoul(value) * 1024;
+            } else if (option == "--compress-threshold") {
+                compress_threshold = std::stoul(value);
+            } else if (option == "--compress-level") {
+                compress_level = std::stoi(value);
+            } else if (option == "--spool-dir") {
+                spool_dir = value;
+            } else if (option == "--spool-after") {
+                spool_after = std::stoul(value) * 1024;
+            } else if (option == "--presence-interval") {
+                presence_interval_ms = std::stoi(value);
+            } else if (option == "--handoff") {
+                handoff_path = value;
+            } else if (option == "--takeover") {
+                takeover_path = value;
+            } else if (option == "--slow-policy") {
+                if (!parse_slow_policy(value, &slow_policy)) {
+                    std::cerr << "Unknown slow consumer policy: " << value << std::endl;
+                    return -1;
+                }
+            } else {
+                std::cerr << "Unknown option: " << option << std::endl;
+                print_usage(argv[0]);
+                return -1;
+            }
+        } catch (const std::exception&) {
+            // std::stoi() and std::stoul() throw on a value that is not a number.
+            std::cerr << "Invalid value for " << option << ": " << value << std::endl;
+            print_usage(argv[0]);
+            return -1;
+        }
+    }
+    if (mode != "threads" && mode != "epoll" && mode != "reactors" && mode != "uring") {
+        std::cerr << "Unknown mode: " << mode << std::endl;
+        return -1;
+    }
+    if (mode == "uring") {
+        // Multishot receives into a buffer ring need Linux 6.0.
+        Uring probe;
+        if (!probe.init(8, 16) || !probe.setup_buffers(kUringBufferGroup, 1, 64)) {
+            std::cerr << "io_uring is not available: " << strerror(errno) << std::endl;
+            return -1;
+        }
+    }
+    if (inactivity_timeout <= 0 || timer_tick_ms <= 0 || stats_interval <= 0 || presence_interval_ms <= 0 ||
+        resume_grace < 0) {
+        std::cerr << "Timeouts must be positive" << std::endl;
+        return -1;
+    }
+    if (reactor_count < 0 || worker_count < 0) {
+        std::cerr << "Reactor and worker counts must not be negative" << std::endl;
+        return -1;
+    }
+    if (reactor_count == 0) {
+        reactor_count = std::max(1, int(sysconf(_SC_NPROCESSORS_ONLN)));
+    }
+    if (outbound_high == 0 || outbound_low >= outbound_high) {
+        std::cerr << "The outbound low watermark must be below the high one" << std::endl;
+        return -1;
+    }
+    if (compress_level < 1 || compress_level > 9) {
+        std::cerr << "The compression level must be between 1 and 9" << std::endl;
+        return -1;
+    }
+    if (offline_segment_mb == 0) {
+        std::cerr << "Offline queue segments must not be empty" << std::endl;
+        return -1;
+    }
 
-    sockaddr_in address;
-    address.sin_family = AF_INET;
-    address.sin_addr.s_addr = INADDR_ANY;
-    address.sin_port = htons(port);
+    timer_wheel = new TimerWheel(timer_tick_ms);
+    log_start(log_level, log_buffer_kb * 1024);
+
+    // A takeover is only confirmed once the rest of the setup below has
+    // worked. Until then, failing just closes the handoff connection and the
+    // old server carries on.
+    std::vector<std::string> known_users;
+    int takeover_peer = -1;
+    if (!takeover_path.empty()) {
+        std::string old_mode;
+        takeover_peer = take_over(takeover_path, &old_mode, &known_users);
+        if (takeover_peer < 0) {
+            std::cerr << "Could not take over from " << takeover_path << std::endl;
+            log_shutdown();
+            return -1;
+        }
+        if (old_mode != mode) {
+            log_warn("Running in {} mode like the server taken over", old_mode);
+            mode = old_mode;
+        }
+        if (mode == "reactors" || mode == "uring") {
+            reactor_count = int(listeners.size());
+        }
+        if (handoff_path.empty()) {
+            handoff_path = takeover_path;
+        }
+    }
+    if (alloc_report_interval > 0) {
+        TimerWheel::init_node(&alloc_report_timer, on_alloc_report, nullptr);
+        timer_wheel->schedule(&alloc_report_timer, uint64_t(alloc_report_interval) * 1000);
+    }
+    // The old server synced its offline queue before handing over and is
+    // parked until confirmed, so the log can be opened while it waits.
+    if (!offline_dir.empty()) {
+        offline_store = new OfflineStore(offline_dir, offline_segment_mb * 1024 * 1024);
+        if (!offline_store->open()) {
+            std::cerr << "Cannot open the offline queue in " << offline_dir << std::endl;
+            log_shutdown();
+            return -1;
+        }
+        for (const std::string& name : known_users) {
+            offline_store->remember(name);
+        }
+    }
+    TimerWheel::init_node(&presence_timer, on_presence_timer, nullptr);
+    timer_wheel->schedule(&presence_timer, presence_interval_ms);
+    if (!stats_file.empty()) {
+        TimerWheel::init_node(&stats_timer, on_stats_timer, nullptr);
+        timer_wheel->schedule(&stats_timer, uint64_t(stats_interval) * 1000);
+    }
+
+    // Writing to a socket the peer already closed must not kill the server.
+    signal(SIGPIPE, SIG_IGN);
+
+    if (listeners.empty()) {
+        int server_fd = open_listener(port, mode == "reactors" || mode == "uring");
+        if (server_fd < 0) {
+            return -1;
+        }
+        listeners.push_back(server_fd);
+    }
+    server_mode = mode;
 
-    bind(server_fd, (sockaddr*)&address, sizeof(address));
-    listen(server_fd, 3);
+    int handoff_fd = -1;
+    if (!handoff_path.empty()) {
+        handoff_fd = handoff_listen(handoff_path);
+        if (handoff_fd < 0) {
+            std::cerr << "Cannot accept handoffs on " << handoff_path << std::endl;
+            log_shutdown();
+            return -1;
+        }
+    }
+    if (takeover_peer >= 0 && !confirm_takeover(takeover_peer, takeover_path)) {
+        std::cerr << "Could not take over from " << takeover_path << std::endl;
+        log_shutdown();
+        return -1;
+    }
+    // Only now, so a takeover that failed never replaced the old server's
+    // socket. From here on the clients are ours: failing to publish just
+    // leaves this server without handoffs.
+    if (handoff_fd >= 0 && !handoff_publish(handoff_path)) {
+        log_error("Handoffs are disabled: {} could not be published", handoff_path);
+        close(handoff_fd);
+        handoff_fd = -1;
+    }
 
+    parking_enter();  // The main thread goes on to run the accept loop or the first reactor.
+    parking_enter();  // The timer thread.
     pthread_t monitor_thread;
-    pthread_create(&monitor_thread, NULL, inactivity_monitor, NULL);
+    pthread_create(&monitor_thread, NULL, timer_monitor, NULL);
+    if (worker_count > 0) {
+        worker_pool = new WorkerPool(worker_count);
+        for (int i = 0; i < worker_count; i++) {
+            parking_enter();
+            pthread_t worker_thread_id;
+            pthread_create(&worker_thread_id, NULL, worker_thread, reinterpret_cast<void*>(intptr_t(i)));
+            pthread_detach(worker_thread_id);
+        }
+    }
 
-    printf("The server is listening on port: %d\n", port);
+    if (handoff_fd >= 0) {
+        pthread_t handoff_thread_id;
+        pthread_create(&handoff_thread_id, NULL, handoff_thread, new int(handoff_fd));
+        pthread_detach(handoff_thread_id);
+    }
 
-    while (true) {
-        sockaddr_in client_address;
-        socklen_t client_addrlen = sizeof(client_address);
-        int client_socket = accept(server_fd, (sockaddr*)&client_address, &client_addrlen);
+    if (worker_count > 0) {
+        printf("The server is listening on port: %d (%s mode, %d workers)\n", port, mode.c_str(), worker_count);
+    } else {
+        printf("The server is listening on port: %d (%s mode)\n", port, mode.c_str());
+    }
 
-        int* new_sock = new int;
-        *new_sock = client_socket;
-        pthread_t thread_id;
-        pthread_create(&thread_id, NULL, handle_client_wrapper, (void*)new_sock);
+    if (mode == "epoll") {
+        run_epoll_server();
+    } else if (mode == "reactors" || mode == "uring") {
+        run_reactor_server(port, reactor_count, mode == "uring");
+    } else {
+        run_thread_server();
     }
 
-    close(server_fd);
+    for (int listen_fd : listeners) {
+        close(listen_fd);
+    }
+    log_shutdown();
     return 0;
 }
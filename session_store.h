@@ -0,0 +1,291 @@
+#ifndef CHAT_SESSION_STORE_H
+#define CHAT_SESSION_STORE_H
+
+// Registered sessions in a dense ID space, stored as struct-of-arrays.
+//
+// A session occupies a slot; freed slots are reused before new ones, so the
+// slots in use stay packed at the front. What scans read (status, socket,
+// last activity) is packed into one 16-byte SessionState per slot, so a
+// broadcast walks contiguous memory; the rest (connection, address, name,
+// generation) lives in parallel arrays that only point lookups touch. Names
+// are not stored here at all: a slot points at the interned copy that keys
+// the server's name index.
+//
+// Slots are allocated in fixed-size chunks that never move, so a slot's
+// fields can be read through plain pointers while other slots are being
+// allocated. Each run of kBlockSlots consecutive slots shares a read-write
+// lock (one of kLocks), which guards their fields; scans take one lock per
+// block.
+//
+// A user ID is the slot plus the slot's generation, bumped every time the
+// slot is freed, so an ID kept by a client never reaches whoever gets the
+// slot next. 0 is never a valid ID.
+//
+// Each session also has a random resume key. A resume token is the ID plus
+// the key, so checking one is an index into the slots and a comparison, with
+// no table of tokens to keep or hash into.
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <pthread.h>
+
+struct Connection;
+
+typedef uint64_t UserId;
+const uint32_t kNoSlot = UINT32_MAX;
+
+struct SessionState {
+    int64_t last_activity_ms;  // SessionStore::now_ms() of the last request.
+    int32_t socket;
+    uint8_t status;  // chat::UserStatus.
+    uint8_t live;  // The slot holds a session.
+    uint8_t detached;  // Its connection dropped; the session waits for a resume.
+    uint8_t reserved;
+};
+
+struct ResumeKey {
+    uint64_t words[2];
+};
+
+// Checks a key in constant time: how much of a guess matched must not show.
+// ResumeKey has no operator== so that nothing compares keys any other way.
+inline bool resume_key_matches(const ResumeKey& key, const ResumeKey& guess) {
+    return ((key.words[0] ^ guess.words[0]) | (key.words[1] ^ guess.words[1])) == 0;
+}
+
+class SessionStore {
+public:
+    static const size_t kChunkSlots = 1024;
+    static const size_t kMaxChunks = 16 * 1024;  // 16M sessions.
+    static const size_t kBlockSlots = 64;
+    static const size_t kLocks = 256;
+
+    // Bytes each allocated slot costs, all arrays included.
+    static const size_t kSlotBytes = sizeof(SessionState) + sizeof(Connection*) + sizeof(const std::string*) +
+                                     sizeof(uint32_t) + sizeof(uint32_t) + sizeof(ResumeKey);
+
+    SessionStore() : slots_(0), live_(0), chunks_allocated_(0) {
+        pthread_mutex_init(&alloc_mutex_, NULL);
+        for (size_t i = 0; i < kLocks; i++) {
+            pthread_rwlock_init(&locks_[i], NULL);
+        }
+        for (size_t i = 0; i < kMaxChunks; i++) {
+            chunks_[i].store(nullptr, std::memory_order_relaxed);
+        }
+    }
+
+    ~SessionStore() {
+        for (size_t i = 0; i < kMaxChunks; i++) {
+            delete chunks_[i].load(std::memory_order_relaxed);
+        }
+    }
+
+    SessionStore(const SessionStore&) = delete;
+    SessionStore& operator=(const SessionStore&) = delete;
+
+    static int64_t now_ms() {
+        return std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now().time_since_epoch()).count();
+    }
+
+    // Takes a free slot, or kNoSlot once every chunk is in use. The slot
+    // is empty until fill().
+    uint32_t acquire() {
+        pthread_mutex_lock(&alloc_mutex_);
+        uint32_t slot = kNoSlot;
+        if (!free_.empty()) {
+            slot = free_.back();
+            free_.pop_back();
+        } else if (slots_ < kChunkSlots * kMaxChunks) {
+            slot = uint32_t(slots_);
+            size_t chunk = slot / kChunkSlots;
+            if (chunks_[chunk].load(std::memory_order_relaxed) == nullptr) {
+                chunks_[chunk].store(new Chunk(), std::memory_order_release);
+                chunks_allocated_++;
+            }
+            // Published after the chunk, so scans bounded by slots() only
+            // ever see allocated chunks.
+            slots_.store(slots_ + 1, std::memory_order_release);
+        }
+        pthread_mutex_unlock(&alloc_mutex_);
+        return slot;
+    }
+
+    // Called with the slot's lock held for writing.
+    void fill(uint32_t slot, const std::string* name, int socket, uint32_t ipv4, Connection* conn, uint8_t status) {
+        Chunk& chunk = chunk_for(slot);
+        size_t i = slot % kChunkSlots;
+        SessionState& state = chunk.states[i];
+        state.last_activity_ms = now_ms();
+        state.socket = socket;
+        state.status = status;
+        state.live = 1;
+        chunk.connections[i] = conn;
+        chunk.names[i] = name;
+        chunk.ipv4[i] = ipv4;
+        if (chunk.generations[i] == 0) {
+            chunk.generations[i] = 1;
+        }
+        live_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // Empties the slot and invalidates its ID; called with the slot's lock
+    // held for writing. Returns the connection reference it held.
+    Connection* clear(uint32_t slot) {
+        Chunk& chunk = chunk_for(slot);
+        size_t i = slot % kChunkSlots;
+        Connection* conn = chunk.connections[i];
+        memset(&chunk.states[i], 0, sizeof(SessionState));
+        chunk.connections[i] = nullptr;
+        chunk.names[i] = nullptr;
+        chunk.ipv4[i] = 0;
+        chunk.resume_keys[i] = ResumeKey();
+        chunk.generations[i] = chunk.generations[i] == UINT32_MAX ? 1 : chunk.generations[i] + 1;
+        live_.fetch_sub(1, std::memory_order_relaxed);
+        return conn;
+    }
+
+    // Attaches the session to another connection (a resume); called with the
+    // slot's lock held for writing. Takes over the reference `conn` holds
+    // and returns the one the slot held.
+    Connection* rebind(uint32_t slot, int socket, uint32_t ipv4, Connection* conn) {
+        Chunk& chunk = chunk_for(slot);
+        size_t i = slot % kChunkSlots;
+        Connection* previous = chunk.connections[i];
+        chunk.states[i].socket = socket;
+        chunk.states[i].detached = 0;
+        chunk.states[i].last_activity_ms = now_ms();
+        chunk.connections[i] = conn;
+        chunk.ipv4[i] = ipv4;
+        return previous;
+    }
+
+    // Hands a cleared slot back; call after releasing its lock.
+    void release(uint32_t slot) {
+        pthread_mutex_lock(&alloc_mutex_);
+        free_.push_back(slot);
+        pthread_mutex_unlock(&alloc_mutex_);
+    }
+
+    pthread_rwlock_t& lock_for(uint32_t slot) { return locks_[(slot / kBlockSlots) % kLocks]; }
+
+    // Field access; the slot's lock must be held.
+    SessionState& state(uint32_t slot) { return chunk_for(slot).states[slot % kChunkSlots]; }
+    Connection* connection(uint32_t slot) { return chunk_for(slot).connections[slot % kChunkSlots]; }
+    const std::string& name(uint32_t slot) { return *chunk_for(slot).names[slot % kChunkSlots]; }
+    uint32_t ipv4(uint32_t slot) { return chunk_for(slot).ipv4[slot % kChunkSlots]; }
+    ResumeKey& resume_key(uint32_t slot) { return chunk_for(slot).resume_keys[slot % kChunkSlots]; }
+    UserId id(uint32_t slot) { return (UserId(chunk_for(slot).generations[slot % kChunkSlots]) << 32) | slot; }
+
+    // The slot an ID refers to if it could be valid, else kNoSlot. Whether
+    // it still is has to be checked with matches() under the slot's lock.
+    uint32_t slot_of(UserId id) {
+        uint32_t slot = uint32_t(id);
+        return (id >> 32) != 0 && slot < slots() ? slot : kNoSlot;
+    }
+
+    bool matches(uint32_t slot, UserId id) { return state(slot).live && this->id(slot) == id; }
+
+    // Calls visit(slot, state) for every live session, taking each block's
+    // lock for reading while its slots are visited.
+    template <typename Visit>
+    void scan(Visit visit) {
+        size_t end = slots();
+        for (size_t first = 0; first < end; first += kBlockSlots) {
+            size_t last = std::min(end, first + kBlockSlots);
+            pthread_rwlock_t& lock = lock_for(uint32_t(first));
+            pthread_rwlock_rdlock(&lock);
+            const SessionState* states = &state(uint32_t(first));  // Blocks never straddle chunks.
+            for (size_t slot = first; slot < last; slot++) {
+                if (states[slot - first].live) {
+                    visit(uint32_t(slot), states[slot - first]);
+                }
+            }
+            pthread_rwlock_unlock(&lock);
+        }
+    }
+
+    // The generation of every slot handed out so far, for restore().
+    std::vector<uint32_t> generations() {
+        pthread_mutex_lock(&alloc_mutex_);
+        std::vector<uint32_t> result(slots_);
+        for (size_t slot = 0; slot < result.size(); slot++) {
+            result[slot] = chunk_for(uint32_t(slot)).generations[slot % kChunkSlots];
+        }
+        pthread_mutex_unlock(&alloc_mutex_);
+        return result;
+    }
+
+    // Recreates another store's slot layout (hot restart): the same slots
+    // with the same generations, so every ID handed out before keeps
+    // referring to the same session and stale ones stay stale. Slots flagged
+    // in `used` are left to be filled; the others become free. Only for an
+    // empty store that no other thread uses yet.
+    void restore(const std::vector<uint32_t>& generations, const std::vector<bool>& used) {
+        size_t count = std::min(generations.size(), kChunkSlots * kMaxChunks);
+        for (size_t slot = 0; slot < count; slot++) {
+            size_t chunk = slot / kChunkSlots;
+            if (chunks_[chunk].load(std::memory_order_relaxed) == nullptr) {
+                chunks_[chunk].store(new Chunk(), std::memory_order_release);
+                chunks_allocated_++;
+            }
+            chunk_for(uint32_t(slot)).generations[slot % kChunkSlots] = generations[slot];
+        }
+        free_.clear();
+        for (size_t slot = count; slot-- > 0;) {
+            if (!used[slot]) {
+                free_.push_back(uint32_t(slot));  // Lowest slots are reused first.
+            }
+        }
+        slots_.store(count, std::memory_order_release);
+    }
+
+    size_t slots() const { return slots_.load(std::memory_order_acquire); }
+    size_t live() const { return live_.load(std::memory_order_relaxed); }
+
+    // Memory held by the store: every allocated chunk plus the free list.
+    size_t memory_bytes() {
+        pthread_mutex_lock(&alloc_mutex_);
+        size_t bytes = chunks_allocated_ * sizeof(Chunk) + free_.capacity() * sizeof(uint32_t);
+        pthread_mutex_unlock(&alloc_mutex_);
+        return bytes;
+    }
+
+private:
+    static_assert(kChunkSlots % kBlockSlots == 0, "lock blocks must not straddle chunks");
+
+    struct Chunk {
+        Chunk() {
+            memset(states, 0, sizeof(states));
+            memset(connections, 0, sizeof(connections));
+            memset(names, 0, sizeof(names));
+            memset(ipv4, 0, sizeof(ipv4));
+            memset(resume_keys, 0, sizeof(resume_keys));
+            memset(generations, 0, sizeof(generations));
+        }
+
+        SessionState states[kChunkSlots];
+        Connection* connections[kChunkSlots];  // Each holds a reference.
+        const std::string* names[kChunkSlots];
+        uint32_t ipv4[kChunkSlots];  // Network byte order.
+        ResumeKey resume_keys[kChunkSlots];  // All zero if none was issued.
+        uint32_t generations[kChunkSlots];
+    };
+
+    Chunk& chunk_for(uint32_t slot) { return *chunks_[slot / kChunkSlots].load(std::memory_order_acquire); }
+
+    pthread_mutex_t alloc_mutex_;
+    std::atomic<size_t> slots_;  // Slots ever handed out; scans stop here.
+    std::atomic<size_t> live_;
+    size_t chunks_allocated_;
+    std::vector<uint32_t> free_;
+    std::atomic<Chunk*> chunks_[kMaxChunks];
+    pthread_rwlock_t locks_[kLocks];
+};
+
+#endif
@@ -0,0 +1,121 @@
+#ifndef CHAT_SNAPSHOT_CELL_H
+#define CHAT_SNAPSHOT_CELL_H
+
+// One immutable, versioned value that many threads read while one writer
+// at a time replaces it, RCU style: readers never lock and never
+// wait, a replacement never blocks a reader, and an old version is only
+// reused once the last reader that took it is done.
+//
+// Versions live in a pool that only grows (a few entries in practice: one
+// more than the replacements that overlap with a slow reader). The current
+// one is a single atomic word holding its index and a count of the readers
+// that took it. Taking it is one fetch_add on that word, so a reader can
+// never pick up an index and then see the entry recycled before it counted
+// itself. When a writer replaces the entry it moves that count into the
+// entry's own reference count, which the readers decrement when they are
+// done (split reference counting). An entry whose count has come back to
+// zero is free for the next replacement.
+
+#include <atomic>
+#include <cstdint>
+#include <utility>
+#include <pthread.h>
+
+template <typename Value>
+class SnapshotCell {
+public:
+    static const size_t kMaxEntries = 1 << 16;
+
+    struct Entry {
+        std::atomic<int64_t> refs;  // Negative while current: readers that let go before the count moved here.
+        uint64_t version;
+        Value value;
+    };
+
+    // A reader's hold on an entry; release() it once done with the value.
+    class Hold {
+    public:
+        Hold() : entry_(nullptr) {}
+        const Entry* operator->() const { return entry_; }
+        void release() {
+            if (entry_ != nullptr) {
+                entry_->refs.fetch_sub(1, std::memory_order_release);
+                entry_ = nullptr;
+            }
+        }
+
+    private:
+        friend class SnapshotCell;
+        Entry* entry_;
+    };
+
+    SnapshotCell() : entries_(new Entry*[kMaxEntries]), used_(1), current_(0) {
+        pthread_mutex_init(&write_mutex_, NULL);
+        entries_[0] = new Entry();
+        entries_[0]->refs.store(1, std::memory_order_relaxed);
+        entries_[0]->version = UINT64_MAX;  // Matches no real version.
+    }
+
+    ~SnapshotCell() {
+        for (size_t i = 0; i < used_; i++) {
+            delete entries_[i];
+        }
+        delete[] entries_;
+    }
+
+    SnapshotCell(const SnapshotCell&) = delete;
+    SnapshotCell& operator=(const SnapshotCell&) = delete;
+
+    Hold acquire() {
+        uint64_t word = current_.fetch_add(1, std::memory_order_acquire);
+        Hold hold;
+        hold.entry_ = entries_[word >> kIndexShift];
+        return hold;
+    }
+
+    // Writers take this around checking whether a replacement is still
+    // needed, building it and publish(), so two never build the same one.
+    pthread_mutex_t& write_mutex() { return write_mutex_; }
+
+    // Makes `value` (swapped out of the argument, which gets what a reused
+    // entry held) the current entry. Called with write_mutex() held. Returns
+    // false, publishing nothing, only if kMaxEntries readers are stuck on
+    // old entries.
+    bool publish(uint64_t version, Value* value) {
+        size_t current = current_.load(std::memory_order_relaxed) >> kIndexShift;
+        size_t index = used_;
+        for (size_t i = 0; i < used_; i++) {
+            if (i != current && entries_[i]->refs.load(std::memory_order_acquire) == 0) {
+                index = i;
+                break;
+            }
+        }
+        if (index == used_) {
+            if (used_ == kMaxEntries) {
+                return false;
+            }
+            entries_[used_++] = new Entry();
+        }
+        Entry* entry = entries_[index];
+        entry->refs.store(1, std::memory_order_relaxed);  // The cell's own, while it is current.
+        entry->version = version;
+        std::swap(entry->value, *value);
+
+        uint64_t old = current_.exchange(uint64_t(index) << kIndexShift, std::memory_order_acq_rel);
+        int64_t readers = int64_t(old & kReaderMask);
+        // The readers move in, the cell's reference moves out.
+        entries_[old >> kIndexShift]->refs.fetch_add(readers - 1, std::memory_order_acq_rel);
+        return true;
+    }
+
+private:
+    static const int kIndexShift = 48;
+    static const uint64_t kReaderMask = (uint64_t(1) << kIndexShift) - 1;
+
+    Entry** entries_;  // Written before their index is published, then fixed.
+    size_t used_;  // Guarded by write_mutex_.
+    std::atomic<uint64_t> current_;  // Index << kIndexShift | readers that took it.
+    pthread_mutex_t write_mutex_;
+};
+
+#endif
@@ -0,0 +1,207 @@
+#ifndef CHAT_TIMER_WHEEL_H
+#define CHAT_TIMER_WHEEL_H
+
+// Hierarchical timing wheel (the classic kernel layout: one 256-slot wheel
+// of single ticks plus four 64-slot wheels that cascade down as time
+// advances).
+//
+// Scheduling and cancelling are O(1) list operations on an intrusive node,
+// and advancing only touches the slots that come due, so the cost of a tick
+// is proportional to the timers that actually expire instead of to the
+// number of timers pending.
+//
+// Callbacks run on the thread that calls advance(), after the wheel lock is
+// released, so they may freely schedule or cancel timers (including their
+// own). A node must stay alive while it is pending; owners that can go away
+// concurrently should hold a reference for as long as schedule() reported
+// the node as newly pending.
+
+#include <chrono>
+#include <cstdint>
+#include <vector>
+#include <pthread.h>
+
+struct TimerNode {
+    TimerNode* prev;
+    TimerNode* next;
+    uint64_t expires;  // Absolute tick.
+    void (*callback)(TimerNode*);
+    void* data;  // Owner context for the callback.
+};
+
+class TimerWheel {
+public:
+    explicit TimerWheel(uint32_t tick_ms) : tick_ms_(tick_ms == 0 ? 1 : tick_ms), current_(0) {
+        pthread_mutex_init(&mutex_, NULL);
+        for (int i = 0; i < kRootSlots; i++) {
+            list_init(&root_[i]);
+        }
+        for (int level = 0; level < kLevels; level++) {
+            for (int i = 0; i < kLevelSlots; i++) {
+                list_init(&levels_[level][i]);
+            }
+        }
+        start_ = std::chrono::steady_clock::now();
+    }
+
+    ~TimerWheel() { pthread_mutex_destroy(&mutex_); }
+
+    TimerWheel(const TimerWheel&) = delete;
+    TimerWheel& operator=(const TimerWheel&) = delete;
+
+    static void init_node(TimerNode* node, void (*callback)(TimerNode*), void* data) {
+        node->prev = node->next = nullptr;
+        node->expires = 0;
+        node->callback = callback;
+        node->data = data;
+    }
+
+    uint32_t tick_ms() const { return tick_ms_; }
+
+    // (Re)arms the node to fire after delay_ms, rounded up to whole ticks.
+    // Returns true if the node was not pending before the call.
+    bool schedule(TimerNode* node, uint64_t delay_ms) {
+        uint64_t ticks = (delay_ms + tick_ms_ - 1) / tick_ms_;
+        pthread_mutex_lock(&mutex_);
+        bool was_idle = node->next == nullptr;
+        if (!was_idle) {
+            list_remove(node);
+        }
+        node->expires = current_ + (ticks == 0 ? 1 : ticks);
+        insert(node);
+        pthread_mutex_unlock(&mutex_);
+        return was_idle;
+    }
+
+    // Returns true if the node was pending (and now is not).
+    bool cancel(TimerNode* node) {
+        pthread_mutex_lock(&mutex_);
+        bool was_pending = node->next != nullptr;
+        if (was_pending) {
+            list_remove(node);
+        }
+        pthread_mutex_unlock(&mutex_);
+        return was_pending;
+    }
+
+    // Moves the wheel up to the current time and runs every timer that came
+    // due. Meant to be called roughly once per tick from one thread.
+    void advance() {
+        uint64_t elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+            std::chrono::steady_clock::now() - start_).count();
+        advance_to(elapsed / tick_ms_);
+    }
+
+    // Same as advance() but with an explicit target tick.
+    void advance_to(uint64_t target) {
+        expired_.clear();
+        pthread_mutex_lock(&mutex_);
+        while (current_ < target) {
+            current_++;
+            int index = current_ & kRootMask;
+            if (index == 0) {
+                // Pull the next batch of timers down one level at a time.
+                for (int level = 0; level < kLevels; level++) {
+                    int slot = (current_ >> (kRootBits + level * kLevelBits)) & kLevelMask;
+                    cascade(&levels_[level][slot]);
+                    if (slot != 0) {
+                        break;
+                    }
+                }
+            }
+
+            TimerNode* head = &root_[index];
+            while (head->next != head) {
+                TimerNode* node = head->next;
+                list_remove(node);
+                expired_.push_back(node);
+            }
+        }
+        pthread_mutex_unlock(&mutex_);
+
+        for (TimerNode* node : expired_) {
+            node->callback(node);
+        }
+    }
+
+private:
+    static const int kRootBits = 8;
+    static const int kLevelBits = 6;
+    static const int kLevels = 4;
+    static const int kRootSlots = 1 << kRootBits;
+    static const int kLevelSlots = 1 << kLevelBits;
+    static const uint64_t kRootMask = kRootSlots - 1;
+    static const uint64_t kLevelMask = kLevelSlots - 1;
+
+    static void list_init(TimerNode* head) {
+        head->prev = head->next = head;
+    }
+
+    static void list_remove(TimerNode* node) {
+        node->prev->next = node->next;
+        node->next->prev = node->prev;
+        node->prev = node->next = nullptr;
+    }
+
+    static void list_append(TimerNode* head, TimerNode* node) {
+        node->prev = head->prev;
+        node->next = head;
+        head->prev->next = node;
+        head->prev = node;
+    }
+
+    void insert(TimerNode* node) {
+        // A node cascaded into the current tick lands in the root slot that
+        // advance() is about to run.
+        if (node->expires < current_) {
+            node->expires = current_;
+        }
+        uint64_t delta = node->expires - current_;
+        if (delta < (uint64_t(1) << kRootBits)) {
+            list_append(&root_[node->expires & kRootMask], node);
+            return;
+        }
+        for (int level = 0; level < kLevels; level++) {
+            int shift = kRootBits + (level + 1) * kLevelBits;
+            if (level == kLevels - 1 || delta < (uint64_t(1) << shift)) {
+                if (delta >= (uint64_t(1) << shift)) {
+                    // Beyond the wheel's range: park it in the last slot reachable.
+                    node->expires = current_ + (uint64_t(1) << shift) - 1;
+                }
+                int slot = (node->expires >> (shift - kLevelBits)) & kLevelMask;
+                list_append(&levels_[level][slot], node);
+                return;
+            }
+        }
+    }
+
+    void cascade(TimerNode* head) {
+        // Detach the slot first: a node parked at the edge of the range can
+        // hash back into the slot being emptied.
+        if (head->next == head) {
+            return;
+        }
+        TimerNode pending;
+        pending.next = head->next;
+        pending.prev = head->prev;
+        pending.next->prev = &pending;
+        pending.prev->next = &pending;
+        list_init(head);
+
+        while (pending.next != &pending) {
+            TimerNode* node = pending.next;
+            list_remove(node);
+            insert(node);
+        }
+    }
+
+    uint32_t tick_ms_;
+    uint64_t current_;
+    std::chrono::steady_clock::time_point start_;
+    pthread_mutex_t mutex_;
+    TimerNode root_[kRootSlots];
+    TimerNode levels_[kLevels][kLevelSlots];
+    std::vector<TimerNode*> expired_;
+};
+
+#endif
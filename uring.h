@@ -0,0 +1,214 @@
+#ifndef CHAT_URING_H
+#define CHAT_URING_H
+
+// A minimal io_uring ring on the raw system calls (liburing is not needed):
+// the submission and completion queues, plus a ring of provided buffers
+// that receives marked IOSQE_BUFFER_SELECT pick their buffer from, so a
+// multishot receive needs no buffer of its own per connection.
+//
+// Not thread-safe: a ring belongs to the thread that runs its loop.
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+class Uring {
+public:
+    Uring()
+        : fd_(-1), sq_ring_(nullptr), sq_ring_size_(0), cq_ring_(nullptr), cq_ring_size_(0), sqes_(nullptr),
+          sqes_size_(0), sqe_tail_(0), buffer_ring_(nullptr), buffer_ring_size_(0), buffers_(nullptr), buffer_count_(0),
+          buffer_size_(0), buffer_tail_(0) {}
+
+    ~Uring() {
+        if (buffer_ring_ != nullptr) {
+            munmap(buffer_ring_, buffer_ring_size_);
+        }
+        delete[] buffers_;
+        if (sqes_ != nullptr) {
+            munmap(sqes_, sqes_size_);
+        }
+        if (cq_ring_ != nullptr && cq_ring_ != sq_ring_) {
+            munmap(cq_ring_, cq_ring_size_);
+        }
+        if (sq_ring_ != nullptr) {
+            munmap(sq_ring_, sq_ring_size_);
+        }
+        if (fd_ >= 0) {
+            close(fd_);
+        }
+    }
+
+    Uring(const Uring&) = delete;
+    Uring& operator=(const Uring&) = delete;
+
+    // Returns false, with errno set, if the kernel has no usable io_uring.
+    bool init(unsigned entries, unsigned completions) {
+        io_uring_params params;
+        memset(&params, 0, sizeof(params));
+        params.flags = IORING_SETUP_CQSIZE | IORING_SETUP_SUBMIT_ALL;
+        params.cq_entries = completions;
+        fd_ = int(syscall(__NR_io_uring_setup, entries, &params));
+        if (fd_ < 0) {
+            return false;
+        }
+        if (!(params.features & IORING_FEAT_NODROP)) {
+            errno = ENOTSUP;  // Completions could be lost on overflow.
+            return false;
+        }
+
+        sq_ring_size_ = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+        cq_ring_size_ = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+        bool single_mmap = params.features & IORING_FEAT_SINGLE_MMAP;
+        if (single_mmap) {
+            sq_ring_size_ = cq_ring_size_ = std::max(sq_ring_size_, cq_ring_size_);
+        }
+        sq_ring_ = map(sq_ring_size_, IORING_OFF_SQ_RING);
+        if (sq_ring_ == nullptr) {
+            return false;
+        }
+        cq_ring_ = single_mmap ? sq_ring_ : map(cq_ring_size_, IORING_OFF_CQ_RING);
+        sqes_size_ = params.sq_entries * sizeof(io_uring_sqe);
+        sqes_ = cq_ring_ == nullptr ? nullptr : static_cast<io_uring_sqe*>(map(sqes_size_, IORING_OFF_SQES));
+        if (sqes_ == nullptr) {
+            return false;
+        }
+
+        char* sq = static_cast<char*>(sq_ring_);
+        sq_head_ = reinterpret_cast<unsigned*>(sq + params.sq_off.head);
+        sq_tail_ = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+        sq_mask_ = *reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+        sq_entries_ = params.sq_entries;
+        // Submission slots are used in order, so the index array is fixed.
+        unsigned* array = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+        for (unsigned i = 0; i < sq_entries_; i++) {
+            array[i] = i;
+        }
+        sqe_tail_ = *sq_tail_;
+
+        char* cq = static_cast<char*>(cq_ring_);
+        cq_head_ = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+        cq_tail_ = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+        cq_mask_ = *reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+        cqes_ = reinterpret_cast<io_uring_cqe*>(cq + params.cq_off.cqes);
+        return true;
+    }
+
+    // A cleared submission entry. If the queue is full what it holds is
+    // submitted first; returns null only if the kernel takes none of it.
+    io_uring_sqe* get_sqe() {
+        if (sqe_tail_ - __atomic_load_n(sq_head_, __ATOMIC_ACQUIRE) >= sq_entries_) {
+            submit(false);
+            if (sqe_tail_ - __atomic_load_n(sq_head_, __ATOMIC_ACQUIRE) >= sq_entries_) {
+                return nullptr;
+            }
+        }
+        io_uring_sqe* sqe = &sqes_[sqe_tail_ & sq_mask_];
+        sqe_tail_++;
+        memset(sqe, 0, sizeof(*sqe));
+        return sqe;
+    }
+
+    // Submits every queued entry in one system call and, with `wait`,
+    // blocks until at least one completion is ready. Returns false on an
+    // error other than an interrupted wait.
+    bool submit(bool wait) {
+        __atomic_store_n(sq_tail_, sqe_tail_, __ATOMIC_RELEASE);
+        unsigned pending = sqe_tail_ - __atomic_load_n(sq_head_, __ATOMIC_ACQUIRE);
+        unsigned flags = wait ? IORING_ENTER_GETEVENTS : 0;
+        if (syscall(__NR_io_uring_enter, fd_, pending, wait ? 1 : 0, flags, nullptr, 0) < 0 && errno != EINTR) {
+            // EBUSY: completions overflowed the queue; the caller has to reap.
+            return errno == EBUSY || errno == EAGAIN;
+        }
+        return true;
+    }
+
+    // Calls visit(cqe) for every ready completion, oldest first, and frees
+    // their slots. Returns how many there were.
+    template <typename Visit>
+    unsigned reap(Visit visit) {
+        unsigned head = *cq_head_;
+        unsigned tail = __atomic_load_n(cq_tail_, __ATOMIC_ACQUIRE);
+        for (unsigned i = head; i != tail; i++) {
+            visit(&cqes_[i & cq_mask_]);
+        }
+        __atomic_store_n(cq_head_, tail, __ATOMIC_RELEASE);
+        return tail - head;
+    }
+
+    // Registers `count` (a power of two) buffers of `size` bytes as buffer
+    // group `group`.
+    bool setup_buffers(uint16_t group, unsigned count, unsigned size) {
+        buffer_ring_size_ = count * sizeof(io_uring_buf);
+        void* memory = mmap(nullptr, buffer_ring_size_, PROT_READ | PROT_WRITE, MAP_ANONYMOUS | MAP_PRIVATE, -1, 0);
+        if (memory == MAP_FAILED) {
+            return false;
+        }
+        buffer_ring_ = static_cast<io_uring_buf_ring*>(memory);
+        io_uring_buf_reg reg;
+        memset(&reg, 0, sizeof(reg));
+        reg.ring_addr = reinterpret_cast<uint64_t>(buffer_ring_);
+        reg.ring_entries = count;
+        reg.bgid = group;
+        if (syscall(__NR_io_uring_register, fd_, IORING_REGISTER_PBUF_RING, &reg, 1) < 0) {
+            return false;
+        }
+        buffers_ = new char[size_t(count) * size];
+        buffer_count_ = count;
+        buffer_size_ = size;
+        for (unsigned id = 0; id < count; id++) {
+            recycle(uint16_t(id));
+        }
+        return true;
+    }
+
+    const char* buffer(uint16_t id) const { return buffers_ + size_t(id) * buffer_size_; }
+
+    // Hands a buffer a completion used back to the kernel.
+    void recycle(uint16_t id) {
+        // Not buffer_ring_->bufs: compiled as C++, the header's flexible
+        // array starts 8 bytes late (its empty placeholder struct has size 1).
+        io_uring_buf& entry = reinterpret_cast<io_uring_buf*>(buffer_ring_)[buffer_tail_ & (buffer_count_ - 1)];
+        entry.addr = reinterpret_cast<uint64_t>(buffer(id));
+        entry.len = buffer_size_;
+        entry.bid = id;
+        buffer_tail_++;
+        __atomic_store_n(&buffer_ring_->tail, buffer_tail_, __ATOMIC_RELEASE);
+    }
+
+private:
+    void* map(size_t size, off_t offset) {
+        void* memory = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, fd_, offset);
+        return memory == MAP_FAILED ? nullptr : memory;
+    }
+
+    int fd_;
+    void* sq_ring_;
+    size_t sq_ring_size_;
+    void* cq_ring_;
+    size_t cq_ring_size_;
+    io_uring_sqe* sqes_;
+    size_t sqes_size_;
+    unsigned* sq_head_;
+    unsigned* sq_tail_;
+    unsigned sq_mask_;
+    unsigned sq_entries_;
+    unsigned sqe_tail_;  // Entries handed out, submitted or not.
+    unsigned* cq_head_;
+    unsigned* cq_tail_;
+    unsigned cq_mask_;
+    io_uring_cqe* cqes_;
+
+    io_uring_buf_ring* buffer_ring_;
+    size_t buffer_ring_size_;
+    char* buffers_;
+    unsigned buffer_count_;
+    unsigned buffer_size_;
+    uint16_t buffer_tail_;
+};
+
+#endif
@@ -0,0 +1,197 @@
+#ifndef CHAT_WORKER_POOL_H
+#define CHAT_WORKER_POOL_H
+
+// Fixed-size pool of worker queues with work stealing.
+//
+// Every worker has its own deque. Jobs are spread over the deques round
+// robin; a worker takes jobs from the front of its own deque and, once that
+// is empty, steals the newer half of the fullest-looking other one from its
+// back, so one worker stuck on a long job does not hold up whatever was
+// queued behind it. Workers with nothing to do sleep on one condition
+// variable; submit() only touches it when someone is asleep.
+//
+// The pool does not own threads: each worker thread is the caller's and
+// loops on take(), so it can do other things between jobs (interrupt()
+// makes idle workers return from take() for that).
+
+#include <atomic>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <vector>
+#include <pthread.h>
+
+struct WorkerJob {
+    void (*run)(void* arg);
+    void* arg;
+};
+
+class WorkerPool {
+public:
+    explicit WorkerPool(size_t workers)
+        : queues_(new Queue[workers]), workers_(workers), next_(0), pending_(0), sleeping_(0), interrupted_(false) {
+        pthread_mutex_init(&idle_mutex_, NULL);
+        pthread_cond_init(&work_ready_, NULL);
+    }
+
+    WorkerPool(const WorkerPool&) = delete;
+    WorkerPool& operator=(const WorkerPool&) = delete;
+
+    size_t size() const { return workers_; }
+
+    void submit(WorkerJob job) {
+        Queue& queue = queues_[next_.fetch_add(1, std::memory_order_relaxed) % workers_];
+        pthread_mutex_lock(&queue.mutex);
+        queue.jobs.push_back(job);
+        queue.size.store(queue.jobs.size(), std::memory_order_relaxed);
+        pthread_mutex_unlock(&queue.mutex);
+        // Pairs with take(): either the sleeper sees the job pending or we
+        // see the sleeper.
+        pending_.fetch_add(1, std::memory_order_seq_cst);
+        if (sleeping_.load(std::memory_order_seq_cst) > 0) {
+            pthread_mutex_lock(&idle_mutex_);
+            pthread_cond_signal(&work_ready_);
+            pthread_mutex_unlock(&idle_mutex_);
+        }
+    }
+
+    // The next job for worker `index` (own deque first, then stolen),
+    // waiting for one if there is none. Returns false without a job only
+    // while interrupted. `stolen` tells whether the job came from another
+    // worker's deque.
+    bool take(size_t index, WorkerJob* job, bool* stolen) {
+        while (true) {
+            if (pop(index, job)) {
+                *stolen = false;
+                return true;
+            }
+            if (steal(index, job)) {
+                *stolen = true;
+                return true;
+            }
+            pthread_mutex_lock(&idle_mutex_);
+            sleeping_.fetch_add(1, std::memory_order_seq_cst);
+            bool interrupted = interrupted_;
+            if (!interrupted && pending_.load(std::memory_order_seq_cst) == 0) {
+                pthread_cond_wait(&work_ready_, &idle_mutex_);
+                interrupted = interrupted_;
+            }
+            sleeping_.fetch_sub(1, std::memory_order_relaxed);
+            pthread_mutex_unlock(&idle_mutex_);
+            if (interrupted && pending_.load(std::memory_order_seq_cst) == 0) {
+                return false;
+            }
+        }
+    }
+
+    // Until resume(), workers that run out of jobs return from take()
+    // instead of waiting.
+    void interrupt() {
+        pthread_mutex_lock(&idle_mutex_);
+        interrupted_ = true;
+        pthread_cond_broadcast(&work_ready_);
+        pthread_mutex_unlock(&idle_mutex_);
+    }
+
+    void resume() {
+        pthread_mutex_lock(&idle_mutex_);
+        interrupted_ = false;
+        pthread_mutex_unlock(&idle_mutex_);
+    }
+
+    // Any queued job, for a thread outside the pool; false once all are
+    // taken.
+    bool take_any(WorkerJob* job) {
+        for (size_t i = 0; i < workers_; i++) {
+            if (pop(i, job)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+private:
+    struct alignas(64) Queue {
+        Queue() : size(0) { pthread_mutex_init(&mutex, NULL); }
+
+        pthread_mutex_t mutex;
+        std::deque<WorkerJob> jobs;
+        std::atomic<size_t> size;  // Of jobs, for thieves to look at without locking.
+    };
+
+    bool pop(size_t index, WorkerJob* job) {
+        Queue& queue = queues_[index];
+        if (queue.size.load(std::memory_order_relaxed) == 0) {
+            return false;
+        }
+        pthread_mutex_lock(&queue.mutex);
+        bool found = !queue.jobs.empty();
+        if (found) {
+            *job = queue.jobs.front();
+            queue.jobs.pop_front();
+            queue.size.store(queue.jobs.size(), std::memory_order_relaxed);
+        }
+        pthread_mutex_unlock(&queue.mutex);
+        if (found) {
+            pending_.fetch_sub(1, std::memory_order_relaxed);
+        }
+        return found;
+    }
+
+    // Moves half of the largest other deque (at least one job) to this
+    // worker: the first is returned, the rest queued on its own deque.
+    bool steal(size_t index, WorkerJob* job) {
+        size_t victim = workers_;
+        size_t largest = 0;
+        for (size_t i = 1; i < workers_; i++) {
+            size_t candidate = (index + i) % workers_;
+            size_t size = queues_[candidate].size.load(std::memory_order_relaxed);
+            if (size > largest) {
+                largest = size;
+                victim = candidate;
+            }
+        }
+        if (victim == workers_) {
+            return false;
+        }
+
+        static thread_local std::vector<WorkerJob> loot;
+        Queue& from = queues_[victim];
+        pthread_mutex_lock(&from.mutex);
+        size_t count = (from.jobs.size() + 1) / 2;
+        for (size_t i = 0; i < count; i++) {
+            loot.push_back(from.jobs.back());
+            from.jobs.pop_back();
+        }
+        from.size.store(from.jobs.size(), std::memory_order_relaxed);
+        pthread_mutex_unlock(&from.mutex);
+        if (loot.empty()) {
+            return false;
+        }
+
+        // Taken from the back, so the oldest stolen job is the last one.
+        *job = loot.back();
+        loot.pop_back();
+        if (!loot.empty()) {
+            Queue& own = queues_[index];
+            pthread_mutex_lock(&own.mutex);
+            own.jobs.insert(own.jobs.end(), loot.rbegin(), loot.rend());
+            own.size.store(own.jobs.size(), std::memory_order_relaxed);
+            pthread_mutex_unlock(&own.mutex);
+            loot.clear();
+        }
+        pending_.fetch_sub(1, std::memory_order_relaxed);
+        return true;
+    }
+
+    std::unique_ptr<Queue[]> queues_;
+    size_t workers_;
+    std::atomic<size_t> next_;  // Round-robin cursor for submit().
+    std::atomic<size_t> pending_;  // Jobs queued on any deque.
+    pthread_mutex_t idle_mutex_;
+    pthread_cond_t work_ready_;
+    std::atomic<int> sleeping_;
+    bool interrupted_;  // Guarded by idle_mutex_.
+};
+
+#endif